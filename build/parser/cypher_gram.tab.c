@@ -0,0 +1,6236 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Skeleton implementation for Bison GLR parsers in C
+
+   Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C GLR parser skeleton written by Paul Hilfinger.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "glr.c"
+
+/* Pure parsers.  */
+#define YYPURE 1
+
+
+
+/* Substitute the type names.  */
+#define YYSTYPE CYPHER_YYSTYPE
+#define YYLTYPE CYPHER_YYLTYPE
+/* Substitute the variable and function names.  */
+#define yyparse cypher_yyparse
+#define yylex   cypher_yylex
+#define yyerror cypher_yyerror
+#define yydebug cypher_yydebug
+
+/* First part of user prologue.  */
+#line 1 "src/backend/parser/cypher_gram.y"
+
+/*
+ * Cypher Grammar for GraphQLite
+ * Simplified version based on Apache AGE grammar for SQLite compatibility
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parser/cypher_ast.h"
+#include "parser/cypher_parser.h"
+
+/* Forward declarations */
+void cypher_yyerror(CYPHER_YYLTYPE *yylloc, cypher_parser_context *context, const char *msg);
+int cypher_yylex(CYPHER_YYSTYPE *yylval, CYPHER_YYLTYPE *yylloc, cypher_parser_context *context);
+
+
+#line 83 "build/parser/cypher_gram.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "cypher_gram.tab.h"
+
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_INTEGER = 3,                    /* INTEGER  */
+  YYSYMBOL_DECIMAL = 4,                    /* DECIMAL  */
+  YYSYMBOL_STRING = 5,                     /* STRING  */
+  YYSYMBOL_IDENTIFIER = 6,                 /* IDENTIFIER  */
+  YYSYMBOL_PARAMETER = 7,                  /* PARAMETER  */
+  YYSYMBOL_BQIDENT = 8,                    /* BQIDENT  */
+  YYSYMBOL_NOT_EQ = 9,                     /* NOT_EQ  */
+  YYSYMBOL_LT_EQ = 10,                     /* LT_EQ  */
+  YYSYMBOL_GT_EQ = 11,                     /* GT_EQ  */
+  YYSYMBOL_DOT_DOT = 12,                   /* DOT_DOT  */
+  YYSYMBOL_TYPECAST = 13,                  /* TYPECAST  */
+  YYSYMBOL_PLUS_EQ = 14,                   /* PLUS_EQ  */
+  YYSYMBOL_REGEX_MATCH = 15,               /* REGEX_MATCH  */
+  YYSYMBOL_MATCH = 16,                     /* MATCH  */
+  YYSYMBOL_RETURN = 17,                    /* RETURN  */
+  YYSYMBOL_CREATE = 18,                    /* CREATE  */
+  YYSYMBOL_WHERE = 19,                     /* WHERE  */
+  YYSYMBOL_WITH = 20,                      /* WITH  */
+  YYSYMBOL_SET = 21,                       /* SET  */
+  YYSYMBOL_DELETE = 22,                    /* DELETE  */
+  YYSYMBOL_REMOVE = 23,                    /* REMOVE  */
+  YYSYMBOL_MERGE = 24,                     /* MERGE  */
+  YYSYMBOL_UNWIND = 25,                    /* UNWIND  */
+  YYSYMBOL_DETACH = 26,                    /* DETACH  */
+  YYSYMBOL_FOREACH = 27,                   /* FOREACH  */
+  YYSYMBOL_OPTIONAL = 28,                  /* OPTIONAL  */
+  YYSYMBOL_DISTINCT = 29,                  /* DISTINCT  */
+  YYSYMBOL_ORDER = 30,                     /* ORDER  */
+  YYSYMBOL_BY = 31,                        /* BY  */
+  YYSYMBOL_SKIP = 32,                      /* SKIP  */
+  YYSYMBOL_LIMIT = 33,                     /* LIMIT  */
+  YYSYMBOL_AS = 34,                        /* AS  */
+  YYSYMBOL_ASC = 35,                       /* ASC  */
+  YYSYMBOL_DESC = 36,                      /* DESC  */
+  YYSYMBOL_AND = 37,                       /* AND  */
+  YYSYMBOL_OR = 38,                        /* OR  */
+  YYSYMBOL_XOR = 39,                       /* XOR  */
+  YYSYMBOL_NOT = 40,                       /* NOT  */
+  YYSYMBOL_IN = 41,                        /* IN  */
+  YYSYMBOL_IS = 42,                        /* IS  */
+  YYSYMBOL_NULL_P = 43,                    /* NULL_P  */
+  YYSYMBOL_TRUE_P = 44,                    /* TRUE_P  */
+  YYSYMBOL_FALSE_P = 45,                   /* FALSE_P  */
+  YYSYMBOL_EXISTS = 46,                    /* EXISTS  */
+  YYSYMBOL_ANY = 47,                       /* ANY  */
+  YYSYMBOL_NONE = 48,                      /* NONE  */
+  YYSYMBOL_SINGLE = 49,                    /* SINGLE  */
+  YYSYMBOL_REDUCE = 50,                    /* REDUCE  */
+  YYSYMBOL_UNION = 51,                     /* UNION  */
+  YYSYMBOL_ALL = 52,                       /* ALL  */
+  YYSYMBOL_CASE = 53,                      /* CASE  */
+  YYSYMBOL_WHEN = 54,                      /* WHEN  */
+  YYSYMBOL_THEN = 55,                      /* THEN  */
+  YYSYMBOL_ELSE = 56,                      /* ELSE  */
+  YYSYMBOL_END_P = 57,                     /* END_P  */
+  YYSYMBOL_ON = 58,                        /* ON  */
+  YYSYMBOL_SHORTESTPATH = 59,              /* SHORTESTPATH  */
+  YYSYMBOL_ALLSHORTESTPATHS = 60,          /* ALLSHORTESTPATHS  */
+  YYSYMBOL_PATTERN = 61,                   /* PATTERN  */
+  YYSYMBOL_EXPLAIN = 62,                   /* EXPLAIN  */
+  YYSYMBOL_LOAD = 63,                      /* LOAD  */
+  YYSYMBOL_CSV = 64,                       /* CSV  */
+  YYSYMBOL_FROM = 65,                      /* FROM  */
+  YYSYMBOL_HEADERS = 66,                   /* HEADERS  */
+  YYSYMBOL_FIELDTERMINATOR = 67,           /* FIELDTERMINATOR  */
+  YYSYMBOL_STARTS = 68,                    /* STARTS  */
+  YYSYMBOL_ENDS = 69,                      /* ENDS  */
+  YYSYMBOL_CONTAINS = 70,                  /* CONTAINS  */
+  YYSYMBOL_71_ = 71,                       /* '='  */
+  YYSYMBOL_72_ = 72,                       /* '<'  */
+  YYSYMBOL_73_ = 73,                       /* '>'  */
+  YYSYMBOL_74_ = 74,                       /* '+'  */
+  YYSYMBOL_75_ = 75,                       /* '-'  */
+  YYSYMBOL_76_ = 76,                       /* '*'  */
+  YYSYMBOL_77_ = 77,                       /* '/'  */
+  YYSYMBOL_78_ = 78,                       /* '%'  */
+  YYSYMBOL_79_ = 79,                       /* '^'  */
+  YYSYMBOL_80_ = 80,                       /* '.'  */
+  YYSYMBOL_81_ = 81,                       /* '['  */
+  YYSYMBOL_UNARY_MINUS = 82,               /* UNARY_MINUS  */
+  YYSYMBOL_UNARY_PLUS = 83,                /* UNARY_PLUS  */
+  YYSYMBOL_84_ = 84,                       /* ';'  */
+  YYSYMBOL_85_ = 85,                       /* '('  */
+  YYSYMBOL_86_ = 86,                       /* '|'  */
+  YYSYMBOL_87_ = 87,                       /* ')'  */
+  YYSYMBOL_88_ = 88,                       /* ','  */
+  YYSYMBOL_89_ = 89,                       /* ':'  */
+  YYSYMBOL_90_ = 90,                       /* ']'  */
+  YYSYMBOL_91_ = 91,                       /* '{'  */
+  YYSYMBOL_92_ = 92,                       /* '}'  */
+  YYSYMBOL_YYACCEPT = 93,                  /* $accept  */
+  YYSYMBOL_stmt = 94,                      /* stmt  */
+  YYSYMBOL_union_query = 95,               /* union_query  */
+  YYSYMBOL_single_query = 96,              /* single_query  */
+  YYSYMBOL_clause_list = 97,               /* clause_list  */
+  YYSYMBOL_clause = 98,                    /* clause  */
+  YYSYMBOL_match_clause = 99,              /* match_clause  */
+  YYSYMBOL_from_graph_opt = 100,           /* from_graph_opt  */
+  YYSYMBOL_optional_opt = 101,             /* optional_opt  */
+  YYSYMBOL_return_clause = 102,            /* return_clause  */
+  YYSYMBOL_with_clause = 103,              /* with_clause  */
+  YYSYMBOL_unwind_clause = 104,            /* unwind_clause  */
+  YYSYMBOL_foreach_clause = 105,           /* foreach_clause  */
+  YYSYMBOL_load_csv_clause = 106,          /* load_csv_clause  */
+  YYSYMBOL_foreach_update_list = 107,      /* foreach_update_list  */
+  YYSYMBOL_distinct_opt = 108,             /* distinct_opt  */
+  YYSYMBOL_order_by_opt = 109,             /* order_by_opt  */
+  YYSYMBOL_skip_opt = 110,                 /* skip_opt  */
+  YYSYMBOL_limit_opt = 111,                /* limit_opt  */
+  YYSYMBOL_where_opt = 112,                /* where_opt  */
+  YYSYMBOL_order_by_list = 113,            /* order_by_list  */
+  YYSYMBOL_order_by_item = 114,            /* order_by_item  */
+  YYSYMBOL_return_item_list = 115,         /* return_item_list  */
+  YYSYMBOL_return_item = 116,              /* return_item  */
+  YYSYMBOL_set_item_list = 117,            /* set_item_list  */
+  YYSYMBOL_set_item = 118,                 /* set_item  */
+  YYSYMBOL_create_clause = 119,            /* create_clause  */
+  YYSYMBOL_merge_clause = 120,             /* merge_clause  */
+  YYSYMBOL_on_create_clause = 121,         /* on_create_clause  */
+  YYSYMBOL_on_match_clause = 122,          /* on_match_clause  */
+  YYSYMBOL_set_clause = 123,               /* set_clause  */
+  YYSYMBOL_delete_clause = 124,            /* delete_clause  */
+  YYSYMBOL_delete_item_list = 125,         /* delete_item_list  */
+  YYSYMBOL_delete_item = 126,              /* delete_item  */
+  YYSYMBOL_remove_clause = 127,            /* remove_clause  */
+  YYSYMBOL_remove_item_list = 128,         /* remove_item_list  */
+  YYSYMBOL_remove_item = 129,              /* remove_item  */
+  YYSYMBOL_detach_opt = 130,               /* detach_opt  */
+  YYSYMBOL_pattern_list = 131,             /* pattern_list  */
+  YYSYMBOL_simple_path = 132,              /* simple_path  */
+  YYSYMBOL_path = 133,                     /* path  */
+  YYSYMBOL_node_pattern = 134,             /* node_pattern  */
+  YYSYMBOL_rel_pattern = 135,              /* rel_pattern  */
+  YYSYMBOL_variable_opt = 136,             /* variable_opt  */
+  YYSYMBOL_varlen_range_opt = 137,         /* varlen_range_opt  */
+  YYSYMBOL_label_opt = 138,                /* label_opt  */
+  YYSYMBOL_label_list = 139,               /* label_list  */
+  YYSYMBOL_rel_type_list = 140,            /* rel_type_list  */
+  YYSYMBOL_expr = 141,                     /* expr  */
+  YYSYMBOL_primary_expr = 142,             /* primary_expr  */
+  YYSYMBOL_literal_expr = 143,             /* literal_expr  */
+  YYSYMBOL_function_call = 144,            /* function_call  */
+  YYSYMBOL_list_predicate = 145,           /* list_predicate  */
+  YYSYMBOL_reduce_expr = 146,              /* reduce_expr  */
+  YYSYMBOL_argument_list = 147,            /* argument_list  */
+  YYSYMBOL_list_literal = 148,             /* list_literal  */
+  YYSYMBOL_list_comprehension = 149,       /* list_comprehension  */
+  YYSYMBOL_pattern_comprehension = 150,    /* pattern_comprehension  */
+  YYSYMBOL_map_literal = 151,              /* map_literal  */
+  YYSYMBOL_map_projection = 152,           /* map_projection  */
+  YYSYMBOL_map_projection_list = 153,      /* map_projection_list  */
+  YYSYMBOL_map_projection_item = 154,      /* map_projection_item  */
+  YYSYMBOL_case_expression = 155,          /* case_expression  */
+  YYSYMBOL_when_clause_list = 156,         /* when_clause_list  */
+  YYSYMBOL_when_clause = 157,              /* when_clause  */
+  YYSYMBOL_literal = 158,                  /* literal  */
+  YYSYMBOL_identifier = 159,               /* identifier  */
+  YYSYMBOL_parameter = 160,                /* parameter  */
+  YYSYMBOL_properties_opt = 161,           /* properties_opt  */
+  YYSYMBOL_map_pair_list = 162,            /* map_pair_list  */
+  YYSYMBOL_map_pair = 163                  /* map_pair  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+/* Default (constant) value used for initialization for null
+   right-hand sides.  Unlike the standard yacc.c template, here we set
+   the default value of $$ to a zeroed-out value.  Since the default
+   value is undefined, this behavior is technically correct.  */
+static YYSTYPE yyval_default;
+static YYLTYPE yyloc_default
+# if defined CYPHER_YYLTYPE_IS_TRIVIAL && CYPHER_YYLTYPE_IS_TRIVIAL
+  = { 1, 1, 1, 1 }
+# endif
+;
+
+
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YYFREE
+# define YYFREE free
+#endif
+#ifndef YYMALLOC
+# define YYMALLOC malloc
+#endif
+#ifndef YYREALLOC
+# define YYREALLOC realloc
+#endif
+
+#ifdef __cplusplus
+  typedef bool yybool;
+# define yytrue true
+# define yyfalse false
+#else
+  /* When we move to stdbool, get rid of the various casts to yybool.  */
+  typedef signed char yybool;
+# define yytrue 1
+# define yyfalse 0
+#endif
+
+#ifndef YYSETJMP
+# include <setjmp.h>
+# define YYJMP_BUF jmp_buf
+# define YYSETJMP(Env) setjmp (Env)
+/* Pacify Clang and ICC.  */
+# define YYLONGJMP(Env, Val)                    \
+ do {                                           \
+   longjmp (Env, Val);                          \
+   YY_ASSERT (0);                               \
+ } while (yyfalse)
+#endif
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* The _Noreturn keyword of C11.  */
+#ifndef _Noreturn
+# if (defined __cplusplus \
+      && ((201103 <= __cplusplus && !(__GNUC__ == 4 && __GNUC_MINOR__ == 7)) \
+          || (defined _MSC_VER && 1900 <= _MSC_VER)))
+#  define _Noreturn [[noreturn]]
+# elif ((!defined __cplusplus || defined __clang__) \
+        && (201112 <= (defined __STDC_VERSION__ ? __STDC_VERSION__ : 0) \
+            || (!defined __STRICT_ANSI__ \
+                && (4 < __GNUC__ + (7 <= __GNUC_MINOR__) \
+                    || (defined __apple_build_version__ \
+                        ? 6000000 <= __apple_build_version__ \
+                        : 3 < __clang_major__ + (5 <= __clang_minor__))))))
+   /* _Noreturn works as-is.  */
+# elif (2 < __GNUC__ + (8 <= __GNUC_MINOR__) || defined __clang__ \
+        || 0x5110 <= __SUNPRO_C)
+#  define _Noreturn __attribute__ ((__noreturn__))
+# elif 1200 <= (defined _MSC_VER ? _MSC_VER : 0)
+#  define _Noreturn __declspec (noreturn)
+# else
+#  define _Noreturn
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  95
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   2293
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  93
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  71
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  249
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  537
+/* YYMAXRHS -- Maximum number of symbols on right-hand side of rule.  */
+#define YYMAXRHS 13
+/* YYMAXLEFT -- Maximum number of symbols to the left of a handle
+   accessed by $0, $-1, etc., in any rule.  */
+#define YYMAXLEFT 0
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   327
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,    78,     2,     2,
+      85,    87,    76,    74,    88,    75,    80,    77,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    89,    84,
+      72,    71,    73,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,    81,     2,    90,    79,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    91,    86,    92,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    82,    83
+};
+
+#if CYPHER_YYDEBUG
+/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   160,   160,   165,   170,   179,   190,   194,   198,   205,
+     212,   217,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,   235,   240,   247,   248,   255,   256,   261,   269,
+     277,   286,   295,   301,   307,   314,   325,   330,   335,   340,
+     345,   350,   355,   360,   365,   370,   375,   380,   388,   389,
+     393,   394,   398,   399,   403,   404,   408,   409,   413,   418,
+     426,   427,   428,   433,   438,   446,   450,   458,   463,   471,
+     475,   488,   496,   500,   504,   508,   512,   519,   526,   534,
+     542,   549,   554,   562,   571,   578,   583,   591,   600,   609,
+     618,   627,   639,   644,   651,   656,   665,   671,   690,   694,
+     700,   707,   712,   719,   727,   742,   746,   751,   756,   763,
+     767,   772,   777,   784,   788,   793,   798,   807,   808,   809,
+     810,   816,   817,   819,   821,   823,   825,   830,   831,   836,
+     843,   850,   857,   867,   877,   888,   898,   909,   919,   930,
+     940,   951,   958,   965,   972,   983,   984,   985,  1004,  1005,
+    1006,  1007,  1008,  1009,  1010,  1011,  1012,  1013,  1014,  1015,
+    1016,  1017,  1018,  1019,  1020,  1021,  1022,  1023,  1024,  1025,
+    1026,  1027,  1032,  1037,  1044,  1045,  1046,  1047,  1048,  1049,
+    1050,  1051,  1052,  1053,  1054,  1055,  1056,  1066,  1070,  1085,
+    1111,  1118,  1126,  1131,  1141,  1145,  1150,  1159,  1164,  1169,
+    1174,  1183,  1194,  1199,  1208,  1212,  1229,  1234,  1239,  1244,
+    1261,  1274,  1291,  1295,  1303,  1312,  1317,  1325,  1331,  1336,
+    1343,  1357,  1361,  1366,  1370,  1377,  1382,  1390,  1397,  1401,
+    1405,  1410,  1414,  1418,  1425,  1430,  1435,  1443,  1452,  1453,
+    1454,  1461,  1466,  1474,  1478,  1482,  1486,  1490,  1494,  1498
+};
+#endif
+
+#define YYPACT_NINF (-371)
+#define YYTABLE_NINF (-154)
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+     475,    23,    30,    23,   593,   301,    30,   648,  -371,   -19,
+    -371,  1139,    19,   171,   -31,  -371,   381,  -371,  -371,   168,
+    -371,  -371,  -371,  -371,  -371,  -371,  -371,  -371,  -371,  -371,
+     207,  -371,   648,   140,   149,   167,    20,   183,    58,  -371,
+    -371,   648,  -371,  -371,  -371,   136,  -371,  -371,   648,  -371,
+    -371,  -371,   249,   267,   272,   278,   284,   285,   386,  -371,
+     290,   300,   310,   648,   648,   483,   648,     7,   239,  -371,
+    2036,  -371,  -371,  -371,  -371,  -371,  -371,  -371,  -371,  -371,
+    -371,  -371,  -371,  -371,  -371,   -41,   331,   312,  -371,   -34,
+     270,  1583,   411,   -24,    29,  -371,  1092,  -371,  -371,    30,
+     418,    -8,  -371,  1628,   134,   352,   352,  -371,  -371,  -371,
+     353,    30,   366,   364,   352,    -8,   297,   440,    11,  2212,
+      82,   443,   444,   452,   463,   477,   648,  1673,   320,  -371,
+     648,   648,   648,  -371,  -371,    81,   703,  -371,   199,  1065,
+     405,   415,   416,   419,   420,   421,   422,  -371,   -57,  -371,
+     593,   648,   648,   648,   648,   648,   648,   648,   648,   340,
+     492,   493,   648,   648,   648,   648,   648,   648,   648,   648,
+     648,   373,   648,   451,   508,   456,   301,   447,   458,   459,
+     512,   513,   648,   479,  -371,   455,   517,  1139,  -371,    55,
+    -371,   436,  -371,   503,   648,   507,   541,   465,   469,    58,
+     241,   242,   460,   457,   466,  -371,   478,    20,  -371,   507,
+     648,   462,  -371,  2081,    89,    47,   471,    17,    25,  -371,
+     152,   103,   515,   520,   521,   494,   522,  1719,   356,   648,
+    -371,  -371,   109,   211,   251,   648,   203,   219,   273,   353,
+    -371,  -371,   648,   648,   648,   648,   648,   648,   648,   417,
+    -371,  -371,   132,   132,   132,   132,  2212,  2171,   189,    15,
+     523,  -371,   648,   648,   132,  2126,   132,   132,   255,   255,
+     137,   137,   137,  -371,  -371,   205,  -371,  -371,  -371,  -371,
+    -371,  -371,   546,   548,   554,  -371,   553,  -371,  -371,  -371,
+     132,   648,   510,   542,  -371,   566,   558,   418,   648,  -371,
+     648,   547,  -371,   352,   352,  -371,  -371,  -371,  -371,    76,
+     502,   464,    20,   -44,   547,  1112,  -371,  -371,   648,   538,
+    -371,  -371,    11,  -371,   573,  -371,   648,   648,   648,   648,
+     648,   648,   648,  -371,  1766,  -371,  -371,  -371,   748,   457,
+    2081,  2081,  2081,  2081,  2081,  2081,  2081,  -371,  -371,   132,
+     132,  -371,   593,   593,  1394,   587,   588,  -371,   648,  -371,
+    -371,   505,  -371,  1538,  2081,   648,  -371,   243,   281,  -371,
+     180,  -371,  -371,  -371,   -43,   221,   467,   457,   558,  -371,
+    2081,   596,  2081,  -371,   516,  1811,  1856,  1901,  1020,  1946,
+    2081,  1991,  -371,   648,   648,  -371,   518,   239,   239,   227,
+     570,   543,  2081,   648,  -371,  -371,  2081,  -371,  -371,  -371,
+     468,   457,   597,   608,   -36,   106,   119,   524,  -371,  -371,
+    -371,   648,   648,   648,   609,   648,  -371,   794,   840,    58,
+    -371,   162,  -371,  -371,  -371,  -371,  -371,   610,   612,  -371,
+     -36,   106,   119,   530,   618,  -371,     3,   457,     8,   457,
+      13,   457,   549,  1159,  1206,  1253,   581,  1300,   648,  -371,
+    -371,   352,  -371,  -371,  -371,  -371,  -371,  -371,  -371,   559,
+    -371,   457,   457,   457,   550,  -371,  -371,  -371,   472,   537,
+    -371,  -371,   473,   540,  -371,  -371,   476,   544,   555,  -371,
+    -371,  -371,   648,  -371,   885,    -1,   626,   545,   557,   567,
+    -371,  -371,  -371,   569,  -371,  -371,   574,  -371,  -371,   583,
+    -371,  1440,  -371,   648,   648,  -371,   584,   585,   589,   575,
+     592,   598,   648,  1486,   930,  -371,  -371,  -371,  -371,  -371,
+    -371,  1347,   648,  -371,  -371,   975,  -371
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_uint8 yydefact[] =
+{
+      26,    48,     0,    48,     0,     0,     0,     0,    92,     0,
+      27,    26,     0,     0,     2,     6,     9,    10,    12,     0,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+       0,    49,     0,     0,     0,     0,   117,    71,    98,    94,
+      96,     0,   228,   229,   230,   234,   237,   235,     0,   233,
+     231,   232,     0,     0,     0,     0,     0,     0,     0,   236,
+       0,     0,     0,     0,     0,     0,     0,     0,    79,    67,
+       0,   145,   174,   177,   178,   179,   180,   181,   182,   183,
+     184,   185,   187,   175,   176,     0,     0,    84,    85,    72,
+     234,     0,     0,     4,     0,     1,    26,     3,    11,     0,
+       0,    50,    63,    65,     0,     0,     0,   118,   119,   120,
+     127,     0,     0,     0,     0,    50,     0,     0,     0,   167,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   225,
+       0,     0,     0,   146,   147,   234,   117,   204,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   212,     0,   241,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    73,    74,
+       0,     0,     0,     0,     5,     0,     0,    26,     7,    24,
+      83,    80,    81,     0,     0,    52,     0,     0,     0,    99,
+       0,     0,     0,   238,   128,    95,     0,   117,    97,    52,
+       0,     0,   188,   202,     0,   186,     0,     0,     0,   215,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     221,   226,     0,     0,     0,     0,   234,   235,   236,   127,
+     205,   170,     0,     0,     0,     0,     0,     0,     0,     0,
+     213,    68,   154,   157,   158,   159,   160,   161,   162,   163,
+       0,   168,     0,     0,   166,    69,   155,   156,   148,   149,
+     150,   151,   152,   171,   172,     0,    87,    88,    91,    89,
+      90,    86,     0,     0,     0,    75,     0,    76,   186,    30,
+     153,     0,     0,     0,     8,     0,    56,     0,     0,    64,
+       0,    54,    66,     0,     0,   101,   103,   129,   130,     0,
+       0,     0,   117,   121,    54,     0,   191,   189,     0,     0,
+     217,   218,     0,   214,     0,   192,     0,     0,     0,     0,
+       0,     0,     0,   223,     0,   195,   196,   194,     0,   238,
+     245,   243,   244,   248,   249,   246,   247,   242,   169,   164,
+     165,   173,     0,     0,     0,     0,     0,    25,     0,    23,
+      82,    51,    58,    60,    53,     0,    28,     0,     0,   239,
+       0,   104,   131,   132,   121,   122,     0,   238,    56,   190,
+     203,     0,   220,   216,     0,     0,     0,     0,     0,     0,
+     227,     0,   222,     0,     0,   206,     0,    78,    77,    93,
+       0,    32,    57,     0,    61,    62,    55,   100,   102,   240,
+       0,   238,   123,     0,   121,   121,   121,     0,    29,   219,
+     193,     0,     0,     0,     0,     0,   224,     0,     0,     0,
+      41,    93,    36,    39,    37,    38,    40,     0,     0,    59,
+     121,   121,   121,     0,   125,   126,     0,   238,     0,   238,
+       0,   238,     0,     0,     0,     0,     0,     0,     0,   207,
+     208,     0,    31,    47,    42,    45,    43,    44,    46,    33,
+      34,   238,   238,   238,     0,   124,   133,   135,     0,     0,
+     137,   139,     0,     0,   141,   142,     0,     0,   113,   198,
+     199,   200,     0,   197,     0,     0,     0,     0,     0,     0,
+     109,   134,   136,     0,   138,   140,     0,   143,   144,     0,
+     105,     0,   209,     0,     0,    35,     0,     0,     0,   114,
+     115,   116,     0,     0,     0,   110,   111,   112,   106,   107,
+     108,     0,     0,   210,   201,     0,   211
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -371,  -371,   621,   -86,  -371,   650,  -371,  -371,  -371,  -371,
+    -371,  -371,  -370,  -371,  -371,   666,   560,   461,   358,   295,
+    -371,   274,    38,   482,    75,   529,  -369,  -344,   501,   504,
+    -295,  -267,  -371,   384,  -262,  -371,   509,  -371,     1,  -102,
+     572,  -113,   257,  -131,  -288,   448,  -371,   279,    -7,  -371,
+    -371,  -371,  -371,  -371,   289,  -371,  -371,  -371,  -371,  -371,
+    -371,   368,  -371,   576,  -120,  -371,  -371,  -371,  -333,   390,
+     453
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,    13,    14,    15,    16,    17,    18,   296,    19,    20,
+      21,    22,    23,    24,   431,    32,   195,   301,   366,   359,
+     361,   362,   101,   102,    68,    69,    25,    26,   178,   179,
+      27,    28,   191,   192,    29,    87,    88,    30,    37,    38,
+      39,    40,   114,   110,   377,   203,   204,   416,    70,    71,
+      72,    73,    74,    75,   214,    76,    77,    78,    79,    80,
+     218,   219,    81,   128,   129,    82,    83,    84,   310,   148,
+     149
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      91,   208,   199,   200,   201,   239,   396,    89,   231,   476,
+     188,   477,   140,   141,   480,   142,   481,   216,   513,   484,
+      96,   485,   193,   320,   177,   103,   107,    96,   108,   430,
+     432,   249,   375,   375,   103,   250,    33,   143,   144,   173,
+     375,   119,   145,   146,   417,   376,   410,   -70,   174,   185,
+     446,   127,    31,    97,   111,   433,   133,   134,   103,   139,
+     184,   463,   464,   -70,   -70,   -70,    92,   -70,   -70,   -70,
+     -70,   -70,   -70,   -70,   -70,   -70,   313,   109,   443,   115,
+     194,   140,   141,    94,   142,   514,   411,   465,   220,    34,
+      35,   217,   478,   321,   186,   171,   172,   482,   -70,   147,
+     189,   294,   486,   138,   434,   -70,   143,   144,   231,   213,
+     -70,   145,   146,   322,   479,    36,   483,   323,   487,   227,
+     295,   221,   235,   213,   213,   213,   447,   449,   451,   139,
+     112,   -70,   435,   113,   -70,   -70,   466,   436,   497,   498,
+     499,    34,    35,   111,   252,   253,   254,   255,   256,   257,
+     258,   259,   471,   472,   473,   264,   265,   266,   267,   268,
+     269,   270,   271,   272,   467,   275,   116,    36,   369,   468,
+     180,    95,   118,   158,   159,   290,   317,   318,   158,   159,
+       2,   374,   375,     4,    99,     5,     6,   103,     8,     9,
+     325,   111,   448,   197,   198,   375,   335,   318,   151,   152,
+     153,   367,   368,   315,   154,   450,   166,   167,   168,   169,
+     170,   104,   171,   172,   151,   152,   153,   171,   172,    36,
+     154,   116,   334,   104,   412,   117,   155,   118,   338,   100,
+     158,   159,   324,   413,   105,   340,   341,   342,   343,   344,
+     345,   346,   155,   156,   157,     2,   158,   159,     4,   462,
+       5,     6,   106,     8,     9,   349,   350,   160,   161,   162,
+     182,   164,   165,   166,   167,   168,   169,   170,   249,   171,
+     172,   111,   409,   160,   161,   162,   182,   164,   165,   166,
+     167,   168,   169,   170,   354,   171,   172,   194,   116,   240,
+    -118,   363,   180,   364,   118,   351,   158,   159,   336,   318,
+      42,    43,    44,    90,    46,    47,  -119,    85,  -119,    86,
+    -119,   380,   382,   112,   112,   112,   113,   113,   113,   385,
+     386,   387,   388,   389,   390,   391,   210,   150,   305,   306,
+     407,   168,   169,   170,   120,   171,   172,    48,   337,   318,
+      49,    50,    51,    52,    53,    54,    55,    56,   495,    57,
+      58,   402,   121,   112,    59,   116,   113,   122,   406,   180,
+    -120,   118,  -120,   123,  -120,    60,    61,    62,   408,   124,
+     125,    63,    64,   211,   126,   130,   229,   230,    65,   273,
+     260,   274,    66,   261,   212,   131,   427,   428,    67,    42,
+      43,    44,    90,    46,    47,   132,   363,   -26,     1,     2,
+     176,     3,     4,   -93,     5,     6,     7,     8,     9,    10,
+     126,   175,   332,   333,   453,   454,   455,   183,   457,   232,
+     233,   234,   140,   141,   190,   142,    48,   397,   398,    49,
+      50,    51,    52,    53,    54,    55,    56,    36,    57,    58,
+     126,   206,   202,    59,    12,   207,   215,   143,   144,   222,
+     223,   494,   145,   146,    60,    61,    62,   276,   224,   277,
+      63,    64,   279,   282,   280,   283,   307,    65,   308,   225,
+     372,    66,   373,   414,   440,   415,   441,    67,   501,   504,
+     502,   505,   507,   226,   508,   511,    42,    43,    44,   135,
+      46,    47,     1,     2,   242,     3,     4,   -93,     5,     6,
+       7,     8,     9,    10,   243,   244,   523,   524,   245,   246,
+     247,   248,   262,   263,   278,   531,   284,   286,   288,   289,
+     291,   292,   293,    48,   297,   535,    49,    50,    51,    52,
+      53,    54,    55,    56,   298,    57,    58,    11,    12,   300,
+      59,    42,    43,    44,    90,    46,    47,   302,   309,   316,
+     303,    60,    61,    62,   304,   311,   326,    63,    64,   312,
+     319,   327,   328,   330,    65,   329,   348,   352,   136,   353,
+     282,   283,   357,   137,    67,   355,   356,   358,    48,   384,
+     365,    49,    50,    51,    52,    53,    54,    55,    56,   371,
+      57,    58,   400,   403,   401,    59,    42,    43,    44,    45,
+      46,    47,   419,   420,   437,   429,    60,    61,    62,   444,
+     438,   445,    63,    64,   452,   456,   469,   470,   381,    65,
+     474,   475,   492,    66,   488,   500,   496,   503,   510,    67,
+     506,   515,    93,    48,   509,   516,    49,    50,    51,    52,
+      53,    54,    55,    56,   519,    57,    58,   517,   528,   520,
+      59,    42,    43,    44,    90,    46,    47,   518,   521,   525,
+     526,    60,    61,    62,   527,   529,    98,    63,    64,    41,
+     314,   530,   378,   418,    65,   209,   299,   439,    66,   251,
+     287,   360,   285,   205,    67,   281,   461,   339,    48,   442,
+     383,    49,    50,    51,    52,    53,    54,    55,    56,   370,
+      57,    58,   347,   228,     0,    59,    42,    43,    44,   236,
+      46,   237,     0,     0,     0,     0,    60,    61,    62,     0,
+       0,     0,    63,    64,     0,     0,     0,     0,     0,    65,
+       0,     0,     0,    66,     0,     0,     0,     0,     0,    67,
+       0,     0,     0,    48,     0,     0,    49,    50,    51,    52,
+      53,    54,    55,    56,     0,    57,    58,   151,   152,   153,
+     238,     0,     0,   154,     0,     0,     0,   393,     0,     0,
+       0,    60,    61,    62,     0,     0,     0,    63,    64,     0,
+       0,     0,     0,     0,    65,   155,   156,   157,    66,   158,
+     159,     0,     0,     0,    67,     0,     0,     0,     0,     0,
+       0,     0,     0,   151,   152,   153,     0,     0,     0,   154,
+       0,     0,     0,     0,     0,     0,   160,   161,   162,   182,
+     164,   165,   166,   167,   168,   169,   170,     0,   171,   172,
+       0,   155,   156,   157,   394,   158,   159,     0,   395,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   151,
+     152,   153,     0,     0,     0,   154,     0,     0,     0,     0,
+       0,     0,   160,   161,   162,   182,   164,   165,   166,   167,
+     168,   169,   170,     0,   171,   172,     0,   155,   156,   157,
+     458,   158,   159,     0,   459,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   151,   152,   153,     0,     0,     0,
+     154,     0,     0,     0,     0,     0,     0,     0,   160,   161,
+     162,   182,   164,   165,   166,   167,   168,   169,   170,     0,
+     171,   172,   155,   156,   157,     0,   158,   159,     0,     0,
+     460,     0,     0,     0,     0,     0,     0,     0,     0,   151,
+     152,   153,     0,     0,     0,   154,     0,     0,     0,     0,
+       0,     0,     0,   160,   161,   162,   182,   164,   165,   166,
+     167,   168,   169,   170,     0,   171,   172,   155,   156,   157,
+       0,   158,   159,     0,     0,   512,     0,     0,     0,     0,
+       0,     0,     0,     0,   151,   152,   153,     0,     0,     0,
+     154,     0,     0,     0,     0,     0,     0,     0,   160,   161,
+     162,   182,   164,   165,   166,   167,   168,   169,   170,     0,
+     171,   172,   155,   156,   157,     0,   158,   159,     0,     0,
+     533,     0,     0,     0,     0,     0,     0,     0,     0,   151,
+     152,   153,     0,     0,     0,   154,     0,     0,     0,     0,
+       0,     0,     0,   160,   161,   162,   182,   164,   165,   166,
+     167,   168,   169,   170,     0,   171,   172,   155,   156,   157,
+       0,   158,   159,     0,     0,   536,     0,     0,     0,     0,
+       0,     0,     0,     0,   151,   152,   153,     0,     0,     0,
+     154,     0,     0,     0,     0,     0,     0,     0,   160,   161,
+     162,   182,   164,   165,   166,   167,   168,   169,   170,     0,
+     171,   172,   155,   156,   157,     0,   158,   159,   424,     1,
+       2,     0,     3,     4,   -93,     5,     6,     7,     8,     9,
+      10,   151,   152,   153,     0,     0,     0,   154,     0,     0,
+       0,     0,     0,   160,   161,   162,   182,   164,   165,   166,
+     167,   168,   169,   170,   187,   171,   172,     0,     0,   155,
+     156,   157,   241,   158,   159,    12,     1,     2,     0,     3,
+       4,   -93,     5,     6,     7,     8,     9,    10,   151,   152,
+     153,     0,     0,     0,   154,     0,     0,     0,     0,     0,
+     160,   161,   162,   182,   164,   165,   166,   167,   168,   169,
+     170,     0,   171,   172,     0,     0,   155,   156,   157,   379,
+     158,   159,    12,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   151,   152,   153,     0,     0,
+       0,   154,     0,     0,     0,     0,     0,   160,   161,   162,
+     182,   164,   165,   166,   167,   168,   169,   170,     0,   171,
+     172,     0,     0,   155,   156,   157,   489,   158,   159,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   151,   152,   153,     0,     0,     0,   154,     0,
+       0,     0,     0,     0,   160,   161,   162,   182,   164,   165,
+     166,   167,   168,   169,   170,     0,   171,   172,     0,     0,
+     155,   156,   157,   490,   158,   159,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   151,
+     152,   153,     0,     0,     0,   154,     0,     0,     0,     0,
+       0,   160,   161,   162,   182,   164,   165,   166,   167,   168,
+     169,   170,     0,   171,   172,     0,     0,   155,   156,   157,
+     491,   158,   159,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   151,   152,   153,     0,
+       0,     0,   154,     0,     0,     0,     0,     0,   160,   161,
+     162,   182,   164,   165,   166,   167,   168,   169,   170,     0,
+     171,   172,     0,     0,   155,   156,   157,   493,   158,   159,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   151,   152,   153,     0,     0,     0,   154,
+       0,     0,     0,     0,     0,   160,   161,   162,   182,   164,
+     165,   166,   167,   168,   169,   170,     0,   171,   172,     0,
+       0,   155,   156,   157,   534,   158,   159,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   151,
+     152,   153,     0,     0,     0,   154,     0,     0,     0,     0,
+       0,     0,   160,   161,   162,   182,   164,   165,   166,   167,
+     168,   169,   170,     0,   171,   172,     0,   155,   156,   157,
+     399,   158,   159,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   151,   152,   153,     0,     0,
+       0,   154,     0,     0,     0,     0,     0,     0,   160,   161,
+     162,   182,   164,   165,   166,   167,   168,   169,   170,     0,
+     171,   172,     0,   155,   156,   157,   522,   158,   159,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   151,   152,   153,
+       0,     0,     0,   154,   160,   161,   162,   182,   164,   165,
+     166,   167,   168,   169,   170,     0,   171,   172,     0,     0,
+       0,     0,   532,   404,   405,   155,   156,   157,     0,   158,
+     159,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   151,   152,   153,     0,     0,     0,   154,     0,
+       0,     0,     0,     0,     0,     0,   160,   161,   162,   182,
+     164,   165,   166,   167,   168,   169,   170,   181,   171,   172,
+     155,   156,   157,     0,   158,   159,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   151,   152,   153,
+       0,     0,     0,   154,     0,     0,     0,     0,     0,     0,
+       0,   160,   161,   162,   182,   164,   165,   166,   167,   168,
+     169,   170,   196,   171,   172,   155,   156,   157,     0,   158,
+     159,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   151,   152,   153,     0,     0,     0,   154,     0,
+       0,     0,     0,     0,     0,     0,   160,   161,   162,   182,
+     164,   165,   166,   167,   168,   169,   170,     0,   171,   172,
+     155,   156,   157,     0,   158,   159,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   126,   151,   152,
+     153,     0,     0,     0,   154,     0,     0,     0,     0,     0,
+       0,   160,   161,   162,   182,   164,   165,   166,   167,   168,
+     169,   170,     0,   171,   172,     0,   155,   156,   157,     0,
+     158,   159,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   331,   151,   152,   153,     0,     0,
+       0,   154,     0,     0,     0,     0,     0,   160,   161,   162,
+     182,   164,   165,   166,   167,   168,   169,   170,     0,   171,
+     172,     0,     0,   155,   156,   157,     0,   158,   159,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     151,   152,   153,   392,     0,     0,   154,     0,     0,     0,
+     421,     0,     0,     0,   160,   161,   162,   182,   164,   165,
+     166,   167,   168,   169,   170,     0,   171,   172,   155,   156,
+     157,     0,   158,   159,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   151,   152,   153,     0,     0,
+       0,   154,     0,     0,     0,   422,     0,     0,     0,   160,
+     161,   162,   182,   164,   165,   166,   167,   168,   169,   170,
+       0,   171,   172,   155,   156,   157,     0,   158,   159,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     151,   152,   153,     0,     0,     0,   154,     0,     0,     0,
+     423,     0,     0,     0,   160,   161,   162,   182,   164,   165,
+     166,   167,   168,   169,   170,     0,   171,   172,   155,   156,
+     157,     0,   158,   159,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   151,   152,   153,     0,     0,
+       0,   154,     0,     0,     0,   425,     0,     0,     0,   160,
+     161,   162,   182,   164,   165,   166,   167,   168,   169,   170,
+       0,   171,   172,   155,   156,   157,     0,   158,   159,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     151,   152,   153,     0,     0,     0,   154,     0,     0,     0,
+       0,     0,     0,     0,   160,   161,   162,   182,   164,   165,
+     166,   167,   168,   169,   170,     0,   171,   172,   155,   156,
+     157,     0,   158,   159,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   151,   152,   153,   426,     0,
+       0,   154,     0,     0,     0,     0,     0,     0,     0,   160,
+     161,   162,   182,   164,   165,   166,   167,   168,   169,   170,
+       0,   171,   172,   155,   156,   157,     0,   158,   159,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     151,   152,   153,     0,     0,     0,   154,     0,     0,     0,
+       0,     0,     0,     0,   160,   161,   162,   163,   164,   165,
+     166,   167,   168,   169,   170,     0,   171,   172,   155,   156,
+     157,     0,   158,   159,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  -153,  -153,  -153,     0,     0,
+       0,  -153,     0,     0,     0,     0,     0,     0,     0,   160,
+     161,   162,   182,   164,   165,   166,   167,   168,   169,   170,
+       0,   171,   172,  -153,  -153,  -153,     0,   158,   159,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     151,   152,   153,     0,     0,     0,   154,     0,     0,     0,
+       0,     0,     0,     0,  -153,  -153,  -153,  -153,  -153,  -153,
+     166,   167,   168,   169,   170,     0,   171,   172,   155,     0,
+     157,     0,   158,   159,     0,     0,     0,     0,     0,     0,
+       0,   151,   152,   153,     0,     0,     0,   154,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   160,
+     161,   162,   182,   164,   165,   166,   167,   168,   169,   170,
+       0,   171,   172,   158,   159,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     160,   161,   162,   182,   164,   165,   166,   167,   168,   169,
+     170,     0,   171,   172
+};
+
+static const yytype_int16 yycheck[] =
+{
+       7,   114,   104,   105,   106,   136,   339,     6,   128,     6,
+      96,     8,     5,     6,     6,     8,     8,     6,    19,     6,
+      51,     8,    30,     6,    58,    32,     6,    51,     8,   399,
+     399,    88,    76,    76,    41,    92,     6,    30,    31,    80,
+      76,    48,    35,    36,   377,    89,    89,     0,    89,    20,
+      86,    58,    29,    84,    88,   399,    63,    64,    65,    66,
+      84,   431,   431,    16,    17,    18,    85,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,   207,    57,   411,    41,
+      88,     5,     6,    64,     8,    86,   374,   431,     6,    59,
+      60,    80,    89,    76,    65,    80,    81,    89,    51,    92,
+      99,   187,    89,    65,   399,    58,    30,    31,   228,   116,
+      63,    35,    36,    88,   447,    85,   449,    92,   451,   126,
+      65,   120,    41,   130,   131,   132,   414,   415,   416,   136,
+      72,    84,   399,    75,    87,    88,   431,   399,   471,   472,
+     473,    59,    60,    88,   151,   152,   153,   154,   155,   156,
+     157,   158,   440,   441,   442,   162,   163,   164,   165,   166,
+     167,   168,   169,   170,   431,   172,    85,    85,    92,   431,
+      89,     0,    91,    41,    42,   182,    87,    88,    41,    42,
+      18,   312,    76,    21,    16,    23,    24,   194,    26,    27,
+      87,    88,    86,    59,    60,    76,    87,    88,     9,    10,
+      11,   303,   304,   210,    15,    86,    74,    75,    76,    77,
+      78,    71,    80,    81,     9,    10,    11,    80,    81,    85,
+      15,    85,   229,    71,     3,    89,    37,    91,   235,    22,
+      41,    42,    80,    12,    85,   242,   243,   244,   245,   246,
+     247,   248,    37,    38,    39,    18,    41,    42,    21,    87,
+      23,    24,    85,    26,    27,   262,   263,    68,    69,    70,
+      71,    72,    73,    74,    75,    76,    77,    78,    88,    80,
+      81,    88,    92,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,   291,    80,    81,    88,    85,    90,
+      87,   298,    89,   300,    91,    90,    41,    42,    87,    88,
+       3,     4,     5,     6,     7,     8,    87,     6,    89,     8,
+      91,   318,   319,    72,    72,    72,    75,    75,    75,   326,
+     327,   328,   329,   330,   331,   332,    29,    88,    87,    87,
+      87,    76,    77,    78,    85,    80,    81,    40,    87,    88,
+      43,    44,    45,    46,    47,    48,    49,    50,   461,    52,
+      53,   358,    85,    72,    57,    85,    75,    85,   365,    89,
+      87,    91,    89,    85,    91,    68,    69,    70,    87,    85,
+      85,    74,    75,    76,    54,    85,    56,    57,    81,     6,
+      40,     8,    85,    43,    87,    85,   393,   394,    91,     3,
+       4,     5,     6,     7,     8,    85,   403,    16,    17,    18,
+      88,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      54,    80,    56,    57,   421,   422,   423,     6,   425,   130,
+     131,   132,     5,     6,     6,     8,    40,   352,   353,    43,
+      44,    45,    46,    47,    48,    49,    50,    85,    52,    53,
+      54,    75,    89,    57,    63,    81,     6,    30,    31,     6,
+       6,   458,    35,    36,    68,    69,    70,     6,     6,     8,
+      74,    75,     6,    16,     8,    18,     6,    81,     8,     6,
+       6,    85,     8,     6,     6,     8,     8,    91,     6,     6,
+       8,     8,     6,     6,     8,   492,     3,     4,     5,     6,
+       7,     8,    17,    18,    89,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    89,    89,   513,   514,    89,    89,
+      89,    89,    20,    20,     6,   522,    58,    58,     6,     6,
+      41,    66,     5,    40,    88,   532,    43,    44,    45,    46,
+      47,    48,    49,    50,    31,    52,    53,    62,    63,    32,
+      57,     3,     4,     5,     6,     7,     8,     6,    91,    87,
+      85,    68,    69,    70,    85,    89,    41,    74,    75,    81,
+      89,    41,    41,    41,    81,    71,    43,    21,    85,    21,
+      16,    18,     6,    90,    91,    65,    34,    19,    40,     6,
+      33,    43,    44,    45,    46,    47,    48,    49,    50,    87,
+      52,    53,     5,    88,     6,    57,     3,     4,     5,     6,
+       7,     8,     6,    87,    34,    87,    68,    69,    70,    12,
+      67,     3,    74,    75,    90,     6,     6,     5,    80,    81,
+      90,     3,    41,    85,    75,    75,    67,    90,    73,    91,
+      90,     5,    11,    40,    90,    90,    43,    44,    45,    46,
+      47,    48,    49,    50,    75,    52,    53,    90,    73,    75,
+      57,     3,     4,     5,     6,     7,     8,    90,    75,    75,
+      75,    68,    69,    70,    75,    73,    16,    74,    75,     3,
+     209,    73,   314,   378,    81,   115,   194,   403,    85,   150,
+     179,   297,   178,   111,    91,   176,   429,   239,    40,   410,
+     322,    43,    44,    45,    46,    47,    48,    49,    50,   309,
+      52,    53,   249,   127,    -1,    57,     3,     4,     5,     6,
+       7,     8,    -1,    -1,    -1,    -1,    68,    69,    70,    -1,
+      -1,    -1,    74,    75,    -1,    -1,    -1,    -1,    -1,    81,
+      -1,    -1,    -1,    85,    -1,    -1,    -1,    -1,    -1,    91,
+      -1,    -1,    -1,    40,    -1,    -1,    43,    44,    45,    46,
+      47,    48,    49,    50,    -1,    52,    53,     9,    10,    11,
+      57,    -1,    -1,    15,    -1,    -1,    -1,    19,    -1,    -1,
+      -1,    68,    69,    70,    -1,    -1,    -1,    74,    75,    -1,
+      -1,    -1,    -1,    -1,    81,    37,    38,    39,    85,    41,
+      42,    -1,    -1,    -1,    91,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,     9,    10,    11,    -1,    -1,    -1,    15,
+      -1,    -1,    -1,    -1,    -1,    -1,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    -1,    80,    81,
+      -1,    37,    38,    39,    86,    41,    42,    -1,    90,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     9,
+      10,    11,    -1,    -1,    -1,    15,    -1,    -1,    -1,    -1,
+      -1,    -1,    68,    69,    70,    71,    72,    73,    74,    75,
+      76,    77,    78,    -1,    80,    81,    -1,    37,    38,    39,
+      86,    41,    42,    -1,    90,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,     9,    10,    11,    -1,    -1,    -1,
+      15,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    68,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    78,    -1,
+      80,    81,    37,    38,    39,    -1,    41,    42,    -1,    -1,
+      90,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     9,
+      10,    11,    -1,    -1,    -1,    15,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    -1,    80,    81,    37,    38,    39,
+      -1,    41,    42,    -1,    -1,    90,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,     9,    10,    11,    -1,    -1,    -1,
+      15,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    68,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    78,    -1,
+      80,    81,    37,    38,    39,    -1,    41,    42,    -1,    -1,
+      90,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     9,
+      10,    11,    -1,    -1,    -1,    15,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    -1,    80,    81,    37,    38,    39,
+      -1,    41,    42,    -1,    -1,    90,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,     9,    10,    11,    -1,    -1,    -1,
+      15,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    68,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    78,    -1,
+      80,    81,    37,    38,    39,    -1,    41,    42,    88,    17,
+      18,    -1,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,     9,    10,    11,    -1,    -1,    -1,    15,    -1,    -1,
+      -1,    -1,    -1,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    52,    80,    81,    -1,    -1,    37,
+      38,    39,    87,    41,    42,    63,    17,    18,    -1,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,     9,    10,
+      11,    -1,    -1,    -1,    15,    -1,    -1,    -1,    -1,    -1,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    -1,    80,    81,    -1,    -1,    37,    38,    39,    87,
+      41,    42,    63,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,     9,    10,    11,    -1,    -1,
+      -1,    15,    -1,    -1,    -1,    -1,    -1,    68,    69,    70,
+      71,    72,    73,    74,    75,    76,    77,    78,    -1,    80,
+      81,    -1,    -1,    37,    38,    39,    87,    41,    42,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,     9,    10,    11,    -1,    -1,    -1,    15,    -1,
+      -1,    -1,    -1,    -1,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    -1,    80,    81,    -1,    -1,
+      37,    38,    39,    87,    41,    42,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     9,
+      10,    11,    -1,    -1,    -1,    15,    -1,    -1,    -1,    -1,
+      -1,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    -1,    80,    81,    -1,    -1,    37,    38,    39,
+      87,    41,    42,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     9,    10,    11,    -1,
+      -1,    -1,    15,    -1,    -1,    -1,    -1,    -1,    68,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    78,    -1,
+      80,    81,    -1,    -1,    37,    38,    39,    87,    41,    42,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,     9,    10,    11,    -1,    -1,    -1,    15,
+      -1,    -1,    -1,    -1,    -1,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    -1,    80,    81,    -1,
+      -1,    37,    38,    39,    87,    41,    42,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     9,
+      10,    11,    -1,    -1,    -1,    15,    -1,    -1,    -1,    -1,
+      -1,    -1,    68,    69,    70,    71,    72,    73,    74,    75,
+      76,    77,    78,    -1,    80,    81,    -1,    37,    38,    39,
+      86,    41,    42,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,     9,    10,    11,    -1,    -1,
+      -1,    15,    -1,    -1,    -1,    -1,    -1,    -1,    68,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    78,    -1,
+      80,    81,    -1,    37,    38,    39,    86,    41,    42,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,     9,    10,    11,
+      -1,    -1,    -1,    15,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    -1,    80,    81,    -1,    -1,
+      -1,    -1,    86,    35,    36,    37,    38,    39,    -1,    41,
+      42,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,     9,    10,    11,    -1,    -1,    -1,    15,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    34,    80,    81,
+      37,    38,    39,    -1,    41,    42,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,     9,    10,    11,
+      -1,    -1,    -1,    15,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    34,    80,    81,    37,    38,    39,    -1,    41,
+      42,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,     9,    10,    11,    -1,    -1,    -1,    15,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    -1,    80,    81,
+      37,    38,    39,    -1,    41,    42,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    54,     9,    10,
+      11,    -1,    -1,    -1,    15,    -1,    -1,    -1,    -1,    -1,
+      -1,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    -1,    80,    81,    -1,    37,    38,    39,    -1,
+      41,    42,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    55,     9,    10,    11,    -1,    -1,
+      -1,    15,    -1,    -1,    -1,    -1,    -1,    68,    69,    70,
+      71,    72,    73,    74,    75,    76,    77,    78,    -1,    80,
+      81,    -1,    -1,    37,    38,    39,    -1,    41,    42,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       9,    10,    11,    57,    -1,    -1,    15,    -1,    -1,    -1,
+      19,    -1,    -1,    -1,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    -1,    80,    81,    37,    38,
+      39,    -1,    41,    42,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,     9,    10,    11,    -1,    -1,
+      -1,    15,    -1,    -1,    -1,    19,    -1,    -1,    -1,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      -1,    80,    81,    37,    38,    39,    -1,    41,    42,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       9,    10,    11,    -1,    -1,    -1,    15,    -1,    -1,    -1,
+      19,    -1,    -1,    -1,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    -1,    80,    81,    37,    38,
+      39,    -1,    41,    42,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,     9,    10,    11,    -1,    -1,
+      -1,    15,    -1,    -1,    -1,    19,    -1,    -1,    -1,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      -1,    80,    81,    37,    38,    39,    -1,    41,    42,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       9,    10,    11,    -1,    -1,    -1,    15,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    -1,    80,    81,    37,    38,
+      39,    -1,    41,    42,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,     9,    10,    11,    57,    -1,
+      -1,    15,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      -1,    80,    81,    37,    38,    39,    -1,    41,    42,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       9,    10,    11,    -1,    -1,    -1,    15,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    -1,    80,    81,    37,    38,
+      39,    -1,    41,    42,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,     9,    10,    11,    -1,    -1,
+      -1,    15,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      -1,    80,    81,    37,    38,    39,    -1,    41,    42,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       9,    10,    11,    -1,    -1,    -1,    15,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    -1,    80,    81,    37,    -1,
+      39,    -1,    41,    42,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,     9,    10,    11,    -1,    -1,    -1,    15,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      -1,    80,    81,    41,    42,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    -1,    80,    81
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_uint8 yystos[] =
+{
+       0,    17,    18,    20,    21,    23,    24,    25,    26,    27,
+      28,    62,    63,    94,    95,    96,    97,    98,    99,   101,
+     102,   103,   104,   105,   106,   119,   120,   123,   124,   127,
+     130,    29,   108,     6,    59,    60,    85,   131,   132,   133,
+     134,   108,     3,     4,     5,     6,     7,     8,    40,    43,
+      44,    45,    46,    47,    48,    49,    50,    52,    53,    57,
+      68,    69,    70,    74,    75,    81,    85,    91,   117,   118,
+     141,   142,   143,   144,   145,   146,   148,   149,   150,   151,
+     152,   155,   158,   159,   160,     6,     8,   128,   129,   131,
+       6,   141,    85,    95,    64,     0,    51,    84,    98,    16,
+      22,   115,   116,   141,    71,    85,    85,     6,     8,    57,
+     136,    88,    72,    75,   135,   115,    85,    89,    91,   141,
+      85,    85,    85,    85,    85,    85,    54,   141,   156,   157,
+      85,    85,    85,   141,   141,     6,    85,    90,   115,   141,
+       5,     6,     8,    30,    31,    35,    36,    92,   162,   163,
+      88,     9,    10,    11,    15,    37,    38,    39,    41,    42,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    80,    81,    80,    89,    80,    88,    58,   121,   122,
+      89,    34,    71,     6,    84,    20,    65,    52,    96,   131,
+       6,   125,   126,    30,    88,   109,    34,    59,    60,   132,
+     132,   132,    89,   138,   139,   133,    75,    81,   134,   109,
+      29,    76,    87,   141,   147,     6,     6,    80,   153,   154,
+       6,   131,     6,     6,     6,     6,     6,   141,   156,    56,
+      57,   157,   147,   147,   147,    41,     6,     8,    57,   136,
+      90,    87,    89,    89,    89,    89,    89,    89,    89,    88,
+      92,   118,   141,   141,   141,   141,   141,   141,   141,   141,
+      40,    43,    20,    20,   141,   141,   141,   141,   141,   141,
+     141,   141,   141,     6,     8,   141,     6,     8,     6,     6,
+       8,   129,    16,    18,    58,   122,    58,   121,     6,     6,
+     141,    41,    66,     5,    96,    65,   100,    88,    31,   116,
+      32,   110,     6,    85,    85,    87,    87,     6,     8,    91,
+     161,    89,    81,   136,   110,   141,    87,    87,    88,    89,
+       6,    76,    88,    92,    80,    87,    41,    41,    41,    71,
+      41,    55,    56,    57,   141,    87,    87,    87,   141,   138,
+     141,   141,   141,   141,   141,   141,   141,   163,    43,   141,
+     141,    90,    21,    21,   141,    65,    34,     6,    19,   112,
+     126,   113,   114,   141,   141,    33,   111,   132,   132,    92,
+     162,    87,     6,     8,   136,    76,    89,   137,   111,    87,
+     141,    80,   141,   154,     6,   141,   141,   141,   141,   141,
+     141,   141,    57,    19,    86,    90,   161,   117,   117,    86,
+       5,     6,   141,    88,    35,    36,   141,    87,    87,    92,
+      89,   137,     3,    12,     6,     8,   140,   161,   112,     6,
+      87,    19,    19,    19,    88,    19,    57,   141,   141,    87,
+     105,   107,   119,   120,   123,   124,   127,    34,    67,   114,
+       6,     8,   140,   161,    12,     3,    86,   137,    86,   137,
+      86,   137,    90,   141,   141,   141,     6,   141,    86,    90,
+      90,   135,    87,   105,   119,   120,   123,   124,   127,     6,
+       5,   137,   137,   137,    90,     3,     6,     8,    89,   161,
+       6,     8,    89,   161,     6,     8,    89,   161,    75,    87,
+      87,    87,    41,    87,   141,   134,    67,   161,   161,   161,
+      75,     6,     8,    90,     6,     8,    90,     6,     8,    90,
+      73,   141,    90,    19,    86,     5,    90,    90,    90,    75,
+      75,    75,    86,   141,   141,    75,    75,    75,    73,    73,
+      73,   141,    86,    90,    87,   141,    90
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,    93,    94,    94,    94,    94,    95,    95,    95,    96,
+      97,    97,    98,    98,    98,    98,    98,    98,    98,    98,
+      98,    98,    98,    99,   100,   100,   101,   101,   102,   103,
+     104,   105,   106,   106,   106,   106,   107,   107,   107,   107,
+     107,   107,   107,   107,   107,   107,   107,   107,   108,   108,
+     109,   109,   110,   110,   111,   111,   112,   112,   113,   113,
+     114,   114,   114,   115,   115,   116,   116,   117,   117,   118,
+     118,   119,   120,   120,   120,   120,   120,   121,   122,   123,
+     124,   125,   125,   126,   127,   128,   128,   129,   129,   129,
+     129,   129,   130,   130,   131,   131,   132,   132,   133,   133,
+     133,   133,   133,   133,   134,   135,   135,   135,   135,   135,
+     135,   135,   135,   135,   135,   135,   135,   136,   136,   136,
+     136,   137,   137,   137,   137,   137,   137,   138,   138,   139,
+     139,   139,   139,   140,   140,   140,   140,   140,   140,   140,
+     140,   140,   140,   140,   140,   141,   141,   141,   141,   141,
+     141,   141,   141,   141,   141,   141,   141,   141,   141,   141,
+     141,   141,   141,   141,   141,   141,   141,   141,   141,   141,
+     141,   141,   141,   141,   142,   142,   142,   142,   142,   142,
+     142,   142,   142,   142,   142,   142,   142,   143,   144,   144,
+     144,   144,   144,   144,   144,   144,   144,   145,   145,   145,
+     145,   146,   147,   147,   148,   148,   149,   149,   149,   149,
+     150,   150,   151,   151,   152,   153,   153,   154,   154,   154,
+     154,   155,   155,   155,   155,   156,   156,   157,   158,   158,
+     158,   158,   158,   158,   159,   159,   159,   160,   161,   161,
+     161,   162,   162,   163,   163,   163,   163,   163,   163,   163
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     2,     2,     3,     1,     3,     4,     1,
+       1,     2,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     5,     0,     2,     0,     1,     6,     7,
+       4,     8,     6,     8,     8,    10,     1,     1,     1,     1,
+       1,     1,     2,     2,     2,     2,     2,     2,     0,     1,
+       0,     3,     0,     2,     0,     2,     0,     2,     1,     3,
+       1,     2,     2,     1,     3,     1,     3,     1,     3,     3,
+       3,     2,     2,     3,     3,     4,     4,     4,     4,     2,
+       3,     1,     3,     1,     2,     1,     3,     3,     3,     3,
+       3,     3,     1,     0,     1,     3,     1,     3,     1,     3,
+       6,     4,     6,     4,     5,     8,    10,    10,    10,     8,
+      10,    10,    10,     7,     9,     9,     9,     0,     1,     1,
+       1,     0,     1,     2,     4,     3,     3,     0,     1,     2,
+       2,     3,     3,     3,     4,     3,     4,     3,     4,     3,
+       4,     3,     3,     4,     4,     1,     2,     2,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     4,     4,     3,     2,     3,     4,
+       3,     3,     3,     4,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     3,     1,     3,     4,
+       5,     4,     4,     6,     4,     4,     4,     8,     8,     8,
+       8,    12,     1,     3,     2,     3,     5,     7,     7,     9,
+      11,    13,     2,     3,     4,     1,     3,     2,     2,     4,
+       3,     3,     5,     4,     6,     1,     2,     4,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     2,
+       3,     1,     3,     3,     3,     3,     3,     3,     3,     3
+};
+
+
+/* YYDPREC[RULE-NUM] -- Dynamic precedence of rule #RULE-NUM (0 if none).  */
+static const yytype_int8 yydprec[] =
+{
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       1,     2,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0
+};
+
+/* YYMERGER[RULE-NUM] -- Index of merging function for rule #RULE-NUM.  */
+static const yytype_int8 yymerger[] =
+{
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0
+};
+
+/* YYIMMEDIATE[RULE-NUM] -- True iff rule #RULE-NUM is not to be deferred, as
+   in the case of predicates.  */
+static const yybool yyimmediate[] =
+{
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0
+};
+
+/* YYCONFLP[YYPACT[STATE-NUM]] -- Pointer into YYCONFL of start of
+   list of conflicting reductions corresponding to action entry for
+   state STATE-NUM in yytable.  0 means no conflicts.  The list in
+   yyconfl is terminated by a rule number of 0.  */
+static const yytype_int8 yyconflp[] =
+{
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     1,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       5,     0,     7,     0,     9,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    11,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      13,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     3,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0
+};
+
+/* YYCONFL[I] -- lists of conflicting rule numbers, each terminated by
+   0, pointed into by YYCONFLP.  */
+static const short yyconfl[] =
+{
+       0,   234,     0,   117,     0,   234,     0,   118,     0,   118,
+       0,   235,     0,   236,     0
+};
+
+
+/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
+   If N is 0, then set CURRENT to the empty location which ends
+   the previous symbol: RHS[0] (always defined).  */
+
+#ifndef YYLLOC_DEFAULT
+# define YYLLOC_DEFAULT(Current, Rhs, N)                                \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;        \
+          (Current).first_column = YYRHSLOC (Rhs, 1).first_column;      \
+          (Current).last_line    = YYRHSLOC (Rhs, N).last_line;         \
+          (Current).last_column  = YYRHSLOC (Rhs, N).last_column;       \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).first_line   = (Current).last_line   =              \
+            YYRHSLOC (Rhs, 0).last_line;                                \
+          (Current).first_column = (Current).last_column =              \
+            YYRHSLOC (Rhs, 0).last_column;                              \
+        }                                                               \
+    while (0)
+#endif
+
+# define YYRHSLOC(Rhs, K) ((Rhs)[K].yystate.yyloc)
+
+
+
+#undef yynerrs
+#define yynerrs (yystackp->yyerrcnt)
+#undef yychar
+#define yychar (yystackp->yyrawchar)
+#undef yylval
+#define yylval (yystackp->yyval)
+#undef yylloc
+#define yylloc (yystackp->yyloc)
+#define cypher_yynerrs yynerrs
+#define cypher_yychar yychar
+#define cypher_yylval yylval
+#define cypher_yylloc yylloc
+
+enum { YYENOMEM = -2 };
+
+typedef enum { yyok, yyaccept, yyabort, yyerr, yynomem } YYRESULTTAG;
+
+#define YYCHK(YYE)                              \
+  do {                                          \
+    YYRESULTTAG yychk_flag = YYE;               \
+    if (yychk_flag != yyok)                     \
+      return yychk_flag;                        \
+  } while (0)
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   SIZE_MAX < YYMAXDEPTH * sizeof (GLRStackItem)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+/* Minimum number of free items on the stack allowed after an
+   allocation.  This is to allow allocation and initialization
+   to be completed by functions that call yyexpandGLRStack before the
+   stack is expanded, thus insuring that all necessary pointers get
+   properly redirected to new data.  */
+#define YYHEADROOM 2
+
+#ifndef YYSTACKEXPANDABLE
+#  define YYSTACKEXPANDABLE 1
+#endif
+
+#if YYSTACKEXPANDABLE
+# define YY_RESERVE_GLRSTACK(Yystack)                   \
+  do {                                                  \
+    if (Yystack->yyspaceLeft < YYHEADROOM)              \
+      yyexpandGLRStack (Yystack);                       \
+  } while (0)
+#else
+# define YY_RESERVE_GLRSTACK(Yystack)                   \
+  do {                                                  \
+    if (Yystack->yyspaceLeft < YYHEADROOM)              \
+      yyMemoryExhausted (Yystack);                      \
+  } while (0)
+#endif
+
+/** State numbers. */
+typedef int yy_state_t;
+
+/** Rule numbers. */
+typedef int yyRuleNum;
+
+/** Item references. */
+typedef short yyItemNum;
+
+typedef struct yyGLRState yyGLRState;
+typedef struct yyGLRStateSet yyGLRStateSet;
+typedef struct yySemanticOption yySemanticOption;
+typedef union yyGLRStackItem yyGLRStackItem;
+typedef struct yyGLRStack yyGLRStack;
+
+struct yyGLRState
+{
+  /** Type tag: always true.  */
+  yybool yyisState;
+  /** Type tag for yysemantics.  If true, yyval applies, otherwise
+   *  yyfirstVal applies.  */
+  yybool yyresolved;
+  /** Number of corresponding LALR(1) machine state.  */
+  yy_state_t yylrState;
+  /** Preceding state in this stack */
+  yyGLRState* yypred;
+  /** Source position of the last token produced by my symbol */
+  YYPTRDIFF_T yyposn;
+  union {
+    /** First in a chain of alternative reductions producing the
+     *  nonterminal corresponding to this state, threaded through
+     *  yynext.  */
+    yySemanticOption* yyfirstVal;
+    /** Semantic value for this state.  */
+    YYSTYPE yyval;
+  } yysemantics;
+  /** Source location for this state.  */
+  YYLTYPE yyloc;
+};
+
+struct yyGLRStateSet
+{
+  yyGLRState** yystates;
+  /** During nondeterministic operation, yylookaheadNeeds tracks which
+   *  stacks have actually needed the current lookahead.  During deterministic
+   *  operation, yylookaheadNeeds[0] is not maintained since it would merely
+   *  duplicate yychar != CYPHER_CYPHER_YYEMPTY.  */
+  yybool* yylookaheadNeeds;
+  YYPTRDIFF_T yysize;
+  YYPTRDIFF_T yycapacity;
+};
+
+struct yySemanticOption
+{
+  /** Type tag: always false.  */
+  yybool yyisState;
+  /** Rule number for this reduction */
+  yyRuleNum yyrule;
+  /** The last RHS state in the list of states to be reduced.  */
+  yyGLRState* yystate;
+  /** The lookahead for this reduction.  */
+  int yyrawchar;
+  YYSTYPE yyval;
+  YYLTYPE yyloc;
+  /** Next sibling in chain of options.  To facilitate merging,
+   *  options are chained in decreasing order by address.  */
+  yySemanticOption* yynext;
+};
+
+/** Type of the items in the GLR stack.  The yyisState field
+ *  indicates which item of the union is valid.  */
+union yyGLRStackItem {
+  yyGLRState yystate;
+  yySemanticOption yyoption;
+};
+
+struct yyGLRStack {
+  int yyerrState;
+  /* To compute the location of the error token.  */
+  yyGLRStackItem yyerror_range[3];
+
+  int yyerrcnt;
+  int yyrawchar;
+  YYSTYPE yyval;
+  YYLTYPE yyloc;
+
+  YYJMP_BUF yyexception_buffer;
+  yyGLRStackItem* yyitems;
+  yyGLRStackItem* yynextFree;
+  YYPTRDIFF_T yyspaceLeft;
+  yyGLRState* yysplitPoint;
+  yyGLRState* yylastDeleted;
+  yyGLRStateSet yytops;
+};
+
+#if YYSTACKEXPANDABLE
+static void yyexpandGLRStack (yyGLRStack* yystackp);
+#endif
+
+_Noreturn static void
+yyFail (yyGLRStack* yystackp, YYLTYPE *yylocp, cypher_parser_context *context, const char* yymsg)
+{
+  if (yymsg != YY_NULLPTR)
+    yyerror (yylocp, context, yymsg);
+  YYLONGJMP (yystackp->yyexception_buffer, 1);
+}
+
+_Noreturn static void
+yyMemoryExhausted (yyGLRStack* yystackp)
+{
+  YYLONGJMP (yystackp->yyexception_buffer, 2);
+}
+
+/** Accessing symbol of state YYSTATE.  */
+static inline yysymbol_kind_t
+yy_accessing_symbol (yy_state_t yystate)
+{
+  return YY_CAST (yysymbol_kind_t, yystos[yystate]);
+}
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  static const char *const yy_sname[] =
+  {
+  "end of file", "error", "invalid token", "INTEGER", "DECIMAL", "STRING",
+  "IDENTIFIER", "PARAMETER", "BQIDENT", "NOT_EQ", "LT_EQ", "GT_EQ",
+  "DOT_DOT", "TYPECAST", "PLUS_EQ", "REGEX_MATCH", "MATCH", "RETURN",
+  "CREATE", "WHERE", "WITH", "SET", "DELETE", "REMOVE", "MERGE", "UNWIND",
+  "DETACH", "FOREACH", "OPTIONAL", "DISTINCT", "ORDER", "BY", "SKIP",
+  "LIMIT", "AS", "ASC", "DESC", "AND", "OR", "XOR", "NOT", "IN", "IS",
+  "NULL_P", "TRUE_P", "FALSE_P", "EXISTS", "ANY", "NONE", "SINGLE",
+  "REDUCE", "UNION", "ALL", "CASE", "WHEN", "THEN", "ELSE", "END_P", "ON",
+  "SHORTESTPATH", "ALLSHORTESTPATHS", "PATTERN", "EXPLAIN", "LOAD", "CSV",
+  "FROM", "HEADERS", "FIELDTERMINATOR", "STARTS", "ENDS", "CONTAINS",
+  "'='", "'<'", "'>'", "'+'", "'-'", "'*'", "'/'", "'%'", "'^'", "'.'",
+  "'['", "UNARY_MINUS", "UNARY_PLUS", "';'", "'('", "'|'", "')'", "','",
+  "':'", "']'", "'{'", "'}'", "$accept", "stmt", "union_query",
+  "single_query", "clause_list", "clause", "match_clause",
+  "from_graph_opt", "optional_opt", "return_clause", "with_clause",
+  "unwind_clause", "foreach_clause", "load_csv_clause",
+  "foreach_update_list", "distinct_opt", "order_by_opt", "skip_opt",
+  "limit_opt", "where_opt", "order_by_list", "order_by_item",
+  "return_item_list", "return_item", "set_item_list", "set_item",
+  "create_clause", "merge_clause", "on_create_clause", "on_match_clause",
+  "set_clause", "delete_clause", "delete_item_list", "delete_item",
+  "remove_clause", "remove_item_list", "remove_item", "detach_opt",
+  "pattern_list", "simple_path", "path", "node_pattern", "rel_pattern",
+  "variable_opt", "varlen_range_opt", "label_opt", "label_list",
+  "rel_type_list", "expr", "primary_expr", "literal_expr", "function_call",
+  "list_predicate", "reduce_expr", "argument_list", "list_literal",
+  "list_comprehension", "pattern_comprehension", "map_literal",
+  "map_projection", "map_projection_list", "map_projection_item",
+  "case_expression", "when_clause_list", "when_clause", "literal",
+  "identifier", "parameter", "properties_opt", "map_pair_list", "map_pair", YY_NULLPTR
+  };
+  return yy_sname[yysymbol];
+}
+#endif
+
+/** Left-hand-side symbol for rule #YYRULE.  */
+static inline yysymbol_kind_t
+yylhsNonterm (yyRuleNum yyrule)
+{
+  return YY_CAST (yysymbol_kind_t, yyr1[yyrule]);
+}
+
+#if CYPHER_YYDEBUG
+
+# ifndef YYFPRINTF
+#  define YYFPRINTF fprintf
+# endif
+
+# define YY_FPRINTF                             \
+  YY_IGNORE_USELESS_CAST_BEGIN YY_FPRINTF_
+
+# define YY_FPRINTF_(Args)                      \
+  do {                                          \
+    YYFPRINTF Args;                             \
+    YY_IGNORE_USELESS_CAST_END                  \
+  } while (0)
+
+# define YY_DPRINTF                             \
+  YY_IGNORE_USELESS_CAST_BEGIN YY_DPRINTF_
+
+# define YY_DPRINTF_(Args)                      \
+  do {                                          \
+    if (yydebug)                                \
+      YYFPRINTF Args;                           \
+    YY_IGNORE_USELESS_CAST_END                  \
+  } while (0)
+
+
+/* YYLOCATION_PRINT -- Print the location on the stream.
+   This macro was not mandated originally: define only if we know
+   we won't break user code: when these are the locations we know.  */
+
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined CYPHER_YYLTYPE_IS_TRIVIAL && CYPHER_YYLTYPE_IS_TRIVIAL
+
+/* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
+
+YY_ATTRIBUTE_UNUSED
+static int
+yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
+{
+  int res = 0;
+  int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
+  if (0 <= yylocp->first_line)
+    {
+      res += YYFPRINTF (yyo, "%d", yylocp->first_line);
+      if (0 <= yylocp->first_column)
+        res += YYFPRINTF (yyo, ".%d", yylocp->first_column);
+    }
+  if (0 <= yylocp->last_line)
+    {
+      if (yylocp->first_line < yylocp->last_line)
+        {
+          res += YYFPRINTF (yyo, "-%d", yylocp->last_line);
+          if (0 <= end_col)
+            res += YYFPRINTF (yyo, ".%d", end_col);
+        }
+      else if (0 <= end_col && yylocp->first_column < end_col)
+        res += YYFPRINTF (yyo, "-%d", end_col);
+    }
+  return res;
+}
+
+#   define YYLOCATION_PRINT  yy_location_print_
+
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
+
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
+
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, cypher_parser_context *context)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
+  YY_USE (context);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, cypher_parser_context *context)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp, context);
+  YYFPRINTF (yyo, ")");
+}
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                  \
+  do {                                                                  \
+    if (yydebug)                                                        \
+      {                                                                 \
+        YY_FPRINTF ((stderr, "%s ", Title));                            \
+        yy_symbol_print (stderr, Kind, Value, Location, context);        \
+        YY_FPRINTF ((stderr, "\n"));                                    \
+      }                                                                 \
+  } while (0)
+
+static inline void
+yy_reduce_print (yybool yynormal, yyGLRStackItem* yyvsp, YYPTRDIFF_T yyk,
+                 yyRuleNum yyrule, cypher_parser_context *context);
+
+# define YY_REDUCE_PRINT(Args)          \
+  do {                                  \
+    if (yydebug)                        \
+      yy_reduce_print Args;             \
+  } while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+
+static void yypstack (yyGLRStack* yystackp, YYPTRDIFF_T yyk)
+  YY_ATTRIBUTE_UNUSED;
+static void yypdumpstack (yyGLRStack* yystackp)
+  YY_ATTRIBUTE_UNUSED;
+
+#else /* !CYPHER_YYDEBUG */
+
+# define YY_DPRINTF(Args) do {} while (yyfalse)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_REDUCE_PRINT(Args)
+
+#endif /* !CYPHER_YYDEBUG */
+
+#ifndef yystrlen
+# define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+#endif
+
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
+/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
+   YYDEST.  */
+static char *
+yystpcpy (char *yydest, const char *yysrc)
+{
+  char *yyd = yydest;
+  const char *yys = yysrc;
+
+  while ((*yyd++ = *yys++) != '\0')
+    continue;
+
+  return yyd - 1;
+}
+# endif
+#endif
+
+
+
+/** Fill in YYVSP[YYLOW1 .. YYLOW0-1] from the chain of states starting
+ *  at YYVSP[YYLOW0].yystate.yypred.  Leaves YYVSP[YYLOW1].yystate.yypred
+ *  containing the pointer to the next state in the chain.  */
+static void yyfillin (yyGLRStackItem *, int, int) YY_ATTRIBUTE_UNUSED;
+static void
+yyfillin (yyGLRStackItem *yyvsp, int yylow0, int yylow1)
+{
+  int i;
+  yyGLRState *s = yyvsp[yylow0].yystate.yypred;
+  for (i = yylow0-1; i >= yylow1; i -= 1)
+    {
+#if CYPHER_YYDEBUG
+      yyvsp[i].yystate.yylrState = s->yylrState;
+#endif
+      yyvsp[i].yystate.yyresolved = s->yyresolved;
+      if (s->yyresolved)
+        yyvsp[i].yystate.yysemantics.yyval = s->yysemantics.yyval;
+      else
+        /* The effect of using yyval or yyloc (in an immediate rule) is
+         * undefined.  */
+        yyvsp[i].yystate.yysemantics.yyfirstVal = YY_NULLPTR;
+      yyvsp[i].yystate.yyloc = s->yyloc;
+      s = yyvsp[i].yystate.yypred = s->yypred;
+    }
+}
+
+
+/** If yychar is empty, fetch the next token.  */
+static inline yysymbol_kind_t
+yygetToken (int *yycharp, yyGLRStack* yystackp, cypher_parser_context *context)
+{
+  yysymbol_kind_t yytoken;
+  YY_USE (context);
+  if (*yycharp == CYPHER_CYPHER_YYEMPTY)
+    {
+      YY_DPRINTF ((stderr, "Reading a token\n"));
+      *yycharp = yylex (&yylval, &yylloc, context);
+    }
+  if (*yycharp <= CYPHER_YYEOF)
+    {
+      *yycharp = CYPHER_YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YY_DPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (*yycharp);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+  return yytoken;
+}
+
+/* Do nothing if YYNORMAL or if *YYLOW <= YYLOW1.  Otherwise, fill in
+ * YYVSP[YYLOW1 .. *YYLOW-1] as in yyfillin and set *YYLOW = YYLOW1.
+ * For convenience, always return YYLOW1.  */
+static inline int yyfill (yyGLRStackItem *, int *, int, yybool)
+     YY_ATTRIBUTE_UNUSED;
+static inline int
+yyfill (yyGLRStackItem *yyvsp, int *yylow, int yylow1, yybool yynormal)
+{
+  if (!yynormal && yylow1 < *yylow)
+    {
+      yyfillin (yyvsp, *yylow, yylow1);
+      *yylow = yylow1;
+    }
+  return yylow1;
+}
+
+/** Perform user action for rule number YYN, with RHS length YYRHSLEN,
+ *  and top stack item YYVSP.  YYLVALP points to place to put semantic
+ *  value ($$), and yylocp points to place for location information
+ *  (@$).  Returns yyok for normal return, yyaccept for YYACCEPT,
+ *  yyerr for YYERROR, yyabort for YYABORT, yynomem for YYNOMEM.  */
+static YYRESULTTAG
+yyuserAction (yyRuleNum yyrule, int yyrhslen, yyGLRStackItem* yyvsp,
+              yyGLRStack* yystackp, YYPTRDIFF_T yyk,
+              YYSTYPE* yyvalp, YYLTYPE *yylocp, cypher_parser_context *context)
+{
+  const yybool yynormal YY_ATTRIBUTE_UNUSED = yystackp->yysplitPoint == YY_NULLPTR;
+  int yylow = 1;
+  YY_USE (yyvalp);
+  YY_USE (yylocp);
+  YY_USE (context);
+  YY_USE (yyk);
+  YY_USE (yyrhslen);
+# undef yyerrok
+# define yyerrok (yystackp->yyerrState = 0)
+# undef YYACCEPT
+# define YYACCEPT return yyaccept
+# undef YYABORT
+# define YYABORT return yyabort
+# undef YYNOMEM
+# define YYNOMEM return yynomem
+# undef YYERROR
+# define YYERROR return yyerrok, yyerr
+# undef YYRECOVERING
+# define YYRECOVERING() (yystackp->yyerrState != 0)
+# undef yyclearin
+# define yyclearin (yychar = CYPHER_CYPHER_YYEMPTY)
+# undef YYFILL
+# define YYFILL(N) yyfill (yyvsp, &yylow, (N), yynormal)
+# undef YYBACKUP
+# define YYBACKUP(Token, Value)                                              \
+  return yyerror (yylocp, context, YY_("syntax error: cannot back up")),     \
+         yyerrok, yyerr
+
+  if (yyrhslen == 0)
+    *yyvalp = yyval_default;
+  else
+    *yyvalp = yyvsp[YYFILL (1-yyrhslen)].yystate.yysemantics.yyval;
+  /* Default location. */
+  YYLLOC_DEFAULT ((*yylocp), (yyvsp - yyrhslen), yyrhslen);
+  yystackp->yyerror_range[1].yystate.yyloc = *yylocp;
+  /* If yyk == -1, we are running a deferred action on a temporary
+     stack.  In that case, YY_REDUCE_PRINT must not play with YYFILL,
+     so pretend the stack is "normal". */
+  YY_REDUCE_PRINT ((yynormal || yyk == -1, yyvsp, yyk, yyrule, context));
+  switch (yyrule)
+    {
+  case 2: /* stmt: union_query  */
+#line 161 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node);
+            context->result = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node);
+        }
+#line 2296 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 3: /* stmt: union_query ';'  */
+#line 166 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node);
+            context->result = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node);
+        }
+#line 2305 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 4: /* stmt: EXPLAIN union_query  */
+#line 171 "src/backend/parser/cypher_gram.y"
+        {
+            /* For EXPLAIN with UNION, wrap if needed */
+            if ((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)->type == AST_NODE_QUERY) {
+                ((cypher_query*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node))->explain = true;
+            }
+            ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node);
+            context->result = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node);
+        }
+#line 2318 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 5: /* stmt: EXPLAIN union_query ';'  */
+#line 180 "src/backend/parser/cypher_gram.y"
+        {
+            if ((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node)->type == AST_NODE_QUERY) {
+                ((cypher_query*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node))->explain = true;
+            }
+            ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node);
+            context->result = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node);
+        }
+#line 2330 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 6: /* union_query: single_query  */
+#line 191 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node);
+        }
+#line 2338 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 7: /* union_query: union_query UNION single_query  */
+#line 195 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_cypher_union((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), false, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line);
+        }
+#line 2346 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 8: /* union_query: union_query UNION ALL single_query  */
+#line 199 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_cypher_union((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), true, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+        }
+#line 2354 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 9: /* single_query: clause_list  */
+#line 206 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_cypher_query((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list), false);
+        }
+#line 2362 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 10: /* clause_list: clause  */
+#line 213 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            ast_list_append(((*yyvalp).list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+        }
+#line 2371 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 11: /* clause_list: clause_list clause  */
+#line 218 "src/backend/parser/cypher_gram.y"
+        {
+            ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list);
+        }
+#line 2380 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 12: /* clause: match_clause  */
+#line 225 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.match); }
+#line 2386 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 13: /* clause: return_clause  */
+#line 226 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.return_clause); }
+#line 2392 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 14: /* clause: with_clause  */
+#line 227 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.with_clause); }
+#line 2398 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 15: /* clause: unwind_clause  */
+#line 228 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 2404 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 16: /* clause: foreach_clause  */
+#line 229 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 2410 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 17: /* clause: load_csv_clause  */
+#line 230 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 2416 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 18: /* clause: create_clause  */
+#line 231 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.create); }
+#line 2422 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 19: /* clause: merge_clause  */
+#line 232 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.merge); }
+#line 2428 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 20: /* clause: set_clause  */
+#line 233 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.set); }
+#line 2434 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 21: /* clause: delete_clause  */
+#line 234 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.delete); }
+#line 2440 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 22: /* clause: remove_clause  */
+#line 235 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.remove); }
+#line 2446 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 23: /* match_clause: optional_opt MATCH pattern_list from_graph_opt where_opt  */
+#line 241 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).match) = make_cypher_match((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.boolean), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.string));
+        }
+#line 2454 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 24: /* from_graph_opt: %empty  */
+#line 247 "src/backend/parser/cypher_gram.y"
+                    { ((*yyvalp).string) = NULL; }
+#line 2460 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 25: /* from_graph_opt: FROM IDENTIFIER  */
+#line 249 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).string) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string);
+        }
+#line 2468 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 26: /* optional_opt: %empty  */
+#line 255 "src/backend/parser/cypher_gram.y"
+                    { ((*yyvalp).boolean) = false; }
+#line 2474 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 27: /* optional_opt: OPTIONAL  */
+#line 256 "src/backend/parser/cypher_gram.y"
+                    { ((*yyvalp).boolean) = true; }
+#line 2480 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 28: /* return_clause: RETURN distinct_opt return_item_list order_by_opt skip_opt limit_opt  */
+#line 262 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).return_clause) = make_cypher_return((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.boolean), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+        }
+#line 2488 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 29: /* with_clause: WITH distinct_opt return_item_list order_by_opt skip_opt limit_opt where_opt  */
+#line 270 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).with_clause) = make_cypher_with((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.boolean), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+        }
+#line 2496 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 30: /* unwind_clause: UNWIND expr AS IDENTIFIER  */
+#line 278 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_cypher_unwind((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 2505 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 31: /* foreach_clause: FOREACH '(' IDENTIFIER IN expr '|' foreach_update_list ')'  */
+#line 287 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_cypher_foreach((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-7)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string));
+        }
+#line 2514 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 32: /* load_csv_clause: LOAD CSV FROM STRING AS IDENTIFIER  */
+#line 296 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_cypher_load_csv((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), false, NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 2524 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 33: /* load_csv_clause: LOAD CSV WITH HEADERS FROM STRING AS IDENTIFIER  */
+#line 302 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_cypher_load_csv((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), true, NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-7)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 2534 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 34: /* load_csv_clause: LOAD CSV FROM STRING AS IDENTIFIER FIELDTERMINATOR STRING  */
+#line 308 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_cypher_load_csv((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), false, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-7)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 2545 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 35: /* load_csv_clause: LOAD CSV WITH HEADERS FROM STRING AS IDENTIFIER FIELDTERMINATOR STRING  */
+#line 315 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_cypher_load_csv((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), true, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-9)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 2556 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 36: /* foreach_update_list: create_clause  */
+#line 326 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            ast_list_append(((*yyvalp).list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.create));
+        }
+#line 2565 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 37: /* foreach_update_list: set_clause  */
+#line 331 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            ast_list_append(((*yyvalp).list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.set));
+        }
+#line 2574 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 38: /* foreach_update_list: delete_clause  */
+#line 336 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            ast_list_append(((*yyvalp).list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.delete));
+        }
+#line 2583 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 39: /* foreach_update_list: merge_clause  */
+#line 341 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            ast_list_append(((*yyvalp).list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.merge));
+        }
+#line 2592 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 40: /* foreach_update_list: remove_clause  */
+#line 346 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            ast_list_append(((*yyvalp).list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.remove));
+        }
+#line 2601 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 41: /* foreach_update_list: foreach_clause  */
+#line 351 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            ast_list_append(((*yyvalp).list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+        }
+#line 2610 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 42: /* foreach_update_list: foreach_update_list create_clause  */
+#line 356 "src/backend/parser/cypher_gram.y"
+        {
+            ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.create));
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list);
+        }
+#line 2619 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 43: /* foreach_update_list: foreach_update_list set_clause  */
+#line 361 "src/backend/parser/cypher_gram.y"
+        {
+            ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.set));
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list);
+        }
+#line 2628 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 44: /* foreach_update_list: foreach_update_list delete_clause  */
+#line 366 "src/backend/parser/cypher_gram.y"
+        {
+            ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.delete));
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list);
+        }
+#line 2637 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 45: /* foreach_update_list: foreach_update_list merge_clause  */
+#line 371 "src/backend/parser/cypher_gram.y"
+        {
+            ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.merge));
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list);
+        }
+#line 2646 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 46: /* foreach_update_list: foreach_update_list remove_clause  */
+#line 376 "src/backend/parser/cypher_gram.y"
+        {
+            ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.remove));
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list);
+        }
+#line 2655 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 47: /* foreach_update_list: foreach_update_list foreach_clause  */
+#line 381 "src/backend/parser/cypher_gram.y"
+        {
+            ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list);
+        }
+#line 2664 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 48: /* distinct_opt: %empty  */
+#line 388 "src/backend/parser/cypher_gram.y"
+                    { ((*yyvalp).boolean) = false; }
+#line 2670 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 49: /* distinct_opt: DISTINCT  */
+#line 389 "src/backend/parser/cypher_gram.y"
+                    { ((*yyvalp).boolean) = true; }
+#line 2676 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 50: /* order_by_opt: %empty  */
+#line 393 "src/backend/parser/cypher_gram.y"
+                    { ((*yyvalp).list) = NULL; }
+#line 2682 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 51: /* order_by_opt: ORDER BY order_by_list  */
+#line 394 "src/backend/parser/cypher_gram.y"
+                             { ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list); }
+#line 2688 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 52: /* skip_opt: %empty  */
+#line 398 "src/backend/parser/cypher_gram.y"
+                    { ((*yyvalp).node) = NULL; }
+#line 2694 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 53: /* skip_opt: SKIP expr  */
+#line 399 "src/backend/parser/cypher_gram.y"
+                    { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 2700 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 54: /* limit_opt: %empty  */
+#line 403 "src/backend/parser/cypher_gram.y"
+                    { ((*yyvalp).node) = NULL; }
+#line 2706 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 55: /* limit_opt: LIMIT expr  */
+#line 404 "src/backend/parser/cypher_gram.y"
+                    { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 2712 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 56: /* where_opt: %empty  */
+#line 408 "src/backend/parser/cypher_gram.y"
+                    { ((*yyvalp).node) = NULL; }
+#line 2718 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 57: /* where_opt: WHERE expr  */
+#line 409 "src/backend/parser/cypher_gram.y"
+                    { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 2724 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 58: /* order_by_list: order_by_item  */
+#line 414 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            ast_list_append(((*yyvalp).list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.order_by_item));
+        }
+#line 2733 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 59: /* order_by_list: order_by_list ',' order_by_item  */
+#line 419 "src/backend/parser/cypher_gram.y"
+        {
+            ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.order_by_item));
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list);
+        }
+#line 2742 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 60: /* order_by_item: expr  */
+#line 426 "src/backend/parser/cypher_gram.y"
+                    { ((*yyvalp).order_by_item) = make_order_by_item((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), false); /* Default is ASC */ }
+#line 2748 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 61: /* order_by_item: expr ASC  */
+#line 427 "src/backend/parser/cypher_gram.y"
+                    { ((*yyvalp).order_by_item) = make_order_by_item((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), false); }
+#line 2754 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 62: /* order_by_item: expr DESC  */
+#line 428 "src/backend/parser/cypher_gram.y"
+                    { ((*yyvalp).order_by_item) = make_order_by_item((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), true); }
+#line 2760 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 63: /* return_item_list: return_item  */
+#line 434 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            ast_list_append(((*yyvalp).list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.return_item));
+        }
+#line 2769 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 64: /* return_item_list: return_item_list ',' return_item  */
+#line 439 "src/backend/parser/cypher_gram.y"
+        {
+            ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.return_item));
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list);
+        }
+#line 2778 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 65: /* return_item: expr  */
+#line 447 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).return_item) = make_return_item((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), NULL);
+        }
+#line 2786 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 66: /* return_item: expr AS IDENTIFIER  */
+#line 451 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).return_item) = make_return_item((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 2795 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 67: /* set_item_list: set_item  */
+#line 459 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            ast_list_append(((*yyvalp).list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.set_item));
+        }
+#line 2804 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 68: /* set_item_list: set_item_list ',' set_item  */
+#line 464 "src/backend/parser/cypher_gram.y"
+        {
+            ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.set_item));
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list);
+        }
+#line 2813 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 69: /* set_item: expr '=' expr  */
+#line 472 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).set_item) = make_cypher_set_item((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+        }
+#line 2821 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 70: /* set_item: IDENTIFIER ':' IDENTIFIER  */
+#line 476 "src/backend/parser/cypher_gram.y"
+        {
+            /* SET n:Label syntax */
+            cypher_identifier *var = make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+            cypher_label_expr *label = make_label_expr((ast_node*)var, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ((*yyvalp).set_item) = make_cypher_set_item((ast_node*)label, NULL);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 2834 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 71: /* create_clause: CREATE pattern_list  */
+#line 489 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).create) = make_cypher_create((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list));
+        }
+#line 2842 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 72: /* merge_clause: MERGE pattern_list  */
+#line 497 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).merge) = make_cypher_merge((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list), NULL, NULL);
+        }
+#line 2850 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 73: /* merge_clause: MERGE pattern_list on_create_clause  */
+#line 501 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).merge) = make_cypher_merge((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list), NULL);
+        }
+#line 2858 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 74: /* merge_clause: MERGE pattern_list on_match_clause  */
+#line 505 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).merge) = make_cypher_merge((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list));
+        }
+#line 2866 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 75: /* merge_clause: MERGE pattern_list on_create_clause on_match_clause  */
+#line 509 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).merge) = make_cypher_merge((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list));
+        }
+#line 2874 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 76: /* merge_clause: MERGE pattern_list on_match_clause on_create_clause  */
+#line 513 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).merge) = make_cypher_merge((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list));
+        }
+#line 2882 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 77: /* on_create_clause: ON CREATE SET set_item_list  */
+#line 520 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list);
+        }
+#line 2890 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 78: /* on_match_clause: ON MATCH SET set_item_list  */
+#line 527 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list);
+        }
+#line 2898 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 79: /* set_clause: SET set_item_list  */
+#line 535 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).set) = make_cypher_set((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list));
+        }
+#line 2906 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 80: /* delete_clause: detach_opt DELETE delete_item_list  */
+#line 543 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).delete) = make_cypher_delete((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.boolean));
+        }
+#line 2914 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 81: /* delete_item_list: delete_item  */
+#line 550 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            ast_list_append(((*yyvalp).list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.delete_item));
+        }
+#line 2923 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 82: /* delete_item_list: delete_item_list ',' delete_item  */
+#line 555 "src/backend/parser/cypher_gram.y"
+        {
+            ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.delete_item));
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list);
+        }
+#line 2932 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 83: /* delete_item: IDENTIFIER  */
+#line 563 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).delete_item) = make_delete_item((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 2941 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 84: /* remove_clause: REMOVE remove_item_list  */
+#line 572 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).remove) = make_cypher_remove((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list));
+        }
+#line 2949 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 85: /* remove_item_list: remove_item  */
+#line 579 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            ast_list_append(((*yyvalp).list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.remove_item));
+        }
+#line 2958 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 86: /* remove_item_list: remove_item_list ',' remove_item  */
+#line 584 "src/backend/parser/cypher_gram.y"
+        {
+            ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.remove_item));
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list);
+        }
+#line 2967 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 87: /* remove_item: IDENTIFIER '.' IDENTIFIER  */
+#line 592 "src/backend/parser/cypher_gram.y"
+        {
+            /* REMOVE n.property - property access */
+            cypher_identifier *base = make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+            ast_node *prop = (ast_node*)make_property((ast_node*)base, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ((*yyvalp).remove_item) = make_remove_item(prop);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 2980 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 88: /* remove_item: IDENTIFIER '.' BQIDENT  */
+#line 601 "src/backend/parser/cypher_gram.y"
+        {
+            /* REMOVE n.`special-key` - backtick-quoted property */
+            cypher_identifier *base = make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+            ast_node *prop = (ast_node*)make_property((ast_node*)base, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ((*yyvalp).remove_item) = make_remove_item(prop);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 2993 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 89: /* remove_item: BQIDENT '.' IDENTIFIER  */
+#line 610 "src/backend/parser/cypher_gram.y"
+        {
+            /* REMOVE `special-var`.property */
+            cypher_identifier *base = make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+            ast_node *prop = (ast_node*)make_property((ast_node*)base, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ((*yyvalp).remove_item) = make_remove_item(prop);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3006 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 90: /* remove_item: BQIDENT '.' BQIDENT  */
+#line 619 "src/backend/parser/cypher_gram.y"
+        {
+            /* REMOVE `special-var`.`special-key` */
+            cypher_identifier *base = make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+            ast_node *prop = (ast_node*)make_property((ast_node*)base, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ((*yyvalp).remove_item) = make_remove_item(prop);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3019 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 91: /* remove_item: IDENTIFIER ':' IDENTIFIER  */
+#line 628 "src/backend/parser/cypher_gram.y"
+        {
+            /* REMOVE n:Label syntax */
+            cypher_identifier *var = make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+            cypher_label_expr *label = make_label_expr((ast_node*)var, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ((*yyvalp).remove_item) = make_remove_item((ast_node*)label);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3032 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 92: /* detach_opt: DETACH  */
+#line 640 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).boolean) = true;
+        }
+#line 3040 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 93: /* detach_opt: %empty  */
+#line 644 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).boolean) = false;
+        }
+#line 3048 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 94: /* pattern_list: path  */
+#line 652 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            ast_list_append(((*yyvalp).list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.path));
+        }
+#line 3057 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 95: /* pattern_list: pattern_list ',' path  */
+#line 657 "src/backend/parser/cypher_gram.y"
+        {
+            ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.path));
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list);
+        }
+#line 3066 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 96: /* simple_path: node_pattern  */
+#line 666 "src/backend/parser/cypher_gram.y"
+        {
+            ast_list *elements = ast_list_create();
+            ast_list_append(elements, (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node_pattern));
+            ((*yyvalp).path) = make_path(elements);
+        }
+#line 3076 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 97: /* simple_path: simple_path rel_pattern node_pattern  */
+#line 672 "src/backend/parser/cypher_gram.y"
+        {
+            /* Create a new list copying elements from the existing path */
+            ast_list *new_elements = ast_list_create();
+            for (int i = 0; i < (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.path)->elements->count; i++) {
+                ast_list_append(new_elements, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.path)->elements->items[i]);
+            }
+            ast_list_append(new_elements, (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.rel_pattern));
+            ast_list_append(new_elements, (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node_pattern));
+
+            /* Note: Let Bison handle memory cleanup of $1 automatically */
+            /* Manual freeing during parsing can cause parser state corruption */
+
+            ((*yyvalp).path) = make_path(new_elements);
+        }
+#line 3095 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 98: /* path: simple_path  */
+#line 691 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).path) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.path);
+        }
+#line 3103 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 99: /* path: IDENTIFIER '=' simple_path  */
+#line 695 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).path) = make_path_with_var((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.path)->elements);
+            /* Free the anonymous path structure, but keep its elements */
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.path));
+        }
+#line 3113 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 100: /* path: IDENTIFIER '=' SHORTESTPATH '(' simple_path ')'  */
+#line 701 "src/backend/parser/cypher_gram.y"
+        {
+            cypher_path *sp = make_shortest_path((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.path)->elements, PATH_TYPE_SHORTEST);
+            sp->var_name = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string);
+            ((*yyvalp).path) = sp;
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.path));
+        }
+#line 3124 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 101: /* path: SHORTESTPATH '(' simple_path ')'  */
+#line 708 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).path) = make_shortest_path((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.path)->elements, PATH_TYPE_SHORTEST);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.path));
+        }
+#line 3133 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 102: /* path: IDENTIFIER '=' ALLSHORTESTPATHS '(' simple_path ')'  */
+#line 713 "src/backend/parser/cypher_gram.y"
+        {
+            cypher_path *sp = make_shortest_path((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.path)->elements, PATH_TYPE_ALL_SHORTEST);
+            sp->var_name = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string);
+            ((*yyvalp).path) = sp;
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.path));
+        }
+#line 3144 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 103: /* path: ALLSHORTESTPATHS '(' simple_path ')'  */
+#line 720 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).path) = make_shortest_path((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.path)->elements, PATH_TYPE_ALL_SHORTEST);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.path));
+        }
+#line 3153 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 104: /* node_pattern: '(' variable_opt label_opt properties_opt ')'  */
+#line 728 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node_pattern) = make_node_pattern((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.map));
+        }
+#line 3161 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 105: /* rel_pattern: '-' '[' variable_opt varlen_range_opt properties_opt ']' '-' '>'  */
+#line 743 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).rel_pattern) = make_rel_pattern_varlen((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string), NULL, (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.map), false, true, (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.varlen_range));
+        }
+#line 3169 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 106: /* rel_pattern: '-' '[' variable_opt ':' IDENTIFIER varlen_range_opt properties_opt ']' '-' '>'  */
+#line 747 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).rel_pattern) = make_rel_pattern_varlen((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-7)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.map), false, true, (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.varlen_range));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string));
+        }
+#line 3178 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 107: /* rel_pattern: '-' '[' variable_opt ':' BQIDENT varlen_range_opt properties_opt ']' '-' '>'  */
+#line 752 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).rel_pattern) = make_rel_pattern_varlen((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-7)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.map), false, true, (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.varlen_range));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string));
+        }
+#line 3187 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 108: /* rel_pattern: '-' '[' variable_opt ':' rel_type_list varlen_range_opt properties_opt ']' '-' '>'  */
+#line 757 "src/backend/parser/cypher_gram.y"
+        {
+            cypher_rel_pattern *p = make_rel_pattern_multi_type((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-7)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.map), false, true);
+            if (p) p->varlen = (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.varlen_range);
+            ((*yyvalp).rel_pattern) = p;
+        }
+#line 3197 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 109: /* rel_pattern: '<' '-' '[' variable_opt varlen_range_opt properties_opt ']' '-'  */
+#line 764 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).rel_pattern) = make_rel_pattern_varlen((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.string), NULL, (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.map), true, false, (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.varlen_range));
+        }
+#line 3205 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 110: /* rel_pattern: '<' '-' '[' variable_opt ':' IDENTIFIER varlen_range_opt properties_opt ']' '-'  */
+#line 768 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).rel_pattern) = make_rel_pattern_varlen((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-6)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.string), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.map), true, false, (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.varlen_range));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.string));
+        }
+#line 3214 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 111: /* rel_pattern: '<' '-' '[' variable_opt ':' BQIDENT varlen_range_opt properties_opt ']' '-'  */
+#line 773 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).rel_pattern) = make_rel_pattern_varlen((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-6)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.string), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.map), true, false, (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.varlen_range));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.string));
+        }
+#line 3223 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 112: /* rel_pattern: '<' '-' '[' variable_opt ':' rel_type_list varlen_range_opt properties_opt ']' '-'  */
+#line 778 "src/backend/parser/cypher_gram.y"
+        {
+            cypher_rel_pattern *p = make_rel_pattern_multi_type((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-6)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.map), true, false);
+            if (p) p->varlen = (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.varlen_range);
+            ((*yyvalp).rel_pattern) = p;
+        }
+#line 3233 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 113: /* rel_pattern: '-' '[' variable_opt varlen_range_opt properties_opt ']' '-'  */
+#line 785 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).rel_pattern) = make_rel_pattern_varlen((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.string), NULL, (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.map), false, false, (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.varlen_range));
+        }
+#line 3241 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 114: /* rel_pattern: '-' '[' variable_opt ':' IDENTIFIER varlen_range_opt properties_opt ']' '-'  */
+#line 789 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).rel_pattern) = make_rel_pattern_varlen((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-6)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.string), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.map), false, false, (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.varlen_range));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.string));
+        }
+#line 3250 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 115: /* rel_pattern: '-' '[' variable_opt ':' BQIDENT varlen_range_opt properties_opt ']' '-'  */
+#line 794 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).rel_pattern) = make_rel_pattern_varlen((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-6)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.string), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.map), false, false, (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.varlen_range));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.string));
+        }
+#line 3259 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 116: /* rel_pattern: '-' '[' variable_opt ':' rel_type_list varlen_range_opt properties_opt ']' '-'  */
+#line 799 "src/backend/parser/cypher_gram.y"
+        {
+            cypher_rel_pattern *p = make_rel_pattern_multi_type((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-6)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.map), false, false);
+            if (p) p->varlen = (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.varlen_range);
+            ((*yyvalp).rel_pattern) = p;
+        }
+#line 3269 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 117: /* variable_opt: %empty  */
+#line 807 "src/backend/parser/cypher_gram.y"
+                    { ((*yyvalp).string) = NULL; }
+#line 3275 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 118: /* variable_opt: IDENTIFIER  */
+#line 808 "src/backend/parser/cypher_gram.y"
+                    { ((*yyvalp).string) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string); }
+#line 3281 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 119: /* variable_opt: BQIDENT  */
+#line 809 "src/backend/parser/cypher_gram.y"
+                    { ((*yyvalp).string) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string); }
+#line 3287 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 120: /* variable_opt: END_P  */
+#line 810 "src/backend/parser/cypher_gram.y"
+                    { ((*yyvalp).string) = strdup("end"); }
+#line 3293 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 121: /* varlen_range_opt: %empty  */
+#line 816 "src/backend/parser/cypher_gram.y"
+        { ((*yyvalp).varlen_range) = NULL; }
+#line 3299 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 122: /* varlen_range_opt: '*'  */
+#line 818 "src/backend/parser/cypher_gram.y"
+        { ((*yyvalp).varlen_range) = make_varlen_range(1, -1); }
+#line 3305 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 123: /* varlen_range_opt: '*' INTEGER  */
+#line 820 "src/backend/parser/cypher_gram.y"
+        { ((*yyvalp).varlen_range) = make_varlen_range((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.integer), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.integer)); }
+#line 3311 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 124: /* varlen_range_opt: '*' INTEGER DOT_DOT INTEGER  */
+#line 822 "src/backend/parser/cypher_gram.y"
+        { ((*yyvalp).varlen_range) = make_varlen_range((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.integer), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.integer)); }
+#line 3317 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 125: /* varlen_range_opt: '*' INTEGER DOT_DOT  */
+#line 824 "src/backend/parser/cypher_gram.y"
+        { ((*yyvalp).varlen_range) = make_varlen_range((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.integer), -1); }
+#line 3323 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 126: /* varlen_range_opt: '*' DOT_DOT INTEGER  */
+#line 826 "src/backend/parser/cypher_gram.y"
+        { ((*yyvalp).varlen_range) = make_varlen_range(1, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.integer)); }
+#line 3329 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 127: /* label_opt: %empty  */
+#line 830 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).list) = NULL; }
+#line 3335 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 128: /* label_opt: label_list  */
+#line 831 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list); }
+#line 3341 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 129: /* label_list: ':' IDENTIFIER  */
+#line 837 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            cypher_literal *label = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ast_list_append(((*yyvalp).list), (ast_node*)label);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3352 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 130: /* label_list: ':' BQIDENT  */
+#line 844 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            cypher_literal *label = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ast_list_append(((*yyvalp).list), (ast_node*)label);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3363 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 131: /* label_list: label_list ':' IDENTIFIER  */
+#line 851 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list);
+            cypher_literal *label = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ast_list_append(((*yyvalp).list), (ast_node*)label);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3374 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 132: /* label_list: label_list ':' BQIDENT  */
+#line 858 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list);
+            cypher_literal *label = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ast_list_append(((*yyvalp).list), (ast_node*)label);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3385 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 133: /* rel_type_list: IDENTIFIER '|' IDENTIFIER  */
+#line 868 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            cypher_literal *type_lit1 = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+            cypher_literal *type_lit3 = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ast_list_append(((*yyvalp).list), (ast_node*)type_lit1);
+            ast_list_append(((*yyvalp).list), (ast_node*)type_lit3);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3399 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 134: /* rel_type_list: IDENTIFIER '|' ':' IDENTIFIER  */
+#line 878 "src/backend/parser/cypher_gram.y"
+        {
+            /* Support [:TYPE1|:TYPE2] syntax with colon before second type */
+            ((*yyvalp).list) = ast_list_create();
+            cypher_literal *type_lit1 = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yyloc).first_line);
+            cypher_literal *type_lit4 = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ast_list_append(((*yyvalp).list), (ast_node*)type_lit1);
+            ast_list_append(((*yyvalp).list), (ast_node*)type_lit4);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3414 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 135: /* rel_type_list: IDENTIFIER '|' BQIDENT  */
+#line 889 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            cypher_literal *type_lit1 = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+            cypher_literal *type_lit3 = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ast_list_append(((*yyvalp).list), (ast_node*)type_lit1);
+            ast_list_append(((*yyvalp).list), (ast_node*)type_lit3);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3428 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 136: /* rel_type_list: IDENTIFIER '|' ':' BQIDENT  */
+#line 899 "src/backend/parser/cypher_gram.y"
+        {
+            /* Support [:TYPE1|:`backtick-type`] syntax */
+            ((*yyvalp).list) = ast_list_create();
+            cypher_literal *type_lit1 = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yyloc).first_line);
+            cypher_literal *type_lit4 = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ast_list_append(((*yyvalp).list), (ast_node*)type_lit1);
+            ast_list_append(((*yyvalp).list), (ast_node*)type_lit4);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3443 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 137: /* rel_type_list: BQIDENT '|' IDENTIFIER  */
+#line 910 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            cypher_literal *type_lit1 = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+            cypher_literal *type_lit3 = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ast_list_append(((*yyvalp).list), (ast_node*)type_lit1);
+            ast_list_append(((*yyvalp).list), (ast_node*)type_lit3);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3457 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 138: /* rel_type_list: BQIDENT '|' ':' IDENTIFIER  */
+#line 920 "src/backend/parser/cypher_gram.y"
+        {
+            /* Support [:`backtick-type`|:TYPE2] syntax */
+            ((*yyvalp).list) = ast_list_create();
+            cypher_literal *type_lit1 = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yyloc).first_line);
+            cypher_literal *type_lit4 = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ast_list_append(((*yyvalp).list), (ast_node*)type_lit1);
+            ast_list_append(((*yyvalp).list), (ast_node*)type_lit4);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3472 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 139: /* rel_type_list: BQIDENT '|' BQIDENT  */
+#line 931 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            cypher_literal *type_lit1 = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+            cypher_literal *type_lit3 = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ast_list_append(((*yyvalp).list), (ast_node*)type_lit1);
+            ast_list_append(((*yyvalp).list), (ast_node*)type_lit3);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3486 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 140: /* rel_type_list: BQIDENT '|' ':' BQIDENT  */
+#line 941 "src/backend/parser/cypher_gram.y"
+        {
+            /* Support [:`backtick-type`|:`backtick-type2`] syntax */
+            ((*yyvalp).list) = ast_list_create();
+            cypher_literal *type_lit1 = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yyloc).first_line);
+            cypher_literal *type_lit4 = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ast_list_append(((*yyvalp).list), (ast_node*)type_lit1);
+            ast_list_append(((*yyvalp).list), (ast_node*)type_lit4);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3501 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 141: /* rel_type_list: rel_type_list '|' IDENTIFIER  */
+#line 952 "src/backend/parser/cypher_gram.y"
+        {
+            cypher_literal *type_lit = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (ast_node*)type_lit);
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3512 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 142: /* rel_type_list: rel_type_list '|' BQIDENT  */
+#line 959 "src/backend/parser/cypher_gram.y"
+        {
+            cypher_literal *type_lit = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (ast_node*)type_lit);
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3523 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 143: /* rel_type_list: rel_type_list '|' ':' IDENTIFIER  */
+#line 966 "src/backend/parser/cypher_gram.y"
+        {
+            cypher_literal *type_lit = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.list), (ast_node*)type_lit);
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.list);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3534 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 144: /* rel_type_list: rel_type_list '|' ':' BQIDENT  */
+#line 973 "src/backend/parser/cypher_gram.y"
+        {
+            cypher_literal *type_lit = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.list), (ast_node*)type_lit);
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.list);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3545 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 145: /* expr: primary_expr  */
+#line 983 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3551 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 146: /* expr: '+' expr  */
+#line 984 "src/backend/parser/cypher_gram.y"
+                                 { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3557 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 147: /* expr: '-' expr  */
+#line 985 "src/backend/parser/cypher_gram.y"
+                                  { 
+        /* Handle unary minus */
+        if ((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)->type == AST_NODE_LITERAL) {
+            cypher_literal *lit = (cypher_literal*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node);
+            if (lit->literal_type == LITERAL_INTEGER) {
+                lit->value.integer = -lit->value.integer;
+                ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node);
+            } else if (lit->literal_type == LITERAL_DECIMAL) {
+                lit->value.decimal = -lit->value.decimal;
+                ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node);
+            } else {
+                /* For other types, we'd need a unary minus node */
+                ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node);
+            }
+        } else {
+            /* For non-literals, we'd need a unary minus expression node */
+            ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node);
+        }
+    }
+#line 3581 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 148: /* expr: expr '+' expr  */
+#line 1004 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)make_binary_op(BINARY_OP_ADD, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line); }
+#line 3587 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 149: /* expr: expr '-' expr  */
+#line 1005 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)make_binary_op(BINARY_OP_SUB, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line); }
+#line 3593 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 150: /* expr: expr '*' expr  */
+#line 1006 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)make_binary_op(BINARY_OP_MUL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line); }
+#line 3599 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 151: /* expr: expr '/' expr  */
+#line 1007 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)make_binary_op(BINARY_OP_DIV, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line); }
+#line 3605 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 152: /* expr: expr '%' expr  */
+#line 1008 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)make_binary_op(BINARY_OP_MOD, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line); }
+#line 3611 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 153: /* expr: expr '=' expr  */
+#line 1009 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)make_binary_op(BINARY_OP_EQ, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line); }
+#line 3617 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 154: /* expr: expr NOT_EQ expr  */
+#line 1010 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)make_binary_op(BINARY_OP_NEQ, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line); }
+#line 3623 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 155: /* expr: expr '<' expr  */
+#line 1011 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)make_binary_op(BINARY_OP_LT, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line); }
+#line 3629 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 156: /* expr: expr '>' expr  */
+#line 1012 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)make_binary_op(BINARY_OP_GT, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line); }
+#line 3635 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 157: /* expr: expr LT_EQ expr  */
+#line 1013 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)make_binary_op(BINARY_OP_LTE, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line); }
+#line 3641 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 158: /* expr: expr GT_EQ expr  */
+#line 1014 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)make_binary_op(BINARY_OP_GTE, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line); }
+#line 3647 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 159: /* expr: expr REGEX_MATCH expr  */
+#line 1015 "src/backend/parser/cypher_gram.y"
+                            { ((*yyvalp).node) = (ast_node*)make_binary_op(BINARY_OP_REGEX_MATCH, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line); }
+#line 3653 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 160: /* expr: expr AND expr  */
+#line 1016 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)make_binary_op(BINARY_OP_AND, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line); }
+#line 3659 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 161: /* expr: expr OR expr  */
+#line 1017 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)make_binary_op(BINARY_OP_OR, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line); }
+#line 3665 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 162: /* expr: expr XOR expr  */
+#line 1018 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)make_binary_op(BINARY_OP_XOR, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line); }
+#line 3671 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 163: /* expr: expr IN expr  */
+#line 1019 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)make_binary_op(BINARY_OP_IN, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line); }
+#line 3677 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 164: /* expr: expr STARTS WITH expr  */
+#line 1020 "src/backend/parser/cypher_gram.y"
+                                         { ((*yyvalp).node) = (ast_node*)make_binary_op(BINARY_OP_STARTS_WITH, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line); }
+#line 3683 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 165: /* expr: expr ENDS WITH expr  */
+#line 1021 "src/backend/parser/cypher_gram.y"
+                                        { ((*yyvalp).node) = (ast_node*)make_binary_op(BINARY_OP_ENDS_WITH, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line); }
+#line 3689 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 166: /* expr: expr CONTAINS expr  */
+#line 1022 "src/backend/parser/cypher_gram.y"
+                                        { ((*yyvalp).node) = (ast_node*)make_binary_op(BINARY_OP_CONTAINS, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line); }
+#line 3695 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 167: /* expr: NOT expr  */
+#line 1023 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)make_not_expr((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line); }
+#line 3701 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 168: /* expr: expr IS NULL_P  */
+#line 1024 "src/backend/parser/cypher_gram.y"
+                          { ((*yyvalp).node) = (ast_node*)make_null_check((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), false, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line); }
+#line 3707 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 169: /* expr: expr IS NOT NULL_P  */
+#line 1025 "src/backend/parser/cypher_gram.y"
+                          { ((*yyvalp).node) = (ast_node*)make_null_check((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.node), true, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line); }
+#line 3713 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 170: /* expr: '(' expr ')'  */
+#line 1026 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node); }
+#line 3719 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 171: /* expr: expr '.' IDENTIFIER  */
+#line 1028 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_property((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3728 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 172: /* expr: expr '.' BQIDENT  */
+#line 1033 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_property((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3737 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 173: /* expr: expr '[' expr ']'  */
+#line 1038 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_subscript((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+        }
+#line 3745 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 174: /* primary_expr: literal_expr  */
+#line 1044 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3751 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 175: /* primary_expr: identifier  */
+#line 1045 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.identifier); }
+#line 3757 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 176: /* primary_expr: parameter  */
+#line 1046 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.parameter); }
+#line 3763 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 177: /* primary_expr: function_call  */
+#line 1047 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3769 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 178: /* primary_expr: list_predicate  */
+#line 1048 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3775 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 179: /* primary_expr: reduce_expr  */
+#line 1049 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3781 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 180: /* primary_expr: list_literal  */
+#line 1050 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3787 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 181: /* primary_expr: list_comprehension  */
+#line 1051 "src/backend/parser/cypher_gram.y"
+                         { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3793 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 182: /* primary_expr: pattern_comprehension  */
+#line 1052 "src/backend/parser/cypher_gram.y"
+                            { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3799 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 183: /* primary_expr: map_literal  */
+#line 1053 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3805 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 184: /* primary_expr: map_projection  */
+#line 1054 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3811 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 185: /* primary_expr: case_expression  */
+#line 1055 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3817 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 186: /* primary_expr: IDENTIFIER ':' IDENTIFIER  */
+#line 1057 "src/backend/parser/cypher_gram.y"
+        {
+            cypher_identifier *base = make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+            ((*yyvalp).node) = (ast_node*)make_label_expr((ast_node*)base, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 3828 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 187: /* literal_expr: literal  */
+#line 1066 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).node) = (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.literal); }
+#line 3834 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 188: /* function_call: IDENTIFIER '(' ')'  */
+#line 1071 "src/backend/parser/cypher_gram.y"
+        {
+            /* Check if this is EXISTS function call */
+            if (strcasecmp((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), "exists") == 0) {
+                /* Empty EXISTS() - invalid */
+                free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string));
+                cypher_yyerror(&(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc), context, "EXISTS requires an argument");
+                YYERROR;
+            } else {
+                ast_list *args = ast_list_create();
+                ((*yyvalp).node) = (ast_node*)make_function_call((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), args, false, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+                free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string));
+            }
+        }
+#line 3852 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 189: /* function_call: IDENTIFIER '(' argument_list ')'  */
+#line 1086 "src/backend/parser/cypher_gram.y"
+        {
+            /* Check if this is EXISTS function call */
+            if (strcasecmp((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string), "exists") == 0) {
+                /* EXISTS with argument list - check first arg */
+                if ((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list)->count == 1 && (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list)->items[0] != NULL) {
+                    ast_node *arg = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list)->items[0];
+                    if (arg->type == AST_NODE_PROPERTY) {
+                        ((*yyvalp).node) = (ast_node*)make_exists_property_expr(arg, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yyloc).first_line);
+                        (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list)->items[0] = NULL;  /* Transfer ownership */
+                        ast_list_free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list));
+                    } else {
+                        ((*yyvalp).node) = (ast_node*)make_exists_pattern_expr((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yyloc).first_line);
+                    }
+                } else {
+                    cypher_yyerror(&(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yyloc), context, "EXISTS requires exactly one argument");
+                    ast_list_free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list));
+                    free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string));
+                    YYERROR;
+                }
+                free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string));
+            } else {
+                ((*yyvalp).node) = (ast_node*)make_function_call((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), false, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yyloc).first_line);
+                free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string));
+            }
+        }
+#line 3882 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 190: /* function_call: IDENTIFIER '(' DISTINCT expr ')'  */
+#line 1112 "src/backend/parser/cypher_gram.y"
+        {
+            ast_list *args = ast_list_create();
+            ast_list_append(args, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node));
+            ((*yyvalp).node) = (ast_node*)make_function_call((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.string), args, true, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.string));
+        }
+#line 3893 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 191: /* function_call: IDENTIFIER '(' '*' ')'  */
+#line 1119 "src/backend/parser/cypher_gram.y"
+        {
+            ast_list *args = ast_list_create();
+            /* For count(*), we'll use a special NULL argument to indicate * */
+            ast_list_append(args, NULL);
+            ((*yyvalp).node) = (ast_node*)make_function_call((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string), args, false, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string));
+        }
+#line 3905 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 192: /* function_call: EXISTS '(' pattern_list ')'  */
+#line 1127 "src/backend/parser/cypher_gram.y"
+        {
+            /* EXISTS((pattern)) - check for relationship/path existence */
+            ((*yyvalp).node) = (ast_node*)make_exists_pattern_expr((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yyloc).first_line);
+        }
+#line 3914 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 193: /* function_call: EXISTS '(' IDENTIFIER '.' IDENTIFIER ')'  */
+#line 1132 "src/backend/parser/cypher_gram.y"
+        {
+            /* EXISTS(n.property) - unambiguous property existence check */
+            ast_node *var = (ast_node*)make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yyloc).first_line);
+            ast_node *prop = (ast_node*)make_property(var, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yyloc).first_line);
+            ((*yyvalp).node) = (ast_node*)make_exists_property_expr(prop, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.string));
+        }
+#line 3927 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 194: /* function_call: CONTAINS '(' argument_list ')'  */
+#line 1142 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_function_call(strdup("contains"), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), false, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yyloc).first_line);
+        }
+#line 3935 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 195: /* function_call: STARTS '(' argument_list ')'  */
+#line 1146 "src/backend/parser/cypher_gram.y"
+        {
+            /* startsWith function uses STARTS keyword */
+            ((*yyvalp).node) = (ast_node*)make_function_call(strdup("startsWith"), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), false, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yyloc).first_line);
+        }
+#line 3944 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 196: /* function_call: ENDS '(' argument_list ')'  */
+#line 1151 "src/backend/parser/cypher_gram.y"
+        {
+            /* endsWith function uses ENDS keyword */
+            ((*yyvalp).node) = (ast_node*)make_function_call(strdup("endsWith"), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), false, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yyloc).first_line);
+        }
+#line 3953 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 197: /* list_predicate: ALL '(' IDENTIFIER IN expr WHERE expr ')'  */
+#line 1160 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_list_predicate(LIST_PRED_ALL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-7)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string));
+        }
+#line 3962 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 198: /* list_predicate: ANY '(' IDENTIFIER IN expr WHERE expr ')'  */
+#line 1165 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_list_predicate(LIST_PRED_ANY, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-7)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string));
+        }
+#line 3971 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 199: /* list_predicate: NONE '(' IDENTIFIER IN expr WHERE expr ')'  */
+#line 1170 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_list_predicate(LIST_PRED_NONE, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-7)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string));
+        }
+#line 3980 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 200: /* list_predicate: SINGLE '(' IDENTIFIER IN expr WHERE expr ')'  */
+#line 1175 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_list_predicate(LIST_PRED_SINGLE, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-7)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string));
+        }
+#line 3989 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 201: /* reduce_expr: REDUCE '(' IDENTIFIER '=' expr ',' IDENTIFIER IN expr '|' expr ')'  */
+#line 1184 "src/backend/parser/cypher_gram.y"
+        {
+            /* reduce(acc = initial, x IN list | expression) */
+            ((*yyvalp).node) = (ast_node*)make_reduce_expr((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-9)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-7)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-11)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-9)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string));
+        }
+#line 4000 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 202: /* argument_list: expr  */
+#line 1195 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            ast_list_append(((*yyvalp).list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+        }
+#line 4009 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 203: /* argument_list: argument_list ',' expr  */
+#line 1200 "src/backend/parser/cypher_gram.y"
+        {
+            ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list);
+        }
+#line 4018 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 204: /* list_literal: '[' ']'  */
+#line 1209 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_list(ast_list_create(), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line);
+        }
+#line 4026 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 205: /* list_literal: '[' return_item_list ']'  */
+#line 1213 "src/backend/parser/cypher_gram.y"
+        {
+            /* Reuse return_item_list for comma-separated expressions */
+            /* But we need to extract the expressions from return_items */
+            ast_list *exprs = ast_list_create();
+            for (int i = 0; i < (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list)->count; i++) {
+                cypher_return_item *item = (cypher_return_item*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list)->items[i];
+                ast_list_append(exprs, item->expr);
+                item->expr = NULL;  /* Prevent double-free */
+            }
+            ast_list_free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list));
+            ((*yyvalp).node) = (ast_node*)make_list(exprs, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+        }
+#line 4043 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 206: /* list_comprehension: '[' IDENTIFIER IN expr ']'  */
+#line 1230 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_list_comprehension((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), NULL, NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string));
+        }
+#line 4052 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 207: /* list_comprehension: '[' IDENTIFIER IN expr WHERE expr ']'  */
+#line 1235 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_list_comprehension((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-6)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string));
+        }
+#line 4061 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 208: /* list_comprehension: '[' IDENTIFIER IN expr '|' expr ']'  */
+#line 1240 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_list_comprehension((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.node), NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-6)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.string));
+        }
+#line 4070 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 209: /* list_comprehension: '[' IDENTIFIER IN expr WHERE expr '|' expr ']'  */
+#line 1245 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_list_comprehension((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-7)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-8)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-7)].yystate.yysemantics.yyval.string));
+        }
+#line 4079 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 210: /* pattern_comprehension: '[' '(' variable_opt label_opt properties_opt ')' rel_pattern node_pattern '|' expr ']'  */
+#line 1262 "src/backend/parser/cypher_gram.y"
+        {
+            cypher_node_pattern *first = make_node_pattern((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-8)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-7)].yystate.yysemantics.yyval.list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-6)].yystate.yysemantics.yyval.map));
+            ast_list *elements = ast_list_create();
+            ast_list_append(elements, (ast_node*)first);
+            ast_list_append(elements, (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.rel_pattern));
+            ast_list_append(elements, (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.node_pattern));
+            cypher_path *path = make_path(elements);
+
+            ast_list *pattern = ast_list_create();
+            ast_list_append(pattern, (ast_node*)path);
+            ((*yyvalp).node) = (ast_node*)make_pattern_comprehension(pattern, NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-10)].yystate.yyloc).first_line);
+        }
+#line 4096 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 211: /* pattern_comprehension: '[' '(' variable_opt label_opt properties_opt ')' rel_pattern node_pattern WHERE expr '|' expr ']'  */
+#line 1275 "src/backend/parser/cypher_gram.y"
+        {
+            cypher_node_pattern *first = make_node_pattern((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-10)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-9)].yystate.yysemantics.yyval.list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-8)].yystate.yysemantics.yyval.map));
+            ast_list *elements = ast_list_create();
+            ast_list_append(elements, (ast_node*)first);
+            ast_list_append(elements, (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-6)].yystate.yysemantics.yyval.rel_pattern));
+            ast_list_append(elements, (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.node_pattern));
+            cypher_path *path = make_path(elements);
+
+            ast_list *pattern = ast_list_create();
+            ast_list_append(pattern, (ast_node*)path);
+            ((*yyvalp).node) = (ast_node*)make_pattern_comprehension(pattern, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-12)].yystate.yyloc).first_line);
+        }
+#line 4113 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 212: /* map_literal: '{' '}'  */
+#line 1292 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_map(ast_list_create(), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line);
+        }
+#line 4121 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 213: /* map_literal: '{' map_pair_list '}'  */
+#line 1296 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_map((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+        }
+#line 4129 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 214: /* map_projection: IDENTIFIER '{' map_projection_list '}'  */
+#line 1304 "src/backend/parser/cypher_gram.y"
+        {
+            cypher_identifier *base = make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yyloc).first_line);
+            ((*yyvalp).node) = (ast_node*)make_map_projection((ast_node*)base, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string));
+        }
+#line 4139 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 215: /* map_projection_list: map_projection_item  */
+#line 1313 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            ast_list_append(((*yyvalp).list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+        }
+#line 4148 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 216: /* map_projection_list: map_projection_list ',' map_projection_item  */
+#line 1318 "src/backend/parser/cypher_gram.y"
+        {
+            ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list);
+        }
+#line 4157 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 217: /* map_projection_item: '.' IDENTIFIER  */
+#line 1326 "src/backend/parser/cypher_gram.y"
+        {
+            /* Shorthand: .prop -> key=prop, property=prop, expr=NULL */
+            ((*yyvalp).node) = (ast_node*)make_map_projection_item((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 4167 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 218: /* map_projection_item: '.' '*'  */
+#line 1332 "src/backend/parser/cypher_gram.y"
+        {
+            /* All properties: .* -> key=NULL, property="*", expr=NULL */
+            ((*yyvalp).node) = (ast_node*)make_map_projection_item(NULL, strdup("*"), NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yyloc).first_line);
+        }
+#line 4176 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 219: /* map_projection_item: IDENTIFIER ':' '.' IDENTIFIER  */
+#line 1337 "src/backend/parser/cypher_gram.y"
+        {
+            /* Aliased property: alias: .prop */
+            ((*yyvalp).node) = (ast_node*)make_map_projection_item((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.string));
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 4187 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 220: /* map_projection_item: IDENTIFIER ':' expr  */
+#line 1344 "src/backend/parser/cypher_gram.y"
+        {
+            /* Computed value: alias: expr */
+            ((*yyvalp).node) = (ast_node*)make_map_projection_item((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string));
+        }
+#line 4197 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 221: /* case_expression: CASE when_clause_list END_P  */
+#line 1358 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_case_expr(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+        }
+#line 4205 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 222: /* case_expression: CASE when_clause_list ELSE expr END_P  */
+#line 1362 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_case_expr(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yyloc).first_line);
+        }
+#line 4213 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 223: /* case_expression: CASE expr when_clause_list END_P  */
+#line 1367 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_case_expr((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yyloc).first_line);
+        }
+#line 4221 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 224: /* case_expression: CASE expr when_clause_list ELSE expr END_P  */
+#line 1371 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_case_expr((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yyloc).first_line);
+        }
+#line 4229 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 225: /* when_clause_list: when_clause  */
+#line 1378 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            ast_list_append(((*yyvalp).list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+        }
+#line 4238 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 226: /* when_clause_list: when_clause_list when_clause  */
+#line 1383 "src/backend/parser/cypher_gram.y"
+        {
+            ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list);
+        }
+#line 4247 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 227: /* when_clause: WHEN expr THEN expr  */
+#line 1391 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).node) = (ast_node*)make_when_clause((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yyloc).first_line);
+        }
+#line 4255 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 228: /* literal: INTEGER  */
+#line 1398 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).literal) = make_integer_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.integer), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+        }
+#line 4263 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 229: /* literal: DECIMAL  */
+#line 1402 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).literal) = make_decimal_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.decimal), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+        }
+#line 4271 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 230: /* literal: STRING  */
+#line 1406 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).literal) = make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 4280 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 231: /* literal: TRUE_P  */
+#line 1411 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).literal) = make_boolean_literal(true, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+        }
+#line 4288 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 232: /* literal: FALSE_P  */
+#line 1415 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).literal) = make_boolean_literal(false, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+        }
+#line 4296 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 233: /* literal: NULL_P  */
+#line 1419 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).literal) = make_null_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+        }
+#line 4304 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 234: /* identifier: IDENTIFIER  */
+#line 1426 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).identifier) = make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 4313 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 235: /* identifier: BQIDENT  */
+#line 1431 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).identifier) = make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 4322 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 236: /* identifier: END_P  */
+#line 1436 "src/backend/parser/cypher_gram.y"
+        {
+            /* Allow 'end' as an identifier - it's only reserved in CASE...END context */
+            ((*yyvalp).identifier) = make_identifier(strdup("end"), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+        }
+#line 4331 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 237: /* parameter: PARAMETER  */
+#line 1444 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).parameter) = make_parameter((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yyloc).first_line);
+            free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.string));
+        }
+#line 4340 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 238: /* properties_opt: %empty  */
+#line 1452 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).map) = NULL; }
+#line 4346 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 239: /* properties_opt: '{' '}'  */
+#line 1453 "src/backend/parser/cypher_gram.y"
+                        { ((*yyvalp).map) = NULL; }
+#line 4352 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 240: /* properties_opt: '{' map_pair_list '}'  */
+#line 1455 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).map) = make_map((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+        }
+#line 4360 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 241: /* map_pair_list: map_pair  */
+#line 1462 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).list) = ast_list_create();
+            ast_list_append(((*yyvalp).list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.map_pair));
+        }
+#line 4369 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 242: /* map_pair_list: map_pair_list ',' map_pair  */
+#line 1467 "src/backend/parser/cypher_gram.y"
+        {
+            ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (ast_node*)(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.map_pair));
+            ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list);
+        }
+#line 4378 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 243: /* map_pair: IDENTIFIER ':' expr  */
+#line 1475 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).map_pair) = make_map_pair((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+        }
+#line 4386 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 244: /* map_pair: BQIDENT ':' expr  */
+#line 1479 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).map_pair) = make_map_pair((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+        }
+#line 4394 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 245: /* map_pair: STRING ':' expr  */
+#line 1483 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).map_pair) = make_map_pair((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+        }
+#line 4402 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 246: /* map_pair: ASC ':' expr  */
+#line 1487 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).map_pair) = make_map_pair("asc", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+        }
+#line 4410 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 247: /* map_pair: DESC ':' expr  */
+#line 1491 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).map_pair) = make_map_pair("desc", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+        }
+#line 4418 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 248: /* map_pair: ORDER ':' expr  */
+#line 1495 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).map_pair) = make_map_pair("order", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+        }
+#line 4426 "build/parser/cypher_gram.tab.c"
+    break;
+
+  case 249: /* map_pair: BY ':' expr  */
+#line 1499 "src/backend/parser/cypher_gram.y"
+        {
+            ((*yyvalp).map_pair) = make_map_pair("by", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yyloc).first_line);
+        }
+#line 4434 "build/parser/cypher_gram.tab.c"
+    break;
+
+
+#line 4438 "build/parser/cypher_gram.tab.c"
+
+      default: break;
+    }
+  YY_SYMBOL_PRINT ("-> $$ =", yylhsNonterm (yyrule), yyvalp, yylocp);
+
+  return yyok;
+# undef yyerrok
+# undef YYABORT
+# undef YYACCEPT
+# undef YYNOMEM
+# undef YYERROR
+# undef YYBACKUP
+# undef yyclearin
+# undef YYRECOVERING
+}
+
+
+static void
+yyuserMerge (int yyn, YYSTYPE* yy0, YYSTYPE* yy1)
+{
+  YY_USE (yy0);
+  YY_USE (yy1);
+
+  switch (yyn)
+    {
+
+      default: break;
+    }
+}
+
+                              /* Bison grammar-table manipulation.  */
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, cypher_parser_context *context)
+{
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
+  YY_USE (context);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+/** Number of symbols composing the right hand side of rule #RULE.  */
+static inline int
+yyrhsLength (yyRuleNum yyrule)
+{
+  return yyr2[yyrule];
+}
+
+static void
+yydestroyGLRState (char const *yymsg, yyGLRState *yys, cypher_parser_context *context)
+{
+  if (yys->yyresolved)
+    yydestruct (yymsg, yy_accessing_symbol (yys->yylrState),
+                &yys->yysemantics.yyval, &yys->yyloc, context);
+  else
+    {
+#if CYPHER_YYDEBUG
+      if (yydebug)
+        {
+          if (yys->yysemantics.yyfirstVal)
+            YY_FPRINTF ((stderr, "%s unresolved", yymsg));
+          else
+            YY_FPRINTF ((stderr, "%s incomplete", yymsg));
+          YY_SYMBOL_PRINT ("", yy_accessing_symbol (yys->yylrState), YY_NULLPTR, &yys->yyloc);
+        }
+#endif
+
+      if (yys->yysemantics.yyfirstVal)
+        {
+          yySemanticOption *yyoption = yys->yysemantics.yyfirstVal;
+          yyGLRState *yyrh;
+          int yyn;
+          for (yyrh = yyoption->yystate, yyn = yyrhsLength (yyoption->yyrule);
+               yyn > 0;
+               yyrh = yyrh->yypred, yyn -= 1)
+            yydestroyGLRState (yymsg, yyrh, context);
+        }
+    }
+}
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+/** True iff LR state YYSTATE has only a default reduction (regardless
+ *  of token).  */
+static inline yybool
+yyisDefaultedState (yy_state_t yystate)
+{
+  return yypact_value_is_default (yypact[yystate]);
+}
+
+/** The default reduction for YYSTATE, assuming it has one.  */
+static inline yyRuleNum
+yydefaultAction (yy_state_t yystate)
+{
+  return yydefact[yystate];
+}
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/** The action to take in YYSTATE on seeing YYTOKEN.
+ *  Result R means
+ *    R < 0:  Reduce on rule -R.
+ *    R = 0:  Error.
+ *    R > 0:  Shift to state R.
+ *  Set *YYCONFLICTS to a pointer into yyconfl to a 0-terminated list
+ *  of conflicting reductions.
+ */
+static inline int
+yygetLRActions (yy_state_t yystate, yysymbol_kind_t yytoken, const short** yyconflicts)
+{
+  int yyindex = yypact[yystate] + yytoken;
+  if (yytoken == YYSYMBOL_YYerror)
+    {
+      // This is the error token.
+      *yyconflicts = yyconfl;
+      return 0;
+    }
+  else if (yyisDefaultedState (yystate)
+           || yyindex < 0 || YYLAST < yyindex || yycheck[yyindex] != yytoken)
+    {
+      *yyconflicts = yyconfl;
+      return -yydefact[yystate];
+    }
+  else if (! yytable_value_is_error (yytable[yyindex]))
+    {
+      *yyconflicts = yyconfl + yyconflp[yyindex];
+      return yytable[yyindex];
+    }
+  else
+    {
+      *yyconflicts = yyconfl + yyconflp[yyindex];
+      return 0;
+    }
+}
+
+/** Compute post-reduction state.
+ * \param yystate   the current state
+ * \param yysym     the nonterminal to push on the stack
+ */
+static inline yy_state_t
+yyLRgotoState (yy_state_t yystate, yysymbol_kind_t yysym)
+{
+  int yyr = yypgoto[yysym - YYNTOKENS] + yystate;
+  if (0 <= yyr && yyr <= YYLAST && yycheck[yyr] == yystate)
+    return yytable[yyr];
+  else
+    return yydefgoto[yysym - YYNTOKENS];
+}
+
+static inline yybool
+yyisShiftAction (int yyaction)
+{
+  return 0 < yyaction;
+}
+
+static inline yybool
+yyisErrorAction (int yyaction)
+{
+  return yyaction == 0;
+}
+
+                                /* GLRStates */
+
+/** Return a fresh GLRStackItem in YYSTACKP.  The item is an LR state
+ *  if YYISSTATE, and otherwise a semantic option.  Callers should call
+ *  YY_RESERVE_GLRSTACK afterwards to make sure there is sufficient
+ *  headroom.  */
+
+static inline yyGLRStackItem*
+yynewGLRStackItem (yyGLRStack* yystackp, yybool yyisState)
+{
+  yyGLRStackItem* yynewItem = yystackp->yynextFree;
+  yystackp->yyspaceLeft -= 1;
+  yystackp->yynextFree += 1;
+  yynewItem->yystate.yyisState = yyisState;
+  return yynewItem;
+}
+
+/** Add a new semantic action that will execute the action for rule
+ *  YYRULE on the semantic values in YYRHS to the list of
+ *  alternative actions for YYSTATE.  Assumes that YYRHS comes from
+ *  stack #YYK of *YYSTACKP. */
+static void
+yyaddDeferredAction (yyGLRStack* yystackp, YYPTRDIFF_T yyk, yyGLRState* yystate,
+                     yyGLRState* yyrhs, yyRuleNum yyrule)
+{
+  yySemanticOption* yynewOption =
+    &yynewGLRStackItem (yystackp, yyfalse)->yyoption;
+  YY_ASSERT (!yynewOption->yyisState);
+  yynewOption->yystate = yyrhs;
+  yynewOption->yyrule = yyrule;
+  if (yystackp->yytops.yylookaheadNeeds[yyk])
+    {
+      yynewOption->yyrawchar = yychar;
+      yynewOption->yyval = yylval;
+      yynewOption->yyloc = yylloc;
+    }
+  else
+    yynewOption->yyrawchar = CYPHER_CYPHER_YYEMPTY;
+  yynewOption->yynext = yystate->yysemantics.yyfirstVal;
+  yystate->yysemantics.yyfirstVal = yynewOption;
+
+  YY_RESERVE_GLRSTACK (yystackp);
+}
+
+                                /* GLRStacks */
+
+/** Initialize YYSET to a singleton set containing an empty stack.  */
+static yybool
+yyinitStateSet (yyGLRStateSet* yyset)
+{
+  yyset->yysize = 1;
+  yyset->yycapacity = 16;
+  yyset->yystates
+    = YY_CAST (yyGLRState**,
+               YYMALLOC (YY_CAST (YYSIZE_T, yyset->yycapacity)
+                         * sizeof yyset->yystates[0]));
+  if (! yyset->yystates)
+    return yyfalse;
+  yyset->yystates[0] = YY_NULLPTR;
+  yyset->yylookaheadNeeds
+    = YY_CAST (yybool*,
+               YYMALLOC (YY_CAST (YYSIZE_T, yyset->yycapacity)
+                         * sizeof yyset->yylookaheadNeeds[0]));
+  if (! yyset->yylookaheadNeeds)
+    {
+      YYFREE (yyset->yystates);
+      return yyfalse;
+    }
+  memset (yyset->yylookaheadNeeds,
+          0,
+          YY_CAST (YYSIZE_T, yyset->yycapacity) * sizeof yyset->yylookaheadNeeds[0]);
+  return yytrue;
+}
+
+static void yyfreeStateSet (yyGLRStateSet* yyset)
+{
+  YYFREE (yyset->yystates);
+  YYFREE (yyset->yylookaheadNeeds);
+}
+
+/** Initialize *YYSTACKP to a single empty stack, with total maximum
+ *  capacity for all stacks of YYSIZE.  */
+static yybool
+yyinitGLRStack (yyGLRStack* yystackp, YYPTRDIFF_T yysize)
+{
+  yystackp->yyerrState = 0;
+  yynerrs = 0;
+  yystackp->yyspaceLeft = yysize;
+  yystackp->yyitems
+    = YY_CAST (yyGLRStackItem*,
+               YYMALLOC (YY_CAST (YYSIZE_T, yysize)
+                         * sizeof yystackp->yynextFree[0]));
+  if (!yystackp->yyitems)
+    return yyfalse;
+  yystackp->yynextFree = yystackp->yyitems;
+  yystackp->yysplitPoint = YY_NULLPTR;
+  yystackp->yylastDeleted = YY_NULLPTR;
+  return yyinitStateSet (&yystackp->yytops);
+}
+
+
+#if YYSTACKEXPANDABLE
+# define YYRELOC(YYFROMITEMS, YYTOITEMS, YYX, YYTYPE)                   \
+  &((YYTOITEMS)                                                         \
+    - ((YYFROMITEMS) - YY_REINTERPRET_CAST (yyGLRStackItem*, (YYX))))->YYTYPE
+
+/** If *YYSTACKP is expandable, extend it.  WARNING: Pointers into the
+    stack from outside should be considered invalid after this call.
+    We always expand when there are 1 or fewer items left AFTER an
+    allocation, so that we can avoid having external pointers exist
+    across an allocation.  */
+static void
+yyexpandGLRStack (yyGLRStack* yystackp)
+{
+  yyGLRStackItem* yynewItems;
+  yyGLRStackItem* yyp0, *yyp1;
+  YYPTRDIFF_T yynewSize;
+  YYPTRDIFF_T yyn;
+  YYPTRDIFF_T yysize = yystackp->yynextFree - yystackp->yyitems;
+  if (YYMAXDEPTH - YYHEADROOM < yysize)
+    yyMemoryExhausted (yystackp);
+  yynewSize = 2*yysize;
+  if (YYMAXDEPTH < yynewSize)
+    yynewSize = YYMAXDEPTH;
+  yynewItems
+    = YY_CAST (yyGLRStackItem*,
+               YYMALLOC (YY_CAST (YYSIZE_T, yynewSize)
+                         * sizeof yynewItems[0]));
+  if (! yynewItems)
+    yyMemoryExhausted (yystackp);
+  for (yyp0 = yystackp->yyitems, yyp1 = yynewItems, yyn = yysize;
+       0 < yyn;
+       yyn -= 1, yyp0 += 1, yyp1 += 1)
+    {
+      *yyp1 = *yyp0;
+      if (*YY_REINTERPRET_CAST (yybool *, yyp0))
+        {
+          yyGLRState* yys0 = &yyp0->yystate;
+          yyGLRState* yys1 = &yyp1->yystate;
+          if (yys0->yypred != YY_NULLPTR)
+            yys1->yypred =
+              YYRELOC (yyp0, yyp1, yys0->yypred, yystate);
+          if (! yys0->yyresolved && yys0->yysemantics.yyfirstVal != YY_NULLPTR)
+            yys1->yysemantics.yyfirstVal =
+              YYRELOC (yyp0, yyp1, yys0->yysemantics.yyfirstVal, yyoption);
+        }
+      else
+        {
+          yySemanticOption* yyv0 = &yyp0->yyoption;
+          yySemanticOption* yyv1 = &yyp1->yyoption;
+          if (yyv0->yystate != YY_NULLPTR)
+            yyv1->yystate = YYRELOC (yyp0, yyp1, yyv0->yystate, yystate);
+          if (yyv0->yynext != YY_NULLPTR)
+            yyv1->yynext = YYRELOC (yyp0, yyp1, yyv0->yynext, yyoption);
+        }
+    }
+  if (yystackp->yysplitPoint != YY_NULLPTR)
+    yystackp->yysplitPoint = YYRELOC (yystackp->yyitems, yynewItems,
+                                      yystackp->yysplitPoint, yystate);
+
+  for (yyn = 0; yyn < yystackp->yytops.yysize; yyn += 1)
+    if (yystackp->yytops.yystates[yyn] != YY_NULLPTR)
+      yystackp->yytops.yystates[yyn] =
+        YYRELOC (yystackp->yyitems, yynewItems,
+                 yystackp->yytops.yystates[yyn], yystate);
+  YYFREE (yystackp->yyitems);
+  yystackp->yyitems = yynewItems;
+  yystackp->yynextFree = yynewItems + yysize;
+  yystackp->yyspaceLeft = yynewSize - yysize;
+}
+#endif
+
+static void
+yyfreeGLRStack (yyGLRStack* yystackp)
+{
+  YYFREE (yystackp->yyitems);
+  yyfreeStateSet (&yystackp->yytops);
+}
+
+/** Assuming that YYS is a GLRState somewhere on *YYSTACKP, update the
+ *  splitpoint of *YYSTACKP, if needed, so that it is at least as deep as
+ *  YYS.  */
+static inline void
+yyupdateSplit (yyGLRStack* yystackp, yyGLRState* yys)
+{
+  if (yystackp->yysplitPoint != YY_NULLPTR && yystackp->yysplitPoint > yys)
+    yystackp->yysplitPoint = yys;
+}
+
+/** Invalidate stack #YYK in *YYSTACKP.  */
+static inline void
+yymarkStackDeleted (yyGLRStack* yystackp, YYPTRDIFF_T yyk)
+{
+  if (yystackp->yytops.yystates[yyk] != YY_NULLPTR)
+    yystackp->yylastDeleted = yystackp->yytops.yystates[yyk];
+  yystackp->yytops.yystates[yyk] = YY_NULLPTR;
+}
+
+/** Undelete the last stack in *YYSTACKP that was marked as deleted.  Can
+    only be done once after a deletion, and only when all other stacks have
+    been deleted.  */
+static void
+yyundeleteLastStack (yyGLRStack* yystackp)
+{
+  if (yystackp->yylastDeleted == YY_NULLPTR || yystackp->yytops.yysize != 0)
+    return;
+  yystackp->yytops.yystates[0] = yystackp->yylastDeleted;
+  yystackp->yytops.yysize = 1;
+  YY_DPRINTF ((stderr, "Restoring last deleted stack as stack #0.\n"));
+  yystackp->yylastDeleted = YY_NULLPTR;
+}
+
+static inline void
+yyremoveDeletes (yyGLRStack* yystackp)
+{
+  YYPTRDIFF_T yyi, yyj;
+  yyi = yyj = 0;
+  while (yyj < yystackp->yytops.yysize)
+    {
+      if (yystackp->yytops.yystates[yyi] == YY_NULLPTR)
+        {
+          if (yyi == yyj)
+            YY_DPRINTF ((stderr, "Removing dead stacks.\n"));
+          yystackp->yytops.yysize -= 1;
+        }
+      else
+        {
+          yystackp->yytops.yystates[yyj] = yystackp->yytops.yystates[yyi];
+          /* In the current implementation, it's unnecessary to copy
+             yystackp->yytops.yylookaheadNeeds[yyi] since, after
+             yyremoveDeletes returns, the parser immediately either enters
+             deterministic operation or shifts a token.  However, it doesn't
+             hurt, and the code might evolve to need it.  */
+          yystackp->yytops.yylookaheadNeeds[yyj] =
+            yystackp->yytops.yylookaheadNeeds[yyi];
+          if (yyj != yyi)
+            YY_DPRINTF ((stderr, "Rename stack %ld -> %ld.\n",
+                        YY_CAST (long, yyi), YY_CAST (long, yyj)));
+          yyj += 1;
+        }
+      yyi += 1;
+    }
+}
+
+/** Shift to a new state on stack #YYK of *YYSTACKP, corresponding to LR
+ * state YYLRSTATE, at input position YYPOSN, with (resolved) semantic
+ * value *YYVALP and source location *YYLOCP.  */
+static inline void
+yyglrShift (yyGLRStack* yystackp, YYPTRDIFF_T yyk, yy_state_t yylrState,
+            YYPTRDIFF_T yyposn,
+            YYSTYPE* yyvalp, YYLTYPE* yylocp)
+{
+  yyGLRState* yynewState = &yynewGLRStackItem (yystackp, yytrue)->yystate;
+
+  yynewState->yylrState = yylrState;
+  yynewState->yyposn = yyposn;
+  yynewState->yyresolved = yytrue;
+  yynewState->yypred = yystackp->yytops.yystates[yyk];
+  yynewState->yysemantics.yyval = *yyvalp;
+  yynewState->yyloc = *yylocp;
+  yystackp->yytops.yystates[yyk] = yynewState;
+
+  YY_RESERVE_GLRSTACK (yystackp);
+}
+
+/** Shift stack #YYK of *YYSTACKP, to a new state corresponding to LR
+ *  state YYLRSTATE, at input position YYPOSN, with the (unresolved)
+ *  semantic value of YYRHS under the action for YYRULE.  */
+static inline void
+yyglrShiftDefer (yyGLRStack* yystackp, YYPTRDIFF_T yyk, yy_state_t yylrState,
+                 YYPTRDIFF_T yyposn, yyGLRState* yyrhs, yyRuleNum yyrule)
+{
+  yyGLRState* yynewState = &yynewGLRStackItem (yystackp, yytrue)->yystate;
+  YY_ASSERT (yynewState->yyisState);
+
+  yynewState->yylrState = yylrState;
+  yynewState->yyposn = yyposn;
+  yynewState->yyresolved = yyfalse;
+  yynewState->yypred = yystackp->yytops.yystates[yyk];
+  yynewState->yysemantics.yyfirstVal = YY_NULLPTR;
+  yystackp->yytops.yystates[yyk] = yynewState;
+
+  /* Invokes YY_RESERVE_GLRSTACK.  */
+  yyaddDeferredAction (yystackp, yyk, yynewState, yyrhs, yyrule);
+}
+
+#if CYPHER_YYDEBUG
+
+/*----------------------------------------------------------------------.
+| Report that stack #YYK of *YYSTACKP is going to be reduced by YYRULE. |
+`----------------------------------------------------------------------*/
+
+static inline void
+yy_reduce_print (yybool yynormal, yyGLRStackItem* yyvsp, YYPTRDIFF_T yyk,
+                 yyRuleNum yyrule, cypher_parser_context *context)
+{
+  int yynrhs = yyrhsLength (yyrule);
+  int yylow = 1;
+  int yyi;
+  YY_FPRINTF ((stderr, "Reducing stack %ld by rule %d (line %d):\n",
+               YY_CAST (long, yyk), yyrule - 1, yyrline[yyrule]));
+  if (! yynormal)
+    yyfillin (yyvsp, 1, -yynrhs);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YY_FPRINTF ((stderr, "   $%d = ", yyi + 1));
+      yy_symbol_print (stderr,
+                       yy_accessing_symbol (yyvsp[yyi - yynrhs + 1].yystate.yylrState),
+                       &yyvsp[yyi - yynrhs + 1].yystate.yysemantics.yyval,
+                       &(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL ((yyi + 1) - (yynrhs))].yystate.yyloc)                       , context);
+      if (!yyvsp[yyi - yynrhs + 1].yystate.yyresolved)
+        YY_FPRINTF ((stderr, " (unresolved)"));
+      YY_FPRINTF ((stderr, "\n"));
+    }
+}
+#endif
+
+/** Pop the symbols consumed by reduction #YYRULE from the top of stack
+ *  #YYK of *YYSTACKP, and perform the appropriate semantic action on their
+ *  semantic values.  Assumes that all ambiguities in semantic values
+ *  have been previously resolved.  Set *YYVALP to the resulting value,
+ *  and *YYLOCP to the computed location (if any).  Return value is as
+ *  for userAction.  */
+static inline YYRESULTTAG
+yydoAction (yyGLRStack* yystackp, YYPTRDIFF_T yyk, yyRuleNum yyrule,
+            YYSTYPE* yyvalp, YYLTYPE *yylocp, cypher_parser_context *context)
+{
+  int yynrhs = yyrhsLength (yyrule);
+
+  if (yystackp->yysplitPoint == YY_NULLPTR)
+    {
+      /* Standard special case: single stack.  */
+      yyGLRStackItem* yyrhs
+        = YY_REINTERPRET_CAST (yyGLRStackItem*, yystackp->yytops.yystates[yyk]);
+      YY_ASSERT (yyk == 0);
+      yystackp->yynextFree -= yynrhs;
+      yystackp->yyspaceLeft += yynrhs;
+      yystackp->yytops.yystates[0] = & yystackp->yynextFree[-1].yystate;
+      return yyuserAction (yyrule, yynrhs, yyrhs, yystackp, yyk,
+                           yyvalp, yylocp, context);
+    }
+  else
+    {
+      yyGLRStackItem yyrhsVals[YYMAXRHS + YYMAXLEFT + 1];
+      yyGLRState* yys = yyrhsVals[YYMAXRHS + YYMAXLEFT].yystate.yypred
+        = yystackp->yytops.yystates[yyk];
+      int yyi;
+      if (yynrhs == 0)
+        /* Set default location.  */
+        yyrhsVals[YYMAXRHS + YYMAXLEFT - 1].yystate.yyloc = yys->yyloc;
+      for (yyi = 0; yyi < yynrhs; yyi += 1)
+        {
+          yys = yys->yypred;
+          YY_ASSERT (yys);
+        }
+      yyupdateSplit (yystackp, yys);
+      yystackp->yytops.yystates[yyk] = yys;
+      return yyuserAction (yyrule, yynrhs, yyrhsVals + YYMAXRHS + YYMAXLEFT - 1,
+                           yystackp, yyk, yyvalp, yylocp, context);
+    }
+}
+
+/** Pop items off stack #YYK of *YYSTACKP according to grammar rule YYRULE,
+ *  and push back on the resulting nonterminal symbol.  Perform the
+ *  semantic action associated with YYRULE and store its value with the
+ *  newly pushed state, if YYFORCEEVAL or if *YYSTACKP is currently
+ *  unambiguous.  Otherwise, store the deferred semantic action with
+ *  the new state.  If the new state would have an identical input
+ *  position, LR state, and predecessor to an existing state on the stack,
+ *  it is identified with that existing state, eliminating stack #YYK from
+ *  *YYSTACKP.  In this case, the semantic value is
+ *  added to the options for the existing state's semantic value.
+ */
+static inline YYRESULTTAG
+yyglrReduce (yyGLRStack* yystackp, YYPTRDIFF_T yyk, yyRuleNum yyrule,
+             yybool yyforceEval, cypher_parser_context *context)
+{
+  YYPTRDIFF_T yyposn = yystackp->yytops.yystates[yyk]->yyposn;
+
+  if (yyforceEval || yystackp->yysplitPoint == YY_NULLPTR)
+    {
+      YYSTYPE yyval;
+      YYLTYPE yyloc;
+
+      YYRESULTTAG yyflag = yydoAction (yystackp, yyk, yyrule, &yyval, &yyloc, context);
+      if (yyflag == yyerr && yystackp->yysplitPoint != YY_NULLPTR)
+        YY_DPRINTF ((stderr,
+                     "Parse on stack %ld rejected by rule %d (line %d).\n",
+                     YY_CAST (long, yyk), yyrule - 1, yyrline[yyrule]));
+      if (yyflag != yyok)
+        return yyflag;
+      yyglrShift (yystackp, yyk,
+                  yyLRgotoState (yystackp->yytops.yystates[yyk]->yylrState,
+                                 yylhsNonterm (yyrule)),
+                  yyposn, &yyval, &yyloc);
+    }
+  else
+    {
+      YYPTRDIFF_T yyi;
+      int yyn;
+      yyGLRState* yys, *yys0 = yystackp->yytops.yystates[yyk];
+      yy_state_t yynewLRState;
+
+      for (yys = yystackp->yytops.yystates[yyk], yyn = yyrhsLength (yyrule);
+           0 < yyn; yyn -= 1)
+        {
+          yys = yys->yypred;
+          YY_ASSERT (yys);
+        }
+      yyupdateSplit (yystackp, yys);
+      yynewLRState = yyLRgotoState (yys->yylrState, yylhsNonterm (yyrule));
+      YY_DPRINTF ((stderr,
+                   "Reduced stack %ld by rule %d (line %d); action deferred.  "
+                   "Now in state %d.\n",
+                   YY_CAST (long, yyk), yyrule - 1, yyrline[yyrule],
+                   yynewLRState));
+      for (yyi = 0; yyi < yystackp->yytops.yysize; yyi += 1)
+        if (yyi != yyk && yystackp->yytops.yystates[yyi] != YY_NULLPTR)
+          {
+            yyGLRState *yysplit = yystackp->yysplitPoint;
+            yyGLRState *yyp = yystackp->yytops.yystates[yyi];
+            while (yyp != yys && yyp != yysplit && yyp->yyposn >= yyposn)
+              {
+                if (yyp->yylrState == yynewLRState && yyp->yypred == yys)
+                  {
+                    yyaddDeferredAction (yystackp, yyk, yyp, yys0, yyrule);
+                    yymarkStackDeleted (yystackp, yyk);
+                    YY_DPRINTF ((stderr, "Merging stack %ld into stack %ld.\n",
+                                 YY_CAST (long, yyk), YY_CAST (long, yyi)));
+                    return yyok;
+                  }
+                yyp = yyp->yypred;
+              }
+          }
+      yystackp->yytops.yystates[yyk] = yys;
+      yyglrShiftDefer (yystackp, yyk, yynewLRState, yyposn, yys0, yyrule);
+    }
+  return yyok;
+}
+
+static YYPTRDIFF_T
+yysplitStack (yyGLRStack* yystackp, YYPTRDIFF_T yyk)
+{
+  if (yystackp->yysplitPoint == YY_NULLPTR)
+    {
+      YY_ASSERT (yyk == 0);
+      yystackp->yysplitPoint = yystackp->yytops.yystates[yyk];
+    }
+  if (yystackp->yytops.yycapacity <= yystackp->yytops.yysize)
+    {
+      YYPTRDIFF_T state_size = YYSIZEOF (yystackp->yytops.yystates[0]);
+      YYPTRDIFF_T half_max_capacity = YYSIZE_MAXIMUM / 2 / state_size;
+      if (half_max_capacity < yystackp->yytops.yycapacity)
+        yyMemoryExhausted (yystackp);
+      yystackp->yytops.yycapacity *= 2;
+
+      {
+        yyGLRState** yynewStates
+          = YY_CAST (yyGLRState**,
+                     YYREALLOC (yystackp->yytops.yystates,
+                                (YY_CAST (YYSIZE_T, yystackp->yytops.yycapacity)
+                                 * sizeof yynewStates[0])));
+        if (yynewStates == YY_NULLPTR)
+          yyMemoryExhausted (yystackp);
+        yystackp->yytops.yystates = yynewStates;
+      }
+
+      {
+        yybool* yynewLookaheadNeeds
+          = YY_CAST (yybool*,
+                     YYREALLOC (yystackp->yytops.yylookaheadNeeds,
+                                (YY_CAST (YYSIZE_T, yystackp->yytops.yycapacity)
+                                 * sizeof yynewLookaheadNeeds[0])));
+        if (yynewLookaheadNeeds == YY_NULLPTR)
+          yyMemoryExhausted (yystackp);
+        yystackp->yytops.yylookaheadNeeds = yynewLookaheadNeeds;
+      }
+    }
+  yystackp->yytops.yystates[yystackp->yytops.yysize]
+    = yystackp->yytops.yystates[yyk];
+  yystackp->yytops.yylookaheadNeeds[yystackp->yytops.yysize]
+    = yystackp->yytops.yylookaheadNeeds[yyk];
+  yystackp->yytops.yysize += 1;
+  return yystackp->yytops.yysize - 1;
+}
+
+/** True iff YYY0 and YYY1 represent identical options at the top level.
+ *  That is, they represent the same rule applied to RHS symbols
+ *  that produce the same terminal symbols.  */
+static yybool
+yyidenticalOptions (yySemanticOption* yyy0, yySemanticOption* yyy1)
+{
+  if (yyy0->yyrule == yyy1->yyrule)
+    {
+      yyGLRState *yys0, *yys1;
+      int yyn;
+      for (yys0 = yyy0->yystate, yys1 = yyy1->yystate,
+           yyn = yyrhsLength (yyy0->yyrule);
+           yyn > 0;
+           yys0 = yys0->yypred, yys1 = yys1->yypred, yyn -= 1)
+        if (yys0->yyposn != yys1->yyposn)
+          return yyfalse;
+      return yytrue;
+    }
+  else
+    return yyfalse;
+}
+
+/** Assuming identicalOptions (YYY0,YYY1), destructively merge the
+ *  alternative semantic values for the RHS-symbols of YYY1 and YYY0.  */
+static void
+yymergeOptionSets (yySemanticOption* yyy0, yySemanticOption* yyy1)
+{
+  yyGLRState *yys0, *yys1;
+  int yyn;
+  for (yys0 = yyy0->yystate, yys1 = yyy1->yystate,
+       yyn = yyrhsLength (yyy0->yyrule);
+       0 < yyn;
+       yys0 = yys0->yypred, yys1 = yys1->yypred, yyn -= 1)
+    {
+      if (yys0 == yys1)
+        break;
+      else if (yys0->yyresolved)
+        {
+          yys1->yyresolved = yytrue;
+          yys1->yysemantics.yyval = yys0->yysemantics.yyval;
+        }
+      else if (yys1->yyresolved)
+        {
+          yys0->yyresolved = yytrue;
+          yys0->yysemantics.yyval = yys1->yysemantics.yyval;
+        }
+      else
+        {
+          yySemanticOption** yyz0p = &yys0->yysemantics.yyfirstVal;
+          yySemanticOption* yyz1 = yys1->yysemantics.yyfirstVal;
+          while (yytrue)
+            {
+              if (yyz1 == *yyz0p || yyz1 == YY_NULLPTR)
+                break;
+              else if (*yyz0p == YY_NULLPTR)
+                {
+                  *yyz0p = yyz1;
+                  break;
+                }
+              else if (*yyz0p < yyz1)
+                {
+                  yySemanticOption* yyz = *yyz0p;
+                  *yyz0p = yyz1;
+                  yyz1 = yyz1->yynext;
+                  (*yyz0p)->yynext = yyz;
+                }
+              yyz0p = &(*yyz0p)->yynext;
+            }
+          yys1->yysemantics.yyfirstVal = yys0->yysemantics.yyfirstVal;
+        }
+    }
+}
+
+/** Y0 and Y1 represent two possible actions to take in a given
+ *  parsing state; return 0 if no combination is possible,
+ *  1 if user-mergeable, 2 if Y0 is preferred, 3 if Y1 is preferred.  */
+static int
+yypreference (yySemanticOption* y0, yySemanticOption* y1)
+{
+  yyRuleNum r0 = y0->yyrule, r1 = y1->yyrule;
+  int p0 = yydprec[r0], p1 = yydprec[r1];
+
+  if (p0 == p1)
+    {
+      if (yymerger[r0] == 0 || yymerger[r0] != yymerger[r1])
+        return 0;
+      else
+        return 1;
+    }
+  if (p0 == 0 || p1 == 0)
+    return 0;
+  if (p0 < p1)
+    return 3;
+  if (p1 < p0)
+    return 2;
+  return 0;
+}
+
+static YYRESULTTAG
+yyresolveValue (yyGLRState* yys, yyGLRStack* yystackp, cypher_parser_context *context);
+
+
+/** Resolve the previous YYN states starting at and including state YYS
+ *  on *YYSTACKP. If result != yyok, some states may have been left
+ *  unresolved possibly with empty semantic option chains.  Regardless
+ *  of whether result = yyok, each state has been left with consistent
+ *  data so that yydestroyGLRState can be invoked if necessary.  */
+static YYRESULTTAG
+yyresolveStates (yyGLRState* yys, int yyn,
+                 yyGLRStack* yystackp, cypher_parser_context *context)
+{
+  if (0 < yyn)
+    {
+      YY_ASSERT (yys->yypred);
+      YYCHK (yyresolveStates (yys->yypred, yyn-1, yystackp, context));
+      if (! yys->yyresolved)
+        YYCHK (yyresolveValue (yys, yystackp, context));
+    }
+  return yyok;
+}
+
+/** Resolve the states for the RHS of YYOPT on *YYSTACKP, perform its
+ *  user action, and return the semantic value and location in *YYVALP
+ *  and *YYLOCP.  Regardless of whether result = yyok, all RHS states
+ *  have been destroyed (assuming the user action destroys all RHS
+ *  semantic values if invoked).  */
+static YYRESULTTAG
+yyresolveAction (yySemanticOption* yyopt, yyGLRStack* yystackp,
+                 YYSTYPE* yyvalp, YYLTYPE *yylocp, cypher_parser_context *context)
+{
+  yyGLRStackItem yyrhsVals[YYMAXRHS + YYMAXLEFT + 1];
+  int yynrhs = yyrhsLength (yyopt->yyrule);
+  YYRESULTTAG yyflag =
+    yyresolveStates (yyopt->yystate, yynrhs, yystackp, context);
+  if (yyflag != yyok)
+    {
+      yyGLRState *yys;
+      for (yys = yyopt->yystate; yynrhs > 0; yys = yys->yypred, yynrhs -= 1)
+        yydestroyGLRState ("Cleanup: popping", yys, context);
+      return yyflag;
+    }
+
+  yyrhsVals[YYMAXRHS + YYMAXLEFT].yystate.yypred = yyopt->yystate;
+  if (yynrhs == 0)
+    /* Set default location.  */
+    yyrhsVals[YYMAXRHS + YYMAXLEFT - 1].yystate.yyloc = yyopt->yystate->yyloc;
+  {
+    int yychar_current = yychar;
+    YYSTYPE yylval_current = yylval;
+    YYLTYPE yylloc_current = yylloc;
+    yychar = yyopt->yyrawchar;
+    yylval = yyopt->yyval;
+    yylloc = yyopt->yyloc;
+    yyflag = yyuserAction (yyopt->yyrule, yynrhs,
+                           yyrhsVals + YYMAXRHS + YYMAXLEFT - 1,
+                           yystackp, -1, yyvalp, yylocp, context);
+    yychar = yychar_current;
+    yylval = yylval_current;
+    yylloc = yylloc_current;
+  }
+  return yyflag;
+}
+
+#if CYPHER_YYDEBUG
+static void
+yyreportTree (yySemanticOption* yyx, int yyindent)
+{
+  int yynrhs = yyrhsLength (yyx->yyrule);
+  int yyi;
+  yyGLRState* yys;
+  yyGLRState* yystates[1 + YYMAXRHS];
+  yyGLRState yyleftmost_state;
+
+  for (yyi = yynrhs, yys = yyx->yystate; 0 < yyi; yyi -= 1, yys = yys->yypred)
+    yystates[yyi] = yys;
+  if (yys == YY_NULLPTR)
+    {
+      yyleftmost_state.yyposn = 0;
+      yystates[0] = &yyleftmost_state;
+    }
+  else
+    yystates[0] = yys;
+
+  if (yyx->yystate->yyposn < yys->yyposn + 1)
+    YY_FPRINTF ((stderr, "%*s%s -> <Rule %d, empty>\n",
+                 yyindent, "", yysymbol_name (yylhsNonterm (yyx->yyrule)),
+                 yyx->yyrule - 1));
+  else
+    YY_FPRINTF ((stderr, "%*s%s -> <Rule %d, tokens %ld .. %ld>\n",
+                 yyindent, "", yysymbol_name (yylhsNonterm (yyx->yyrule)),
+                 yyx->yyrule - 1, YY_CAST (long, yys->yyposn + 1),
+                 YY_CAST (long, yyx->yystate->yyposn)));
+  for (yyi = 1; yyi <= yynrhs; yyi += 1)
+    {
+      if (yystates[yyi]->yyresolved)
+        {
+          if (yystates[yyi-1]->yyposn+1 > yystates[yyi]->yyposn)
+            YY_FPRINTF ((stderr, "%*s%s <empty>\n", yyindent+2, "",
+                         yysymbol_name (yy_accessing_symbol (yystates[yyi]->yylrState))));
+          else
+            YY_FPRINTF ((stderr, "%*s%s <tokens %ld .. %ld>\n", yyindent+2, "",
+                         yysymbol_name (yy_accessing_symbol (yystates[yyi]->yylrState)),
+                         YY_CAST (long, yystates[yyi-1]->yyposn + 1),
+                         YY_CAST (long, yystates[yyi]->yyposn)));
+        }
+      else
+        yyreportTree (yystates[yyi]->yysemantics.yyfirstVal, yyindent+2);
+    }
+}
+#endif
+
+static YYRESULTTAG
+yyreportAmbiguity (yySemanticOption* yyx0,
+                   yySemanticOption* yyx1, YYLTYPE *yylocp, cypher_parser_context *context)
+{
+  YY_USE (yyx0);
+  YY_USE (yyx1);
+
+#if CYPHER_YYDEBUG
+  YY_FPRINTF ((stderr, "Ambiguity detected.\n"));
+  YY_FPRINTF ((stderr, "Option 1,\n"));
+  yyreportTree (yyx0, 2);
+  YY_FPRINTF ((stderr, "\nOption 2,\n"));
+  yyreportTree (yyx1, 2);
+  YY_FPRINTF ((stderr, "\n"));
+#endif
+
+  yyerror (yylocp, context, YY_("syntax is ambiguous"));
+  return yyabort;
+}
+
+/** Resolve the locations for each of the YYN1 states in *YYSTACKP,
+ *  ending at YYS1.  Has no effect on previously resolved states.
+ *  The first semantic option of a state is always chosen.  */
+static void
+yyresolveLocations (yyGLRState *yys1, int yyn1,
+                    yyGLRStack *yystackp, cypher_parser_context *context)
+{
+  if (0 < yyn1)
+    {
+      yyresolveLocations (yys1->yypred, yyn1 - 1, yystackp, context);
+      if (!yys1->yyresolved)
+        {
+          yyGLRStackItem yyrhsloc[1 + YYMAXRHS];
+          int yynrhs;
+          yySemanticOption *yyoption = yys1->yysemantics.yyfirstVal;
+          YY_ASSERT (yyoption);
+          yynrhs = yyrhsLength (yyoption->yyrule);
+          if (0 < yynrhs)
+            {
+              yyGLRState *yys;
+              int yyn;
+              yyresolveLocations (yyoption->yystate, yynrhs,
+                                  yystackp, context);
+              for (yys = yyoption->yystate, yyn = yynrhs;
+                   yyn > 0;
+                   yys = yys->yypred, yyn -= 1)
+                yyrhsloc[yyn].yystate.yyloc = yys->yyloc;
+            }
+          else
+            {
+              /* Both yyresolveAction and yyresolveLocations traverse the GSS
+                 in reverse rightmost order.  It is only necessary to invoke
+                 yyresolveLocations on a subforest for which yyresolveAction
+                 would have been invoked next had an ambiguity not been
+                 detected.  Thus the location of the previous state (but not
+                 necessarily the previous state itself) is guaranteed to be
+                 resolved already.  */
+              yyGLRState *yyprevious = yyoption->yystate;
+              yyrhsloc[0].yystate.yyloc = yyprevious->yyloc;
+            }
+          YYLLOC_DEFAULT ((yys1->yyloc), yyrhsloc, yynrhs);
+        }
+    }
+}
+
+/** Resolve the ambiguity represented in state YYS in *YYSTACKP,
+ *  perform the indicated actions, and set the semantic value of YYS.
+ *  If result != yyok, the chain of semantic options in YYS has been
+ *  cleared instead or it has been left unmodified except that
+ *  redundant options may have been removed.  Regardless of whether
+ *  result = yyok, YYS has been left with consistent data so that
+ *  yydestroyGLRState can be invoked if necessary.  */
+static YYRESULTTAG
+yyresolveValue (yyGLRState* yys, yyGLRStack* yystackp, cypher_parser_context *context)
+{
+  yySemanticOption* yyoptionList = yys->yysemantics.yyfirstVal;
+  yySemanticOption* yybest = yyoptionList;
+  yySemanticOption** yypp;
+  yybool yymerge = yyfalse;
+  YYSTYPE yyval;
+  YYRESULTTAG yyflag;
+  YYLTYPE *yylocp = &yys->yyloc;
+
+  for (yypp = &yyoptionList->yynext; *yypp != YY_NULLPTR; )
+    {
+      yySemanticOption* yyp = *yypp;
+
+      if (yyidenticalOptions (yybest, yyp))
+        {
+          yymergeOptionSets (yybest, yyp);
+          *yypp = yyp->yynext;
+        }
+      else
+        {
+          switch (yypreference (yybest, yyp))
+            {
+            case 0:
+              yyresolveLocations (yys, 1, yystackp, context);
+              return yyreportAmbiguity (yybest, yyp, yylocp, context);
+              break;
+            case 1:
+              yymerge = yytrue;
+              break;
+            case 2:
+              break;
+            case 3:
+              yybest = yyp;
+              yymerge = yyfalse;
+              break;
+            default:
+              /* This cannot happen so it is not worth a YY_ASSERT (yyfalse),
+                 but some compilers complain if the default case is
+                 omitted.  */
+              break;
+            }
+          yypp = &yyp->yynext;
+        }
+    }
+
+  if (yymerge)
+    {
+      yySemanticOption* yyp;
+      int yyprec = yydprec[yybest->yyrule];
+      yyflag = yyresolveAction (yybest, yystackp, &yyval, yylocp, context);
+      if (yyflag == yyok)
+        for (yyp = yybest->yynext; yyp != YY_NULLPTR; yyp = yyp->yynext)
+          {
+            if (yyprec == yydprec[yyp->yyrule])
+              {
+                YYSTYPE yyval_other;
+                YYLTYPE yydummy;
+                yyflag = yyresolveAction (yyp, yystackp, &yyval_other, &yydummy, context);
+                if (yyflag != yyok)
+                  {
+                    yydestruct ("Cleanup: discarding incompletely merged value for",
+                                yy_accessing_symbol (yys->yylrState),
+                                &yyval, yylocp, context);
+                    break;
+                  }
+                yyuserMerge (yymerger[yyp->yyrule], &yyval, &yyval_other);
+              }
+          }
+    }
+  else
+    yyflag = yyresolveAction (yybest, yystackp, &yyval, yylocp, context);
+
+  if (yyflag == yyok)
+    {
+      yys->yyresolved = yytrue;
+      yys->yysemantics.yyval = yyval;
+    }
+  else
+    yys->yysemantics.yyfirstVal = YY_NULLPTR;
+  return yyflag;
+}
+
+static YYRESULTTAG
+yyresolveStack (yyGLRStack* yystackp, cypher_parser_context *context)
+{
+  if (yystackp->yysplitPoint != YY_NULLPTR)
+    {
+      yyGLRState* yys;
+      int yyn;
+
+      for (yyn = 0, yys = yystackp->yytops.yystates[0];
+           yys != yystackp->yysplitPoint;
+           yys = yys->yypred, yyn += 1)
+        continue;
+      YYCHK (yyresolveStates (yystackp->yytops.yystates[0], yyn, yystackp
+                             , context));
+    }
+  return yyok;
+}
+
+/** Called when returning to deterministic operation to clean up the extra
+ * stacks. */
+static void
+yycompressStack (yyGLRStack* yystackp)
+{
+  /* yyr is the state after the split point.  */
+  yyGLRState *yyr;
+
+  if (yystackp->yytops.yysize != 1 || yystackp->yysplitPoint == YY_NULLPTR)
+    return;
+
+  {
+    yyGLRState *yyp, *yyq;
+    for (yyp = yystackp->yytops.yystates[0], yyq = yyp->yypred, yyr = YY_NULLPTR;
+         yyp != yystackp->yysplitPoint;
+         yyr = yyp, yyp = yyq, yyq = yyp->yypred)
+      yyp->yypred = yyr;
+  }
+
+  yystackp->yyspaceLeft += yystackp->yynextFree - yystackp->yyitems;
+  yystackp->yynextFree = YY_REINTERPRET_CAST (yyGLRStackItem*, yystackp->yysplitPoint) + 1;
+  yystackp->yyspaceLeft -= yystackp->yynextFree - yystackp->yyitems;
+  yystackp->yysplitPoint = YY_NULLPTR;
+  yystackp->yylastDeleted = YY_NULLPTR;
+
+  while (yyr != YY_NULLPTR)
+    {
+      yystackp->yynextFree->yystate = *yyr;
+      yyr = yyr->yypred;
+      yystackp->yynextFree->yystate.yypred = &yystackp->yynextFree[-1].yystate;
+      yystackp->yytops.yystates[0] = &yystackp->yynextFree->yystate;
+      yystackp->yynextFree += 1;
+      yystackp->yyspaceLeft -= 1;
+    }
+}
+
+static YYRESULTTAG
+yyprocessOneStack (yyGLRStack* yystackp, YYPTRDIFF_T yyk,
+                   YYPTRDIFF_T yyposn, YYLTYPE *yylocp, cypher_parser_context *context)
+{
+  while (yystackp->yytops.yystates[yyk] != YY_NULLPTR)
+    {
+      yy_state_t yystate = yystackp->yytops.yystates[yyk]->yylrState;
+      YY_DPRINTF ((stderr, "Stack %ld Entering state %d\n",
+                   YY_CAST (long, yyk), yystate));
+
+      YY_ASSERT (yystate != YYFINAL);
+
+      if (yyisDefaultedState (yystate))
+        {
+          YYRESULTTAG yyflag;
+          yyRuleNum yyrule = yydefaultAction (yystate);
+          if (yyrule == 0)
+            {
+              YY_DPRINTF ((stderr, "Stack %ld dies.\n", YY_CAST (long, yyk)));
+              yymarkStackDeleted (yystackp, yyk);
+              return yyok;
+            }
+          yyflag = yyglrReduce (yystackp, yyk, yyrule, yyimmediate[yyrule], context);
+          if (yyflag == yyerr)
+            {
+              YY_DPRINTF ((stderr,
+                           "Stack %ld dies "
+                           "(predicate failure or explicit user error).\n",
+                           YY_CAST (long, yyk)));
+              yymarkStackDeleted (yystackp, yyk);
+              return yyok;
+            }
+          if (yyflag != yyok)
+            return yyflag;
+        }
+      else
+        {
+          yysymbol_kind_t yytoken = yygetToken (&yychar, yystackp, context);
+          const short* yyconflicts;
+          const int yyaction = yygetLRActions (yystate, yytoken, &yyconflicts);
+          yystackp->yytops.yylookaheadNeeds[yyk] = yytrue;
+
+          for (/* nothing */; *yyconflicts; yyconflicts += 1)
+            {
+              YYRESULTTAG yyflag;
+              YYPTRDIFF_T yynewStack = yysplitStack (yystackp, yyk);
+              YY_DPRINTF ((stderr, "Splitting off stack %ld from %ld.\n",
+                           YY_CAST (long, yynewStack), YY_CAST (long, yyk)));
+              yyflag = yyglrReduce (yystackp, yynewStack,
+                                    *yyconflicts,
+                                    yyimmediate[*yyconflicts], context);
+              if (yyflag == yyok)
+                YYCHK (yyprocessOneStack (yystackp, yynewStack,
+                                          yyposn, yylocp, context));
+              else if (yyflag == yyerr)
+                {
+                  YY_DPRINTF ((stderr, "Stack %ld dies.\n", YY_CAST (long, yynewStack)));
+                  yymarkStackDeleted (yystackp, yynewStack);
+                }
+              else
+                return yyflag;
+            }
+
+          if (yyisShiftAction (yyaction))
+            break;
+          else if (yyisErrorAction (yyaction))
+            {
+              YY_DPRINTF ((stderr, "Stack %ld dies.\n", YY_CAST (long, yyk)));
+              yymarkStackDeleted (yystackp, yyk);
+              break;
+            }
+          else
+            {
+              YYRESULTTAG yyflag = yyglrReduce (yystackp, yyk, -yyaction,
+                                                yyimmediate[-yyaction], context);
+              if (yyflag == yyerr)
+                {
+                  YY_DPRINTF ((stderr,
+                               "Stack %ld dies "
+                               "(predicate failure or explicit user error).\n",
+                               YY_CAST (long, yyk)));
+                  yymarkStackDeleted (yystackp, yyk);
+                  break;
+                }
+              else if (yyflag != yyok)
+                return yyflag;
+            }
+        }
+    }
+  return yyok;
+}
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYSTACKP, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  */
+static int
+yypcontext_expected_tokens (const yyGLRStack* yystackp,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[yystackp->yytops.yystates[0]->yylrState];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+static int
+yy_syntax_error_arguments (const yyGLRStack* yystackp,
+                           yysymbol_kind_t yyarg[], int yyargn)
+{
+  yysymbol_kind_t yytoken = yychar == CYPHER_CYPHER_YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  /* There are many possibilities here to consider:
+     - If this state is a consistent state with a default action, then
+       the only way this function was invoked is if the default action
+       is an error action.  In that case, don't check for expected
+       tokens because there are none.
+     - The only way there can be no lookahead present (in yychar) is if
+       this state is a consistent state with a default action.  Thus,
+       detecting the absence of a lookahead is sufficient to determine
+       that there is no unexpected or expected token to report.  In that
+       case, just report a simple "syntax error".
+     - Don't assume there isn't a lookahead just because this state is a
+       consistent state with a default action.  There might have been a
+       previous inconsistent state, consistent state with a non-default
+       action, or user semantic action that manipulated yychar.
+     - Of course, the expected token list depends on states to have
+       correct lookahead information, and it depends on the parser not
+       to perform extra reductions after fetching a lookahead from the
+       scanner and before detecting a syntax error.  Thus, state merging
+       (from LALR or IELR) and default reductions corrupt the expected
+       token list.  However, the list is correct for canonical LR with
+       one exception: it will still contain any token that will not be
+       accepted due to an error action in a later state.
+  */
+  if (yytoken != YYSYMBOL_YYEMPTY)
+    {
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yystackp,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
+    }
+  return yycount;
+}
+
+
+
+static void
+yyreportSyntaxError (yyGLRStack* yystackp, cypher_parser_context *context)
+{
+  if (yystackp->yyerrState != 0)
+    return;
+  {
+  yybool yysize_overflow = yyfalse;
+  char* yymsg = YY_NULLPTR;
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount
+    = yy_syntax_error_arguments (yystackp, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    yyMemoryExhausted (yystackp);
+
+  switch (yycount)
+    {
+#define YYCASE_(N, S)                   \
+      case N:                           \
+        yyformat = S;                   \
+      break
+    default: /* Avoid compiler warnings. */
+      YYCASE_(0, YY_("syntax error"));
+      YYCASE_(1, YY_("syntax error, unexpected %s"));
+      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
+      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+#undef YYCASE_
+    }
+
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
+  {
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysz
+          = yystrlen (yysymbol_name (yyarg[yyi]));
+        if (YYSIZE_MAXIMUM - yysize < yysz)
+          yysize_overflow = yytrue;
+        else
+          yysize += yysz;
+      }
+  }
+
+  if (!yysize_overflow)
+    yymsg = YY_CAST (char *, YYMALLOC (YY_CAST (YYSIZE_T, yysize)));
+
+  if (yymsg)
+    {
+      char *yyp = yymsg;
+      int yyi = 0;
+      while ((*yyp = *yyformat))
+        {
+          if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
+            {
+              yyp = yystpcpy (yyp, yysymbol_name (yyarg[yyi++]));
+              yyformat += 2;
+            }
+          else
+            {
+              ++yyp;
+              ++yyformat;
+            }
+        }
+      yyerror (&yylloc, context, yymsg);
+      YYFREE (yymsg);
+    }
+  else
+    {
+      yyerror (&yylloc, context, YY_("syntax error"));
+      yyMemoryExhausted (yystackp);
+    }
+  }
+  yynerrs += 1;
+}
+
+/* Recover from a syntax error on *YYSTACKP, assuming that *YYSTACKP->YYTOKENP,
+   yylval, and yylloc are the syntactic category, semantic value, and location
+   of the lookahead.  */
+static void
+yyrecoverSyntaxError (yyGLRStack* yystackp, cypher_parser_context *context)
+{
+  if (yystackp->yyerrState == 3)
+    /* We just shifted the error token and (perhaps) took some
+       reductions.  Skip tokens until we can proceed.  */
+    while (yytrue)
+      {
+        yysymbol_kind_t yytoken;
+        int yyj;
+        if (yychar == CYPHER_YYEOF)
+          yyFail (yystackp, &yylloc, context, YY_NULLPTR);
+        if (yychar != CYPHER_CYPHER_YYEMPTY)
+          {
+            /* We throw away the lookahead, but the error range
+               of the shifted error token must take it into account.  */
+            yyGLRState *yys = yystackp->yytops.yystates[0];
+            yyGLRStackItem yyerror_range[3];
+            yyerror_range[1].yystate.yyloc = yys->yyloc;
+            yyerror_range[2].yystate.yyloc = yylloc;
+            YYLLOC_DEFAULT ((yys->yyloc), yyerror_range, 2);
+            yytoken = YYTRANSLATE (yychar);
+            yydestruct ("Error: discarding",
+                        yytoken, &yylval, &yylloc, context);
+            yychar = CYPHER_CYPHER_YYEMPTY;
+          }
+        yytoken = yygetToken (&yychar, yystackp, context);
+        yyj = yypact[yystackp->yytops.yystates[0]->yylrState];
+        if (yypact_value_is_default (yyj))
+          return;
+        yyj += yytoken;
+        if (yyj < 0 || YYLAST < yyj || yycheck[yyj] != yytoken)
+          {
+            if (yydefact[yystackp->yytops.yystates[0]->yylrState] != 0)
+              return;
+          }
+        else if (! yytable_value_is_error (yytable[yyj]))
+          return;
+      }
+
+  /* Reduce to one stack.  */
+  {
+    YYPTRDIFF_T yyk;
+    for (yyk = 0; yyk < yystackp->yytops.yysize; yyk += 1)
+      if (yystackp->yytops.yystates[yyk] != YY_NULLPTR)
+        break;
+    if (yyk >= yystackp->yytops.yysize)
+      yyFail (yystackp, &yylloc, context, YY_NULLPTR);
+    for (yyk += 1; yyk < yystackp->yytops.yysize; yyk += 1)
+      yymarkStackDeleted (yystackp, yyk);
+    yyremoveDeletes (yystackp);
+    yycompressStack (yystackp);
+  }
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  yystackp->yyerrState = 3;
+  while (yystackp->yytops.yystates[0] != YY_NULLPTR)
+    {
+      yyGLRState *yys = yystackp->yytops.yystates[0];
+      int yyj = yypact[yys->yylrState];
+      if (! yypact_value_is_default (yyj))
+        {
+          yyj += YYSYMBOL_YYerror;
+          if (0 <= yyj && yyj <= YYLAST && yycheck[yyj] == YYSYMBOL_YYerror
+              && yyisShiftAction (yytable[yyj]))
+            {
+              /* Shift the error token.  */
+              int yyaction = yytable[yyj];
+              /* First adjust its location.*/
+              YYLTYPE yyerrloc;
+              yystackp->yyerror_range[2].yystate.yyloc = yylloc;
+              YYLLOC_DEFAULT (yyerrloc, (yystackp->yyerror_range), 2);
+              YY_SYMBOL_PRINT ("Shifting", yy_accessing_symbol (yyaction),
+                               &yylval, &yyerrloc);
+              yyglrShift (yystackp, 0, yyaction,
+                          yys->yyposn, &yylval, &yyerrloc);
+              yys = yystackp->yytops.yystates[0];
+              break;
+            }
+        }
+      yystackp->yyerror_range[1].yystate.yyloc = yys->yyloc;
+      if (yys->yypred != YY_NULLPTR)
+        yydestroyGLRState ("Error: popping", yys, context);
+      yystackp->yytops.yystates[0] = yys->yypred;
+      yystackp->yynextFree -= 1;
+      yystackp->yyspaceLeft += 1;
+    }
+  if (yystackp->yytops.yystates[0] == YY_NULLPTR)
+    yyFail (yystackp, &yylloc, context, YY_NULLPTR);
+}
+
+#define YYCHK1(YYE)                             \
+  do {                                          \
+    switch (YYE) {                              \
+    case yyok:     break;                       \
+    case yyabort:  goto yyabortlab;             \
+    case yyaccept: goto yyacceptlab;            \
+    case yyerr:    goto yyuser_error;           \
+    case yynomem:  goto yyexhaustedlab;         \
+    default:       goto yybuglab;               \
+    }                                           \
+  } while (0)
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (cypher_parser_context *context)
+{
+  int yyresult;
+  yyGLRStack yystack;
+  yyGLRStack* const yystackp = &yystack;
+  YYPTRDIFF_T yyposn;
+
+  YY_DPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = CYPHER_CYPHER_YYEMPTY;
+  yylval = yyval_default;
+  yylloc = yyloc_default;
+
+  if (! yyinitGLRStack (yystackp, YYINITDEPTH))
+    goto yyexhaustedlab;
+  switch (YYSETJMP (yystack.yyexception_buffer))
+    {
+    case 0: break;
+    case 1: goto yyabortlab;
+    case 2: goto yyexhaustedlab;
+    default: goto yybuglab;
+    }
+  yyglrShift (&yystack, 0, 0, 0, &yylval, &yylloc);
+  yyposn = 0;
+
+  while (yytrue)
+    {
+      /* For efficiency, we have two loops, the first of which is
+         specialized to deterministic operation (single stack, no
+         potential ambiguity).  */
+      /* Standard mode. */
+      while (yytrue)
+        {
+          yy_state_t yystate = yystack.yytops.yystates[0]->yylrState;
+          YY_DPRINTF ((stderr, "Entering state %d\n", yystate));
+          if (yystate == YYFINAL)
+            goto yyacceptlab;
+          if (yyisDefaultedState (yystate))
+            {
+              yyRuleNum yyrule = yydefaultAction (yystate);
+              if (yyrule == 0)
+                {
+                  yystack.yyerror_range[1].yystate.yyloc = yylloc;
+                  yyreportSyntaxError (&yystack, context);
+                  goto yyuser_error;
+                }
+              YYCHK1 (yyglrReduce (&yystack, 0, yyrule, yytrue, context));
+            }
+          else
+            {
+              yysymbol_kind_t yytoken = yygetToken (&yychar, yystackp, context);
+              const short* yyconflicts;
+              int yyaction = yygetLRActions (yystate, yytoken, &yyconflicts);
+              if (*yyconflicts)
+                /* Enter nondeterministic mode.  */
+                break;
+              if (yyisShiftAction (yyaction))
+                {
+                  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+                  yychar = CYPHER_CYPHER_YYEMPTY;
+                  yyposn += 1;
+                  yyglrShift (&yystack, 0, yyaction, yyposn, &yylval, &yylloc);
+                  if (0 < yystack.yyerrState)
+                    yystack.yyerrState -= 1;
+                }
+              else if (yyisErrorAction (yyaction))
+                {
+                  yystack.yyerror_range[1].yystate.yyloc = yylloc;
+                  /* Issue an error message unless the scanner already
+                     did. */
+                  if (yychar != CYPHER_CYPHER_YYerror)
+                    yyreportSyntaxError (&yystack, context);
+                  goto yyuser_error;
+                }
+              else
+                YYCHK1 (yyglrReduce (&yystack, 0, -yyaction, yytrue, context));
+            }
+        }
+
+      /* Nondeterministic mode. */
+      while (yytrue)
+        {
+          yysymbol_kind_t yytoken_to_shift;
+          YYPTRDIFF_T yys;
+
+          for (yys = 0; yys < yystack.yytops.yysize; yys += 1)
+            yystackp->yytops.yylookaheadNeeds[yys] = yychar != CYPHER_CYPHER_YYEMPTY;
+
+          /* yyprocessOneStack returns one of three things:
+
+              - An error flag.  If the caller is yyprocessOneStack, it
+                immediately returns as well.  When the caller is finally
+                yyparse, it jumps to an error label via YYCHK1.
+
+              - yyok, but yyprocessOneStack has invoked yymarkStackDeleted
+                (&yystack, yys), which sets the top state of yys to NULL.  Thus,
+                yyparse's following invocation of yyremoveDeletes will remove
+                the stack.
+
+              - yyok, when ready to shift a token.
+
+             Except in the first case, yyparse will invoke yyremoveDeletes and
+             then shift the next token onto all remaining stacks.  This
+             synchronization of the shift (that is, after all preceding
+             reductions on all stacks) helps prevent double destructor calls
+             on yylval in the event of memory exhaustion.  */
+
+          for (yys = 0; yys < yystack.yytops.yysize; yys += 1)
+            YYCHK1 (yyprocessOneStack (&yystack, yys, yyposn, &yylloc, context));
+          yyremoveDeletes (&yystack);
+          if (yystack.yytops.yysize == 0)
+            {
+              yyundeleteLastStack (&yystack);
+              if (yystack.yytops.yysize == 0)
+                yyFail (&yystack, &yylloc, context, YY_("syntax error"));
+              YYCHK1 (yyresolveStack (&yystack, context));
+              YY_DPRINTF ((stderr, "Returning to deterministic operation.\n"));
+              yystack.yyerror_range[1].yystate.yyloc = yylloc;
+              yyreportSyntaxError (&yystack, context);
+              goto yyuser_error;
+            }
+
+          /* If any yyglrShift call fails, it will fail after shifting.  Thus,
+             a copy of yylval will already be on stack 0 in the event of a
+             failure in the following loop.  Thus, yychar is set to CYPHER_CYPHER_YYEMPTY
+             before the loop to make sure the user destructor for yylval isn't
+             called twice.  */
+          yytoken_to_shift = YYTRANSLATE (yychar);
+          yychar = CYPHER_CYPHER_YYEMPTY;
+          yyposn += 1;
+          for (yys = 0; yys < yystack.yytops.yysize; yys += 1)
+            {
+              yy_state_t yystate = yystack.yytops.yystates[yys]->yylrState;
+              const short* yyconflicts;
+              int yyaction = yygetLRActions (yystate, yytoken_to_shift,
+                              &yyconflicts);
+              /* Note that yyconflicts were handled by yyprocessOneStack.  */
+              YY_DPRINTF ((stderr, "On stack %ld, ", YY_CAST (long, yys)));
+              YY_SYMBOL_PRINT ("shifting", yytoken_to_shift, &yylval, &yylloc);
+              yyglrShift (&yystack, yys, yyaction, yyposn,
+                          &yylval, &yylloc);
+              YY_DPRINTF ((stderr, "Stack %ld now in state %d\n",
+                           YY_CAST (long, yys),
+                           yystack.yytops.yystates[yys]->yylrState));
+            }
+
+          if (yystack.yytops.yysize == 1)
+            {
+              YYCHK1 (yyresolveStack (&yystack, context));
+              YY_DPRINTF ((stderr, "Returning to deterministic operation.\n"));
+              yycompressStack (&yystack);
+              break;
+            }
+        }
+      continue;
+    yyuser_error:
+      yyrecoverSyntaxError (&yystack, context);
+      yyposn = yystack.yytops.yystates[0]->yyposn;
+    }
+
+ yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+ yybuglab:
+  YY_ASSERT (yyfalse);
+  goto yyabortlab;
+
+ yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+ yyexhaustedlab:
+  yyerror (&yylloc, context, YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+ yyreturnlab:
+  if (yychar != CYPHER_CYPHER_YYEMPTY)
+    yydestruct ("Cleanup: discarding lookahead",
+                YYTRANSLATE (yychar), &yylval, &yylloc, context);
+
+  /* If the stack is well-formed, pop the stack until it is empty,
+     destroying its entries as we go.  But free the stack regardless
+     of whether it is well-formed.  */
+  if (yystack.yyitems)
+    {
+      yyGLRState** yystates = yystack.yytops.yystates;
+      if (yystates)
+        {
+          YYPTRDIFF_T yysize = yystack.yytops.yysize;
+          YYPTRDIFF_T yyk;
+          for (yyk = 0; yyk < yysize; yyk += 1)
+            if (yystates[yyk])
+              {
+                while (yystates[yyk])
+                  {
+                    yyGLRState *yys = yystates[yyk];
+                    yystack.yyerror_range[1].yystate.yyloc = yys->yyloc;
+                    if (yys->yypred != YY_NULLPTR)
+                      yydestroyGLRState ("Cleanup: popping", yys, context);
+                    yystates[yyk] = yys->yypred;
+                    yystack.yynextFree -= 1;
+                    yystack.yyspaceLeft += 1;
+                  }
+                break;
+              }
+        }
+      yyfreeGLRStack (&yystack);
+    }
+
+  return yyresult;
+}
+
+/* DEBUGGING ONLY */
+#if CYPHER_YYDEBUG
+/* Print *YYS and its predecessors. */
+static void
+yy_yypstack (yyGLRState* yys)
+{
+  if (yys->yypred)
+    {
+      yy_yypstack (yys->yypred);
+      YY_FPRINTF ((stderr, " -> "));
+    }
+  YY_FPRINTF ((stderr, "%d@%ld", yys->yylrState, YY_CAST (long, yys->yyposn)));
+}
+
+/* Print YYS (possibly NULL) and its predecessors. */
+static void
+yypstates (yyGLRState* yys)
+{
+  if (yys == YY_NULLPTR)
+    YY_FPRINTF ((stderr, "<null>"));
+  else
+    yy_yypstack (yys);
+  YY_FPRINTF ((stderr, "\n"));
+}
+
+/* Print the stack #YYK.  */
+static void
+yypstack (yyGLRStack* yystackp, YYPTRDIFF_T yyk)
+{
+  yypstates (yystackp->yytops.yystates[yyk]);
+}
+
+/* Print all the stacks.  */
+static void
+yypdumpstack (yyGLRStack* yystackp)
+{
+#define YYINDEX(YYX)                                                    \
+  YY_CAST (long,                                                        \
+           ((YYX)                                                       \
+            ? YY_REINTERPRET_CAST (yyGLRStackItem*, (YYX)) - yystackp->yyitems \
+            : -1))
+
+  yyGLRStackItem* yyp;
+  for (yyp = yystackp->yyitems; yyp < yystackp->yynextFree; yyp += 1)
+    {
+      YY_FPRINTF ((stderr, "%3ld. ",
+                   YY_CAST (long, yyp - yystackp->yyitems)));
+      if (*YY_REINTERPRET_CAST (yybool *, yyp))
+        {
+          YY_ASSERT (yyp->yystate.yyisState);
+          YY_ASSERT (yyp->yyoption.yyisState);
+          YY_FPRINTF ((stderr, "Res: %d, LR State: %d, posn: %ld, pred: %ld",
+                       yyp->yystate.yyresolved, yyp->yystate.yylrState,
+                       YY_CAST (long, yyp->yystate.yyposn),
+                       YYINDEX (yyp->yystate.yypred)));
+          if (! yyp->yystate.yyresolved)
+            YY_FPRINTF ((stderr, ", firstVal: %ld",
+                         YYINDEX (yyp->yystate.yysemantics.yyfirstVal)));
+        }
+      else
+        {
+          YY_ASSERT (!yyp->yystate.yyisState);
+          YY_ASSERT (!yyp->yyoption.yyisState);
+          YY_FPRINTF ((stderr, "Option. rule: %d, state: %ld, next: %ld",
+                       yyp->yyoption.yyrule - 1,
+                       YYINDEX (yyp->yyoption.yystate),
+                       YYINDEX (yyp->yyoption.yynext)));
+        }
+      YY_FPRINTF ((stderr, "\n"));
+    }
+
+  YY_FPRINTF ((stderr, "Tops:"));
+  {
+    YYPTRDIFF_T yyi;
+    for (yyi = 0; yyi < yystackp->yytops.yysize; yyi += 1)
+      YY_FPRINTF ((stderr, "%ld: %ld; ", YY_CAST (long, yyi),
+                   YYINDEX (yystackp->yytops.yystates[yyi])));
+    YY_FPRINTF ((stderr, "\n"));
+  }
+#undef YYINDEX
+}
+#endif
+
+#undef yylval
+#undef yychar
+#undef yynerrs
+#undef yylloc
+
+/* Substitute the variable and function names.  */
+#define yyparse cypher_yyparse
+#define yylex   cypher_yylex
+#define yyerror cypher_yyerror
+#define yylval  cypher_yylval
+#define yychar  cypher_yychar
+#define yydebug cypher_yydebug
+#define yynerrs cypher_yynerrs
+#define yylloc  cypher_yylloc
+
+
+#line 1504 "src/backend/parser/cypher_gram.y"
+
+
+/* Error handling function */
+void cypher_yyerror(CYPHER_YYLTYPE *yylloc, cypher_parser_context *context, const char *msg)
+{
+    if (!context || !msg) {
+        return;
+    }
+
+    context->has_error = true;
+    context->error_location = yylloc ? yylloc->first_line : -1;
+
+    /* Create error message with line number - Bison's detailed error mode
+     * provides good context about what was expected */
+    char error_buffer[512];
+    if (yylloc && yylloc->first_line > 0) {
+        snprintf(error_buffer, sizeof(error_buffer),
+                 "Line %d: %s", yylloc->first_line, msg);
+    } else {
+        snprintf(error_buffer, sizeof(error_buffer), "%s", msg);
+    }
+
+    free(context->error_message);
+    context->error_message = strdup(error_buffer);
+}
+
+/* cypher_yylex function is implemented in cypher_parser.c */
@@ -9,6 +9,7 @@
 
 #include "executor/executor_internal.h"
 #include "executor/cypher_executor.h"
+#include "executor/graph_algorithms.h"
 #include "parser/cypher_debug.h"
 
 /* Helper function to execute a single path pattern with variable tracking */
@@ -46,6 +47,7 @@ int execute_path_pattern_with_variables(cypher_executor *executor, cypher_path *
                     set_result_error(result, "Failed to create node");
                     return -1;
                 }
+                csr_graph_record_node_added(executor->cached_graph, node_id);
 
                 result->nodes_created++;
                 CYPHER_DEBUG("Created new node %d", node_id);
@@ -204,6 +206,7 @@ int execute_path_pattern_with_variables(cypher_executor *executor, cypher_path *
                     set_result_error(result, "Failed to create target node");
                     return -1;
                 }
+                csr_graph_record_node_added(executor->cached_graph, target_node_id);
 
                 result->nodes_created++;
                 CYPHER_DEBUG("Created new target node %d", target_node_id);
@@ -320,6 +323,7 @@ int execute_path_pattern_with_variables(cypher_executor *executor, cypher_path *
                 set_result_error(result, "Failed to create relationship");
                 return -1;
             }
+            csr_graph_record_edge_added(executor->cached_graph, edge_id, source_id, target_id, rel_type);
 
             /* Process relationship properties if present */
             if (rel_pattern->properties && rel_pattern->properties->type == AST_NODE_MAP) {
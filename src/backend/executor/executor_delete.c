@@ -9,6 +9,7 @@
 
 #include "executor/executor_internal.h"
 #include "executor/cypher_executor.h"
+#include "executor/graph_algorithms.h"
 #include "parser/cypher_debug.h"
 
 /* Execute MATCH+DELETE query combination */
@@ -184,6 +185,10 @@ int delete_edge_by_id(cypher_executor *executor, int64_t edge_id)
         return -1;
     }
 
+    if (sqlite3_changes(executor->db) > 0) {
+        csr_graph_record_edge_removed(executor->cached_graph, edge_id);
+    }
+
     return 0;
 }
 
@@ -210,6 +215,9 @@ int delete_node_by_id(cypher_executor *executor, int64_t node_id, bool detach)
             return -1;
         }
         CYPHER_DEBUG("Deleted all connected edges for node %lld", node_id);
+
+        /* These go with the node in the cached graph; account for the rows */
+        csr_graph_record_edges_detached(executor->cached_graph, sqlite3_changes(executor->db));
     } else {
         /* Regular DELETE: Check for connected edges (constraint enforcement) */
         char check_sql[256];
@@ -263,8 +271,15 @@ int delete_node_by_id(cypher_executor *executor, int64_t node_id, bool detach)
     if (rc != SQLITE_OK) {
         CYPHER_DEBUG("Failed to delete node: %s", err_msg ? err_msg : "unknown error");
         if (err_msg) sqlite3_free(err_msg);
+        if (detach) {
+            /* Its edges are already gone */
+            csr_graph_mark_stale(executor->cached_graph);
+        }
         return -1;
     }
 
+    /* Removing the node also drops its edges from the cached graph */
+    csr_graph_record_node_removed(executor->cached_graph, node_id);
+
     return 0;
 }
@@ -9,6 +9,7 @@
 
 #include "executor/executor_internal.h"
 #include "executor/cypher_executor.h"
+#include "executor/graph_algorithms.h"
 #include "parser/cypher_debug.h"
 #include "transform/transform_variables.h"
 
@@ -397,6 +398,7 @@ int execute_merge_clause(cypher_executor *executor, cypher_merge *merge, cypher_
                         free_variable_map(var_map);
                         return -1;
                     }
+                    csr_graph_record_node_added(executor->cached_graph, node_id);
 
                     was_created = true;
                     nodes_created_in_merge++;
@@ -520,6 +522,7 @@ int execute_merge_clause(cypher_executor *executor, cypher_merge *merge, cypher_
                             free_variable_map(var_map);
                             return -1;
                         }
+                        csr_graph_record_node_added(executor->cached_graph, target_node_id);
 
                         target_was_created = true;
                         nodes_created_in_merge++;
@@ -614,6 +617,7 @@ int execute_merge_clause(cypher_executor *executor, cypher_merge *merge, cypher_
                         free_variable_map(var_map);
                         return -1;
                     }
+                    csr_graph_record_edge_added(executor->cached_graph, edge_id, source_id, dest_id, rel_type);
 
                     edge_was_created = true;
                     result->relationships_created++;
@@ -868,6 +872,7 @@ int execute_match_merge_query(cypher_executor *executor, cypher_match *match, cy
                         free_variable_map(var_map);
                         return -1;
                     }
+                    csr_graph_record_node_added(executor->cached_graph, node_id);
 
                     was_created = true;
                     nodes_created_in_merge++;
@@ -993,6 +998,7 @@ int execute_match_merge_query(cypher_executor *executor, cypher_match *match, cy
                             free_variable_map(var_map);
                             return -1;
                         }
+                        csr_graph_record_node_added(executor->cached_graph, target_node_id);
 
                         nodes_created_in_merge++;
                         result->nodes_created++;
@@ -1083,6 +1089,7 @@ int execute_match_merge_query(cypher_executor *executor, cypher_match *match, cy
                         free_variable_map(var_map);
                         return -1;
                     }
+                    csr_graph_record_edge_added(executor->cached_graph, edge_id, source_id, dest_id, rel_type);
 
                     result->relationships_created++;
                     CYPHER_DEBUG("MERGE created new edge %d: %d -[:%s]-> %d", edge_id, source_id, rel_type, dest_id);
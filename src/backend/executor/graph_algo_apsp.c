@@ -1,193 +1,348 @@
 /*
  * All Pairs Shortest Path Algorithm Implementation
  *
- * Uses Floyd-Warshall algorithm to compute shortest paths between all pairs.
- * O(V³) time complexity, O(V²) space complexity.
+ * Two strategies, picked from the graph:
+ *
+ * - Unweighted, sparse: a BFS from every source, O(V * (V + E)). Sources
+ *   run in small blocks split across the worker threads, and each block's
+ *   pairs are written out before the next starts, so no V x V matrix is
+ *   ever held.
+ * - Weighted or dense: Floyd-Warshall, O(V³) time and O(V²) space, over a
+ *   float matrix cut into APSP_TILE x APSP_TILE tiles (the blocked
+ *   algorithm of Venkataraman et al.). For each block of intermediate
+ *   nodes k, the diagonal tile is relaxed first, then the tiles sharing its
+ *   rows or columns, then every other tile. Tiles in the last two phases
+ *   are independent, so they are split across the worker threads, and
+ *   each tile's rows stay in cache while all of its k are applied.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
-#include <float.h>
 
 #include "executor/graph_algorithms.h"
 #include "executor/graph_algo_internal.h"
+#include "executor/json_builder.h"
+
+/* Tile edge: three 64 x 64 float tiles fit in a 48KB L1 */
+#define APSP_TILE 64
+
+/* Unweighted graphs with fewer than V² / APSP_DENSE_RATIO edges use BFS */
+#define APSP_DENSE_RATIO 8
 
-#define APSP_INF DBL_MAX
+/* BFS sources per block, per worker thread */
+#define APSP_BFS_SOURCES_PER_THREAD 4
+
+/* Significant digits of hop counts and of float distances */
+#define APSP_HOP_DIGITS 10
+#define APSP_FLOAT_DIGITS 7
+
+static void append_pair(json_builder *jb, const csr_graph *graph, int i, int j, double distance, int digits)
+{
+    const char *source_id = graph->user_ids ? graph->user_ids[i] : NULL;
+    const char *target_id = graph->user_ids ? graph->user_ids[j] : NULL;
+
+    if (source_id && target_id) {
+        jbuf_add_item(jb, "{\"source\":\"%s\",\"target\":\"%s\",\"distance\":%.*g}",
+                      source_id, target_id, digits, distance);
+    } else {
+        /* Fallback to node IDs if user_ids not available */
+        jbuf_add_item(jb, "{\"source\":%lld,\"target\":%lld,\"distance\":%.*g}",
+                      (long long)graph->node_ids[i], (long long)graph->node_ids[j], digits, distance);
+    }
+}
 
 /*
- * Execute All Pairs Shortest Path using Floyd-Warshall algorithm.
- *
- * Returns distances between all reachable pairs of nodes.
- * Only includes pairs where a path exists (distance < infinity).
+ * =============================================================================
+ * BFS from every source
+ * =============================================================================
  */
-graph_algo_result* execute_apsp(sqlite3 *db, csr_graph *cached)
+
+typedef struct {
+    const csr_graph *graph;
+    int first;          /* First source of the block */
+    int count;          /* Sources in the block */
+    int chunks;
+    int *dist;          /* count rows of n hop counts, -1 = unreachable */
+    int **queues;       /* Per chunk, n nodes */
+} bfs_block;
+
+/* Chunk c runs sources c, c + chunks, ... of the block */
+static void bfs_block_chunk(void *ctx, int chunk, int64_t begin, int64_t end)
 {
-    graph_algo_result *result = calloc(1, sizeof(graph_algo_result));
-    if (!result) return NULL;
+    (void)begin;
+    (void)end;
+    bfs_block *block = (bfs_block *)ctx;
+    const csr_graph *graph = block->graph;
+    int n = graph->node_count;
+    int *queue = block->queues[chunk];
 
-    CYPHER_DEBUG("Executing C-based All Pairs Shortest Path (Floyd-Warshall): cached=%s",
-                 cached ? "yes" : "no");
+    for (int i = chunk; i < block->count; i += block->chunks) {
+        int *dist = block->dist + (size_t)i * n;
+        for (int v = 0; v < n; v++) {
+            dist[v] = -1;
+        }
 
-    /* Use cached graph or load from SQLite */
-    csr_graph *graph;
-    bool should_free_graph = false;
+        int s = block->first + i;
+        dist[s] = 0;
+        int head = 0, tail = 0;
+        queue[tail++] = s;
+        while (head < tail) {
+            int u = queue[head++];
+            for (csr_edge_iter it = csr_out_edges(graph, u); csr_edge_next(&it); ) {
+                if (dist[it.node] < 0) {
+                    dist[it.node] = dist[u] + 1;
+                    queue[tail++] = it.node;
+                }
+            }
+        }
+    }
+}
 
-    if (cached) {
-        graph = cached;
-    } else {
-        graph = csr_graph_load(db);
-        should_free_graph = true;
+/* Every reachable pair by BFS; 0 on success */
+static int apsp_bfs(const csr_graph *graph, json_builder *jb)
+{
+    int n = graph->node_count;
+    int block_size = graph_thread_count() * APSP_BFS_SOURCES_PER_THREAD;
+    if (block_size > n) block_size = n;
+
+    int chunks = graph_parallel_chunks((int64_t)block_size * ((int64_t)n + graph->edge_count));
+    if (chunks > block_size) chunks = block_size;
+
+    int *dist = malloc((size_t)block_size * n * sizeof(int));
+    int **queues = calloc(chunks, sizeof(int *));
+    bool ok = dist && queues;
+    for (int c = 0; ok && c < chunks; c++) {
+        queues[c] = malloc(n * sizeof(int));
+        if (!queues[c]) ok = false;
     }
 
-    if (!graph) {
-        result->success = true;
-        result->json_result = strdup("[]");
-        return result;
+    for (int first = 0; ok && first < n; first += block_size) {
+        int count = n - first < block_size ? n - first : block_size;
+        bfs_block block = {graph, first, count, chunks, dist, queues};
+        graph_parallel_for(chunks, chunks, bfs_block_chunk, &block);
+
+        /* Write the block's pairs in source order, then reuse its rows */
+        for (int i = 0; i < count; i++) {
+            const int *row = dist + (size_t)i * n;
+            for (int j = 0; j < n; j++) {
+                if (row[j] > 0) append_pair(jb, graph, first + i, j, row[j], APSP_HOP_DIGITS);
+            }
+        }
     }
 
-    int n = graph->node_count;
+    for (int c = 0; queues && c < chunks; c++) {
+        free(queues[c]);
+    }
+    free(queues);
+    free(dist);
+    return ok ? 0 : -1;
+}
 
-    /* Warn if graph is too large */
-    if (n > 10000) {
-        CYPHER_DEBUG("Warning: APSP on %d nodes requires O(n³) = %.0f operations",
-                     n, (double)n * n * n);
+/*
+ * =============================================================================
+ * Blocked Floyd-Warshall
+ * =============================================================================
+ */
+
+typedef struct {
+    float *dist;        /* n rows of `stride` floats, INFINITY = no path */
+    int n;
+    int stride;         /* n rounded up to whole tiles; padding stays INFINITY */
+    int tiles;          /* Tiles per row */
+    int kb;             /* Tile row/column of the current intermediate nodes */
+} fw_round;
+
+/*
+ * row_i[j] = min(row_i[j], dist_ik + row_k[j]) over one tile. Branch-free
+ * (INFINITY + x stays INFINITY), the rows never alias and the width is a
+ * whole tile, so it vectorizes with no scalar remainder.
+ */
+static inline void relax_row(float *restrict row_i, const float *restrict row_k, float dist_ik)
+{
+    for (int j = 0; j < APSP_TILE; j++) {
+        float through = dist_ik + row_k[j];
+        row_i[j] = through < row_i[j] ? through : row_i[j];
     }
+}
 
-    /* Allocate distance matrix - O(V²) space */
-    double *dist = malloc(n * n * sizeof(double));
-    if (!dist) {
-        if (should_free_graph) csr_graph_free(graph);
-        result->success = false;
-        result->error_message = strdup("Memory allocation failed for distance matrix");
-        return result;
+/* Relax tile (ti, tj) through every k of tile kb */
+static void fw_tile(const fw_round *round, int ti, int tj)
+{
+    int i0 = ti * APSP_TILE, i1 = i0 + APSP_TILE < round->n ? i0 + APSP_TILE : round->n;
+    int k0 = round->kb * APSP_TILE, k1 = k0 + APSP_TILE < round->n ? k0 + APSP_TILE : round->n;
+    size_t j0 = (size_t)tj * APSP_TILE;
+
+    for (int k = k0; k < k1; k++) {
+        const float *row_k = round->dist + (size_t)k * round->stride + j0;
+        for (int i = i0; i < i1; i++) {
+            float *row_i = round->dist + (size_t)i * round->stride;
+            float dist_ik = row_i[k];
+            /* Row k through itself adds d(k,k) = 0: nothing to relax */
+            if (i == k || dist_ik == INFINITY) continue;
+            relax_row(row_i + j0, row_k, dist_ik);
+        }
     }
+}
 
-    /* Initialize distances */
-    for (int i = 0; i < n; i++) {
-        for (int j = 0; j < n; j++) {
-            if (i == j) {
-                dist[i * n + j] = 0.0;
-            } else {
-                dist[i * n + j] = APSP_INF;
-            }
+/* Phase 2: items 0..tiles-1 are the tiles of row kb, tiles..2*tiles-1 those of column kb */
+static void fw_panel_chunk(void *ctx, int chunk, int64_t begin, int64_t end)
+{
+    (void)chunk;
+    fw_round *round = (fw_round *)ctx;
+    for (int64_t t = begin; t < end; t++) {
+        int other = (int)(t % round->tiles);
+        if (other == round->kb) continue;
+        if (t < round->tiles) {
+            fw_tile(round, round->kb, other);
+        } else {
+            fw_tile(round, other, round->kb);
         }
     }
+}
 
-    /* Set direct edge distances to 1 (unweighted) */
-    for (int i = 0; i < n; i++) {
-        int start = graph->row_ptr[i];
-        int end = graph->row_ptr[i + 1];
-        for (int e = start; e < end; e++) {
-            int j = graph->col_idx[e];
-            dist[i * n + j] = 1.0;
+/* Phase 3: every tile outside row and column kb, split by tile row */
+static void fw_rest_chunk(void *ctx, int chunk, int64_t begin, int64_t end)
+{
+    (void)chunk;
+    fw_round *round = (fw_round *)ctx;
+    for (int64_t ti = begin; ti < end; ti++) {
+        if (ti == round->kb) continue;
+        for (int tj = 0; tj < round->tiles; tj++) {
+            if (tj != round->kb) fw_tile(round, (int)ti, tj);
         }
     }
+}
 
-    /* Floyd-Warshall main loop - O(V³) */
-    for (int k = 0; k < n; k++) {
-        for (int i = 0; i < n; i++) {
-            double dist_ik = dist[i * n + k];
-            if (dist_ik >= APSP_INF) continue;  /* Optimization: skip if no path to k */
+/* Every reachable pair by blocked Floyd-Warshall; 0 on success */
+static int apsp_floyd_warshall(const csr_graph *graph, const double *weights, json_builder *jb)
+{
+    int n = graph->node_count;
+    int tiles = (n + APSP_TILE - 1) / APSP_TILE;
+    int stride = tiles * APSP_TILE;
+    float *dist = malloc((size_t)n * stride * sizeof(float));
+    if (!dist) return -1;
 
-            for (int j = 0; j < n; j++) {
-                double dist_kj = dist[k * n + j];
-                if (dist_kj >= APSP_INF) continue;  /* Optimization: skip if no path from k */
+    for (size_t c = 0; c < (size_t)n * stride; c++) {
+        dist[c] = INFINITY;
+    }
+    for (int i = 0; i < n; i++) {
+        dist[(size_t)i * stride + i] = 0.0f;
+    }
 
-                double new_dist = dist_ik + dist_kj;
-                if (new_dist < dist[i * n + j]) {
-                    dist[i * n + j] = new_dist;
-                }
-            }
+    /* Parallel edges keep the lightest */
+    for (int i = 0; i < n; i++) {
+        for (csr_edge_iter it = csr_out_edges(graph, i); csr_edge_next(&it); ) {
+            float w = weights ? (float)weights[it.slot] : 1.0f;
+            float *cell = &dist[(size_t)i * stride + it.node];
+            if (w < *cell) *cell = w;
         }
     }
 
-    CYPHER_DEBUG("Floyd-Warshall completed for %d nodes", n);
+    fw_round round = {dist, n, stride, tiles, 0};
+    int panel_chunks = graph_parallel_chunks(2 * (int64_t)n * APSP_TILE);
+    int rest_chunks = graph_parallel_chunks((int64_t)n * n);
+    if (panel_chunks > 2 * tiles) panel_chunks = 2 * tiles;
+    if (rest_chunks > tiles) rest_chunks = tiles;
+
+    for (round.kb = 0; round.kb < tiles; round.kb++) {
+        fw_tile(&round, round.kb, round.kb);
+        graph_parallel_for(2 * tiles, panel_chunks, fw_panel_chunk, &round);
+        graph_parallel_for(tiles, rest_chunks, fw_rest_chunk, &round);
+    }
+
+    CYPHER_DEBUG("Floyd-Warshall completed for %d nodes (%d x %d tiles)", n, tiles, tiles);
 
-    /* Count reachable pairs (excluding self-loops) */
-    int pair_count = 0;
+    int digits = weights ? APSP_FLOAT_DIGITS : APSP_HOP_DIGITS;
     for (int i = 0; i < n; i++) {
+        const float *row = dist + (size_t)i * stride;
         for (int j = 0; j < n; j++) {
-            if (i != j && dist[i * n + j] < APSP_INF) {
-                pair_count++;
-            }
+            if (i != j && row[j] != INFINITY) append_pair(jb, graph, i, j, row[j], digits);
         }
     }
 
-    CYPHER_DEBUG("Found %d reachable pairs", pair_count);
+    free(dist);
+    return 0;
+}
 
-    /* Build JSON output */
-    /* Estimate: each entry ~80 chars: {"source":"...","target":"...","distance":...} */
-    size_t json_capacity = 64 + pair_count * 100;
-    char *json = malloc(json_capacity);
-    if (!json) {
-        free(dist);
-        if (should_free_graph) csr_graph_free(graph);
-        result->success = false;
-        result->error_message = strdup("Memory allocation failed for JSON result");
+/*
+ * Execute All Pairs Shortest Path.
+ *
+ * Returns distances between all reachable pairs of nodes, in hops or, with
+ * weight_prop, as sums of that edge property (missing values weigh 1.0).
+ * Only includes pairs where a path exists, in source then target order.
+ */
+graph_algo_result* execute_apsp(sqlite3 *db, csr_graph *cached, const char *weight_prop)
+{
+    graph_algo_result *result = calloc(1, sizeof(graph_algo_result));
+    if (!result) return NULL;
+
+    CYPHER_DEBUG("Executing C-based All Pairs Shortest Path: cached=%s, weight=%s",
+                 cached ? "yes" : "no", weight_prop ? weight_prop : "NULL");
+
+    /* Use cached graph or load from SQLite */
+    csr_graph *graph;
+    bool should_free_graph = false;
+
+    if (cached) {
+        graph = cached;
+    } else {
+        graph = csr_graph_load(db);
+        should_free_graph = true;
+    }
+
+    if (!graph) {
+        result->success = true;
+        result->json_result = strdup("[]");
         return result;
     }
 
-    strcpy(json, "[");
-    size_t json_len = 1;
-    int first = 1;
+    int n = graph->node_count;
 
-    for (int i = 0; i < n; i++) {
-        for (int j = 0; j < n; j++) {
-            if (i == j) continue;  /* Skip self-loops */
-
-            double d = dist[i * n + j];
-            if (d >= APSP_INF) continue;  /* Skip unreachable pairs */
-
-            const char *source_id = graph->user_ids ? graph->user_ids[i] : NULL;
-            const char *target_id = graph->user_ids ? graph->user_ids[j] : NULL;
-
-            char entry[256];
-            int entry_len;
-
-            if (source_id && target_id) {
-                entry_len = snprintf(entry, sizeof(entry),
-                                     "%s{\"source\":\"%s\",\"target\":\"%s\",\"distance\":%.10g}",
-                                     first ? "" : ",",
-                                     source_id, target_id, d);
-            } else {
-                /* Fallback to node IDs if user_ids not available */
-                entry_len = snprintf(entry, sizeof(entry),
-                                     "%s{\"source\":%d,\"target\":%d,\"distance\":%.10g}",
-                                     first ? "" : ",",
-                                     graph->node_ids[i], graph->node_ids[j], d);
-            }
+    /* Edge weights if specified (cached on the graph) */
+    const double *weights = weight_prop && graph->edge_count > 0
+                          ? csr_graph_edge_weights(graph, db, weight_prop) : NULL;
+    if (weight_prop && graph->edge_count > 0 && !weights) {
+        if (should_free_graph) csr_graph_free(graph);
+        result->success = false;
+        result->error_message = strdup("Failed to load edge weights");
+        return result;
+    }
 
-            first = 0;
-
-            /* Grow buffer if needed */
-            if (json_len + entry_len >= json_capacity - 2) {
-                json_capacity *= 2;
-                char *new_json = realloc(json, json_capacity);
-                if (!new_json) {
-                    free(json);
-                    free(dist);
-                    if (should_free_graph) csr_graph_free(graph);
-                    result->success = false;
-                    result->error_message = strdup("Memory reallocation failed");
-                    return result;
-                }
-                json = new_json;
-            }
+    bool use_bfs = !weights && graph->edge_count * APSP_DENSE_RATIO < (int64_t)n * n;
 
-            memcpy(json + json_len, entry, entry_len);
-            json_len += entry_len;
-        }
+    /* Warn if graph is too large */
+    if (n > 10000) {
+        CYPHER_DEBUG("Warning: APSP on %d nodes writes up to %.0f pairs", n, (double)n * n);
     }
+    CYPHER_DEBUG("APSP: %s", use_bfs ? "BFS from every source" : "blocked Floyd-Warshall");
 
-    json[json_len] = ']';
-    json[json_len + 1] = '\0';
+    /* Pairs are appended as they are produced */
+    json_builder jb;
+    jbuf_init(&jb, 4096);
+    jbuf_start_array(&jb);
 
-    free(dist);
+    int rc = n == 0 ? 0 : use_bfs ? apsp_bfs(graph, &jb) : apsp_floyd_warshall(graph, weights, &jb);
+
+    jbuf_end_array(&jb);
     if (should_free_graph) csr_graph_free(graph);
 
+    if (rc != 0) {
+        jbuf_free(&jb);
+        result->success = false;
+        result->error_message = strdup(use_bfs ? "Memory allocation failed for BFS buffers"
+                                               : "Memory allocation failed for distance matrix");
+        return result;
+    }
+    if (!jbuf_ok(&jb)) {
+        jbuf_free(&jb);
+        result->success = false;
+        result->error_message = strdup("Memory allocation failed for JSON result");
+        return result;
+    }
+
     result->success = true;
-    result->json_result = json;
+    result->json_result = jbuf_take(&jb);
     return result;
 }
@@ -22,6 +22,7 @@
 #include <math.h>
 #include <float.h>
 #include "executor/graph_algorithms.h"
+#include "executor/graph_algo_internal.h"
 
 #define EARTH_RADIUS_KM 6371.0
 #define PI 3.14159265358979323846
@@ -163,11 +164,9 @@ static int load_node_coordinates(sqlite3 *db, csr_graph *graph,
             double value = sqlite3_column_double(stmt, 1);
 
             /* Find internal index for this node */
-            for (int i = 0; i < n; i++) {
-                if (graph->node_ids[i] == node_id) {
-                    lat[i] = value;
-                    break;
-                }
+            int idx = node_map_find(&graph->node_map, node_id);
+            if (idx >= 0) {
+                lat[idx] = value;
             }
         }
         sqlite3_finalize(stmt);
@@ -184,11 +183,9 @@ static int load_node_coordinates(sqlite3 *db, csr_graph *graph,
             int node_id = sqlite3_column_int(stmt, 0);
             double value = sqlite3_column_double(stmt, 1);
 
-            for (int i = 0; i < n; i++) {
-                if (graph->node_ids[i] == node_id) {
-                    lon[i] = value;
-                    break;
-                }
+            int idx = node_map_find(&graph->node_map, node_id);
+            if (idx >= 0) {
+                lon[idx] = value;
             }
         }
         sqlite3_finalize(stmt);
@@ -199,49 +196,6 @@ static int load_node_coordinates(sqlite3 *db, csr_graph *graph,
     return 0;
 }
 
-/* Load edge weights from database */
-static double* load_edge_weights(sqlite3 *db, csr_graph *graph, const char *weight_prop) {
-    int edge_count = graph->edge_count;
-    double *weights = malloc(edge_count * sizeof(double));
-
-    if (!weights) return NULL;
-
-    /* Default weight = 1.0 */
-    for (int i = 0; i < edge_count; i++) {
-        weights[i] = 1.0;
-    }
-
-    if (!weight_prop) return weights;
-
-    /* Query edge weights */
-    char sql[512];
-    snprintf(sql, sizeof(sql),
-        "SELECT e.rowid, ep.value FROM edges e "
-        "JOIN edge_props_real ep ON e.rowid = ep.edge_id "
-        "WHERE ep.key_id = (SELECT id FROM property_keys WHERE key = '%s')",
-        weight_prop);
-
-    sqlite3_stmt *stmt;
-    if (sqlite3_prepare_v2(db, sql, -1, &stmt, NULL) == SQLITE_OK) {
-        while (sqlite3_step(stmt) == SQLITE_ROW) {
-            int edge_id = sqlite3_column_int(stmt, 0);
-            double weight = sqlite3_column_double(stmt, 1);
-
-            /* Find edge in CSR structure */
-            for (int u = 0; u < graph->node_count; u++) {
-                for (int j = graph->row_ptr[u]; j < graph->row_ptr[u + 1]; j++) {
-                    /* This is a simplification - we'd need edge IDs in CSR for exact matching */
-                    (void)edge_id;  /* Suppress unused warning */
-                    (void)weight;
-                }
-            }
-        }
-        sqlite3_finalize(stmt);
-    }
-
-    return weights;
-}
-
 graph_algo_result* execute_astar(sqlite3 *db, csr_graph *cached, const char *source_id, const char *target_id,
                                   const char *weight_prop, const char *lat_prop, const char *lon_prop) {
     graph_algo_result *result = malloc(sizeof(graph_algo_result));
@@ -271,15 +225,8 @@ graph_algo_result* execute_astar(sqlite3 *db, csr_graph *cached, const char *sou
     int n = graph->node_count;
 
     /* Find source and target nodes */
-    int source = -1, target = -1;
-    for (int i = 0; i < n; i++) {
-        if (graph->user_ids[i] && strcmp(graph->user_ids[i], source_id) == 0) {
-            source = i;
-        }
-        if (graph->user_ids[i] && strcmp(graph->user_ids[i], target_id) == 0) {
-            target = i;
-        }
-    }
+    int source = find_node_by_user_id(graph, source_id);
+    int target = find_node_by_user_id(graph, target_id);
 
     if (source == -1 || target == -1) {
         if (should_free_graph) csr_graph_free(graph);
@@ -307,18 +254,18 @@ graph_algo_result* execute_astar(sqlite3 *db, csr_graph *cached, const char *sou
     }
 
     /* Load edge weights */
-    double *edge_weights = load_edge_weights(db, graph, weight_prop);
+    /* Edge weights if specified (cached on the graph) */
+    const double *edge_weights = weight_prop ? csr_graph_edge_weights(graph, db, weight_prop) : NULL;
 
     /* A* algorithm */
     double *g_score = malloc(n * sizeof(double));
     int *came_from = malloc(n * sizeof(int));
     int *closed = calloc(n, sizeof(int));
 
-    if (!g_score || !came_from || !closed || !edge_weights) {
+    if (!g_score || !came_from || !closed) {
         free(g_score);
         free(came_from);
         free(closed);
-        free(edge_weights);
         free(lat);
         free(lon);
         if (should_free_graph) csr_graph_free(graph);
@@ -338,7 +285,6 @@ graph_algo_result* execute_astar(sqlite3 *db, csr_graph *cached, const char *sou
         free(g_score);
         free(came_from);
         free(closed);
-        free(edge_weights);
         free(lat);
         free(lon);
         if (should_free_graph) csr_graph_free(graph);
@@ -375,12 +321,12 @@ graph_algo_result* execute_astar(sqlite3 *db, csr_graph *cached, const char *sou
         }
 
         /* Explore neighbors */
-        for (int j = graph->row_ptr[current]; j < graph->row_ptr[current + 1]; j++) {
-            int neighbor = graph->col_idx[j];
+        for (csr_edge_iter it = csr_out_edges(graph, current); csr_edge_next(&it); ) {
+            int neighbor = it.node;
 
             if (closed[neighbor]) continue;
 
-            double weight = edge_weights[j];
+            double weight = edge_weights ? edge_weights[it.slot] : 1.0;
             double tentative_g = g_score[current] + weight;
 
             if (tentative_g < g_score[neighbor]) {
@@ -410,7 +356,6 @@ graph_algo_result* execute_astar(sqlite3 *db, csr_graph *cached, const char *sou
         free(g_score);
         free(came_from);
         free(closed);
-        free(edge_weights);
         free(lat);
         free(lon);
         if (should_free_graph) csr_graph_free(graph);
@@ -456,7 +401,6 @@ graph_algo_result* execute_astar(sqlite3 *db, csr_graph *cached, const char *sou
     free(g_score);
     free(came_from);
     free(closed);
-    free(edge_weights);
     free(lat);
     free(lon);
     if (should_free_graph) csr_graph_free(graph);
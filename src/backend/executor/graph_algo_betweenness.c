@@ -4,13 +4,20 @@
  * Betweenness Centrality using Brandes' algorithm.
  * Measures how often a node lies on shortest paths between other nodes.
  * O(VE) complexity for unweighted graphs.
+ *
+ * Sources are split across the worker threads (gql_graph_threads()). Each
+ * thread keeps its own path counts, dependencies and scores, and the
+ * scores are added up once every source is done. For graphs too large for
+ * O(VE), a sample of k sources gives an unbiased estimate.
  */
 
 #include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <math.h>
 #include "executor/graph_algo_internal.h"
+#include "executor/json_builder.h"
 
 /*
  * =============================================================================
@@ -19,47 +26,143 @@
  *
  * For each source node s:
  * 1. BFS to find shortest path counts (sigma) and distances (d)
- * 2. Track predecessors on shortest paths
- * 3. Backtrack to accumulate dependencies (delta)
- * 4. Add delta to betweenness scores
+ * 2. Backtrack in reverse BFS order to accumulate dependencies (delta);
+ *    the predecessors of w are its in-neighbours one step closer to s
+ * 3. Add delta to betweenness scores
+ *
+ * Path counts are doubles: they grow exponentially with depth on dense
+ * graphs and would overflow an int.
  */
 
-/* Dynamic array for predecessors */
+/* Confidence of the reported error bound of a sampled run (1 - delta) */
+#define BETWEENNESS_ERROR_DELTA 0.05
+
+/* Sources to run and per-chunk scores */
 typedef struct {
-    int *data;
-    int count;
-    int capacity;
-} pred_list;
-
-static void pred_list_init(pred_list *p) {
-    p->data = NULL;
-    p->count = 0;
-    p->capacity = 0;
-}
+    const csr_graph *graph;
+    const int *sources;    /* NULL = every node */
+    int source_count;
+    int chunks;
+    double **scores;       /* Per chunk, n scores (NULL if allocation failed) */
+} brandes_run;
+
+/* Chunk c runs sources c, c + chunks, ... so slow and fast sources spread evenly */
+static void brandes_chunk(void *ctx, int chunk, int64_t begin, int64_t end)
+{
+    (void)begin;
+    (void)end;
+    brandes_run *run = (brandes_run *)ctx;
+    const csr_graph *graph = run->graph;
+    int n = graph->node_count;
+
+    double *score = calloc(n, sizeof(double));
+    double *sigma = calloc(n, sizeof(double));   /* Number of shortest paths */
+    double *delta = calloc(n, sizeof(double));   /* Dependency */
+    int *d = malloc(n * sizeof(int));            /* Distance from source */
+    int *order = malloc(n * sizeof(int));        /* BFS order, backtracked in reverse */
 
-static void pred_list_add(pred_list *p, int val) {
-    if (p->count >= p->capacity) {
-        int new_cap = p->capacity == 0 ? 4 : p->capacity * 2;
-        int *new_data = realloc(p->data, new_cap * sizeof(int));
-        if (!new_data) return;
-        p->data = new_data;
-        p->capacity = new_cap;
+    if (!score || !sigma || !delta || !d || !order) {
+        free(score);
+        score = NULL;
+        goto done;
     }
-    p->data[p->count++] = val;
-}
+    for (int i = 0; i < n; i++) {
+        d[i] = -1;
+    }
+
+    for (int i = chunk; i < run->source_count; i += run->chunks) {
+        int s = run->sources ? run->sources[i] : i;
+
+        sigma[s] = 1.0;
+        d[s] = 0;
+        order[0] = s;
+        int head = 0, tail = 1;
+
+        /* BFS phase - find shortest paths */
+        while (head < tail) {
+            int v = order[head++];
+
+            for (csr_edge_iter it = csr_out_edges(graph, v); csr_edge_next(&it); ) {
+                int w = it.node;
+
+                /* First visit to w? */
+                if (d[w] < 0) {
+                    d[w] = d[v] + 1;
+                    order[tail++] = w;
+                }
+
+                /* Shortest path to w via v? (a coalesced slot is that many paths) */
+                if (d[w] == d[v] + 1) {
+                    sigma[w] += sigma[v] * csr_slot_multiplicity(graph->multiplicity, it.slot);
+                }
+            }
+        }
 
-static void pred_list_clear(pred_list *p) {
-    p->count = 0;
+        /* Backtrack phase - accumulate dependencies (the source scores nothing) */
+        for (int k = tail - 1; k > 0; k--) {
+            int w = order[k];
+            double coefficient = (1.0 + delta[w]) / sigma[w];
+
+            for (csr_edge_iter it = csr_in_edges(graph, w); csr_edge_next(&it); ) {
+                int v = it.node;
+                if (d[v] == d[w] - 1) {
+                    delta[v] += sigma[v] * csr_slot_multiplicity(graph->in_multiplicity, it.slot) * coefficient;
+                }
+            }
+            score[w] += delta[w];
+        }
+
+        /* Reset only what this source touched */
+        for (int k = 0; k < tail; k++) {
+            int v = order[k];
+            sigma[v] = 0.0;
+            delta[v] = 0.0;
+            d[v] = -1;
+        }
+    }
+
+done:
+    run->scores[chunk] = score;
+    free(sigma);
+    free(delta);
+    free(d);
+    free(order);
 }
 
-static void pred_list_free(pred_list *p) {
-    free(p->data);
-    p->data = NULL;
-    p->count = 0;
-    p->capacity = 0;
+/* Partial Fisher-Yates shuffle */
+int* graph_sample_nodes(int n, int k, int64_t seed)
+{
+    int *nodes = malloc(n * sizeof(int));
+    if (!nodes) return NULL;
+    for (int i = 0; i < n; i++) {
+        nodes[i] = i;
+    }
+
+    uint64_t state = (uint64_t)seed;
+    for (int i = 0; i < k; i++) {
+        int j = i + (int)(graph_random_next(&state) % (uint64_t)(n - i));
+        int tmp = nodes[i];
+        nodes[i] = nodes[j];
+        nodes[j] = tmp;
+    }
+    return nodes;
 }
 
-graph_algo_result* execute_betweenness_centrality(sqlite3 *db, csr_graph *cached)
+/*
+ * Execute Betweenness Centrality
+ *
+ * samples = 0 (or at least the node count) runs every source and gives
+ * exact scores. Otherwise `samples` distinct sources are drawn with the
+ * given seed and each score is scaled by n / samples, an unbiased
+ * estimate. Each source adds at most n - 2 to a node, so by Hoeffding's
+ * inequality and a union bound over the nodes, every estimate is within
+ *
+ *     error = n (n - 2) sqrt(ln(2n / 0.05) / (2 samples))
+ *
+ * of its exact score with probability 95%. Sampled rows report `samples`
+ * and `error`.
+ */
+graph_algo_result* execute_betweenness_centrality(sqlite3 *db, csr_graph *cached, int samples, int64_t seed)
 {
     graph_algo_result *result = malloc(sizeof(graph_algo_result));
     if (!result) return NULL;
@@ -87,156 +190,101 @@ graph_algo_result* execute_betweenness_centrality(sqlite3 *db, csr_graph *cached
     }
 
     int n = graph->node_count;
-
-    /* Allocate betweenness scores (initialized to 0) */
-    double *betweenness = calloc(n, sizeof(double));
-    if (!betweenness) {
-        result->error_message = strdup("Failed to allocate betweenness array");
+    if (n == 0) {
         if (should_free_graph) csr_graph_free(graph);
+        result->success = true;
+        result->json_result = strdup("[]");
         return result;
     }
 
-    /* Allocate working arrays */
-    int *sigma = malloc(n * sizeof(int));       /* Number of shortest paths */
-    int *d = malloc(n * sizeof(int));           /* Distance from source */
-    double *delta = malloc(n * sizeof(double)); /* Dependency */
-    pred_list *P = malloc(n * sizeof(pred_list)); /* Predecessors */
-    int *queue = malloc(n * sizeof(int));       /* BFS queue */
-    int *stack = malloc(n * sizeof(int));       /* Stack for backtracking */
-
-    if (!sigma || !d || !delta || !P || !queue || !stack) {
-        free(betweenness);
-        free(sigma);
-        free(d);
-        free(delta);
-        free(P);
-        free(queue);
-        free(stack);
+    bool sampled = samples > 0 && samples < n;
+    int source_count = sampled ? samples : n;
+
+    int *sources = sampled ? graph_sample_nodes(n, samples, seed) : NULL;
+
+    /* Enough chunks to keep every thread busy, one buffer set per chunk */
+    int64_t work = (int64_t)source_count * ((int64_t)n + graph->edge_count);
+    int chunks = graph_parallel_chunks(work);
+    if (chunks > source_count) chunks = source_count > 0 ? source_count : 1;
+
+    double **scores = calloc(chunks, sizeof(double *));
+    if ((sampled && !sources) || !scores) {
+        free(sources);
+        free(scores);
         if (should_free_graph) csr_graph_free(graph);
         result->error_message = strdup("Failed to allocate working arrays");
         return result;
     }
 
-    /* Initialize predecessor lists */
-    for (int i = 0; i < n; i++) {
-        pred_list_init(&P[i]);
-    }
-
-    /* Run Brandes' algorithm from each source node */
-    for (int s = 0; s < n; s++) {
-        /* Initialize for this source */
-        for (int i = 0; i < n; i++) {
-            sigma[i] = 0;
-            d[i] = -1;
-            delta[i] = 0.0;
-            pred_list_clear(&P[i]);
-        }
-
-        sigma[s] = 1;
-        d[s] = 0;
-
-        int queue_front = 0, queue_back = 0;
-        int stack_top = 0;
-
-        queue[queue_back++] = s;
-
-        /* BFS phase - find shortest paths */
-        while (queue_front < queue_back) {
-            int v = queue[queue_front++];
-            stack[stack_top++] = v;
-
-            /* Iterate over neighbors of v */
-            for (int j = graph->row_ptr[v]; j < graph->row_ptr[v + 1]; j++) {
-                int w = graph->col_idx[j];
+    CYPHER_DEBUG("Betweenness: %d of %d sources, %d chunks", source_count, n, chunks);
 
-                /* First visit to w? */
-                if (d[w] < 0) {
-                    d[w] = d[v] + 1;
-                    queue[queue_back++] = w;
-                }
+    brandes_run run = {graph, sources, source_count, chunks, scores};
+    graph_parallel_for(chunks, chunks, brandes_chunk, &run);
+    free(sources);
 
-                /* Shortest path to w via v? */
-                if (d[w] == d[v] + 1) {
-                    sigma[w] += sigma[v];
-                    pred_list_add(&P[w], v);
-                }
-            }
-        }
-
-        /* Backtrack phase - accumulate dependencies */
-        while (stack_top > 0) {
-            int w = stack[--stack_top];
-
-            for (int i = 0; i < P[w].count; i++) {
-                int v = P[w].data[i];
-                double contribution = ((double)sigma[v] / (double)sigma[w]) * (1.0 + delta[w]);
-                delta[v] += contribution;
-            }
-
-            /* Add to betweenness (skip source node) */
-            if (w != s) {
-                betweenness[w] += delta[w];
-            }
+    /* Reduce in chunk order */
+    bool failed = false;
+    for (int c = 0; c < chunks; c++) {
+        if (!scores[c]) failed = true;
+    }
+    double *betweenness = failed ? NULL : scores[0];
+    for (int c = 1; c < chunks && !failed; c++) {
+        for (int i = 0; i < n; i++) {
+            betweenness[i] += scores[c][i];
         }
     }
-
-    /* For undirected interpretation, divide by 2 */
-    /* We treat the graph as directed, so no division needed */
-
-    /* Normalize by (n-1)(n-2) for comparison across graphs of different sizes */
-    /* This is optional - we'll return raw scores for now */
-
-    /* Free predecessor lists */
-    for (int i = 0; i < n; i++) {
-        pred_list_free(&P[i]);
+    for (int c = failed ? 0 : 1; c < chunks; c++) {
+        free(scores[c]);
     }
+    free(scores);
 
-    /* Build JSON result */
-    size_t buf_size = 256 + n * 128;
-    char *json = malloc(buf_size);
-    if (!json) {
-        free(betweenness);
-        free(sigma);
-        free(d);
-        free(delta);
-        free(P);
-        free(queue);
-        free(stack);
+    if (failed) {
         if (should_free_graph) csr_graph_free(graph);
-        result->error_message = strdup("Failed to allocate result buffer");
+        result->error_message = strdup("Failed to allocate working arrays");
         return result;
     }
 
-    char *ptr = json;
-    ptr += sprintf(ptr, "[");
+    double error = 0.0;
+    if (sampled) {
+        double scale = (double)n / samples;
+        for (int i = 0; i < n; i++) {
+            betweenness[i] *= scale;
+        }
+        error = (double)n * (n - 2) * sqrt(log(2.0 * n / BETWEENNESS_ERROR_DELTA) / (2.0 * samples));
+    }
 
-    for (int i = 0; i < n; i++) {
-        if (i > 0) ptr += sprintf(ptr, ",");
+    /* Build JSON result */
+    json_builder jb;
+    jbuf_init(&jb, 256 + n * 128);
+    jbuf_start_array(&jb);
 
+    for (int i = 0; i < n; i++) {
         const char *user_id = graph->user_ids ? graph->user_ids[i] : NULL;
+        jbuf_add_item(&jb, "{\"node_id\":%lld,", (long long)graph->node_ids[i]);
         if (user_id) {
-            ptr += sprintf(ptr, "{\"node_id\":%d,\"user_id\":\"%s\",\"score\":%.6f}",
-                          graph->node_ids[i], user_id, betweenness[i]);
+            jbuf_appendf(&jb, "\"user_id\":\"%s\",", user_id);
         } else {
-            ptr += sprintf(ptr, "{\"node_id\":%d,\"user_id\":null,\"score\":%.6f}",
-                          graph->node_ids[i], betweenness[i]);
+            jbuf_append(&jb, "\"user_id\":null,");
         }
+        jbuf_appendf(&jb, "\"score\":%.6f", betweenness[i]);
+        if (sampled) {
+            jbuf_appendf(&jb, ",\"samples\":%d,\"error\":%.6f", samples, error);
+        }
+        jbuf_append(&jb, "}");
     }
 
-    ptr += sprintf(ptr, "]");
+    jbuf_end_array(&jb);
 
-    result->success = true;
-    result->json_result = json;
-
-    /* Cleanup */
     free(betweenness);
-    free(sigma);
-    free(d);
-    free(delta);
-    free(P);
-    free(queue);
-    free(stack);
     if (should_free_graph) csr_graph_free(graph);
 
+    if (!jbuf_ok(&jb)) {
+        jbuf_free(&jb);
+        result->error_message = strdup("Failed to allocate result buffer");
+        return result;
+    }
+
+    result->success = true;
+    result->json_result = jbuf_take(&jb);
     return result;
 }
@@ -56,20 +56,20 @@ graph_algo_result* execute_degree_centrality(sqlite3 *db, csr_graph *cached)
     jbuf_start_array(&jb);
 
     for (int i = 0; i < n; i++) {
-        int out_degree = graph->row_ptr[i + 1] - graph->row_ptr[i];
-        int in_degree = graph->in_row_ptr[i + 1] - graph->in_row_ptr[i];
+        int out_degree = (int)csr_out_degree(graph, i);
+        int in_degree = (int)csr_in_degree(graph, i);
         int total_degree = out_degree + in_degree;
 
         const char *user_id = graph->user_ids ? graph->user_ids[i] : NULL;
 
         if (user_id) {
             jbuf_add_item(&jb,
-                "{\"node_id\":%d,\"user_id\":\"%s\",\"in_degree\":%d,\"out_degree\":%d,\"degree\":%d}",
-                graph->node_ids[i], user_id, in_degree, out_degree, total_degree);
+                "{\"node_id\":%lld,\"user_id\":\"%s\",\"in_degree\":%d,\"out_degree\":%d,\"degree\":%d}",
+                (long long)graph->node_ids[i], user_id, in_degree, out_degree, total_degree);
         } else {
             jbuf_add_item(&jb,
-                "{\"node_id\":%d,\"user_id\":null,\"in_degree\":%d,\"out_degree\":%d,\"degree\":%d}",
-                graph->node_ids[i], in_degree, out_degree, total_degree);
+                "{\"node_id\":%lld,\"user_id\":null,\"in_degree\":%d,\"out_degree\":%d,\"degree\":%d}",
+                (long long)graph->node_ids[i], in_degree, out_degree, total_degree);
         }
     }
 
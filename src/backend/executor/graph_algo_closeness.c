@@ -1,13 +1,20 @@
 /*
  * graph_algo_closeness.c
  *
- * Closeness Centrality using harmonic centrality variant.
- * Measures how close a node is to all other reachable nodes.
- * O(V * (V + E)) complexity - BFS from each node.
+ * Distance-based centralities: closeness, harmonic centrality,
+ * eccentricity and diameter. Each needs the BFS distances from every node
+ * (O(V * (V + E))); they run on the multi-source BFS of graph_msbfs.c,
+ * which advances MSBFS_WIDTH searches per pass over the edges. Only the
+ * number of nodes at each distance is needed, never the nodes themselves.
  *
- * Uses harmonic centrality to handle disconnected graphs:
- * H(v) = sum of 1/d(v,u) for all reachable nodes u
- * Normalized by (n-1) to produce values in [0,1]
+ * Edges are followed in both directions.
+ *
+ * Closeness is harmonic centrality, which handles disconnected graphs:
+ *     H(v) = sum of 1/d(v,u) over reachable u,
+ * normalized by (n-1) to produce values in [0,1]. The Wasserman-Faust
+ * form is available as an option: with r nodes reachable from v at total
+ * distance D,
+ *     C(v) = (r / (n-1)) * (r / D)
  */
 
 #include <stddef.h>
@@ -15,8 +22,65 @@
 #include <string.h>
 #include <stdio.h>
 #include "executor/graph_algo_internal.h"
+#include "executor/json_builder.h"
+
+/* Per-source distance totals, filled level by level */
+typedef struct {
+    const int *sources;     /* NULL = every node */
+    int64_t *reached;       /* Nodes reachable from the source */
+    int64_t *distance_sum;
+    double *harmonic_sum;
+    int *eccentricity;      /* Largest finite distance */
+} distance_stats;
+
+static void add_level(void *ctx, int first, int count, int depth, const int64_t *reached)
+{
+    distance_stats *stats = (distance_stats *)ctx;
+    for (int i = 0; i < count; i++) {
+        if (reached[i] == 0) continue;
+        int s = stats->sources ? stats->sources[first + i] : first + i;
+        stats->reached[s] += reached[i];
+        stats->distance_sum[s] += reached[i] * depth;
+        stats->harmonic_sum[s] += (double)reached[i] / depth;
+        stats->eccentricity[s] = depth;
+    }
+}
+
+static void distance_stats_free(distance_stats *stats)
+{
+    free(stats->reached);
+    free(stats->distance_sum);
+    free(stats->harmonic_sum);
+    free(stats->eccentricity);
+}
+
+/* Distance totals of the given sources (NULL = every node, indexed by node); 0 on success */
+static int distance_stats_compute(const csr_graph *graph, const int *sources, int source_count,
+                                  distance_stats *stats)
+{
+    int n = graph->node_count;
+    int size = n > 0 ? n : 1;
+    stats->sources = sources;
+    stats->reached = calloc(size, sizeof(int64_t));
+    stats->distance_sum = calloc(size, sizeof(int64_t));
+    stats->harmonic_sum = calloc(size, sizeof(double));
+    stats->eccentricity = calloc(size, sizeof(int));
+    if (!stats->reached || !stats->distance_sum || !stats->harmonic_sum || !stats->eccentricity ||
+        graph_msbfs(graph, sources, source_count, true, add_level, stats) != 0) {
+        distance_stats_free(stats);
+        return -1;
+    }
+    return 0;
+}
+
+/* Shared body of the per-node centralities */
+typedef enum {
+    DISTANCE_HARMONIC,
+    DISTANCE_WASSERMAN_FAUST,
+    DISTANCE_ECCENTRICITY
+} distance_measure;
 
-graph_algo_result* execute_closeness_centrality(sqlite3 *db, csr_graph *cached)
+static graph_algo_result* execute_distance_measure(sqlite3 *db, csr_graph *cached, distance_measure measure)
 {
     graph_algo_result *result = malloc(sizeof(graph_algo_result));
     if (!result) return NULL;
@@ -45,117 +109,182 @@ graph_algo_result* execute_closeness_centrality(sqlite3 *db, csr_graph *cached)
 
     int n = graph->node_count;
 
-    /* Allocate closeness scores (initialized to 0) */
-    double *closeness = calloc(n, sizeof(double));
-    if (!closeness) {
-        result->error_message = strdup("Failed to allocate closeness array");
+    distance_stats stats;
+    if (distance_stats_compute(graph, NULL, n, &stats) != 0) {
         if (should_free_graph) csr_graph_free(graph);
+        result->error_message = strdup("Failed to allocate working arrays");
         return result;
     }
 
-    /* Allocate working arrays for BFS */
-    int *dist = malloc(n * sizeof(int));
-    int *queue = malloc(n * sizeof(int));
+    /* Build JSON result */
+    json_builder jb;
+    jbuf_init(&jb, 256 + n * 128);
+    jbuf_start_array(&jb);
 
-    if (!dist || !queue) {
-        free(closeness);
-        free(dist);
-        free(queue);
-        if (should_free_graph) csr_graph_free(graph);
-        result->error_message = strdup("Failed to allocate working arrays");
-        return result;
-    }
+    for (int i = 0; i < n; i++) {
+        const char *user_id = graph->user_ids ? graph->user_ids[i] : NULL;
+        jbuf_add_item(&jb, "{\"node_id\":%lld,", (long long)graph->node_ids[i]);
+        if (user_id) {
+            jbuf_appendf(&jb, "\"user_id\":\"%s\",", user_id);
+        } else {
+            jbuf_append(&jb, "\"user_id\":null,");
+        }
 
-    /* Calculate harmonic closeness for each node */
-    for (int s = 0; s < n; s++) {
-        /* Initialize distances to -1 (unvisited) */
-        for (int i = 0; i < n; i++) {
-            dist[i] = -1;
+        if (measure == DISTANCE_ECCENTRICITY) {
+            jbuf_appendf(&jb, "\"eccentricity\":%d}", stats.eccentricity[i]);
+            continue;
         }
 
-        dist[s] = 0;
-        int queue_front = 0, queue_back = 0;
-        queue[queue_back++] = s;
+        double score = 0.0;
+        if (n > 1 && stats.reached[i] > 0) {
+            double r = (double)stats.reached[i];
+            if (measure == DISTANCE_WASSERMAN_FAUST) {
+                score = (r / (double)(n - 1)) * (r / (double)stats.distance_sum[i]);
+            } else {
+                score = stats.harmonic_sum[i] / (double)(n - 1);
+            }
+        }
+        jbuf_appendf(&jb, "\"score\":%.6f}", score);
+    }
 
-        double harmonic_sum = 0.0;
+    jbuf_end_array(&jb);
 
-        /* BFS from source node s */
-        while (queue_front < queue_back) {
-            int u = queue[queue_front++];
+    distance_stats_free(&stats);
+    if (should_free_graph) csr_graph_free(graph);
 
-            /* Explore outgoing edges */
-            for (int j = graph->row_ptr[u]; j < graph->row_ptr[u + 1]; j++) {
-                int v = graph->col_idx[j];
+    if (!jbuf_ok(&jb)) {
+        jbuf_free(&jb);
+        result->error_message = strdup("Failed to allocate result buffer");
+        return result;
+    }
 
-                if (dist[v] < 0) {
-                    dist[v] = dist[u] + 1;
-                    queue[queue_back++] = v;
+    result->success = true;
+    result->json_result = jbuf_take(&jb);
+    return result;
+}
 
-                    /* Add contribution to harmonic sum */
-                    harmonic_sum += 1.0 / (double)dist[v];
-                }
-            }
+graph_algo_result* execute_closeness_centrality(sqlite3 *db, csr_graph *cached, bool wasserman_faust)
+{
+    return execute_distance_measure(db, cached, wasserman_faust ? DISTANCE_WASSERMAN_FAUST : DISTANCE_HARMONIC);
+}
 
-            /* Also explore incoming edges (treat as undirected for closeness) */
-            for (int j = graph->in_row_ptr[u]; j < graph->in_row_ptr[u + 1]; j++) {
-                int v = graph->in_col_idx[j];
+graph_algo_result* execute_harmonic_centrality(sqlite3 *db, csr_graph *cached)
+{
+    return execute_distance_measure(db, cached, DISTANCE_HARMONIC);
+}
 
-                if (dist[v] < 0) {
-                    dist[v] = dist[u] + 1;
-                    queue[queue_back++] = v;
+graph_algo_result* execute_eccentricity(sqlite3 *db, csr_graph *cached)
+{
+    return execute_distance_measure(db, cached, DISTANCE_ECCENTRICITY);
+}
 
-                    /* Add contribution to harmonic sum */
-                    harmonic_sum += 1.0 / (double)dist[v];
+/* Plain BFS (both directions): the last node reached, at distance *depth */
+static int farthest_node(const csr_graph *graph, int s, int *dist, int *queue, int *depth)
+{
+    int n = graph->node_count;
+    for (int i = 0; i < n; i++) {
+        dist[i] = -1;
+    }
+
+    dist[s] = 0;
+    int front = 0, back = 0;
+    queue[back++] = s;
+    while (front < back) {
+        int u = queue[front++];
+        for (int dir = 0; dir < 2; dir++) {
+            csr_edge_iter it = dir == 0 ? csr_out_edges(graph, u) : csr_in_edges(graph, u);
+            while (csr_edge_next(&it)) {
+                if (dist[it.node] < 0) {
+                    dist[it.node] = dist[u] + 1;
+                    queue[back++] = it.node;
                 }
             }
         }
-
-        /* Normalize by (n-1) to get value in [0,1] */
-        if (n > 1) {
-            closeness[s] = harmonic_sum / (double)(n - 1);
-        } else {
-            closeness[s] = 0.0;
-        }
     }
 
-    /* Build JSON result */
-    size_t buf_size = 256 + n * 128;
-    char *json = malloc(buf_size);
-    if (!json) {
-        free(closeness);
-        free(dist);
-        free(queue);
-        if (should_free_graph) csr_graph_free(graph);
-        result->error_message = strdup("Failed to allocate result buffer");
-        return result;
+    int last = queue[back - 1];
+    *depth = dist[last];
+    return last;
+}
+
+/*
+ * Execute Diameter
+ *
+ * The largest eccentricity, following edges in both directions (the
+ * longest shortest path within any connected component).
+ *
+ * samples = 0 (or at least the node count) runs from every node and is
+ * exact. Otherwise `samples` random nodes are searched, then a double
+ * sweep runs from the farthest node of the most eccentric sample; the
+ * result is a lower bound, usually tight on real-world graphs.
+ *
+ * Returns {"diameter": int, "exact": bool, "sources": int}
+ */
+graph_algo_result* execute_diameter(sqlite3 *db, csr_graph *cached, int samples, int64_t seed)
+{
+    graph_algo_result *result = calloc(1, sizeof(graph_algo_result));
+    if (!result) return NULL;
+
+    /* Use cached graph or load from SQLite */
+    csr_graph *graph;
+    bool should_free_graph = false;
+
+    if (cached) {
+        graph = cached;
+    } else {
+        graph = csr_graph_load(db);
+        should_free_graph = true;
     }
 
-    char *ptr = json;
-    ptr += sprintf(ptr, "[");
+    int n = graph ? graph->node_count : 0;
+    bool sampled = samples > 0 && samples < n;
+    int source_count = sampled ? samples : n;
 
-    for (int i = 0; i < n; i++) {
-        if (i > 0) ptr += sprintf(ptr, ",");
+    int *sources = sampled ? graph_sample_nodes(n, samples, seed) : NULL;
 
-        const char *user_id = graph->user_ids ? graph->user_ids[i] : NULL;
-        if (user_id) {
-            ptr += sprintf(ptr, "{\"node_id\":%d,\"user_id\":\"%s\",\"score\":%.6f}",
-                          graph->node_ids[i], user_id, closeness[i]);
-        } else {
-            ptr += sprintf(ptr, "{\"node_id\":%d,\"user_id\":null,\"score\":%.6f}",
-                          graph->node_ids[i], closeness[i]);
+    distance_stats stats = {0};
+    bool failed = (sampled && !sources) ||
+                  (n > 0 && distance_stats_compute(graph, sources, source_count, &stats) != 0);
+
+    int diameter = 0;
+    int most_eccentric = -1;
+    for (int i = 0; !failed && i < source_count; i++) {
+        int s = sources ? sources[i] : i;
+        if (most_eccentric < 0 || stats.eccentricity[s] > diameter) {
+            diameter = stats.eccentricity[s];
+            most_eccentric = s;
         }
     }
 
-    ptr += sprintf(ptr, "]");
-
-    result->success = true;
-    result->json_result = json;
+    /* Double sweep: the node farthest from the most eccentric sample is likely peripheral */
+    if (!failed && sampled && most_eccentric >= 0) {
+        int *dist = malloc(n * sizeof(int));
+        int *queue = malloc(n * sizeof(int));
+        if (dist && queue) {
+            int depth = 0;
+            int far = farthest_node(graph, most_eccentric, dist, queue, &depth);
+            farthest_node(graph, far, dist, queue, &depth);
+            if (depth > diameter) diameter = depth;
+            source_count += 2;
+        }
+        free(dist);
+        free(queue);
+    }
 
-    /* Cleanup */
-    free(closeness);
-    free(dist);
-    free(queue);
+    free(sources);
+    if (n > 0 && !failed) distance_stats_free(&stats);
     if (should_free_graph) csr_graph_free(graph);
 
+    if (failed) {
+        result->success = false;
+        result->error_message = strdup("Failed to allocate working arrays");
+        return result;
+    }
+
+    char json[128];
+    snprintf(json, sizeof(json), "{\"diameter\":%d,\"exact\":%s,\"sources\":%d}",
+             diameter, sampled ? "false" : "true", source_count);
+    result->success = true;
+    result->json_result = strdup(json);
     return result;
 }
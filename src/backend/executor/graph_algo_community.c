@@ -64,8 +64,9 @@ graph_algo_result* execute_label_propagation(sqlite3 *db, csr_graph *cached, int
     /* Sparse label counting arrays */
     int *label_counts = calloc(n, sizeof(int));
     int *touched_labels = malloc(n * sizeof(int));
+    const csr_neighbour_sets *adj = csr_graph_undirected(graph);
 
-    if (!label_counts || !touched_labels) {
+    if (!label_counts || !touched_labels || !adj) {
         free(labels);
         free(new_labels);
         free(label_counts);
@@ -81,36 +82,23 @@ graph_algo_result* execute_label_propagation(sqlite3 *db, csr_graph *cached, int
         int changes = 0;
 
         for (int i = 0; i < n; i++) {
-            int in_start = graph->in_row_ptr[i];
-            int in_end = graph->in_row_ptr[i + 1];
-            int out_start = graph->row_ptr[i];
-            int out_end = graph->row_ptr[i + 1];
+            int64_t start = adj->row_ptr[i];
+            int64_t end = adj->row_ptr[i + 1];
 
-            int neighbor_count = (in_end - in_start) + (out_end - out_start);
-
-            if (neighbor_count == 0) {
+            if (start == end) {
                 new_labels[i] = labels[i];
                 continue;
             }
 
             int touched_count = 0;
 
-            /* Count incoming neighbor labels */
-            for (int j = in_start; j < in_end; j++) {
-                int label = labels[graph->in_col_idx[j]];
-                if (label_counts[label] == 0) {
-                    touched_labels[touched_count++] = label;
-                }
-                label_counts[label]++;
-            }
-
-            /* Count outgoing neighbor labels */
-            for (int j = out_start; j < out_end; j++) {
-                int label = labels[graph->col_idx[j]];
+            /* Count neighbor labels, both directions, one per edge */
+            for (int64_t j = start; j < end; j++) {
+                int label = labels[adj->col_idx[j]];
                 if (label_counts[label] == 0) {
                     touched_labels[touched_count++] = label;
                 }
-                label_counts[label]++;
+                label_counts[label] += adj->multiplicity[j];
             }
 
             /* Find best label */
@@ -196,14 +184,14 @@ graph_algo_result* execute_label_propagation(sqlite3 *db, csr_graph *cached, int
 
         if (user_id) {
             entry_len = snprintf(entry, sizeof(entry),
-                                 "%s{\"node_id\":%d,\"user_id\":\"%s\",\"community\":%d}",
+                                 "%s{\"node_id\":%lld,\"user_id\":\"%s\",\"community\":%d}",
                                  (i > 0) ? "," : "",
-                                 graph->node_ids[i], user_id, community_id);
+                                 (long long)graph->node_ids[i], user_id, community_id);
         } else {
             entry_len = snprintf(entry, sizeof(entry),
-                                 "%s{\"node_id\":%d,\"user_id\":null,\"community\":%d}",
+                                 "%s{\"node_id\":%lld,\"user_id\":null,\"community\":%d}",
                                  (i > 0) ? "," : "",
-                                 graph->node_ids[i], community_id);
+                                 (long long)graph->node_ids[i], community_id);
         }
 
         if (json_len + entry_len >= json_capacity - 2) {
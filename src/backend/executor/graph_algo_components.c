@@ -128,9 +128,8 @@ graph_algo_result* execute_wcc(sqlite3 *db, csr_graph *cached)
 
     /* Process all edges (treating as undirected) */
     for (int u = 0; u < graph->node_count; u++) {
-        for (int j = graph->row_ptr[u]; j < graph->row_ptr[u + 1]; j++) {
-            int v = graph->col_idx[j];
-            uf_union(uf, u, v);
+        for (csr_edge_iter it = csr_out_edges(graph, u); csr_edge_next(&it); ) {
+            uf_union(uf, u, it.node);
         }
     }
 
@@ -182,11 +181,11 @@ graph_algo_result* execute_wcc(sqlite3 *db, csr_graph *cached)
 
         const char *user_id = graph->user_ids ? graph->user_ids[i] : NULL;
         if (user_id) {
-            ptr += sprintf(ptr, "{\"node_id\":%d,\"user_id\":\"%s\",\"component\":%d}",
-                          graph->node_ids[i], user_id, component[i]);
+            ptr += sprintf(ptr, "{\"node_id\":%lld,\"user_id\":\"%s\",\"component\":%d}",
+                          (long long)graph->node_ids[i], user_id, component[i]);
         } else {
-            ptr += sprintf(ptr, "{\"node_id\":%d,\"user_id\":null,\"component\":%d}",
-                          graph->node_ids[i], component[i]);
+            ptr += sprintf(ptr, "{\"node_id\":%lld,\"user_id\":null,\"component\":%d}",
+                          (long long)graph->node_ids[i], component[i]);
         }
     }
 
@@ -272,7 +271,7 @@ static void tarjan_free(tarjan_state *t)
 /* Iterative Tarjan's algorithm using explicit call stack */
 typedef struct {
     int node;
-    int edge_idx;
+    csr_edge_iter edges;  /* Outgoing edges not yet visited */
     int phase;  /* 0 = entering, 1 = returning from neighbor */
     int saved_neighbor;
 } call_frame;
@@ -289,7 +288,7 @@ static void tarjan_iterative(csr_graph *graph, tarjan_state *t, int start)
 
     /* Push initial call */
     call_stack[call_top].node = start;
-    call_stack[call_top].edge_idx = graph->row_ptr[start];
+    call_stack[call_top].edges = csr_out_edges(graph, start);
     call_stack[call_top].phase = 0;
     call_top++;
 
@@ -309,9 +308,8 @@ static void tarjan_iterative(csr_graph *graph, tarjan_state *t, int start)
 
         /* Process outgoing edges */
         int found_unvisited = 0;
-        while (frame->edge_idx < graph->row_ptr[v + 1]) {
-            int w = graph->col_idx[frame->edge_idx];
-            frame->edge_idx++;
+        while (csr_edge_next(&frame->edges)) {
+            int w = frame->edges.node;
 
             if (t->index[w] == -1) {
                 /* w not yet visited - recurse */
@@ -319,7 +317,7 @@ static void tarjan_iterative(csr_graph *graph, tarjan_state *t, int start)
 
                 /* Push new frame for w */
                 call_stack[call_top].node = w;
-                call_stack[call_top].edge_idx = graph->row_ptr[w];
+                call_stack[call_top].edges = csr_out_edges(graph, w);
                 call_stack[call_top].phase = 0;
                 call_top++;
                 found_unvisited = 1;
@@ -423,11 +421,11 @@ graph_algo_result* execute_scc(sqlite3 *db, csr_graph *cached)
 
         const char *user_id = graph->user_ids ? graph->user_ids[i] : NULL;
         if (user_id) {
-            ptr += sprintf(ptr, "{\"node_id\":%d,\"user_id\":\"%s\",\"component\":%d}",
-                          graph->node_ids[i], user_id, t->component[i]);
+            ptr += sprintf(ptr, "{\"node_id\":%lld,\"user_id\":\"%s\",\"component\":%d}",
+                          (long long)graph->node_ids[i], user_id, t->component[i]);
         } else {
-            ptr += sprintf(ptr, "{\"node_id\":%d,\"user_id\":null,\"component\":%d}",
-                          graph->node_ids[i], t->component[i]);
+            ptr += sprintf(ptr, "{\"node_id\":%lld,\"user_id\":null,\"component\":%d}",
+                          (long long)graph->node_ids[i], t->component[i]);
         }
     }
 
@@ -18,7 +18,7 @@
 
 /* Result structure for sorting */
 typedef struct {
-    int node_id;
+    int64_t node_id;
     const char *user_id;
     double score;
 } ev_result;
@@ -99,12 +99,8 @@ graph_algo_result* execute_eigenvector_centrality(sqlite3 *db, csr_graph *cached
         /* Multiply by adjacency matrix (using incoming edges) */
         /* For each node, sum the eigenvector values of nodes pointing to it */
         for (int i = 0; i < n; i++) {
-            int in_start = graph->in_row_ptr[i];
-            int in_end = graph->in_row_ptr[i + 1];
-
-            for (int j = in_start; j < in_end; j++) {
-                int source = graph->in_col_idx[j];
-                ev_new[i] += ev[source];
+            for (csr_edge_iter it = csr_in_edges(graph, i); csr_edge_next(&it); ) {
+                ev_new[i] += ev[it.node] * csr_slot_multiplicity(graph->in_multiplicity, it.slot);
             }
         }
 
@@ -188,16 +184,16 @@ graph_algo_result* execute_eigenvector_centrality(sqlite3 *db, csr_graph *cached
         int entry_len;
         if (results[i].user_id) {
             entry_len = snprintf(entry, sizeof(entry),
-                                 "%s{\"node_id\":%d,\"user_id\":\"%s\",\"score\":%.10g}",
+                                 "%s{\"node_id\":%lld,\"user_id\":\"%s\",\"score\":%.10g}",
                                  (i > 0) ? "," : "",
-                                 results[i].node_id,
+                                 (long long)results[i].node_id,
                                  results[i].user_id,
                                  results[i].score);
         } else {
             entry_len = snprintf(entry, sizeof(entry),
-                                 "%s{\"node_id\":%d,\"user_id\":null,\"score\":%.10g}",
+                                 "%s{\"node_id\":%lld,\"user_id\":null,\"score\":%.10g}",
                                  (i > 0) ? "," : "",
-                                 results[i].node_id,
+                                 (long long)results[i].node_id,
                                  results[i].score);
         }
 
@@ -3,92 +3,18 @@
  *
  * K-Nearest Neighbors algorithm.
  * Finds the K most similar nodes to a given node using Jaccard similarity.
+ *
+ * Only nodes sharing an out-neighbour with the source have a non-zero
+ * similarity, so candidates are collected through the in-edges of the
+ * source's out-neighbours; each is scored by intersecting sorted
+ * out-neighbour sets (see csr_graph_out_sets).
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include "executor/graph_algorithms.h"
-
-/* Helper to get neighbors as a sorted array for efficient intersection */
-static int* get_neighbors_sorted(csr_graph *graph, int node_idx, int *count) {
-    int start = graph->row_ptr[node_idx];
-    int end = graph->row_ptr[node_idx + 1];
-    *count = end - start;
-
-    if (*count == 0) return NULL;
-
-    int *neighbors = malloc(*count * sizeof(int));
-    if (!neighbors) return NULL;
-
-    for (int i = 0; i < *count; i++) {
-        neighbors[i] = graph->col_idx[start + i];
-    }
-
-    /* Sort using insertion sort (typically small degree) */
-    for (int i = 1; i < *count; i++) {
-        int key = neighbors[i];
-        int j = i - 1;
-        while (j >= 0 && neighbors[j] > key) {
-            neighbors[j + 1] = neighbors[j];
-            j--;
-        }
-        neighbors[j + 1] = key;
-    }
-
-    return neighbors;
-}
-
-/* Compute intersection and union sizes of two sorted arrays */
-static void compute_intersection_union(int *a, int count_a, int *b, int count_b,
-                                        int *intersection, int *union_size) {
-    int i = 0, j = 0;
-    *intersection = 0;
-    *union_size = 0;
-
-    while (i < count_a && j < count_b) {
-        if (a[i] < b[j]) {
-            (*union_size)++;
-            i++;
-        } else if (a[i] > b[j]) {
-            (*union_size)++;
-            j++;
-        } else {
-            (*intersection)++;
-            (*union_size)++;
-            i++;
-            j++;
-        }
-    }
-
-    *union_size += (count_a - i) + (count_b - j);
-}
-
-/* Compute Jaccard similarity between source node and another node */
-static double jaccard_similarity(csr_graph *graph, int node_b,
-                                  int *neighbors_a, int count_a) {
-    int count_b;
-    int *neighbors_b = get_neighbors_sorted(graph, node_b, &count_b);
-
-    if (count_a == 0 && count_b == 0) {
-        return 0.0;
-    }
-
-    if (count_a == 0 || count_b == 0) {
-        if (neighbors_b) free(neighbors_b);
-        return 0.0;
-    }
-
-    int intersection, union_size;
-    compute_intersection_union(neighbors_a, count_a, neighbors_b, count_b,
-                               &intersection, &union_size);
-
-    free(neighbors_b);
-
-    if (union_size == 0) return 0.0;
-
-    return (double)intersection / (double)union_size;
-}
+#include "executor/graph_algo_internal.h"
 
 /* Structure for storing neighbor similarities */
 typedef struct {
@@ -134,13 +60,7 @@ graph_algo_result* execute_knn(sqlite3 *db, csr_graph *cached, const char *node_
     }
 
     /* Find the source node index */
-    int source_idx = -1;
-    for (int i = 0; i < graph->node_count; i++) {
-        if (graph->user_ids[i] && strcmp(graph->user_ids[i], node_id) == 0) {
-            source_idx = i;
-            break;
-        }
-    }
+    int source_idx = find_node_by_user_id(graph, node_id);
 
     if (source_idx < 0) {
         result->success = true;
@@ -149,25 +69,31 @@ graph_algo_result* execute_knn(sqlite3 *db, csr_graph *cached, const char *node_
         return result;
     }
 
-    /* Get source node's neighbors once */
-    int source_count;
-    int *source_neighbors = get_neighbors_sorted(graph, source_idx, &source_count);
-
-    /* Compute similarity to all other nodes */
-    neighbor_sim *similarities = malloc((graph->node_count - 1) * sizeof(neighbor_sim));
-    if (!similarities) {
+    const csr_neighbour_sets *sets = csr_graph_out_sets(graph);
+    neighbor_sim *similarities = malloc(graph->node_count * sizeof(neighbor_sim));
+    bool *candidate = calloc(graph->node_count, sizeof(bool));
+    if (!sets || !similarities || !candidate) {
         result->success = false;
         result->error_message = strdup("Out of memory");
-        if (source_neighbors) free(source_neighbors);
+        free(similarities);
+        free(candidate);
         if (should_free_graph) csr_graph_free(graph);
         return result;
     }
 
+    /* Mark nodes sharing an out-neighbour with the source */
+    for (int64_t e = sets->row_ptr[source_idx]; e < sets->row_ptr[source_idx + 1]; e++) {
+        for (csr_edge_iter it = csr_in_edges(graph, sets->col_idx[e]); csr_edge_next(&it); ) {
+            candidate[it.node] = true;
+        }
+    }
+
+    /* Compute similarity to the candidates, in node order */
     int sim_count = 0;
     for (int i = 0; i < graph->node_count; i++) {
-        if (i == source_idx) continue;
+        if (i == source_idx || !candidate[i]) continue;
 
-        double sim = jaccard_similarity(graph, i, source_neighbors, source_count);
+        double sim = graph_jaccard(sets, source_idx, i);
 
         /* Only include nodes with non-zero similarity */
         if (sim > 0.0) {
@@ -177,7 +103,7 @@ graph_algo_result* execute_knn(sqlite3 *db, csr_graph *cached, const char *node_
         }
     }
 
-    if (source_neighbors) free(source_neighbors);
+    free(candidate);
 
     /* Sort by similarity descending */
     if (sim_count > 0) {
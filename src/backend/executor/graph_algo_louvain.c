@@ -87,8 +87,8 @@ graph_algo_result* execute_louvain(sqlite3 *db, csr_graph *cached, double resolu
 
     /* Calculate degrees (undirected view) */
     for (int i = 0; i < n; i++) {
-        int out_deg = graph->row_ptr[i + 1] - graph->row_ptr[i];
-        int in_deg = graph->in_row_ptr[i + 1] - graph->in_row_ptr[i];
+        int64_t out_deg = csr_out_degree(graph, i);
+        int64_t in_deg = csr_in_degree(graph, i);
         k[i] = out_deg + in_deg;  /* Unweighted: each edge counts as 1 */
         m += out_deg;  /* Count each edge once (directed -> undirected) */
     }
@@ -109,11 +109,11 @@ graph_algo_result* execute_louvain(sqlite3 *db, csr_graph *cached, double resolu
                 if (i > 0) ptr += sprintf(ptr, ",");
                 const char *user_id = graph->user_ids ? graph->user_ids[i] : NULL;
                 if (user_id) {
-                    ptr += sprintf(ptr, "{\"node_id\":%d,\"user_id\":\"%s\",\"community\":%d}",
-                                  graph->node_ids[i], user_id, i);
+                    ptr += sprintf(ptr, "{\"node_id\":%lld,\"user_id\":\"%s\",\"community\":%d}",
+                                  (long long)graph->node_ids[i], user_id, i);
                 } else {
-                    ptr += sprintf(ptr, "{\"node_id\":%d,\"user_id\":null,\"community\":%d}",
-                                  graph->node_ids[i], i);
+                    ptr += sprintf(ptr, "{\"node_id\":%lld,\"user_id\":null,\"community\":%d}",
+                                  (long long)graph->node_ids[i], i);
                 }
             }
             ptr += sprintf(ptr, "]");
@@ -129,12 +129,15 @@ graph_algo_result* execute_louvain(sqlite3 *db, csr_graph *cached, double resolu
     int *community = malloc(n * sizeof(int));
     community_info *comm_info = malloc(n * sizeof(community_info));
     double *k_i_in = calloc(n, sizeof(double));  /* Working array for edges to each community */
+    int *neighbor_comms = malloc(n * sizeof(int));
+    const csr_neighbour_sets *adj = csr_graph_undirected(graph);
 
-    if (!community || !comm_info || !k_i_in) {
+    if (!community || !comm_info || !k_i_in || !neighbor_comms || !adj) {
         free(k);
         free(community);
         free(comm_info);
         free(k_i_in);
+        free(neighbor_comms);
         if (should_free_graph) csr_graph_free(graph);
         result->error_message = strdup("Failed to allocate working arrays");
         return result;
@@ -157,38 +160,16 @@ graph_algo_result* execute_louvain(sqlite3 *db, csr_graph *cached, double resolu
         for (int i = 0; i < n; i++) {
             int current_comm = community[i];
 
-            /* Reset k_i_in for neighbor communities */
-            /* Calculate edges from i to each neighboring community */
-
             /* Collect unique neighboring communities and edges to them */
-            int *neighbor_comms = malloc(n * sizeof(int));
             int num_neighbor_comms = 0;
 
-            if (!neighbor_comms) continue;
-
-            /* Initialize */
-            for (int c = 0; c < n; c++) {
-                k_i_in[c] = 0.0;
-            }
-
-            /* Count edges to each community (outgoing) */
-            for (int j = graph->row_ptr[i]; j < graph->row_ptr[i + 1]; j++) {
-                int neighbor = graph->col_idx[j];
-                int neighbor_comm = community[neighbor];
-                if (k_i_in[neighbor_comm] == 0.0 && neighbor_comm != current_comm) {
-                    neighbor_comms[num_neighbor_comms++] = neighbor_comm;
-                }
-                k_i_in[neighbor_comm] += 1.0;  /* Unweighted edge */
-            }
-
-            /* Count edges to each community (incoming, for undirected) */
-            for (int j = graph->in_row_ptr[i]; j < graph->in_row_ptr[i + 1]; j++) {
-                int neighbor = graph->in_col_idx[j];
-                int neighbor_comm = community[neighbor];
+            /* Count edges to each community, both directions (undirected) */
+            for (int64_t j = adj->row_ptr[i]; j < adj->row_ptr[i + 1]; j++) {
+                int neighbor_comm = community[adj->col_idx[j]];
                 if (k_i_in[neighbor_comm] == 0.0 && neighbor_comm != current_comm) {
                     neighbor_comms[num_neighbor_comms++] = neighbor_comm;
                 }
-                k_i_in[neighbor_comm] += 1.0;
+                k_i_in[neighbor_comm] += adj->multiplicity[j];  /* Unweighted: one per edge */
             }
 
             /* Find best community to move to */
@@ -241,10 +222,16 @@ graph_algo_result* execute_louvain(sqlite3 *db, csr_graph *cached, double resolu
                 improved = 1;
             }
 
-            free(neighbor_comms);
+            /* Reset only the communities this node touched */
+            for (int c = 0; c < num_neighbor_comms; c++) {
+                k_i_in[neighbor_comms[c]] = 0.0;
+            }
+            k_i_in[current_comm] = 0.0;
         }
     }
 
+    free(neighbor_comms);
+
     /* Renumber communities to be consecutive starting from 0 */
     int *comm_map = malloc(n * sizeof(int));
     if (!comm_map) {
@@ -291,11 +278,11 @@ graph_algo_result* execute_louvain(sqlite3 *db, csr_graph *cached, double resolu
 
         const char *user_id = graph->user_ids ? graph->user_ids[i] : NULL;
         if (user_id) {
-            ptr += sprintf(ptr, "{\"node_id\":%d,\"user_id\":\"%s\",\"community\":%d}",
-                          graph->node_ids[i], user_id, community[i]);
+            ptr += sprintf(ptr, "{\"node_id\":%lld,\"user_id\":\"%s\",\"community\":%d}",
+                          (long long)graph->node_ids[i], user_id, community[i]);
         } else {
-            ptr += sprintf(ptr, "{\"node_id\":%d,\"user_id\":null,\"community\":%d}",
-                          graph->node_ids[i], community[i]);
+            ptr += sprintf(ptr, "{\"node_id\":%lld,\"user_id\":null,\"community\":%d}",
+                          (long long)graph->node_ids[i], community[i]);
         }
     }
 
@@ -1,7 +1,10 @@
 /*
  * PageRank Algorithm Implementation
  *
- * Optimized push-based PageRank with early convergence detection.
+ * Pull-based PageRank: each node sums the rank its in-neighbours send it,
+ * so every node's new rank is written by exactly one thread and the update
+ * runs in parallel without atomics. Iteration stops early once the L1
+ * change of the rank vector falls below a tolerance.
  */
 
 #include <stdio.h>
@@ -14,7 +17,7 @@
 
 /* Result structure for sorting */
 typedef struct {
-    int node_id;
+    int64_t node_id;
     const char *user_id;
     double score;
 } pr_result;
@@ -27,27 +30,64 @@ static int compare_pr_desc(const void *a, const void *b)
     return 0;
 }
 
+/* One pull iteration, split across threads */
+typedef struct {
+    const csr_graph *graph;
+    const float *pr;
+    const float *contrib;       /* damping * pr[u] / out_degree(u) */
+    const float *inv_out_degree;
+    float *pr_new;
+    float *contrib_new;
+    float damping;
+    float teleport;
+    double *delta;              /* Per chunk: L1 change of its nodes' ranks */
+} pull_step;
+
+static void pull_chunk(void *ctx, int chunk, int64_t begin, int64_t end)
+{
+    pull_step *step = (pull_step *)ctx;
+    const csr_graph *graph = step->graph;
+    int first = csr_first_node_at(graph->in_row_ptr, graph->node_count, begin);
+    int last = csr_first_node_at(graph->in_row_ptr, graph->node_count, end);
+
+    double delta = 0.0;
+    for (int v = first; v < last; v++) {
+        float sum = 0.0f;
+        for (csr_edge_iter it = csr_in_edges(graph, v); csr_edge_next(&it); ) {
+            sum += step->contrib[it.node] * csr_slot_multiplicity(graph->in_multiplicity, it.slot);
+        }
+        float rank = step->teleport + sum;
+        delta += fabsf(rank - step->pr[v]);
+        step->pr_new[v] = rank;
+        step->contrib_new[v] = step->damping * rank * step->inv_out_degree[v];
+    }
+    step->delta[chunk] = delta;
+}
+
 /*
- * Execute PageRank algorithm (optimized)
+ * Execute PageRank algorithm
  *
  * Formula: PR(n) = (1-d)/N + d * SUM(PR(m)/out_degree(m)) for all m -> n
  *
- * Optimizations:
  * - Uses float instead of double (2x memory bandwidth)
- * - Pre-computes 1/out_degree to avoid division in inner loop
- * - Early convergence detection (stops if max change < 1e-6)
- * - Push-based approach for better cache locality on outgoing edges
+ * - Each node's outgoing share PR(m)/out_degree(m) is computed once per
+ *   iteration, while its rank is written, not once per edge
+ * - Runs at most `iterations` iterations, stopping once the L1 change of
+ *   the ranks is below tolerance (0 = always run them all)
+ *
+ * With report_iterations, each result row also carries the iterations run.
  *
  * If cached is non-NULL, uses it directly (fast path).
  * If cached is NULL, loads graph from SQLite (original behavior).
  */
-graph_algo_result* execute_pagerank(sqlite3 *db, csr_graph *cached, double damping, int iterations, int top_k)
+graph_algo_result* execute_pagerank(sqlite3 *db, csr_graph *cached, double damping, int iterations,
+                                    double tolerance, int top_k, bool report_iterations)
 {
     graph_algo_result *result = calloc(1, sizeof(graph_algo_result));
     if (!result) return NULL;
 
-    CYPHER_DEBUG("Executing PageRank: damping=%.2f, iterations=%d, top_k=%d, cached=%s",
-                 damping, iterations, top_k, cached ? "yes" : "no");
+    CYPHER_DEBUG("Executing PageRank: damping=%.2f, iterations=%d, tolerance=%g, top_k=%d, cached=%s",
+                 damping, iterations, tolerance, top_k, cached ? "yes" : "no");
 
     /* Use cached graph or load from SQLite */
     csr_graph *graph;
@@ -68,25 +108,32 @@ graph_algo_result* execute_pagerank(sqlite3 *db, csr_graph *cached, double dampi
 
     int n = graph->node_count;
     float dampf = (float)damping;
+    int chunks = graph_parallel_chunks((int64_t)n + graph->edge_count);
 
     /* Allocate PageRank arrays - use float for 2x memory bandwidth */
     float *pr = malloc(n * sizeof(float));
     float *pr_new = malloc(n * sizeof(float));
+    float *contrib = malloc(n * sizeof(float));
+    float *contrib_new = malloc(n * sizeof(float));
     float *inv_out_degree = malloc(n * sizeof(float));
+    double *delta = malloc(chunks * sizeof(double));
 
-    if (!pr || !pr_new || !inv_out_degree) {
+    if (!pr || !pr_new || !contrib || !contrib_new || !inv_out_degree || !delta) {
         free(pr);
         free(pr_new);
+        free(contrib);
+        free(contrib_new);
         free(inv_out_degree);
+        free(delta);
         if (should_free_graph) csr_graph_free(graph);
         result->success = false;
         result->error_message = strdup("Memory allocation failed");
         return result;
     }
 
-    /* Pre-compute inverse out-degrees */
+    /* Pre-compute inverse out-degrees (in edges, so coalesced slots count their multiplicity) */
     for (int i = 0; i < n; i++) {
-        int out_deg = graph->row_ptr[i + 1] - graph->row_ptr[i];
+        int64_t out_deg = csr_out_degree(graph, i);
         inv_out_degree[i] = (out_deg > 0) ? (1.0f / out_deg) : 0.0f;
     }
 
@@ -94,53 +141,46 @@ graph_algo_result* execute_pagerank(sqlite3 *db, csr_graph *cached, double dampi
     float init_pr = 1.0f / n;
     for (int i = 0; i < n; i++) {
         pr[i] = init_pr;
+        contrib[i] = dampf * init_pr * inv_out_degree[i];
     }
 
-    /* PageRank iterations with convergence detection */
-    float teleport = (1.0f - dampf) / n;
-    float convergence_threshold = 1e-6f;
+    pull_step step = {graph, NULL, NULL, inv_out_degree, NULL, NULL, dampf, (1.0f - dampf) / n, delta};
     int actual_iters = 0;
 
-    for (int iter = 0; iter < iterations; iter++) {
+    for (int iter = 0; iter < iterations && n > 0; iter++) {
         actual_iters++;
 
-        /* Initialize new PR with teleport probability */
-        for (int i = 0; i < n; i++) {
-            pr_new[i] = teleport;
-        }
-
-        /* Push-based: each node distributes its rank to neighbors */
-        for (int i = 0; i < n; i++) {
-            float contribution = dampf * pr[i] * inv_out_degree[i];
-            int out_start = graph->row_ptr[i];
-            int out_end = graph->row_ptr[i + 1];
-
-            for (int j = out_start; j < out_end; j++) {
-                int target = graph->col_idx[j];
-                pr_new[target] += contribution;
-            }
-        }
+        step.pr = pr;
+        step.contrib = contrib;
+        step.pr_new = pr_new;
+        step.contrib_new = contrib_new;
+        graph_parallel_for((int64_t)n + graph->in_row_ptr[n], chunks, pull_chunk, &step);
 
-        /* Check convergence and swap */
-        float max_diff = 0.0f;
-        for (int i = 0; i < n; i++) {
-            float diff = pr_new[i] - pr[i];
-            if (diff < 0) diff = -diff;
-            if (diff > max_diff) max_diff = diff;
+        /* Chunk order is fixed, so the total is the same on every run */
+        double change = 0.0;
+        for (int c = 0; c < chunks; c++) {
+            change += delta[c];
         }
 
         float *tmp = pr;
         pr = pr_new;
         pr_new = tmp;
+        tmp = contrib;
+        contrib = contrib_new;
+        contrib_new = tmp;
 
-        if (max_diff < convergence_threshold) {
-            CYPHER_DEBUG("PageRank converged at iteration %d (max_diff=%.2e)", iter, max_diff);
+        if (change < tolerance) {
+            CYPHER_DEBUG("PageRank converged at iteration %d (L1 change %.2e)", iter, change);
             break;
         }
     }
 
     CYPHER_DEBUG("PageRank completed in %d iterations", actual_iters);
 
+    free(contrib);
+    free(contrib_new);
+    free(delta);
+
     /* Build results array for sorting */
     pr_result *results = malloc(n * sizeof(pr_result));
     if (!results) {
@@ -164,7 +204,7 @@ graph_algo_result* execute_pagerank(sqlite3 *db, csr_graph *cached, double dampi
     int result_count = (top_k > 0 && top_k < n) ? top_k : n;
 
     /* Build JSON output */
-    size_t json_capacity = 64 + result_count * 64;
+    size_t json_capacity = 64 + result_count * 80;
     char *json = malloc(json_capacity);
     if (!json) {
         free(results);
@@ -180,22 +220,27 @@ graph_algo_result* execute_pagerank(sqlite3 *db, csr_graph *cached, double dampi
     strcpy(json, "[");
     size_t json_len = 1;
 
+    char iters[32] = "";
+    if (report_iterations) snprintf(iters, sizeof(iters), ",\"iterations\":%d", actual_iters);
+
     for (int i = 0; i < result_count; i++) {
         char entry[512];
         int entry_len;
         if (results[i].user_id) {
             entry_len = snprintf(entry, sizeof(entry),
-                                 "%s{\"node_id\":%d,\"user_id\":\"%s\",\"score\":%.10g}",
+                                 "%s{\"node_id\":%lld,\"user_id\":\"%s\",\"score\":%.10g%s}",
                                  (i > 0) ? "," : "",
-                                 results[i].node_id,
+                                 (long long)results[i].node_id,
                                  results[i].user_id,
-                                 results[i].score);
+                                 results[i].score,
+                                 iters);
         } else {
             entry_len = snprintf(entry, sizeof(entry),
-                                 "%s{\"node_id\":%d,\"user_id\":null,\"score\":%.10g}",
+                                 "%s{\"node_id\":%lld,\"user_id\":null,\"score\":%.10g%s}",
                                  (i > 0) ? "," : "",
-                                 results[i].node_id,
-                                 results[i].score);
+                                 (long long)results[i].node_id,
+                                 results[i].score,
+                                 iters);
         }
 
         if (json_len + entry_len >= json_capacity - 2) {
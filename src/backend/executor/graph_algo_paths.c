@@ -66,54 +66,8 @@ graph_algo_result* execute_dijkstra(sqlite3 *db, csr_graph *cached, const char *
         return result;
     }
 
-    /* Load edge weights if specified */
-    double *weights = NULL;
-    if (weight_prop) {
-        weights = malloc(graph->edge_count * sizeof(double));
-        if (weights) {
-            for (int i = 0; i < graph->edge_count; i++) {
-                weights[i] = 1.0;
-            }
-
-            char sql[256];
-            snprintf(sql, sizeof(sql),
-                "SELECT e.source_id, e.target_id, ep.value FROM edges e "
-                "JOIN edge_props_real ep ON ep.edge_id = e.id "
-                "JOIN property_keys pk ON pk.id = ep.key_id AND pk.key = '%s'",
-                weight_prop);
-
-            sqlite3_stmt *stmt = NULL;
-            if (sqlite3_prepare_v2(db, sql, -1, &stmt, NULL) == SQLITE_OK) {
-                while (sqlite3_step(stmt) == SQLITE_ROW) {
-                    int src_id = sqlite3_column_int(stmt, 0);
-                    int tgt_id = sqlite3_column_int(stmt, 1);
-                    double weight = sqlite3_column_double(stmt, 2);
-
-                    int h = hash_int(src_id, graph->node_idx_size);
-                    while (graph->node_idx[h] != -1 && graph->node_ids[graph->node_idx[h]] != src_id) {
-                        h = (h + 1) % graph->node_idx_size;
-                    }
-                    int src_idx = (graph->node_idx[h] != -1) ? graph->node_idx[h] : -1;
-
-                    h = hash_int(tgt_id, graph->node_idx_size);
-                    while (graph->node_idx[h] != -1 && graph->node_ids[graph->node_idx[h]] != tgt_id) {
-                        h = (h + 1) % graph->node_idx_size;
-                    }
-                    int tgt_idx = (graph->node_idx[h] != -1) ? graph->node_idx[h] : -1;
-
-                    if (src_idx >= 0 && tgt_idx >= 0) {
-                        for (int j = graph->row_ptr[src_idx]; j < graph->row_ptr[src_idx + 1]; j++) {
-                            if (graph->col_idx[j] == tgt_idx) {
-                                weights[j] = weight;
-                                break;
-                            }
-                        }
-                    }
-                }
-                sqlite3_finalize(stmt);
-            }
-        }
-    }
+    /* Edge weights if specified (cached on the graph) */
+    const double *weights = weight_prop ? csr_graph_edge_weights(graph, db, weight_prop) : NULL;
 
     /* Dijkstra's algorithm */
     double *dist = malloc(n * sizeof(double));
@@ -124,7 +78,6 @@ graph_algo_result* execute_dijkstra(sqlite3 *db, csr_graph *cached, const char *
         free(dist);
         free(prev);
         free(visited);
-        free(weights);
         if (should_free_graph) csr_graph_free(graph);
         result->success = false;
         result->error_message = strdup("Memory allocation failed");
@@ -142,7 +95,6 @@ graph_algo_result* execute_dijkstra(sqlite3 *db, csr_graph *cached, const char *
         free(dist);
         free(prev);
         free(visited);
-        free(weights);
         if (should_free_graph) csr_graph_free(graph);
         result->success = false;
         result->error_message = strdup("Memory allocation failed");
@@ -160,9 +112,9 @@ graph_algo_result* execute_dijkstra(sqlite3 *db, csr_graph *cached, const char *
 
         if (u == target_idx) break;
 
-        for (int j = graph->row_ptr[u]; j < graph->row_ptr[u + 1]; j++) {
-            int v = graph->col_idx[j];
-            double w = weights ? weights[j] : 1.0;
+        for (csr_edge_iter it = csr_out_edges(graph, u); csr_edge_next(&it); ) {
+            int v = it.node;
+            double w = weights ? weights[it.slot] : 1.0;
             double alt = dist[u] + w;
 
             if (alt < dist[v]) {
@@ -180,7 +132,6 @@ graph_algo_result* execute_dijkstra(sqlite3 *db, csr_graph *cached, const char *
     if (prev[target_idx] < 0 && source_idx != target_idx) {
         free(dist);
         free(prev);
-        free(weights);
         if (should_free_graph) csr_graph_free(graph);
         result->success = true;
         result->json_result = strdup("{\"path\":[],\"distance\":null,\"found\":false}");
@@ -193,7 +144,6 @@ graph_algo_result* execute_dijkstra(sqlite3 *db, csr_graph *cached, const char *
     if (!path) {
         free(dist);
         free(prev);
-        free(weights);
         if (should_free_graph) csr_graph_free(graph);
         result->success = false;
         result->error_message = strdup("Memory allocation failed");
@@ -220,7 +170,6 @@ graph_algo_result* execute_dijkstra(sqlite3 *db, csr_graph *cached, const char *
         free(dist);
         free(prev);
         free(path);
-        free(weights);
         if (should_free_graph) csr_graph_free(graph);
         result->success = false;
         result->error_message = strdup("Memory allocation failed");
@@ -239,8 +188,8 @@ graph_algo_result* execute_dijkstra(sqlite3 *db, csr_graph *cached, const char *
             entry_len = snprintf(entry, sizeof(entry), "%s\"%s\"",
                                  (i > 0) ? "," : "", user_id);
         } else {
-            entry_len = snprintf(entry, sizeof(entry), "%s%d",
-                                 (i > 0) ? "," : "", graph->node_ids[path[i]]);
+            entry_len = snprintf(entry, sizeof(entry), "%s%lld",
+                                 (i > 0) ? "," : "", (long long)graph->node_ids[path[i]]);
         }
 
         if (json_len + entry_len >= json_capacity - 64) {
@@ -259,7 +208,6 @@ graph_algo_result* execute_dijkstra(sqlite3 *db, csr_graph *cached, const char *
     free(dist);
     free(prev);
     free(path);
-    free(weights);
     if (should_free_graph) csr_graph_free(graph);
 
     result->success = true;
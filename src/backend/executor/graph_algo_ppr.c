@@ -0,0 +1,373 @@
+/*
+ * Personalized PageRank - Local Push from Seed Nodes
+ *
+ * Approximates PageRank with teleports back to a set of seed nodes using
+ * the push method of Andersen, Chung and Lang. Every touched node holds an
+ * estimate p and a residual r; the seeds start with all the residual. A
+ * node whose residual reaches epsilon times its out-degree is pushed: it
+ * keeps (1 - damping) of the residual as rank and hands the rest to its
+ * out-neighbours. Pushing stops when no residual is large enough, at which
+ * point every estimate is within epsilon * out_degree of the exact score.
+ *
+ * Only nodes reached by a push are stored (in a hash table keyed by node
+ * index), so the cost depends on the neighbourhood of the seeds and on
+ * epsilon - at most about 1 / (epsilon * (1 - damping)) edge visits - not
+ * on the size of the graph.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "executor/graph_algorithms.h"
+#include "executor/graph_algo_internal.h"
+#include "executor/json_builder.h"
+
+/* Nodes touched by the push, with their estimate and residual */
+typedef struct {
+    int *slots;         /* Hash slot -> entry, -1 if empty */
+    int capacity;       /* Power of two */
+    int *node;          /* Per entry: node index */
+    int64_t *degree;    /* Per entry: out-degree in edges */
+    double *p;
+    double *r;
+    bool *queued;
+    int count;
+    int entry_capacity;
+} ppr_table;
+
+static void ppr_table_free(ppr_table *t)
+{
+    free(t->slots);
+    free(t->node);
+    free(t->degree);
+    free(t->p);
+    free(t->r);
+    free(t->queued);
+}
+
+static int ppr_table_rehash(ppr_table *t, int capacity)
+{
+    int *slots = malloc(capacity * sizeof(int));
+    if (!slots) return -1;
+    memset(slots, -1, capacity * sizeof(int));
+
+    unsigned int mask = (unsigned int)capacity - 1;
+    for (int e = 0; e < t->count; e++) {
+        unsigned int h = hash_int(t->node[e]) & mask;
+        while (slots[h] != -1) h = (h + 1) & mask;
+        slots[h] = e;
+    }
+    free(t->slots);
+    t->slots = slots;
+    t->capacity = capacity;
+    return 0;
+}
+
+/* Entry for node u, added with zero estimate and residual if new; -1 on failure */
+static int ppr_table_entry(ppr_table *t, const csr_graph *graph, int u)
+{
+    unsigned int mask = (unsigned int)t->capacity - 1;
+    unsigned int h = hash_int(u) & mask;
+    while (t->slots[h] != -1) {
+        if (t->node[t->slots[h]] == u) return t->slots[h];
+        h = (h + 1) & mask;
+    }
+
+    if (t->count >= t->entry_capacity) {
+        int capacity = t->entry_capacity * 2;
+        int *node = realloc(t->node, capacity * sizeof(int));
+        if (node) t->node = node;
+        int64_t *degree = node ? realloc(t->degree, capacity * sizeof(int64_t)) : NULL;
+        if (degree) t->degree = degree;
+        double *p = degree ? realloc(t->p, capacity * sizeof(double)) : NULL;
+        if (p) t->p = p;
+        double *r = p ? realloc(t->r, capacity * sizeof(double)) : NULL;
+        if (r) t->r = r;
+        bool *queued = r ? realloc(t->queued, capacity * sizeof(bool)) : NULL;
+        if (!queued) return -1;
+        t->queued = queued;
+        t->entry_capacity = capacity;
+    }
+
+    int e = t->count++;
+    t->node[e] = u;
+    t->degree[e] = csr_out_degree(graph, u);
+    t->p[e] = 0.0;
+    t->r[e] = 0.0;
+    t->queued[e] = false;
+    t->slots[h] = e;
+
+    /* Keep the load factor at most 0.5 */
+    if (t->count * 2 > t->capacity && ppr_table_rehash(t, t->capacity * 2) != 0) {
+        return -1;
+    }
+    return e;
+}
+
+static int ppr_table_init(ppr_table *t)
+{
+    memset(t, 0, sizeof(*t));
+    t->entry_capacity = 64;
+    t->node = malloc(t->entry_capacity * sizeof(int));
+    t->degree = malloc(t->entry_capacity * sizeof(int64_t));
+    t->p = malloc(t->entry_capacity * sizeof(double));
+    t->r = malloc(t->entry_capacity * sizeof(double));
+    t->queued = malloc(t->entry_capacity * sizeof(bool));
+    if (!t->node || !t->degree || !t->p || !t->r || !t->queued) return -1;
+    return ppr_table_rehash(t, 128);
+}
+
+/* Growable list of entries waiting to be pushed */
+typedef struct {
+    int *items;
+    int count;
+    int capacity;
+} ppr_queue;
+
+static int ppr_queue_add(ppr_queue *q, int e)
+{
+    if (q->count >= q->capacity) {
+        int capacity = q->capacity > 0 ? q->capacity * 2 : 64;
+        int *items = realloc(q->items, capacity * sizeof(int));
+        if (!items) return -1;
+        q->items = items;
+        q->capacity = capacity;
+    }
+    q->items[q->count++] = e;
+    return 0;
+}
+
+/* A residual worth pushing: at least epsilon per out-edge (dangling nodes count one) */
+static inline bool ppr_should_push(const ppr_table *t, int e, double epsilon)
+{
+    return t->r[e] >= epsilon * (t->degree[e] > 0 ? (double)t->degree[e] : 1.0);
+}
+
+/*
+ * Resolve seeds into the table with their share of the starting residual.
+ * seeds is a JSON array: numbers are node IDs, strings are user 'id'
+ * properties. Seeds not in the graph are skipped. Returns the number of
+ * seeds found, or -1 if seeds is not valid JSON.
+ */
+static int add_seeds(sqlite3 *db, const csr_graph *graph, const char *seeds, ppr_table *t)
+{
+    sqlite3_stmt *stmt = NULL;
+    if (sqlite3_prepare_v2(db, "SELECT type, value FROM json_each(?)", -1, &stmt, NULL) != SQLITE_OK) {
+        return -1;
+    }
+    sqlite3_bind_text(stmt, 1, seeds, -1, SQLITE_STATIC);
+
+    int *found = NULL;
+    int found_count = 0;
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        const char *type = (const char *)sqlite3_column_text(stmt, 0);
+        int u = -1;
+        if (type && strcmp(type, "integer") == 0) {
+            u = node_map_find(&graph->node_map, sqlite3_column_int64(stmt, 1));
+        } else if (type && strcmp(type, "text") == 0) {
+            u = find_node_by_user_id((csr_graph *)graph, (const char *)sqlite3_column_text(stmt, 1));
+        }
+        if (u < 0) continue;
+
+        int e = ppr_table_entry(t, graph, u);
+        int *grown = e >= 0 ? realloc(found, (found_count + 1) * sizeof(int)) : NULL;
+        if (!grown) {
+            rc = SQLITE_NOMEM;
+            break;
+        }
+        found = grown;
+        found[found_count++] = e;
+    }
+    sqlite3_finalize(stmt);
+
+    if (rc != SQLITE_DONE) {
+        free(found);
+        return -1;
+    }
+
+    /* Each occurrence of a seed gets an equal share */
+    for (int i = 0; i < found_count; i++) {
+        t->r[found[i]] += 1.0 / found_count;
+    }
+    free(found);
+    return found_count;
+}
+
+/* Scored node for sorting */
+typedef struct {
+    int64_t node_id;
+    int node;
+    double score;
+} ppr_result;
+
+/* Score descending, then node ID */
+static int compare_ppr_desc(const void *a, const void *b)
+{
+    const ppr_result *ra = (const ppr_result *)a, *rb = (const ppr_result *)b;
+    if (ra->score > rb->score) return -1;
+    if (ra->score < rb->score) return 1;
+    return (ra->node_id > rb->node_id) - (ra->node_id < rb->node_id);
+}
+
+/*
+ * Execute push-based Personalized PageRank
+ *
+ * Returns the top_k nodes by score (0 = every node with a score):
+ * [{"node_id": 4, "user_id": "d", "score": 0.31}, ...]
+ */
+graph_algo_result* execute_personalized_pagerank(sqlite3 *db, csr_graph *cached, const char *seeds,
+                                                 double damping, double epsilon, int top_k)
+{
+    graph_algo_result *result = calloc(1, sizeof(graph_algo_result));
+    if (!result) return NULL;
+
+    CYPHER_DEBUG("Executing Personalized PageRank: seeds=%s, damping=%.2f, epsilon=%g, top_k=%d, cached=%s",
+                 seeds ? seeds : "(none)", damping, epsilon, top_k, cached ? "yes" : "no");
+
+    if (!seeds) {
+        result->success = false;
+        result->error_message = strdup("personalizedPageRank() requires seed nodes as a JSON array or list");
+        return result;
+    }
+    if (epsilon <= 0.0 || damping < 0.0 || damping >= 1.0) {
+        result->success = false;
+        result->error_message = strdup("personalizedPageRank() requires 0 <= damping < 1 and epsilon > 0");
+        return result;
+    }
+
+    /* Use cached graph or load from SQLite */
+    csr_graph *graph;
+    bool should_free_graph = false;
+
+    if (cached) {
+        graph = cached;
+    } else {
+        graph = csr_graph_load(db);
+        should_free_graph = true;
+    }
+
+    if (!graph) {
+        result->success = true;
+        result->json_result = strdup("[]");
+        return result;
+    }
+
+    ppr_table t;
+    ppr_queue queue = {0}, next = {0};
+    int seed_count = -1;
+    int64_t pushes = 0;
+    bool failed = ppr_table_init(&t) != 0;
+    if (!failed) {
+        seed_count = add_seeds(db, graph, seeds, &t);
+        if (seed_count < 0) {
+            ppr_table_free(&t);
+            if (should_free_graph) csr_graph_free(graph);
+            result->success = false;
+            result->error_message = strdup("personalizedPageRank() seeds must be a JSON array of node IDs");
+            return result;
+        }
+        for (int e = 0; e < t.count && !failed; e++) {
+            if (ppr_should_push(&t, e, epsilon)) {
+                t.queued[e] = true;
+                failed = ppr_queue_add(&queue, e) != 0;
+            }
+        }
+    }
+
+    /* Push in rounds; nodes whose residual crosses the threshold join the next round */
+    while (!failed && queue.count > 0) {
+        for (int i = 0; i < queue.count && !failed; i++) {
+            int e = queue.items[i];
+            double mass = t.r[e];
+            t.r[e] = 0.0;
+            t.queued[e] = false;
+            t.p[e] += (1.0 - damping) * mass;
+            pushes++;
+
+            /* A dangling node's forwarded share leaves the walk, as in pageRank() */
+            if (t.degree[e] == 0) continue;
+
+            double share = damping * mass / (double)t.degree[e];
+            int u = t.node[e];
+            for (csr_edge_iter it = csr_out_edges(graph, u); csr_edge_next(&it); ) {
+                int v = ppr_table_entry(&t, graph, it.node);
+                if (v < 0) {
+                    failed = true;
+                    break;
+                }
+                t.r[v] += share * csr_slot_multiplicity(graph->multiplicity, it.slot);
+                if (!t.queued[v] && ppr_should_push(&t, v, epsilon)) {
+                    t.queued[v] = true;
+                    if (ppr_queue_add(&next, v) != 0) {
+                        failed = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        ppr_queue swap = queue;
+        queue = next;
+        next = swap;
+        next.count = 0;
+    }
+    free(queue.items);
+    free(next.items);
+
+    CYPHER_DEBUG("Personalized PageRank: %d seeds, %lld pushes, %d nodes touched",
+                 seed_count, (long long)pushes, t.count);
+
+    /* Rank the touched nodes that received a score */
+    ppr_result *results = failed ? NULL : malloc((t.count > 0 ? t.count : 1) * sizeof(ppr_result));
+    if (!results) {
+        ppr_table_free(&t);
+        if (should_free_graph) csr_graph_free(graph);
+        result->success = false;
+        result->error_message = strdup("Memory allocation failed");
+        return result;
+    }
+
+    int scored = 0;
+    for (int e = 0; e < t.count; e++) {
+        if (t.p[e] <= 0.0) continue;
+        results[scored].node_id = graph->node_ids[t.node[e]];
+        results[scored].node = t.node[e];
+        results[scored].score = t.p[e];
+        scored++;
+    }
+    qsort(results, scored, sizeof(ppr_result), compare_ppr_desc);
+
+    int result_count = (top_k > 0 && top_k < scored) ? top_k : scored;
+
+    json_builder jb;
+    jbuf_init(&jb, 64 + result_count * 80);
+    jbuf_start_array(&jb);
+    for (int i = 0; i < result_count; i++) {
+        const char *user_id = graph->user_ids ? graph->user_ids[results[i].node] : NULL;
+        if (user_id) {
+            jbuf_add_item(&jb, "{\"node_id\":%lld,\"user_id\":\"%s\",\"score\":%.10g}",
+                          (long long)results[i].node_id, user_id, results[i].score);
+        } else {
+            jbuf_add_item(&jb, "{\"node_id\":%lld,\"user_id\":null,\"score\":%.10g}",
+                          (long long)results[i].node_id, results[i].score);
+        }
+    }
+    jbuf_end_array(&jb);
+
+    free(results);
+    ppr_table_free(&t);
+    if (should_free_graph) csr_graph_free(graph);
+
+    if (!jbuf_ok(&jb)) {
+        jbuf_free(&jb);
+        result->success = false;
+        result->error_message = strdup("Memory allocation failed");
+        return result;
+    }
+
+    result->success = true;
+    result->json_result = jbuf_take(&jb);
+    return result;
+}
@@ -6,101 +6,19 @@
  *
  * Jaccard(a, b) = |N(a) ∩ N(b)| / |N(a) ∪ N(b)|
  *
- * Where N(x) is the set of neighbors of node x.
+ * Where N(x) is the set of neighbors of node x: its distinct out-neighbours,
+ * from the graph's sorted out-neighbour sets (see csr_graph_out_sets).
+ *
+ * With a positive threshold only pairs sharing a neighbour can qualify, so
+ * the candidates for node a are found through the in-edges of N(a) rather
+ * than by trying every other node.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include "executor/graph_algorithms.h"
-
-/* Helper to get neighbors as a sorted array for efficient intersection */
-static int* get_neighbors_sorted(csr_graph *graph, int node_idx, int *count) {
-    int start = graph->row_ptr[node_idx];
-    int end = graph->row_ptr[node_idx + 1];
-    *count = end - start;
-
-    if (*count == 0) return NULL;
-
-    int *neighbors = malloc(*count * sizeof(int));
-    if (!neighbors) return NULL;
-
-    /* Copy neighbors */
-    for (int i = 0; i < *count; i++) {
-        neighbors[i] = graph->col_idx[start + i];
-    }
-
-    /* Sort using simple insertion sort (typically small degree) */
-    for (int i = 1; i < *count; i++) {
-        int key = neighbors[i];
-        int j = i - 1;
-        while (j >= 0 && neighbors[j] > key) {
-            neighbors[j + 1] = neighbors[j];
-            j--;
-        }
-        neighbors[j + 1] = key;
-    }
-
-    return neighbors;
-}
-
-/* Compute intersection and union sizes of two sorted arrays */
-static void compute_intersection_union(int *a, int count_a, int *b, int count_b,
-                                        int *intersection, int *union_size) {
-    int i = 0, j = 0;
-    *intersection = 0;
-    *union_size = 0;
-
-    while (i < count_a && j < count_b) {
-        if (a[i] < b[j]) {
-            (*union_size)++;
-            i++;
-        } else if (a[i] > b[j]) {
-            (*union_size)++;
-            j++;
-        } else {
-            /* Equal - in both sets */
-            (*intersection)++;
-            (*union_size)++;
-            i++;
-            j++;
-        }
-    }
-
-    /* Add remaining elements */
-    *union_size += (count_a - i) + (count_b - j);
-}
-
-/* Compute Jaccard similarity between two nodes */
-static double jaccard_similarity(csr_graph *graph, int node_a, int node_b) {
-    int count_a, count_b;
-    int *neighbors_a = get_neighbors_sorted(graph, node_a, &count_a);
-    int *neighbors_b = get_neighbors_sorted(graph, node_b, &count_b);
-
-    /* Handle edge cases */
-    if (count_a == 0 && count_b == 0) {
-        /* Both have no neighbors - undefined, return 0 */
-        return 0.0;
-    }
-
-    if (count_a == 0 || count_b == 0) {
-        /* One has no neighbors - no overlap possible */
-        if (neighbors_a) free(neighbors_a);
-        if (neighbors_b) free(neighbors_b);
-        return 0.0;
-    }
-
-    int intersection, union_size;
-    compute_intersection_union(neighbors_a, count_a, neighbors_b, count_b,
-                               &intersection, &union_size);
-
-    free(neighbors_a);
-    free(neighbors_b);
-
-    if (union_size == 0) return 0.0;
-
-    return (double)intersection / (double)union_size;
-}
+#include "executor/graph_algo_internal.h"
 
 /* Structure for storing similarity pairs */
 typedef struct {
@@ -109,6 +27,13 @@ typedef struct {
     double similarity;
 } similarity_pair;
 
+/* Comparison function for sorting node indices ascending */
+static int compare_index(const void *a, const void *b) {
+    int ia = *(const int *)a;
+    int ib = *(const int *)b;
+    return (ia > ib) - (ia < ib);
+}
+
 /* Comparison function for sorting by similarity descending */
 static int compare_similarity(const void *a, const void *b) {
     similarity_pair *pa = (similarity_pair *)a;
@@ -143,19 +68,19 @@ graph_algo_result* execute_node_similarity(sqlite3 *db, csr_graph *cached, const
         return result;
     }
 
+    const csr_neighbour_sets *sets = csr_graph_out_sets(graph);
+    if (!sets) {
+        result->success = false;
+        result->error_message = strdup("Out of memory");
+        if (should_free_graph) csr_graph_free(graph);
+        return result;
+    }
+
     /* Case 1: Specific pair requested */
     if (node1_id && node2_id) {
-        int idx1 = -1, idx2 = -1;
-
         /* Find node indices */
-        for (int i = 0; i < graph->node_count; i++) {
-            if (graph->user_ids[i] && strcmp(graph->user_ids[i], node1_id) == 0) {
-                idx1 = i;
-            }
-            if (graph->user_ids[i] && strcmp(graph->user_ids[i], node2_id) == 0) {
-                idx2 = i;
-            }
-        }
+        int idx1 = find_node_by_user_id(graph, node1_id);
+        int idx2 = find_node_by_user_id(graph, node2_id);
 
         if (idx1 < 0 || idx2 < 0) {
             result->success = true;
@@ -164,7 +89,7 @@ graph_algo_result* execute_node_similarity(sqlite3 *db, csr_graph *cached, const
             return result;
         }
 
-        double sim = jaccard_similarity(graph, idx1, idx2);
+        double sim = graph_jaccard(sets, idx1, idx2);
 
         /* Build JSON result */
         char *json = malloc(256);
@@ -184,38 +109,77 @@ graph_algo_result* execute_node_similarity(sqlite3 *db, csr_graph *cached, const
     }
 
     /* Case 2: All pairs above threshold */
-    /* Allocate space for pairs - worst case is n*(n-1)/2 */
-    int max_pairs = (graph->node_count * (graph->node_count - 1)) / 2;
-    if (max_pairs == 0) {
+    int n = graph->node_count;
+    if (n < 2) {
         result->success = true;
         result->json_result = strdup("[]");
         if (should_free_graph) csr_graph_free(graph);
         return result;
     }
 
-    similarity_pair *pairs = malloc(max_pairs * sizeof(similarity_pair));
-    if (!pairs) {
+    int pair_capacity = 1024;
+    int pair_count = 0;
+    similarity_pair *pairs = malloc(pair_capacity * sizeof(similarity_pair));
+    int *candidates = malloc(n * sizeof(int));
+    int *seen = malloc(n * sizeof(int));
+    if (!pairs || !candidates || !seen) {
+        free(pairs);
+        free(candidates);
+        free(seen);
         result->success = false;
         result->error_message = strdup("Out of memory");
         if (should_free_graph) csr_graph_free(graph);
         return result;
     }
+    for (int i = 0; i < n; i++) seen[i] = -1;
+
+    /* Compute pairwise similarities, j > i in ascending order */
+    for (int i = 0; i < n; i++) {
+        int candidate_count = 0;
+        if (threshold > 0.0) {
+            /* Nodes sharing an out-neighbour with i: in-neighbours of N(i) */
+            for (int64_t e = sets->row_ptr[i]; e < sets->row_ptr[i + 1]; e++) {
+                for (csr_edge_iter it = csr_in_edges(graph, sets->col_idx[e]); csr_edge_next(&it); ) {
+                    if (it.node > i && seen[it.node] != i) {
+                        seen[it.node] = i;
+                        candidates[candidate_count++] = it.node;
+                    }
+                }
+            }
+            qsort(candidates, candidate_count, sizeof(int), compare_index);
+        } else {
+            for (int j = i + 1; j < n; j++) {
+                candidates[candidate_count++] = j;
+            }
+        }
 
-    int pair_count = 0;
-
-    /* Compute all pairwise similarities */
-    for (int i = 0; i < graph->node_count; i++) {
-        for (int j = i + 1; j < graph->node_count; j++) {
-            double sim = jaccard_similarity(graph, i, j);
-
-            if (sim >= threshold) {
-                pairs[pair_count].node1 = i;
-                pairs[pair_count].node2 = j;
-                pairs[pair_count].similarity = sim;
-                pair_count++;
+        for (int c = 0; c < candidate_count; c++) {
+            int j = candidates[c];
+            double sim = graph_jaccard(sets, i, j);
+            if (sim < threshold) continue;
+
+            if (pair_count == pair_capacity) {
+                similarity_pair *grown = realloc(pairs, 2 * (size_t)pair_capacity * sizeof(similarity_pair));
+                if (!grown) {
+                    free(pairs);
+                    free(candidates);
+                    free(seen);
+                    result->success = false;
+                    result->error_message = strdup("Out of memory");
+                    if (should_free_graph) csr_graph_free(graph);
+                    return result;
+                }
+                pairs = grown;
+                pair_capacity *= 2;
             }
+            pairs[pair_count].node1 = i;
+            pairs[pair_count].node2 = j;
+            pairs[pair_count].similarity = sim;
+            pair_count++;
         }
     }
+    free(candidates);
+    free(seen);
 
     /* Sort by similarity descending */
     if (pair_count > 0) {
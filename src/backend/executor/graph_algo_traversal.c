@@ -15,6 +15,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "executor/graph_algorithms.h"
+#include "executor/graph_algo_internal.h"
 
 /* Queue for BFS */
 typedef struct {
@@ -105,6 +106,15 @@ static void dfs_stack_push(dfs_stack *s, int node, int depth) {
     s->top++;
 }
 
+/* Reverse the entries pushed since top was 'from' */
+static void dfs_stack_reverse(dfs_stack *s, int from) {
+    for (int i = from, j = s->top - 1; i < j; i++, j--) {
+        int node = s->data[i];
+        s->data[i] = s->data[j];
+        s->data[j] = node;
+    }
+}
+
 static int dfs_stack_pop(dfs_stack *s, int *depth) {
     s->top--;
     *depth = s->depths[s->top];
@@ -144,13 +154,7 @@ graph_algo_result* execute_bfs(sqlite3 *db, csr_graph *cached, const char *start
     int n = graph->node_count;
 
     /* Find start node */
-    int start = -1;
-    for (int i = 0; i < n; i++) {
-        if (graph->user_ids[i] && strcmp(graph->user_ids[i], start_id) == 0) {
-            start = i;
-            break;
-        }
-    }
+    int start = find_node_by_user_id(graph, start_id);
 
     if (start == -1) {
         if (should_free_graph) csr_graph_free(graph);
@@ -201,8 +205,8 @@ graph_algo_result* execute_bfs(sqlite3 *db, csr_graph *cached, const char *start
         count++;
 
         /* Add neighbors to queue */
-        for (int j = graph->row_ptr[current]; j < graph->row_ptr[current + 1]; j++) {
-            int neighbor = graph->col_idx[j];
+        for (csr_edge_iter it = csr_out_edges(graph, current); csr_edge_next(&it); ) {
+            int neighbor = it.node;
             if (!visited[neighbor]) {
                 visited[neighbor] = 1;
                 bfs_queue_push(queue, neighbor, depth + 1);
@@ -233,8 +237,8 @@ graph_algo_result* execute_bfs(sqlite3 *db, csr_graph *cached, const char *start
         if (i > 0) json[pos++] = ',';
 
         int written = snprintf(json + pos, buf_size - pos,
-            "{\"node_id\":%d,\"user_id\":\"%s\",\"depth\":%d,\"order\":%d}",
-            graph->node_ids[node], user_id, depths[i], i);
+            "{\"node_id\":%lld,\"user_id\":\"%s\",\"depth\":%d,\"order\":%d}",
+            (long long)graph->node_ids[node], user_id, depths[i], i);
 
         if (written < 0 || (size_t)written >= buf_size - pos) {
             buf_size *= 2;
@@ -251,8 +255,8 @@ graph_algo_result* execute_bfs(sqlite3 *db, csr_graph *cached, const char *start
             }
             json = new_json;
             written = snprintf(json + pos, buf_size - pos,
-                "{\"node_id\":%d,\"user_id\":\"%s\",\"depth\":%d,\"order\":%d}",
-                graph->node_ids[node], user_id, depths[i], i);
+                "{\"node_id\":%lld,\"user_id\":\"%s\",\"depth\":%d,\"order\":%d}",
+                (long long)graph->node_ids[node], user_id, depths[i], i);
         }
         pos += written;
     }
@@ -301,13 +305,7 @@ graph_algo_result* execute_dfs(sqlite3 *db, csr_graph *cached, const char *start
     int n = graph->node_count;
 
     /* Find start node */
-    int start = -1;
-    for (int i = 0; i < n; i++) {
-        if (graph->user_ids[i] && strcmp(graph->user_ids[i], start_id) == 0) {
-            start = i;
-            break;
-        }
-    }
+    int start = find_node_by_user_id(graph, start_id);
 
     if (start == -1) {
         if (should_free_graph) csr_graph_free(graph);
@@ -360,12 +358,13 @@ graph_algo_result* execute_dfs(sqlite3 *db, csr_graph *cached, const char *start
         count++;
 
         /* Add neighbors to stack (reverse order for consistent traversal) */
-        for (int j = graph->row_ptr[current + 1] - 1; j >= graph->row_ptr[current]; j--) {
-            int neighbor = graph->col_idx[j];
-            if (!visited[neighbor]) {
-                dfs_stack_push(stack, neighbor, depth + 1);
+        int first = stack->top;
+        for (csr_edge_iter it = csr_out_edges(graph, current); csr_edge_next(&it); ) {
+            if (!visited[it.node]) {
+                dfs_stack_push(stack, it.node, depth + 1);
             }
         }
+        dfs_stack_reverse(stack, first);
     }
 
     /* Build JSON result */
@@ -391,8 +390,8 @@ graph_algo_result* execute_dfs(sqlite3 *db, csr_graph *cached, const char *start
         if (i > 0) json[pos++] = ',';
 
         int written = snprintf(json + pos, buf_size - pos,
-            "{\"node_id\":%d,\"user_id\":\"%s\",\"depth\":%d,\"order\":%d}",
-            graph->node_ids[node], user_id, depths[i], i);
+            "{\"node_id\":%lld,\"user_id\":\"%s\",\"depth\":%d,\"order\":%d}",
+            (long long)graph->node_ids[node], user_id, depths[i], i);
 
         if (written < 0 || (size_t)written >= buf_size - pos) {
             buf_size *= 2;
@@ -409,8 +408,8 @@ graph_algo_result* execute_dfs(sqlite3 *db, csr_graph *cached, const char *start
             }
             json = new_json;
             written = snprintf(json + pos, buf_size - pos,
-                "{\"node_id\":%d,\"user_id\":\"%s\",\"depth\":%d,\"order\":%d}",
-                graph->node_ids[node], user_id, depths[i], i);
+                "{\"node_id\":%lld,\"user_id\":\"%s\",\"depth\":%d,\"order\":%d}",
+                (long long)graph->node_ids[node], user_id, depths[i], i);
         }
         pos += written;
     }
@@ -6,71 +6,40 @@
  * Counts triangles each node participates in and computes local clustering coefficients.
  * A triangle is a set of 3 nodes that are all connected to each other.
  *
- * Algorithm: Node-iterator approach (treats graph as undirected)
- * For each node u:
- *   For each pair of neighbors (v, w) where v < w:
- *     If edge (v, w) exists, increment triangle count for u, v, and w
+ * Algorithm: Edge-iterator approach over the graph's undirected adjacency
+ * (distinct neighbours in either direction, sorted)
+ * For each edge (u, v) with u < v:
+ *   Every common neighbour w of u and v closes a triangle (u, v, w);
+ *   credit u and v once each. Each node is credited twice per triangle
+ *   (once through each of its two triangle edges).
+ *
+ * Self-loops neither form triangles nor count towards the degree.
  *
  * Clustering coefficient for node u = 2 * triangles[u] / (degree[u] * (degree[u] - 1))
  *
- * Complexity: O(d_max * E) where d_max is max degree
+ * Complexity: one sorted set intersection per edge (see graph_intersect.c),
+ * O(min(d_u, d_v) * log) for a hub against a low-degree node
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include "executor/graph_algorithms.h"
-
-/* Check if edge exists between two nodes (undirected) */
-static int edge_exists(csr_graph *graph, int u, int v) {
-    /* Check outgoing edges from u */
-    for (int i = graph->row_ptr[u]; i < graph->row_ptr[u + 1]; i++) {
-        if (graph->col_idx[i] == v) return 1;
-    }
-    /* Check incoming edges to u (for undirected treatment) */
-    for (int i = graph->in_row_ptr[u]; i < graph->in_row_ptr[u + 1]; i++) {
-        if (graph->in_col_idx[i] == v) return 1;
-    }
-    return 0;
-}
-
-/* Get all neighbors of a node (both directions for undirected) */
-static int* get_neighbors(csr_graph *graph, int node, int *neighbor_count) {
-    /* Count total neighbors */
-    int out_count = graph->row_ptr[node + 1] - graph->row_ptr[node];
-    int in_count = graph->in_row_ptr[node + 1] - graph->in_row_ptr[node];
-    int max_neighbors = out_count + in_count;
-
-    int *neighbors = malloc(max_neighbors * sizeof(int));
-    if (!neighbors) {
-        *neighbor_count = 0;
-        return NULL;
-    }
-
-    int count = 0;
-
-    /* Add outgoing neighbors */
-    for (int i = graph->row_ptr[node]; i < graph->row_ptr[node + 1]; i++) {
-        neighbors[count++] = graph->col_idx[i];
-    }
-
-    /* Add incoming neighbors (avoid duplicates) */
-    for (int i = graph->in_row_ptr[node]; i < graph->in_row_ptr[node + 1]; i++) {
-        int neighbor = graph->in_col_idx[i];
-        int is_dup = 0;
-        for (int j = 0; j < count; j++) {
-            if (neighbors[j] == neighbor) {
-                is_dup = 1;
-                break;
-            }
-        }
-        if (!is_dup) {
-            neighbors[count++] = neighbor;
+#include "executor/graph_algo_internal.h"
+
+/* Check if v is a neighbour of u by binary search of u's sorted undirected row */
+static int edge_exists(const csr_neighbour_sets *adj, int u, int v) {
+    int64_t lo = adj->row_ptr[u];
+    int64_t hi = adj->row_ptr[u + 1];
+    while (lo < hi) {
+        int64_t mid = lo + (hi - lo) / 2;
+        if (adj->col_idx[mid] < v) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
         }
     }
-
-    *neighbor_count = count;
-    return neighbors;
+    return lo < adj->row_ptr[u + 1] && adj->col_idx[lo] == v;
 }
 
 graph_algo_result* execute_triangle_count(sqlite3 *db, csr_graph *cached) {
@@ -110,50 +79,49 @@ graph_algo_result* execute_triangle_count(sqlite3 *db, csr_graph *cached) {
     }
 
     /* Allocate triangle counts and degrees */
-    int *triangles = calloc(n, sizeof(int));
+    int64_t *triangles = calloc(n, sizeof(int64_t));
     int *degrees = calloc(n, sizeof(int));
+    bool *self_loop = calloc(n, sizeof(bool));
+    const csr_neighbour_sets *adj = csr_graph_undirected(graph);
 
-    if (!triangles || !degrees) {
+    if (!triangles || !degrees || !self_loop || !adj) {
         free(triangles);
         free(degrees);
+        free(self_loop);
         if (should_free_graph) csr_graph_free(graph);
         result->error_message = strdup("Failed to allocate memory");
         return result;
     }
 
-    /* Calculate degrees (undirected) */
+    /* Degrees (undirected): distinct neighbours other than the node itself */
     for (int u = 0; u < n; u++) {
-        int neighbor_count;
-        int *neighbors = get_neighbors(graph, u, &neighbor_count);
-        degrees[u] = neighbor_count;
-        free(neighbors);
+        self_loop[u] = edge_exists(adj, u, u);
+        degrees[u] = (int)(adj->row_ptr[u + 1] - adj->row_ptr[u]) - (self_loop[u] ? 1 : 0);
     }
 
-    /* Count triangles using node-iterator algorithm */
-    /* For each node u, check all pairs of neighbors (v, w) */
+    /* Count triangles using edge-iterator algorithm */
     for (int u = 0; u < n; u++) {
-        int neighbor_count;
-        int *neighbors = get_neighbors(graph, u, &neighbor_count);
-
-        if (!neighbors) continue;
-
-        /* For each pair of neighbors */
-        for (int i = 0; i < neighbor_count; i++) {
-            int v = neighbors[i];
-            for (int j = i + 1; j < neighbor_count; j++) {
-                int w = neighbors[j];
-
-                /* Check if v and w are connected (forming a triangle) */
-                if (edge_exists(graph, v, w)) {
-                    /* Found triangle (u, v, w) - count for u only here
-                     * Each triangle will be counted once per participating node */
-                    triangles[u]++;
-                }
-            }
-        }
+        const int *row_u = adj->col_idx + adj->row_ptr[u];
+        int64_t len_u = adj->row_ptr[u + 1] - adj->row_ptr[u];
 
-        free(neighbors);
+        for (int64_t i = 0; i < len_u; i++) {
+            int v = row_u[i];
+            if (v <= u) continue;
+
+            const int *row_v = adj->col_idx + adj->row_ptr[v];
+            int64_t len_v = adj->row_ptr[v + 1] - adj->row_ptr[v];
+
+            /* u and v are common neighbours of themselves only through self-loops */
+            int64_t common = graph_intersect_count(row_u, len_u, row_v, len_v) -
+                             self_loop[u] - self_loop[v];
+            triangles[u] += common;
+            triangles[v] += common;
+        }
+    }
+    for (int u = 0; u < n; u++) {
+        triangles[u] /= 2;
     }
+    free(self_loop);
 
     /* Build JSON result */
     size_t buf_size = 256 + n * 200;
@@ -176,7 +144,7 @@ graph_algo_result* execute_triangle_count(sqlite3 *db, csr_graph *cached) {
         if (d >= 2) {
             /* Max possible triangles = d*(d-1)/2 */
             /* clustering = triangles / max_possible */
-            clustering = (2.0 * triangles[i]) / (d * (d - 1));
+            clustering = (2.0 * triangles[i]) / ((double)d * (d - 1));
         }
 
         /* Get user_id */
@@ -187,8 +155,8 @@ graph_algo_result* execute_triangle_count(sqlite3 *db, csr_graph *cached) {
         }
 
         int written = snprintf(json + pos, buf_size - pos,
-            "{\"node_id\":%d,\"user_id\":\"%s\",\"triangles\":%d,\"clustering_coefficient\":%.6f}",
-            graph->node_ids[i], user_id, triangles[i], clustering);
+            "{\"node_id\":%lld,\"user_id\":\"%s\",\"triangles\":%lld,\"clustering_coefficient\":%.6f}",
+            (long long)graph->node_ids[i], user_id, (long long)triangles[i], clustering);
 
         if (written < 0 || (size_t)written >= buf_size - pos) {
             /* Buffer overflow, reallocate */
@@ -204,8 +172,8 @@ graph_algo_result* execute_triangle_count(sqlite3 *db, csr_graph *cached) {
             }
             json = new_json;
             written = snprintf(json + pos, buf_size - pos,
-                "{\"node_id\":%d,\"user_id\":\"%s\",\"triangles\":%d,\"clustering_coefficient\":%.6f}",
-                graph->node_ids[i], user_id, triangles[i], clustering);
+                "{\"node_id\":%lld,\"user_id\":\"%s\",\"triangles\":%lld,\"clustering_coefficient\":%.6f}",
+                (long long)graph->node_ids[i], user_id, (long long)triangles[i], clustering);
         }
         pos += written;
     }
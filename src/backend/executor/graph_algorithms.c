@@ -12,52 +12,1244 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 
 #include "executor/graph_algorithms.h"
 #include "executor/graph_algo_internal.h"
+#include "executor/json_builder.h"
 #include "parser/cypher_ast.h"
 
+/*
+ * Node ID -> index map
+ */
+
+/* Round up to the next power of two, at least NODE_MAP_MIN_CAPACITY */
+static int node_map_capacity_for(int expected_count)
+{
+    int capacity = NODE_MAP_MIN_CAPACITY;
+    /* Keep the load factor at or below 0.5 */
+    while (capacity < expected_count * 2 && capacity < (1 << 30)) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+static int node_map_alloc(csr_node_map *map, int capacity)
+{
+    map->slots = malloc((size_t)capacity * sizeof(csr_node_slot));
+    if (!map->slots) return -1;
+
+    for (int i = 0; i < capacity; i++) {
+        map->slots[i].index = -1;
+    }
+    map->capacity = capacity;
+    map->count = 0;
+    map->dense = false;
+    map->first_id = 0;
+    return 0;
+}
+
+int node_map_init(csr_node_map *map, int expected_count)
+{
+    return node_map_alloc(map, node_map_capacity_for(expected_count));
+}
+
+/* Double the slot array and rehash all entries */
+static int node_map_grow(csr_node_map *map)
+{
+    csr_node_map grown;
+    if (node_map_alloc(&grown, map->capacity * 2) != 0) return -1;
+
+    unsigned int mask = (unsigned int)grown.capacity - 1;
+    for (int i = 0; i < map->capacity; i++) {
+        if (map->slots[i].index == -1) continue;
+        unsigned int h = hash_int(map->slots[i].node_id) & mask;
+        while (grown.slots[h].index != -1) {
+            h = (h + 1) & mask;
+        }
+        grown.slots[h] = map->slots[i];
+        grown.count++;
+    }
+
+    free(map->slots);
+    *map = grown;
+    return 0;
+}
+
+/* Replace a dense map by the equivalent hash map */
+static int node_map_hash_dense(csr_node_map *map)
+{
+    csr_node_map hashed;
+    if (node_map_init(&hashed, map->count) != 0) return -1;
+    for (int i = 0; i < map->count; i++) {
+        if (node_map_insert(&hashed, map->first_id + i, i) != 0) {
+            node_map_free(&hashed);
+            return -1;
+        }
+    }
+    *map = hashed;
+    return 0;
+}
+
+/* Insert or update a node ID; returns 0 on success, -1 on allocation failure */
+int node_map_insert(csr_node_map *map, int64_t node_id, int index)
+{
+    if (map->dense && node_map_hash_dense(map) != 0) return -1;
+    if (!map->slots && node_map_init(map, 0) != 0) return -1;
+    if ((map->count + 1) * 2 > map->capacity && node_map_grow(map) != 0) return -1;
+
+    unsigned int mask = (unsigned int)map->capacity - 1;
+    unsigned int h = hash_int(node_id) & mask;
+    while (map->slots[h].index != -1) {
+        if (map->slots[h].node_id == node_id) {
+            map->slots[h].index = index;
+            return 0;
+        }
+        h = (h + 1) & mask;
+    }
+    map->slots[h].node_id = node_id;
+    map->slots[h].index = index;
+    map->count++;
+    return 0;
+}
+
+void node_map_free(csr_node_map *map)
+{
+    free(map->slots);
+    map->slots = NULL;
+    map->capacity = 0;
+    map->count = 0;
+    map->dense = false;
+    map->first_id = 0;
+}
+
+int node_map_build(csr_node_map *map, const int64_t *node_ids, int count)
+{
+    bool dense = count > 0;
+    for (int i = 1; dense && i < count; i++) {
+        dense = node_ids[i] == node_ids[0] + i;
+    }
+    if (dense) {
+        map->slots = NULL;
+        map->capacity = 0;
+        map->count = count;
+        map->dense = true;
+        map->first_id = node_ids[0];
+        return 0;
+    }
+
+    if (node_map_init(map, count) != 0) return -1;
+    for (int i = 0; i < count; i++) {
+        if (node_map_insert(map, node_ids[i], i) != 0) {
+            node_map_free(map);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int csr_graph_find_node(const csr_graph *graph, int64_t node_id)
+{
+    if (!graph) return -1;
+    return node_map_find(&graph->node_map, node_id);
+}
+
+/*
+ * User ID index
+ */
+
+int csr_graph_index_user_ids(csr_graph *graph)
+{
+    csr_graph_release(graph, graph->user_id_index);
+    graph->user_id_index = NULL;
+    graph->user_id_index_capacity = 0;
+    if (!graph->user_ids) return 0;
+
+    int capacity = node_map_capacity_for(graph->node_count);
+    csr_string_slot *slots = malloc((size_t)capacity * sizeof(csr_string_slot));
+    if (!slots) return -1;
+    for (int i = 0; i < capacity; i++) {
+        slots[i].index = -1;
+    }
+
+    /* Insert in index order; on duplicate IDs the lowest index wins */
+    unsigned int mask = (unsigned int)capacity - 1;
+    for (int i = 0; i < graph->node_count; i++) {
+        const char *user_id = graph->user_ids[i];
+        if (!user_id) continue;
+
+        unsigned int hash = hash_string(user_id);
+        unsigned int h = hash & mask;
+        bool duplicate = false;
+        while (slots[h].index != -1) {
+            if (slots[h].hash == hash && strcmp(graph->user_ids[slots[h].index], user_id) == 0) {
+                duplicate = true;
+                break;
+            }
+            h = (h + 1) & mask;
+        }
+        if (!duplicate) {
+            slots[h].hash = hash;
+            slots[h].index = i;
+        }
+    }
+
+    graph->user_id_index = slots;
+    graph->user_id_index_capacity = capacity;
+    return 0;
+}
+
+/*
+ * Intern user IDs from an array of node_count strings (entries may be NULL)
+ * into a fresh arena and rebuild the index. Returns 0 on success.
+ */
+int csr_graph_build_user_ids(csr_graph *graph, const char *const *ids)
+{
+    size_t arena_size = 0;
+    for (int i = 0; i < graph->node_count; i++) {
+        if (ids[i]) arena_size += strlen(ids[i]) + 1;
+    }
+
+    char **user_ids = calloc(graph->node_count > 0 ? graph->node_count : 1, sizeof(char*));
+    char *arena = malloc(arena_size > 0 ? arena_size : 1);
+    if (!user_ids || !arena) {
+        free(user_ids);
+        free(arena);
+        return -1;
+    }
+
+    size_t offset = 0;
+    for (int i = 0; i < graph->node_count; i++) {
+        if (!ids[i]) continue;
+        size_t len = strlen(ids[i]) + 1;
+        memcpy(arena + offset, ids[i], len);
+        user_ids[i] = arena + offset;
+        offset += len;
+    }
+
+    csr_graph_release(graph, graph->user_ids);
+    csr_graph_release(graph, graph->user_id_arena);
+    graph->user_ids = user_ids;
+    graph->user_id_arena = arena;
+    graph->user_id_arena_size = arena_size;
+    return csr_graph_index_user_ids(graph);
+}
+
+/*
+ * Load the user-defined 'id' property of every node. Strings are interned
+ * back to back in one arena instead of one allocation per node, then
+ * indexed for O(1) lookup by user ID. Replaces any previous user IDs.
+ */
+int csr_graph_load_user_ids(csr_graph *graph, sqlite3 *db)
+{
+    char **user_ids = calloc(graph->node_count > 0 ? graph->node_count : 1, sizeof(char*));
+    if (!user_ids) return -1;
+
+    csr_graph_release(graph, graph->user_ids);
+    csr_graph_release(graph, graph->user_id_arena);
+    graph->user_ids = user_ids;
+    graph->user_id_arena = NULL;
+    graph->user_id_arena_size = 0;
+
+    sqlite3_stmt *stmt = NULL;
+    int rc = sqlite3_prepare_v2(db,
+        "SELECT np.node_id, np.value FROM node_props_text np "
+        "JOIN property_keys pk ON pk.id = np.key_id AND pk.key = 'id'",
+        -1, &stmt, NULL);
+    if (rc != SQLITE_OK) {
+        /* No property tables: nodes simply have no user IDs */
+        return csr_graph_index_user_ids(graph);
+    }
+
+    size_t *offsets = malloc((graph->node_count > 0 ? graph->node_count : 1) * sizeof(size_t));
+    size_t arena_capacity = 4096;
+    size_t arena_size = 0;
+    char *arena = malloc(arena_capacity);
+    if (!offsets || !arena) {
+        free(offsets);
+        free(arena);
+        sqlite3_finalize(stmt);
+        return -1;
+    }
+    for (int i = 0; i < graph->node_count; i++) {
+        offsets[i] = (size_t)-1;
+    }
+
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        int idx = node_map_find(&graph->node_map, sqlite3_column_int64(stmt, 0));
+        const char *user_id = (const char*)sqlite3_column_text(stmt, 1);
+        if (idx < 0 || !user_id) continue;
+
+        size_t len = (size_t)sqlite3_column_bytes(stmt, 1) + 1;
+        if (arena_size + len > arena_capacity) {
+            while (arena_size + len > arena_capacity) arena_capacity *= 2;
+            char *new_arena = realloc(arena, arena_capacity);
+            if (!new_arena) {
+                free(offsets);
+                free(arena);
+                sqlite3_finalize(stmt);
+                return -1;
+            }
+            arena = new_arena;
+        }
+        memcpy(arena + arena_size, user_id, len);
+        offsets[idx] = arena_size;
+        arena_size += len;
+    }
+    sqlite3_finalize(stmt);
+
+    /* Arena is final; point user_ids into it */
+    graph->user_id_arena = arena;
+    graph->user_id_arena_size = arena_size;
+    for (int i = 0; i < graph->node_count; i++) {
+        if (offsets[i] != (size_t)-1) {
+            user_ids[i] = arena + offsets[i];
+        }
+    }
+    free(offsets);
+
+    return csr_graph_index_user_ids(graph);
+}
+
+int csr_graph_find_user_id(const csr_graph *graph, const char *user_id)
+{
+    if (!graph) return -1;
+    return find_node_by_user_id((csr_graph *)graph, user_id);
+}
+
+void csr_graph_probe_stats(const csr_graph *graph, double *avg_probe, int *max_probe)
+{
+    double avg = 0.0;
+    int max = 0;
+
+    if (graph && graph->node_map.slots && graph->node_map.count > 0) {
+        const csr_node_map *map = &graph->node_map;
+        unsigned int mask = (unsigned int)map->capacity - 1;
+        long long total = 0;
+
+        for (int i = 0; i < map->capacity; i++) {
+            if (map->slots[i].index == -1) continue;
+            /* Probe length = slots inspected to find this key */
+            unsigned int home = hash_int(map->slots[i].node_id) & mask;
+            int probes = (int)(((unsigned int)i - home) & mask) + 1;
+            total += probes;
+            if (probes > max) max = probes;
+        }
+        avg = (double)total / map->count;
+    }
+
+    if (avg_probe) *avg_probe = avg;
+    if (max_probe) *max_probe = max;
+}
+
 /* Free CSR graph */
 void csr_graph_free(csr_graph *graph)
 {
     if (!graph) return;
 
-    free(graph->row_ptr);
-    free(graph->col_idx);
-    free(graph->node_ids);
-    if (graph->user_ids) {
-        for (int i = 0; i < graph->node_count; i++) {
-            free(graph->user_ids[i]);
-        }
-        free(graph->user_ids);
+    csr_graph_unshare(graph);
+    csr_graph_release(graph, graph->row_ptr);
+    csr_graph_release(graph, graph->col_idx);
+    if (!graph->borrowed_nodes) {
+        csr_graph_release(graph, graph->node_ids);
+        csr_graph_release(graph, graph->user_ids);
+        csr_graph_release(graph, graph->user_id_arena);
+        csr_graph_release(graph, graph->user_id_index);
+        csr_graph_release(graph, graph->node_map.slots);
+    }
+    csr_graph_release(graph, graph->in_row_ptr);
+    csr_graph_release(graph, graph->in_col_idx);
+    csr_graph_release(graph, graph->edge_types);
+    csr_graph_release(graph, graph->in_edge_types);
+    for (int t = 0; t < graph->type_count; t++) {
+        free(graph->type_names[t]);
     }
-    free(graph->node_idx);
-    free(graph->in_row_ptr);
-    free(graph->in_col_idx);
+    free(graph->type_names);
+    csr_graph_release(graph, graph->edge_ids);
+    csr_graph_release(graph, graph->multiplicity);
+    csr_graph_release(graph, graph->in_multiplicity);
+    csr_adjacency_free(&graph->adj);
+    csr_adjacency_free(&graph->in_adj);
+    csr_graph_drop_weights(graph);
+    csr_graph_free(graph->type_view);
+    free(graph->type_view_key);
+    csr_neighbour_sets_free(graph->undirected);
+    csr_neighbour_sets_free(graph->out_sets);
+    csr_delta_free(graph->delta);
+    csr_graph_unmap_snapshot(graph);
     free(graph);
 }
 
+/*
+ * Stable counting sort of edge indices by key[e] in [0, buckets).
+ * in == NULL sorts the identity permutation. Returns 0, or -1 on allocation failure.
+ */
+static int sort_edges_by_key(const int64_t *in, int64_t *out, int64_t edge_total,
+                             const int *key, int buckets)
+{
+    int64_t *offsets = calloc(buckets + 1, sizeof(int64_t));
+    if (!offsets) return -1;
+
+    for (int64_t e = 0; e < edge_total; e++) {
+        offsets[key[e] + 1]++;
+    }
+    for (int b = 1; b <= buckets; b++) {
+        offsets[b] += offsets[b - 1];
+    }
+    for (int64_t i = 0; i < edge_total; i++) {
+        int64_t e = in ? in[i] : i;
+        out[offsets[key[e]]++] = e;
+    }
+
+    free(offsets);
+    return 0;
+}
+
+/*
+ * Parallel edge build. Degrees are counted and edges scattered into rows
+ * with atomic increments, so each row fills in arbitrary order; rows are
+ * then sorted by (type, neighbour, edge index), the order the serial
+ * counting sorts produce, so both paths build identical graphs.
+ */
+typedef struct {
+    int type;
+    int neighbour;
+    int64_t edge;
+} row_entry;
+
+static int compare_row_entry(const void *a, const void *b)
+{
+    const row_entry *x = (const row_entry *)a;
+    const row_entry *y = (const row_entry *)b;
+    if (x->type != y->type) return x->type < y->type ? -1 : 1;
+    if (x->neighbour != y->neighbour) return x->neighbour < y->neighbour ? -1 : 1;
+    return (x->edge > y->edge) - (x->edge < y->edge);
+}
+
+static void sort_row_entries(row_entry *entries, int64_t count)
+{
+    if (count > 16) {
+        qsort(entries, count, sizeof(row_entry), compare_row_entry);
+        return;
+    }
+    for (int64_t i = 1; i < count; i++) {
+        row_entry entry = entries[i];
+        int64_t j = i;
+        while (j > 0 && compare_row_entry(&entries[j - 1], &entry) > 0) {
+            entries[j] = entries[j - 1];
+            j--;
+        }
+        entries[j] = entry;
+    }
+}
+
+typedef struct {
+    csr_graph *graph;
+    const int *edge_src;
+    const int *edge_tgt;
+    const int *edge_type;
+    const int64_t *edge_id;
+    const int *edge_mult;
+    int64_t *order;         /* Edge index per out-edge slot */
+    int64_t *in_order;      /* Edge index per in-edge slot */
+    int64_t *pos;
+    int64_t *in_pos;
+    int64_t *chunk_sums;    /* Out and in degree totals per node chunk */
+    bool failed;
+} edge_build;
+
+static void count_degrees_chunk(void *ctx, int chunk, int64_t begin, int64_t end)
+{
+    (void)chunk;
+    edge_build *b = (edge_build *)ctx;
+    for (int64_t e = begin; e < end; e++) {
+        __atomic_fetch_add(&b->graph->row_ptr[b->edge_src[e] + 1], 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&b->graph->in_row_ptr[b->edge_tgt[e] + 1], 1, __ATOMIC_RELAXED);
+    }
+}
+
+/* Prefix sums over nodes: each chunk totals its degrees, then adds the totals before it */
+static void total_degrees_chunk(void *ctx, int chunk, int64_t begin, int64_t end)
+{
+    edge_build *b = (edge_build *)ctx;
+    int64_t out = 0, in = 0;
+    for (int64_t i = begin; i < end; i++) {
+        out += b->graph->row_ptr[i + 1];
+        in += b->graph->in_row_ptr[i + 1];
+    }
+    b->chunk_sums[2 * chunk] = out;
+    b->chunk_sums[2 * chunk + 1] = in;
+}
+
+static void offset_degrees_chunk(void *ctx, int chunk, int64_t begin, int64_t end)
+{
+    edge_build *b = (edge_build *)ctx;
+    int64_t out = b->chunk_sums[2 * chunk];
+    int64_t in = b->chunk_sums[2 * chunk + 1];
+    for (int64_t i = begin; i < end; i++) {
+        out += b->graph->row_ptr[i + 1];
+        in += b->graph->in_row_ptr[i + 1];
+        b->graph->row_ptr[i + 1] = out;
+        b->graph->in_row_ptr[i + 1] = in;
+    }
+}
+
+static void scatter_edges_chunk(void *ctx, int chunk, int64_t begin, int64_t end)
+{
+    (void)chunk;
+    edge_build *b = (edge_build *)ctx;
+    for (int64_t e = begin; e < end; e++) {
+        b->order[__atomic_fetch_add(&b->pos[b->edge_src[e]], 1, __ATOMIC_RELAXED)] = e;
+        b->in_order[__atomic_fetch_add(&b->in_pos[b->edge_tgt[e]], 1, __ATOMIC_RELAXED)] = e;
+    }
+}
+
+/* First node whose row starts at or after slot */
+static int first_row_at(const int64_t *row_ptr, int n, int64_t slot)
+{
+    int lo = 0, hi = n;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (row_ptr[mid] < slot) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/* Sort and write the rows of one direction that start in slots [begin, end) */
+static bool fill_rows(edge_build *b, bool incoming, int64_t begin, int64_t end,
+                      row_entry **entries, int64_t *capacity)
+{
+    csr_graph *graph = b->graph;
+    const int64_t *row_ptr = incoming ? graph->in_row_ptr : graph->row_ptr;
+    const int64_t *order = incoming ? b->in_order : b->order;
+    const int *neighbour = incoming ? b->edge_src : b->edge_tgt;
+    int *col_idx = incoming ? graph->in_col_idx : graph->col_idx;
+    int *types = incoming ? graph->in_edge_types : graph->edge_types;
+    int *mult = incoming ? graph->in_multiplicity : graph->multiplicity;
+
+    for (int u = first_row_at(row_ptr, graph->node_count, begin);
+         u < graph->node_count && row_ptr[u] < end; u++) {
+        int64_t start = row_ptr[u];
+        int64_t degree = row_ptr[u + 1] - start;
+        if (degree > *capacity) {
+            row_entry *grown = realloc(*entries, degree * sizeof(row_entry));
+            if (!grown) return false;
+            *entries = grown;
+            *capacity = degree;
+        }
+
+        row_entry *row = *entries;
+        for (int64_t k = 0; k < degree; k++) {
+            int64_t e = order[start + k];
+            row[k].type = b->edge_type ? b->edge_type[e] : 0;
+            row[k].neighbour = neighbour[e];
+            row[k].edge = e;
+        }
+        sort_row_entries(row, degree);
+
+        for (int64_t k = 0; k < degree; k++) {
+            col_idx[start + k] = row[k].neighbour;
+            if (types) types[start + k] = row[k].type;
+            if (!incoming && b->edge_id) graph->edge_ids[start + k] = b->edge_id[row[k].edge];
+            if (mult) mult[start + k] = b->edge_mult[row[k].edge];
+        }
+    }
+    return true;
+}
+
+static void fill_rows_chunk(void *ctx, int chunk, int64_t begin, int64_t end)
+{
+    (void)chunk;
+    edge_build *b = (edge_build *)ctx;
+    row_entry *entries = NULL;
+    int64_t capacity = 0;
+    if (!fill_rows(b, false, begin, end, &entries, &capacity) ||
+        !fill_rows(b, true, begin, end, &entries, &capacity)) {
+        b->failed = true;
+    }
+    free(entries);
+}
+
+/* Fill the CSR arrays allocated by csr_graph_build_edges with chunks threads */
+static int build_edges_parallel(csr_graph *graph, const int *edge_src, const int *edge_tgt,
+                                const int *edge_type, const int64_t *edge_id, const int *edge_mult,
+                                int64_t edge_total, int chunks, int64_t *order, int64_t *in_order,
+                                int64_t *pos)
+{
+    int n = graph->node_count;
+    int node_chunks = graph_parallel_chunks(n);
+    edge_build b = {graph, edge_src, edge_tgt, edge_type, edge_id, edge_mult, order, in_order, pos,
+                    malloc((n > 0 ? n : 1) * sizeof(int64_t)),
+                    malloc(2 * node_chunks * sizeof(int64_t)), false};
+    if (!b.in_pos || !b.chunk_sums) {
+        free(b.in_pos);
+        free(b.chunk_sums);
+        return -1;
+    }
+
+    graph_parallel_for(edge_total, chunks, count_degrees_chunk, &b);
+
+    graph_parallel_for(n, node_chunks, total_degrees_chunk, &b);
+    int64_t out = 0, in = 0;
+    for (int c = 0; c < node_chunks; c++) {
+        int64_t chunk_out = b.chunk_sums[2 * c];
+        int64_t chunk_in = b.chunk_sums[2 * c + 1];
+        b.chunk_sums[2 * c] = out;
+        b.chunk_sums[2 * c + 1] = in;
+        out += chunk_out;
+        in += chunk_in;
+    }
+    graph_parallel_for(n, node_chunks, offset_degrees_chunk, &b);
+
+    memcpy(pos, graph->row_ptr, n * sizeof(int64_t));
+    memcpy(b.in_pos, graph->in_row_ptr, n * sizeof(int64_t));
+    graph_parallel_for(edge_total, chunks, scatter_edges_chunk, &b);
+    graph_parallel_for(edge_total, chunks, fill_rows_chunk, &b);
+
+    free(b.in_pos);
+    free(b.chunk_sums);
+    if (b.failed) return -1;
+
+    graph->edge_count = edge_total;
+    return 0;
+}
+
+/*
+ * Fill row_ptr/col_idx and in_row_ptr/in_col_idx (and the edge type arrays)
+ * from an edge list of internal indices. Rows are ordered by (type,
+ * neighbour) with least-significant-digit counting sorts: by neighbour, then
+ * by type, then scattered into rows. Large edge lists are built by
+ * build_edges_parallel() when more than one worker thread is configured.
+ * Returns 0 on success, -1 on allocation failure.
+ */
+int csr_graph_build_edges(csr_graph *graph, const int *edge_src, const int *edge_tgt,
+                          const int *edge_type, const int64_t *edge_id, const int *edge_mult,
+                          int64_t edge_total)
+{
+    int n = graph->node_count;
+    size_t m = edge_total > 0 ? (size_t)edge_total : 1;
+    bool sort_types = edge_type && graph->type_count > 1;
+    int rc = -1;
+
+    graph->row_ptr = calloc((size_t)n + 1, sizeof(int64_t));
+    graph->in_row_ptr = calloc((size_t)n + 1, sizeof(int64_t));
+    graph->col_idx = malloc(m * sizeof(int));
+    graph->in_col_idx = malloc(m * sizeof(int));
+    if (!graph->row_ptr || !graph->in_row_ptr || !graph->col_idx || !graph->in_col_idx) {
+        return -1;
+    }
+    if (edge_type) {
+        graph->edge_types = malloc(m * sizeof(int));
+        graph->in_edge_types = malloc(m * sizeof(int));
+        if (!graph->edge_types || !graph->in_edge_types) return -1;
+    }
+    if (edge_id) {
+        graph->edge_ids = malloc(m * sizeof(int64_t));
+        if (!graph->edge_ids) return -1;
+    }
+    if (edge_mult) {
+        graph->multiplicity = malloc(m * sizeof(int));
+        graph->in_multiplicity = malloc(m * sizeof(int));
+        if (!graph->multiplicity || !graph->in_multiplicity) return -1;
+    }
+
+    int64_t *order = malloc(m * sizeof(int64_t));
+    int64_t *scratch = malloc(m * sizeof(int64_t));
+    int64_t *pos = malloc((n > 0 ? n : 1) * sizeof(int64_t));
+    if (!order || !scratch || !pos) goto done;
+
+    int chunks = graph_parallel_chunks(edge_total);
+    if (chunks > 1) {
+        rc = build_edges_parallel(graph, edge_src, edge_tgt, edge_type, edge_id, edge_mult, edge_total,
+                                  chunks, order, scratch, pos);
+        goto done;
+    }
+
+    /* Count degrees */
+    for (int64_t e = 0; e < edge_total; e++) {
+        graph->row_ptr[edge_src[e] + 1]++;
+        graph->in_row_ptr[edge_tgt[e] + 1]++;
+    }
+
+    /* Convert counts to cumulative offsets */
+    for (int i = 1; i <= n; i++) {
+        graph->row_ptr[i] += graph->row_ptr[i - 1];
+        graph->in_row_ptr[i] += graph->in_row_ptr[i - 1];
+    }
+
+    /* Out-edges: order by target, then by type, then scatter by source */
+    if (sort_edges_by_key(NULL, order, edge_total, edge_tgt, n) != 0) goto done;
+    if (sort_types) {
+        if (sort_edges_by_key(order, scratch, edge_total, edge_type, graph->type_count) != 0) goto done;
+        int64_t *tmp = order; order = scratch; scratch = tmp;
+    }
+
+    memcpy(pos, graph->row_ptr, n * sizeof(int64_t));
+    for (int64_t i = 0; i < edge_total; i++) {
+        int64_t e = order[i];
+        int64_t slot = pos[edge_src[e]]++;
+        graph->col_idx[slot] = edge_tgt[e];
+        if (edge_type) graph->edge_types[slot] = edge_type[e];
+        if (edge_id) graph->edge_ids[slot] = edge_id[e];
+        if (edge_mult) graph->multiplicity[slot] = edge_mult[e];
+    }
+
+    /* In-edges: order by source, then by type, then scatter by target */
+    if (sort_edges_by_key(NULL, order, edge_total, edge_src, n) != 0) goto done;
+    if (sort_types) {
+        if (sort_edges_by_key(order, scratch, edge_total, edge_type, graph->type_count) != 0) goto done;
+        int64_t *tmp = order; order = scratch; scratch = tmp;
+    }
+
+    memcpy(pos, graph->in_row_ptr, n * sizeof(int64_t));
+    for (int64_t i = 0; i < edge_total; i++) {
+        int64_t e = order[i];
+        int64_t slot = pos[edge_tgt[e]]++;
+        graph->in_col_idx[slot] = edge_src[e];
+        if (edge_type) graph->in_edge_types[slot] = edge_type[e];
+        if (edge_mult) graph->in_multiplicity[slot] = edge_mult[e];
+    }
+
+    graph->edge_count = edge_total;
+    rc = 0;
+
+done:
+    free(order);
+    free(scratch);
+    free(pos);
+    return rc;
+}
+
+int csr_graph_intern_type(csr_graph *graph, const char *type)
+{
+    if (!type) return -1;
+
+    int t = csr_graph_find_type(graph, type);
+    if (t >= 0) return t;
+
+    char **names = realloc(graph->type_names, (graph->type_count + 1) * sizeof(char*));
+    if (!names) return -1;
+    graph->type_names = names;
+
+    names[graph->type_count] = strdup(type);
+    if (!names[graph->type_count]) return -1;
+    return graph->type_count++;
+}
+
+typedef struct {
+    char *name;
+    int id;
+} named_type;
+
+static int compare_named_types(const void *a, const void *b)
+{
+    return strcmp(((const named_type *)a)->name, ((const named_type *)b)->name);
+}
+
+int csr_graph_canonical_types(csr_graph *graph, int *edge_type, int64_t edge_total)
+{
+    int count = graph->type_count;
+    if (count == 0) return 0;
+
+    int *remap = calloc(count, sizeof(int));
+    named_type *sorted = malloc(count * sizeof(named_type));
+    if (!remap || !sorted) {
+        free(remap);
+        free(sorted);
+        return -1;
+    }
+
+    for (int64_t e = 0; e < edge_total; e++) {
+        remap[edge_type[e]] = 1;
+    }
+
+    /* Drop unused names, order the rest by name */
+    int kept = 0;
+    for (int t = 0; t < count; t++) {
+        if (remap[t]) {
+            sorted[kept].name = graph->type_names[t];
+            sorted[kept].id = t;
+            kept++;
+        } else {
+            free(graph->type_names[t]);
+        }
+    }
+    qsort(sorted, kept, sizeof(named_type), compare_named_types);
+
+    for (int i = 0; i < kept; i++) {
+        remap[sorted[i].id] = i;
+        graph->type_names[i] = sorted[i].name;
+    }
+    for (int64_t e = 0; e < edge_total; e++) {
+        edge_type[e] = remap[edge_type[e]];
+    }
+    graph->type_count = kept;
+
+    free(remap);
+    free(sorted);
+    return 0;
+}
+
+int csr_graph_find_type(const csr_graph *graph, const char *type)
+{
+    if (!graph || !type) return -1;
+
+    for (int t = 0; t < graph->type_count; t++) {
+        if (strcmp(graph->type_names[t], type) == 0) return t;
+    }
+    return -1;
+}
+
+/* Bounds of the run of type_id in types[start..end), which is sorted */
+static void type_segment(const int *types, int64_t start, int64_t end, int type_id,
+                         int64_t *seg_start, int64_t *seg_end)
+{
+    int64_t lo = start, hi = end;
+    while (lo < hi) {
+        int64_t mid = lo + (hi - lo) / 2;
+        if (types[mid] < type_id) lo = mid + 1; else hi = mid;
+    }
+    *seg_start = lo;
+
+    hi = end;
+    while (lo < hi) {
+        int64_t mid = lo + (hi - lo) / 2;
+        if (types[mid] <= type_id) lo = mid + 1; else hi = mid;
+    }
+    *seg_end = lo;
+}
+
+void csr_graph_type_range(const csr_graph *graph, int node, int type_id, int64_t *start, int64_t *end)
+{
+    if (!graph->edge_types) {
+        *start = *end = graph->row_ptr[node];
+        return;
+    }
+    type_segment(graph->edge_types, graph->row_ptr[node], graph->row_ptr[node + 1], type_id, start, end);
+}
+
+static int compare_strings(const void *a, const void *b)
+{
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+/*
+ * Copy the edges of the wanted types from one direction of the graph (and
+ * edge IDs and multiplicities, if given). Rows are read in order, so they
+ * stay sorted by (type, neighbour).
+ */
+static int copy_type_segments(const csr_graph *graph, bool incoming, const bool *wanted,
+                              const int64_t *edge_ids, const int *mult,
+                              int64_t **out_row_ptr, int **out_col_idx, int64_t **out_edge_ids,
+                              int **out_mult)
+{
+    int n = graph->node_count;
+    const int64_t *row_ptr = incoming ? graph->in_row_ptr : graph->row_ptr;
+    const int *types = incoming ? graph->in_edge_types : graph->edge_types;
+
+    int64_t *view_row_ptr = calloc((size_t)n + 1, sizeof(int64_t));
+    if (!view_row_ptr) return -1;
+
+    for (int u = 0; u < n; u++) {
+        int64_t degree = 0;
+        for (int64_t j = row_ptr[u]; j < row_ptr[u + 1]; j++) {
+            if (wanted[types[j]]) degree++;
+        }
+        view_row_ptr[u + 1] = view_row_ptr[u] + degree;
+    }
+
+    size_t m = view_row_ptr[n] > 0 ? (size_t)view_row_ptr[n] : 1;
+    int *view_col_idx = malloc(m * sizeof(int));
+    int64_t *view_edge_ids = edge_ids ? malloc(m * sizeof(int64_t)) : NULL;
+    int *view_mult = mult ? malloc(m * sizeof(int)) : NULL;
+    if (!view_col_idx || (edge_ids && !view_edge_ids) || (mult && !view_mult)) {
+        free(view_row_ptr);
+        free(view_col_idx);
+        free(view_edge_ids);
+        free(view_mult);
+        return -1;
+    }
+
+    for (int u = 0; u < n; u++) {
+        int64_t pos = view_row_ptr[u];
+        csr_edge_iter it = incoming ? csr_in_edges(graph, u) : csr_out_edges(graph, u);
+        while (csr_edge_next(&it)) {
+            if (!wanted[types[it.slot]]) continue;
+            view_col_idx[pos] = it.node;
+            if (edge_ids) view_edge_ids[pos] = edge_ids[it.slot];
+            if (mult) view_mult[pos] = mult[it.slot];
+            pos++;
+        }
+    }
+
+    *out_row_ptr = view_row_ptr;
+    *out_col_idx = view_col_idx;
+    if (out_edge_ids) *out_edge_ids = view_edge_ids;
+    *out_mult = view_mult;
+    return 0;
+}
+
+csr_graph* csr_graph_type_view(csr_graph *graph, char *const *types, int type_count)
+{
+    if (!graph || !types || type_count <= 0) return graph;
+
+    /* Key: sorted type names, so the same filter in any order reuses the view */
+    char **sorted = malloc(type_count * sizeof(char*));
+    if (!sorted) return NULL;
+    memcpy(sorted, types, type_count * sizeof(char*));
+    qsort(sorted, type_count, sizeof(char*), compare_strings);
+
+    size_t key_len = 1;
+    for (int i = 0; i < type_count; i++) {
+        key_len += strlen(sorted[i]) + 1;
+    }
+    char *key = malloc(key_len);
+    bool *wanted = calloc(graph->type_count > 0 ? graph->type_count : 1, sizeof(bool));
+    if (!key || !wanted) {
+        free(sorted);
+        free(key);
+        free(wanted);
+        return NULL;
+    }
+    key[0] = '\0';
+    for (int i = 0; i < type_count; i++) {
+        strcat(key, sorted[i]);
+        strcat(key, "\n");
+    }
+
+    if (graph->type_view && strcmp(graph->type_view_key, key) == 0) {
+        free(sorted);
+        free(key);
+        free(wanted);
+        return graph->type_view;
+    }
+
+    for (int i = 0; i < type_count; i++) {
+        int t = csr_graph_find_type(graph, sorted[i]);
+        if (t >= 0) wanted[t] = true;
+    }
+    free(sorted);
+
+    csr_graph *view = calloc(1, sizeof(csr_graph));
+    if (!view) {
+        free(key);
+        free(wanted);
+        return NULL;
+    }
+    view->borrowed_nodes = true;
+    view->node_count = graph->node_count;
+    view->node_ids = graph->node_ids;
+    view->user_ids = graph->user_ids;
+    view->user_id_arena = graph->user_id_arena;
+    view->user_id_arena_size = graph->user_id_arena_size;
+    view->user_id_index = graph->user_id_index;
+    view->user_id_index_capacity = graph->user_id_index_capacity;
+    view->node_map = graph->node_map;
+    view->data_version = graph->data_version;
+
+    int n = graph->node_count;
+    int rc = 0;
+    if (graph->edge_types) {
+        rc = copy_type_segments(graph, false, wanted, graph->edge_ids, graph->multiplicity,
+                                &view->row_ptr, &view->col_idx, &view->edge_ids, &view->multiplicity);
+        if (rc == 0) {
+            rc = copy_type_segments(graph, true, wanted, NULL, graph->in_multiplicity,
+                                    &view->in_row_ptr, &view->in_col_idx, NULL, &view->in_multiplicity);
+        }
+    } else {
+        /* Untyped graph: no edge matches */
+        view->row_ptr = calloc((size_t)n + 1, sizeof(int64_t));
+        view->in_row_ptr = calloc((size_t)n + 1, sizeof(int64_t));
+        view->col_idx = malloc(sizeof(int));
+        view->in_col_idx = malloc(sizeof(int));
+        if (!view->row_ptr || !view->in_row_ptr || !view->col_idx || !view->in_col_idx) rc = -1;
+    }
+    free(wanted);
+
+    if (rc != 0) {
+        csr_graph_free(view);
+        free(key);
+        return NULL;
+    }
+    view->edge_count = view->row_ptr[n];
+    if (graph->adj.bytes && csr_graph_compress(view) != 0) {
+        csr_graph_free(view);
+        free(key);
+        return NULL;
+    }
+
+    CYPHER_DEBUG("Built relationship type view: %lld of %lld edges",
+                 (long long)view->edge_count, (long long)graph->edge_count);
+
+    csr_graph_free(graph->type_view);
+    free(graph->type_view_key);
+    graph->type_view = view;
+    graph->type_view_key = key;
+    return view;
+}
+
+typedef struct {
+    int64_t edge_id;
+    int64_t slot;
+} edge_slot;
+
+static int compare_edge_slot(const void *a, const void *b)
+{
+    int64_t x = ((const edge_slot *)a)->edge_id, y = ((const edge_slot *)b)->edge_id;
+    return (x > y) - (x < y);
+}
+
+/*
+ * Read one weight column: edge_props_real values matched to col_idx slots by
+ * edge ID. A coalesced slot takes the lightest of its edges, grouped the
+ * same way as the slots and keyed by the lowest edge ID of each group.
+ */
+static double* load_weight_column(csr_graph *graph, sqlite3 *db, const char *property)
+{
+    int64_t m = graph->edge_count;
+    double *values = malloc((m > 0 ? (size_t)m : 1) * sizeof(double));
+    edge_slot *slots = malloc((m > 0 ? (size_t)m : 1) * sizeof(edge_slot));
+    if (!values || !slots) {
+        free(values);
+        free(slots);
+        return NULL;
+    }
+
+    for (int64_t j = 0; j < m; j++) {
+        values[j] = 1.0;
+        slots[j].edge_id = graph->edge_ids[j];
+        slots[j].slot = j;
+    }
+    qsort(slots, (size_t)m, sizeof(edge_slot), compare_edge_slot);
+
+    sqlite3_stmt *stmt = NULL;
+    int rc = sqlite3_prepare_v2(db, graph->multiplicity
+        ? "SELECT MIN(e.id), MIN(coalesce(ep.value, 1.0)) FROM edges e "
+          "LEFT JOIN edge_props_real ep ON ep.edge_id = e.id "
+          "AND ep.key_id = (SELECT id FROM property_keys WHERE key = ?) "
+          "GROUP BY e.source_id, e.type, e.target_id"
+        : "SELECT ep.edge_id, ep.value FROM edge_props_real ep "
+          "JOIN property_keys pk ON pk.id = ep.key_id AND pk.key = ?",
+        -1, &stmt, NULL);
+    if (rc != SQLITE_OK) {
+        /* No property tables yet: every edge weighs 1.0 */
+        free(slots);
+        return values;
+    }
+    sqlite3_bind_text(stmt, 1, property, -1, SQLITE_STATIC);
+
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        edge_slot key = { sqlite3_column_int64(stmt, 0), 0 };
+        edge_slot *found = bsearch(&key, slots, (size_t)m, sizeof(edge_slot), compare_edge_slot);
+        if (found) values[found->slot] = sqlite3_column_double(stmt, 1);
+    }
+    sqlite3_finalize(stmt);
+
+    free(slots);
+    return values;
+}
+
+const double* csr_graph_edge_weights(csr_graph *graph, sqlite3 *db, const char *property)
+{
+    if (!graph || !property || !graph->edge_ids) return NULL;
+
+    for (int i = 0; i < graph->weight_count; i++) {
+        if (strcmp(graph->weights[i].property, property) == 0) {
+            return graph->weights[i].values;
+        }
+    }
+
+    csr_weight_column *weights = realloc(graph->weights, (graph->weight_count + 1) * sizeof(csr_weight_column));
+    if (!weights) return NULL;
+    graph->weights = weights;
+
+    csr_weight_column *column = &weights[graph->weight_count];
+    column->property = strdup(property);
+    column->values = column->property ? load_weight_column(graph, db, property) : NULL;
+    if (!column->values) {
+        free(column->property);
+        return NULL;
+    }
+    graph->weight_count++;
+
+    CYPHER_DEBUG("Cached edge weights for property '%s' (%lld edges)", property, (long long)graph->edge_count);
+    return column->values;
+}
+
+void csr_graph_drop_weights(csr_graph *graph)
+{
+    if (!graph) return;
+
+    for (int i = 0; i < graph->weight_count; i++) {
+        free(graph->weights[i].property);
+        free(graph->weights[i].values);
+    }
+    free(graph->weights);
+    graph->weights = NULL;
+    graph->weight_count = 0;
+
+    csr_graph_drop_weights(graph->type_view);
+}
+
+/*
+ * Relationship type lookup used while scanning the edges table: a hash
+ * index over graph->type_names, plus the last type seen since edges of one
+ * type tend to arrive together.
+ */
+typedef struct {
+    csr_string_slot *slots;
+    int capacity;
+    int last;
+} type_table;
+
+static int type_table_grow(type_table *table, const csr_graph *graph)
+{
+    int capacity = table->capacity ? table->capacity * 2 : 64;
+    csr_string_slot *slots = malloc(capacity * sizeof(csr_string_slot));
+    if (!slots) return -1;
+    for (int i = 0; i < capacity; i++) {
+        slots[i].index = -1;
+    }
+
+    for (int t = 0; t < graph->type_count; t++) {
+        unsigned int hash = hash_string(graph->type_names[t]);
+        unsigned int h = hash & (capacity - 1);
+        while (slots[h].index >= 0) h = (h + 1) & (capacity - 1);
+        slots[h].hash = hash;
+        slots[h].index = t;
+    }
+
+    free(table->slots);
+    table->slots = slots;
+    table->capacity = capacity;
+    return 0;
+}
+
+static int type_table_intern(type_table *table, csr_graph *graph, const char *type, int len)
+{
+    if (!type) type = "";
+
+    if (graph->type_count > 0 && table->last >= 0 &&
+        strncmp(graph->type_names[table->last], type, len + 1) == 0) {
+        return table->last;
+    }
+
+    if ((graph->type_count + 1) * 2 > table->capacity && type_table_grow(table, graph) != 0) {
+        return -1;
+    }
+
+    unsigned int hash = hash_string(type);
+    unsigned int h = hash & (table->capacity - 1);
+    while (table->slots[h].index >= 0) {
+        int t = table->slots[h].index;
+        if (table->slots[h].hash == hash && strcmp(graph->type_names[t], type) == 0) {
+            table->last = t;
+            return t;
+        }
+        h = (h + 1) & (table->capacity - 1);
+    }
+
+    char **names = realloc(graph->type_names, (graph->type_count + 1) * sizeof(char*));
+    if (!names) return -1;
+    graph->type_names = names;
+    names[graph->type_count] = strdup(type);
+    if (!names[graph->type_count]) return -1;
+
+    table->slots[h].hash = hash;
+    table->slots[h].index = graph->type_count;
+    table->last = graph->type_count;
+    return graph->type_count++;
+}
+
+/* Edge endpoints resolved to internal indices, -1 for missing nodes */
+typedef struct {
+    const csr_node_map *map;
+    const int64_t *source_ids;
+    const int64_t *target_ids;
+    int *edge_src;
+    int *edge_tgt;
+    int64_t *resolved;      /* Edges with both endpoints present, per chunk */
+} endpoint_lookup;
+
+static void resolve_endpoints_chunk(void *ctx, int chunk, int64_t begin, int64_t end)
+{
+    endpoint_lookup *lookup = (endpoint_lookup *)ctx;
+    int64_t resolved = 0;
+    for (int64_t e = begin; e < end; e++) {
+        lookup->edge_src[e] = node_map_find(lookup->map, lookup->source_ids[e]);
+        lookup->edge_tgt[e] = node_map_find(lookup->map, lookup->target_ids[e]);
+        if (lookup->edge_src[e] >= 0 && lookup->edge_tgt[e] >= 0) resolved++;
+    }
+    lookup->resolved[chunk] = resolved;
+}
+
+/*
+ * Prepare "<prefix> IN (?, ...) <suffix>" with one parameter per name, bound
+ * in order, or just "<unfiltered>" when there are no names.
+ */
+static int prepare_name_filter(sqlite3 *db, const char *unfiltered, const char *prefix,
+                               char *const *names, int count, const char *suffix,
+                               sqlite3_stmt **stmt)
+{
+    if (count <= 0) {
+        return sqlite3_prepare_v2(db, unfiltered, -1, stmt, NULL);
+    }
+
+    size_t len = strlen(prefix) + strlen(suffix) + 3 * (size_t)count + 8;
+    char *sql = malloc(len);
+    if (!sql) return SQLITE_NOMEM;
+
+    size_t pos = (size_t)snprintf(sql, len, "%s IN (", prefix);
+    for (int i = 0; i < count; i++) {
+        pos += (size_t)snprintf(sql + pos, len - pos, i > 0 ? ", ?" : "?");
+    }
+    snprintf(sql + pos, len - pos, ") %s", suffix);
+
+    int rc = sqlite3_prepare_v2(db, sql, -1, stmt, NULL);
+    free(sql);
+    for (int i = 0; rc == SQLITE_OK && i < count; i++) {
+        rc = sqlite3_bind_text(*stmt, i + 1, names[i], -1, SQLITE_TRANSIENT);
+    }
+    return rc;
+}
+
 /* Load graph from SQLite into CSR format */
 csr_graph* csr_graph_load(sqlite3 *db)
+{
+    return csr_graph_load_filtered(db, NULL, 0, NULL, 0);
+}
+
+csr_graph* csr_graph_load_filtered(sqlite3 *db, char *const *labels, int label_count,
+                                   char *const *rel_types, int rel_type_count)
 {
     if (!db) return NULL;
 
     csr_graph *graph = calloc(1, sizeof(csr_graph));
     if (!graph) return NULL;
 
+    /* Taken before reading so commits made while loading are detected later */
+    csr_data_version(db, &graph->data_version);
+
     sqlite3_stmt *stmt = NULL;
     int rc;
 
-    /* Step 1: Count nodes and get node IDs */
-    rc = sqlite3_prepare_v2(db, "SELECT id FROM nodes ORDER BY id", -1, &stmt, NULL);
+    /* Step 1: Count nodes and get node IDs (nodes with any of the labels, if given) */
+    rc = prepare_name_filter(db, "SELECT id FROM nodes ORDER BY id",
+                             "SELECT DISTINCT node_id FROM node_labels WHERE label",
+                             labels, label_count, "ORDER BY node_id", &stmt);
     if (rc != SQLITE_OK) {
         CYPHER_DEBUG("Failed to prepare node query: %s", sqlite3_errmsg(db));
+        sqlite3_finalize(stmt);
         free(graph);
         return NULL;
     }
 
     int node_capacity = 1024;
-    graph->node_ids = malloc(node_capacity * sizeof(int));
+    graph->node_ids = malloc(node_capacity * sizeof(int64_t));
     if (!graph->node_ids) {
         sqlite3_finalize(stmt);
         free(graph);
@@ -67,15 +1259,20 @@ csr_graph* csr_graph_load(sqlite3 *db)
     graph->node_count = 0;
     while (sqlite3_step(stmt) == SQLITE_ROW) {
         if (graph->node_count >= node_capacity) {
-            node_capacity *= 2;
-            graph->node_ids = realloc(graph->node_ids, node_capacity * sizeof(int));
-            if (!graph->node_ids) {
+            /* Internal indices are 32-bit */
+            int64_t *node_ids = node_capacity <= INT_MAX / 2
+                ? realloc(graph->node_ids, (size_t)node_capacity * 2 * sizeof(int64_t))
+                : NULL;
+            if (!node_ids) {
+                CYPHER_DEBUG("Too many nodes for the graph cache");
                 sqlite3_finalize(stmt);
                 csr_graph_free(graph);
                 return NULL;
             }
+            graph->node_ids = node_ids;
+            node_capacity *= 2;
         }
-        graph->node_ids[graph->node_count++] = sqlite3_column_int(stmt, 0);
+        graph->node_ids[graph->node_count++] = sqlite3_column_int64(stmt, 0);
     }
     sqlite3_finalize(stmt);
 
@@ -87,166 +1284,210 @@ csr_graph* csr_graph_load(sqlite3 *db)
 
     CYPHER_DEBUG("Loaded %d nodes", graph->node_count);
 
-    /* Build node ID -> index hash table */
-    graph->node_idx_size = HASH_TABLE_SIZE;
-    graph->node_idx = malloc(graph->node_idx_size * sizeof(int));
-    if (!graph->node_idx) {
+    /*
+     * Build node ID -> index map, sized from the node count. IDs come in
+     * ascending order, so without gaps the map is dense and edge endpoints
+     * resolve by subtraction instead of a hash probe.
+     */
+    if (node_map_build(&graph->node_map, graph->node_ids, graph->node_count) != 0) {
         csr_graph_free(graph);
         return NULL;
     }
 
-    for (int i = 0; i < graph->node_idx_size; i++) {
-        graph->node_idx[i] = -1;
-    }
-
-    for (int i = 0; i < graph->node_count; i++) {
-        int node_id = graph->node_ids[i];
-        int h = hash_int(node_id, graph->node_idx_size);
-        while (graph->node_idx[h] != -1) {
-            h = (h + 1) % graph->node_idx_size;
-        }
-        graph->node_idx[h] = i;
-    }
-
     /* Step 1b: Load user-defined 'id' property for each node */
-    graph->user_ids = calloc(graph->node_count, sizeof(char*));
-    if (graph->user_ids) {
-        rc = sqlite3_prepare_v2(db,
-            "SELECT np.node_id, np.value FROM node_props_text np "
-            "JOIN property_keys pk ON pk.id = np.key_id AND pk.key = 'id'",
-            -1, &stmt, NULL);
-        if (rc == SQLITE_OK) {
-            while (sqlite3_step(stmt) == SQLITE_ROW) {
-                int node_id = sqlite3_column_int(stmt, 0);
-                const char *user_id = (const char*)sqlite3_column_text(stmt, 1);
-
-                int h = hash_int(node_id, graph->node_idx_size);
-                while (graph->node_idx[h] != -1) {
-                    int idx = graph->node_idx[h];
-                    if (graph->node_ids[idx] == node_id) {
-                        graph->user_ids[idx] = user_id ? strdup(user_id) : NULL;
-                        break;
-                    }
-                    h = (h + 1) % graph->node_idx_size;
-                }
-            }
-            sqlite3_finalize(stmt);
-        }
-    }
-
-    /* Step 2: Count edges per node */
-    graph->row_ptr = calloc(graph->node_count + 1, sizeof(int));
-    graph->in_row_ptr = calloc(graph->node_count + 1, sizeof(int));
-    if (!graph->row_ptr || !graph->in_row_ptr) {
+    if (csr_graph_load_user_ids(graph, db) != 0) {
         csr_graph_free(graph);
         return NULL;
     }
 
-    rc = sqlite3_prepare_v2(db, "SELECT source_id, target_id FROM edges", -1, &stmt, NULL);
+    /*
+     * Step 2: Read edges (of the given types, if any) in a single scan.
+     * Endpoints are kept in memory so the CSR arrays can be filled
+     * without re-reading the edges table.
+     */
+    rc = prepare_name_filter(db, "SELECT id, source_id, target_id, type FROM edges",
+                             "SELECT id, source_id, target_id, type FROM edges WHERE type",
+                             rel_types, rel_type_count, "", &stmt);
     if (rc != SQLITE_OK) {
+        sqlite3_finalize(stmt);
         csr_graph_free(graph);
         return NULL;
     }
 
-    graph->edge_count = 0;
-    while (sqlite3_step(stmt) == SQLITE_ROW) {
-        int source_id = sqlite3_column_int(stmt, 0);
-        int target_id = sqlite3_column_int(stmt, 1);
-
-        int h = hash_int(source_id, graph->node_idx_size);
-        while (graph->node_idx[h] != -1 && graph->node_ids[graph->node_idx[h]] != source_id) {
-            h = (h + 1) % graph->node_idx_size;
-        }
-        int source_idx = (graph->node_idx[h] != -1) ? graph->node_idx[h] : -1;
+    size_t edge_capacity = 4096;
+    int64_t edge_total = 0;
+    int64_t *source_ids = malloc(edge_capacity * sizeof(int64_t));
+    int64_t *target_ids = malloc(edge_capacity * sizeof(int64_t));
+    int *edge_type = malloc(edge_capacity * sizeof(int));
+    int64_t *edge_id = malloc(edge_capacity * sizeof(int64_t));
+    int *edge_src = NULL;
+    int *edge_tgt = NULL;
+    type_table types = {0};
+    if (!source_ids || !target_ids || !edge_type || !edge_id) {
+        goto edge_error;
+    }
 
-        h = hash_int(target_id, graph->node_idx_size);
-        while (graph->node_idx[h] != -1 && graph->node_ids[graph->node_idx[h]] != target_id) {
-            h = (h + 1) % graph->node_idx_size;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        if ((size_t)edge_total >= edge_capacity) {
+            edge_capacity *= 2;
+            int64_t *new_src = realloc(source_ids, edge_capacity * sizeof(int64_t));
+            if (new_src) source_ids = new_src;
+            int64_t *new_tgt = new_src ? realloc(target_ids, edge_capacity * sizeof(int64_t)) : NULL;
+            if (new_tgt) target_ids = new_tgt;
+            int *new_type = new_tgt ? realloc(edge_type, edge_capacity * sizeof(int)) : NULL;
+            if (new_type) edge_type = new_type;
+            int64_t *new_id = new_type ? realloc(edge_id, edge_capacity * sizeof(int64_t)) : NULL;
+            if (new_id) edge_id = new_id;
+            if (!new_id) {
+                goto edge_error;
+            }
         }
-        int target_idx = (graph->node_idx[h] != -1) ? graph->node_idx[h] : -1;
-
-        if (source_idx >= 0 && target_idx >= 0) {
-            graph->row_ptr[source_idx + 1]++;
-            graph->in_row_ptr[target_idx + 1]++;
-            graph->edge_count++;
+        edge_id[edge_total] = sqlite3_column_int64(stmt, 0);
+        source_ids[edge_total] = sqlite3_column_int64(stmt, 1);
+        target_ids[edge_total] = sqlite3_column_int64(stmt, 2);
+        edge_type[edge_total] = type_table_intern(&types, graph,
+                                                  (const char *)sqlite3_column_text(stmt, 3),
+                                                  sqlite3_column_bytes(stmt, 3));
+        if (edge_type[edge_total] < 0) {
+            goto edge_error;
         }
+        edge_total++;
     }
     sqlite3_finalize(stmt);
-
-    CYPHER_DEBUG("Loaded %d edges", graph->edge_count);
-
-    /* Convert counts to cumulative offsets */
-    for (int i = 1; i <= graph->node_count; i++) {
-        graph->row_ptr[i] += graph->row_ptr[i - 1];
-        graph->in_row_ptr[i] += graph->in_row_ptr[i - 1];
+    stmt = NULL;
+    free(types.slots);
+
+    /*
+     * Resolve endpoints to internal indices in a tight loop after the scan;
+     * independent lookups overlap their cache misses far better than when
+     * interleaved with row decoding, and are split across worker threads.
+     * Edges to missing nodes are dropped.
+     */
+    edge_src = malloc((edge_total > 0 ? (size_t)edge_total : 1) * sizeof(int));
+    edge_tgt = malloc((edge_total > 0 ? (size_t)edge_total : 1) * sizeof(int));
+    if (!edge_src || !edge_tgt) {
+        goto edge_error;
     }
-
-    /* Step 3: Fill col_idx arrays */
-    graph->col_idx = malloc(graph->edge_count * sizeof(int));
-    graph->in_col_idx = malloc(graph->edge_count * sizeof(int));
-    if (!graph->col_idx || !graph->in_col_idx) {
-        csr_graph_free(graph);
-        return NULL;
+    int chunks = graph_parallel_chunks(edge_total);
+    endpoint_lookup lookup = {&graph->node_map, source_ids, target_ids, edge_src, edge_tgt,
+                              calloc(chunks, sizeof(int64_t))};
+    if (!lookup.resolved) {
+        goto edge_error;
     }
+    graph_parallel_for(edge_total, chunks, resolve_endpoints_chunk, &lookup);
 
-    int *out_count = calloc(graph->node_count, sizeof(int));
-    int *in_count = calloc(graph->node_count, sizeof(int));
-    if (!out_count || !in_count) {
-        free(out_count);
-        free(in_count);
-        csr_graph_free(graph);
-        return NULL;
+    int64_t kept = 0;
+    for (int c = 0; c < chunks; c++) {
+        kept += lookup.resolved[c];
+    }
+    free(lookup.resolved);
+    if (kept < edge_total) {
+        kept = 0;
+        for (int64_t e = 0; e < edge_total; e++) {
+            if (edge_src[e] < 0 || edge_tgt[e] < 0) continue;
+            edge_src[kept] = edge_src[e];
+            edge_tgt[kept] = edge_tgt[e];
+            edge_type[kept] = edge_type[e];
+            edge_id[kept] = edge_id[e];
+            kept++;
+        }
+        edge_total = kept;
     }
+    free(source_ids);
+    free(target_ids);
 
-    rc = sqlite3_prepare_v2(db, "SELECT source_id, target_id FROM edges", -1, &stmt, NULL);
-    if (rc != SQLITE_OK) {
-        free(out_count);
-        free(in_count);
+    CYPHER_DEBUG("Loaded %lld edges", (long long)edge_total);
+
+    /* Step 3: Build CSR arrays from the in-memory edge list */
+    rc = csr_graph_canonical_types(graph, edge_type, edge_total);
+    if (rc == 0) {
+        rc = csr_graph_build_edges(graph, edge_src, edge_tgt, edge_type, edge_id, NULL, edge_total);
+    }
+    free(edge_src);
+    free(edge_tgt);
+    free(edge_type);
+    free(edge_id);
+    if (rc != 0) {
         csr_graph_free(graph);
         return NULL;
     }
 
-    while (sqlite3_step(stmt) == SQLITE_ROW) {
-        int source_id = sqlite3_column_int(stmt, 0);
-        int target_id = sqlite3_column_int(stmt, 1);
+    CYPHER_DEBUG("CSR graph loaded: %d nodes, %lld edges, %d relationship types",
+                 graph->node_count, (long long)graph->edge_count, graph->type_count);
 
-        int h = hash_int(source_id, graph->node_idx_size);
-        while (graph->node_idx[h] != -1 && graph->node_ids[graph->node_idx[h]] != source_id) {
-            h = (h + 1) % graph->node_idx_size;
-        }
-        int source_idx = (graph->node_idx[h] != -1) ? graph->node_idx[h] : -1;
+    return graph;
 
-        h = hash_int(target_id, graph->node_idx_size);
-        while (graph->node_idx[h] != -1 && graph->node_ids[graph->node_idx[h]] != target_id) {
-            h = (h + 1) % graph->node_idx_size;
-        }
-        int target_idx = (graph->node_idx[h] != -1) ? graph->node_idx[h] : -1;
+edge_error:
+    free(source_ids);
+    free(target_ids);
+    free(edge_src);
+    free(edge_tgt);
+    free(edge_type);
+    free(edge_id);
+    free(types.slots);
+    sqlite3_finalize(stmt);
+    csr_graph_free(graph);
+    return NULL;
+}
 
-        if (source_idx >= 0 && target_idx >= 0) {
-            int out_pos = graph->row_ptr[source_idx] + out_count[source_idx]++;
-            graph->col_idx[out_pos] = target_idx;
+/*
+ * Seed nodes of personalizedPageRank() as a JSON array: a string argument
+ * is taken as JSON already, a list of integers and strings is converted.
+ * NULL if the argument is neither.
+ */
+static char* seeds_to_json(ast_node *arg)
+{
+    if (!arg) return NULL;
 
-            int in_pos = graph->in_row_ptr[target_idx] + in_count[target_idx]++;
-            graph->in_col_idx[in_pos] = source_idx;
+    cypher_literal *lit = (cypher_literal *)arg;
+    if (arg->type == AST_NODE_LITERAL && lit->literal_type == LITERAL_STRING) {
+        return lit->value.string ? strdup(lit->value.string) : NULL;
+    }
+    if (arg->type != AST_NODE_LIST) return NULL;
+
+    cypher_list *list = (cypher_list *)arg;
+    json_builder jb;
+    jbuf_init(&jb, 64);
+    jbuf_start_array(&jb);
+    for (int i = 0; list->items && i < list->items->count; i++) {
+        cypher_literal *item = (cypher_literal *)list->items->items[i];
+        if (!item || item->base.type != AST_NODE_LITERAL) continue;
+
+        if (item->literal_type == LITERAL_INTEGER) {
+            jbuf_add_item(&jb, "%lld", (long long)item->value.integer);
+        } else if (item->literal_type == LITERAL_STRING && item->value.string) {
+            /* Quote the ID, escaping what JSON requires */
+            jbuf_add_item(&jb, "\"");
+            for (const unsigned char *c = (const unsigned char *)item->value.string; *c; c++) {
+                if (*c == '"' || *c == '\\') {
+                    jbuf_appendf(&jb, "\\%c", *c);
+                } else if (*c < 0x20) {
+                    jbuf_appendf(&jb, "\\u%04x", *c);
+                } else {
+                    jbuf_appendf(&jb, "%c", *c);
+                }
+            }
+            jbuf_append(&jb, "\"");
         }
     }
-    sqlite3_finalize(stmt);
+    jbuf_end_array(&jb);
 
-    free(out_count);
-    free(in_count);
-
-    CYPHER_DEBUG("CSR graph loaded: %d nodes, %d edges", graph->node_count, graph->edge_count);
-
-    return graph;
+    if (!jbuf_ok(&jb)) {
+        jbuf_free(&jb);
+        return NULL;
+    }
+    return jbuf_take(&jb);
 }
 
 /* Detect graph algorithm in RETURN clause */
-graph_algo_params detect_graph_algorithm(cypher_return *return_clause)
+static graph_algo_params detect_algorithm_call(cypher_return *return_clause)
 {
     graph_algo_params params = {0};
     params.type = GRAPH_ALGO_NONE;
     params.damping = 0.85;
     params.iterations = 20;
+    params.tolerance = 1e-6;
+    params.epsilon = 1e-6;
     params.top_k = 0;
     params.source_id = NULL;
     params.target_id = NULL;
@@ -329,6 +1570,61 @@ graph_algo_params detect_graph_algorithm(cypher_return *return_clause)
         return params;
     }
 
+    /*
+     * Personalized PageRank: personalizedPageRank(seeds, damping, epsilon, k)
+     * or with an options map runs the push algorithm. Every other form
+     * (seeds, damping, iterations) still runs as SQL
+     * (transform_personalized_pagerank_function).
+     */
+    if (strcasecmp(func->function_name, "personalizedPageRank") == 0) {
+        bool push = false;
+        for (int i = 0; func->args && i < func->args->count; i++) {
+            ast_node *arg = func->args->items[i];
+            if (arg && arg->type == AST_NODE_MAP) push = true;
+        }
+        if (func->args && func->args->count >= 3) {
+            cypher_literal *eps_lit = (cypher_literal *)func->args->items[2];
+            if (eps_lit && eps_lit->base.type == AST_NODE_LITERAL &&
+                eps_lit->literal_type == LITERAL_DECIMAL) {
+                push = true;
+            }
+        }
+        if (!push) return params;
+
+        params.type = GRAPH_ALGO_PERSONALIZED_PAGERANK;
+        params.top_k = 0;
+
+        if (func->args && func->args->count >= 1) {
+            params.seeds = seeds_to_json(func->args->items[0]);
+        }
+        if (func->args && func->args->count >= 2) {
+            cypher_literal *damp_lit = (cypher_literal *)func->args->items[1];
+            if (damp_lit && damp_lit->base.type == AST_NODE_LITERAL) {
+                if (damp_lit->literal_type == LITERAL_DECIMAL) {
+                    params.damping = damp_lit->value.decimal;
+                } else if (damp_lit->literal_type == LITERAL_INTEGER) {
+                    params.damping = (double)damp_lit->value.integer;
+                }
+            }
+        }
+        if (func->args && func->args->count >= 3) {
+            cypher_literal *eps_lit = (cypher_literal *)func->args->items[2];
+            if (eps_lit && eps_lit->base.type == AST_NODE_LITERAL &&
+                eps_lit->literal_type == LITERAL_DECIMAL) {
+                params.epsilon = eps_lit->value.decimal;
+            }
+        }
+        if (func->args && func->args->count >= 4) {
+            cypher_literal *k_lit = (cypher_literal *)func->args->items[3];
+            if (k_lit && k_lit->base.type == AST_NODE_LITERAL &&
+                k_lit->literal_type == LITERAL_INTEGER) {
+                params.top_k = k_lit->value.integer;
+                if (params.top_k < 0) params.top_k = 0;
+            }
+        }
+        return params;
+    }
+
     /* Label Propagation */
     if (strcasecmp(func->function_name, "labelPropagation") == 0) {
         params.type = GRAPH_ALGO_LABEL_PROPAGATION;
@@ -407,6 +1703,25 @@ graph_algo_params detect_graph_algorithm(cypher_return *return_clause)
         return params;
     }
 
+    /* Harmonic Centrality */
+    if (strcasecmp(func->function_name, "harmonicCentrality") == 0 ||
+        strcasecmp(func->function_name, "harmonic") == 0) {
+        params.type = GRAPH_ALGO_HARMONIC_CENTRALITY;
+        return params;
+    }
+
+    /* Eccentricity */
+    if (strcasecmp(func->function_name, "eccentricity") == 0) {
+        params.type = GRAPH_ALGO_ECCENTRICITY;
+        return params;
+    }
+
+    /* Diameter */
+    if (strcasecmp(func->function_name, "diameter") == 0) {
+        params.type = GRAPH_ALGO_DIAMETER;
+        return params;
+    }
+
     /* Louvain Community Detection */
     if (strcasecmp(func->function_name, "louvain") == 0) {
         params.type = GRAPH_ALGO_LOUVAIN;
@@ -612,6 +1927,157 @@ graph_algo_params detect_graph_algorithm(cypher_return *return_clause)
     return params;
 }
 
+/* Append a relationship type name from an options map value */
+static void add_rel_type(graph_algo_params *params, ast_node *value)
+{
+    cypher_literal *lit = (cypher_literal *)value;
+    if (!lit || lit->base.type != AST_NODE_LITERAL || lit->literal_type != LITERAL_STRING ||
+        !lit->value.string) {
+        return;
+    }
+
+    char **types = realloc(params->rel_types, (params->rel_type_count + 1) * sizeof(char*));
+    if (!types) return;
+    params->rel_types = types;
+
+    types[params->rel_type_count] = strdup(lit->value.string);
+    if (types[params->rel_type_count]) params->rel_type_count++;
+}
+
+/*
+ * Read algorithm options from a map argument, e.g. {relationshipTypes: ['KNOWS'], graph: 'social'}
+ * or, for PageRank, {tolerance: 1e-8, reportIterations: true}, or, for personalizedPageRank, {epsilon: 1e-4},
+ * or, for betweenness and diameter, {samples: 1000, seed: 7},
+ * or, for closeness, {wassermanFaust: true},
+ * or, for APSP, {weight: 'cost'}
+ */
+static void parse_algorithm_options(cypher_function_call *func, graph_algo_params *params)
+{
+    if (!func->args) return;
+
+    for (int i = 0; i < func->args->count; i++) {
+        ast_node *arg = func->args->items[i];
+        if (!arg || arg->type != AST_NODE_MAP) continue;
+
+        cypher_map *map = (cypher_map *)arg;
+        for (int p = 0; map->pairs && p < map->pairs->count; p++) {
+            cypher_map_pair *pair = (cypher_map_pair *)map->pairs->items[p];
+            if (!pair || !pair->key) continue;
+
+            if (strcmp(pair->key, "graph") == 0) {
+                cypher_literal *lit = (cypher_literal *)pair->value;
+                if (lit && lit->base.type == AST_NODE_LITERAL && lit->literal_type == LITERAL_STRING &&
+                    lit->value.string && !params->graph_name) {
+                    params->graph_name = strdup(lit->value.string);
+                }
+                continue;
+            }
+            if (strcmp(pair->key, "tolerance") == 0) {
+                cypher_literal *lit = (cypher_literal *)pair->value;
+                if (lit && lit->base.type == AST_NODE_LITERAL) {
+                    if (lit->literal_type == LITERAL_DECIMAL && lit->value.decimal >= 0) {
+                        params->tolerance = lit->value.decimal;
+                    } else if (lit->literal_type == LITERAL_INTEGER && lit->value.integer >= 0) {
+                        params->tolerance = (double)lit->value.integer;
+                    }
+                }
+                continue;
+            }
+            if (strcmp(pair->key, "reportIterations") == 0) {
+                cypher_literal *lit = (cypher_literal *)pair->value;
+                if (lit && lit->base.type == AST_NODE_LITERAL && lit->literal_type == LITERAL_BOOLEAN) {
+                    params->report_iterations = lit->value.boolean;
+                }
+                continue;
+            }
+            if (strcmp(pair->key, "epsilon") == 0) {
+                cypher_literal *lit = (cypher_literal *)pair->value;
+                if (lit && lit->base.type == AST_NODE_LITERAL && lit->literal_type == LITERAL_DECIMAL &&
+                    lit->value.decimal > 0) {
+                    params->epsilon = lit->value.decimal;
+                }
+                continue;
+            }
+            if (strcmp(pair->key, "wassermanFaust") == 0) {
+                cypher_literal *lit = (cypher_literal *)pair->value;
+                if (lit && lit->base.type == AST_NODE_LITERAL && lit->literal_type == LITERAL_BOOLEAN) {
+                    params->wasserman_faust = lit->value.boolean;
+                }
+                continue;
+            }
+            if (strcmp(pair->key, "samples") == 0) {
+                cypher_literal *lit = (cypher_literal *)pair->value;
+                if (lit && lit->base.type == AST_NODE_LITERAL && lit->literal_type == LITERAL_INTEGER &&
+                    lit->value.integer > 0 && lit->value.integer <= INT_MAX) {
+                    params->samples = (int)lit->value.integer;
+                }
+                continue;
+            }
+            if (strcmp(pair->key, "seed") == 0) {
+                cypher_literal *lit = (cypher_literal *)pair->value;
+                if (lit && lit->base.type == AST_NODE_LITERAL && lit->literal_type == LITERAL_INTEGER) {
+                    params->seed = lit->value.integer;
+                }
+                continue;
+            }
+            if (strcmp(pair->key, "weight") == 0) {
+                cypher_literal *lit = (cypher_literal *)pair->value;
+                if (lit && lit->base.type == AST_NODE_LITERAL && lit->literal_type == LITERAL_STRING &&
+                    lit->value.string && !params->weight_prop) {
+                    params->weight_prop = strdup(lit->value.string);
+                }
+                continue;
+            }
+            if (strcmp(pair->key, "relationshipTypes") != 0) continue;
+
+            if (pair->value && pair->value->type == AST_NODE_LIST) {
+                cypher_list *list = (cypher_list *)pair->value;
+                for (int t = 0; list->items && t < list->items->count; t++) {
+                    add_rel_type(params, list->items->items[t]);
+                }
+            } else {
+                add_rel_type(params, pair->value);
+            }
+        }
+    }
+}
+
+graph_algo_params detect_graph_algorithm(cypher_return *return_clause)
+{
+    graph_algo_params params = detect_algorithm_call(return_clause);
+    if (params.type == GRAPH_ALGO_NONE) {
+        return params;
+    }
+
+    cypher_return_item *item = (cypher_return_item *)return_clause->items->items[0];
+    parse_algorithm_options((cypher_function_call *)item->expr, &params);
+    return params;
+}
+
+void graph_algo_params_free(graph_algo_params *params)
+{
+    if (!params) return;
+
+    free(params->source_id);
+    free(params->target_id);
+    free(params->weight_prop);
+    free(params->lat_prop);
+    free(params->lon_prop);
+    for (int i = 0; i < params->rel_type_count; i++) {
+        free(params->rel_types[i]);
+    }
+    free(params->rel_types);
+    free(params->graph_name);
+    free(params->seeds);
+
+    params->source_id = params->target_id = params->weight_prop = NULL;
+    params->lat_prop = params->lon_prop = NULL;
+    params->rel_types = NULL;
+    params->rel_type_count = 0;
+    params->graph_name = NULL;
+    params->seeds = NULL;
+}
+
 /* Free algorithm result */
 void graph_algo_result_free(graph_algo_result *result)
 {
@@ -0,0 +1,176 @@
+/*
+ * Parallel Edge Coalescing - One CSR Slot per Distinct Edge
+ *
+ * Interaction graphs repeat the same (source, type, target) edge many
+ * times. Each copy costs a col_idx and an in_col_idx entry, an edge type in
+ * each direction and an edge ID, and every traversal visits it again.
+ * csr_graph_coalesce() folds the copies into one slot with a multiplicity:
+ * rows are sorted by (type, neighbour), so parallel edges sit next to each
+ * other and one pass per direction merges each run into a single slot,
+ * summing multiplicities and keeping the lowest edge ID. Both directions
+ * fold to the same number of slots.
+ *
+ * Merges and reloads rebuild the arrays (graph_delta.c) and run the pass
+ * again, folding added edges into existing slots; slots already coalesced
+ * carry their multiplicity through csr_graph_build_edges().
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "executor/graph_algorithms.h"
+#include "executor/graph_algo_internal.h"
+
+/* One direction's rows after folding */
+typedef struct {
+    int64_t *row_ptr;
+    int *col_idx;
+    int *types;
+    int64_t *edge_ids;
+    int *mult;
+} folded_rows;
+
+static void folded_rows_free(folded_rows *rows)
+{
+    free(rows->row_ptr);
+    free(rows->col_idx);
+    free(rows->types);
+    free(rows->edge_ids);
+    free(rows->mult);
+    memset(rows, 0, sizeof(*rows));
+}
+
+/* Fold runs of equal (type, neighbour) in every row of one direction; 0 on success */
+static int fold_rows(const csr_graph *graph, bool incoming, const int *col_idx, folded_rows *out)
+{
+    int n = graph->node_count;
+    const int64_t *row_ptr = incoming ? graph->in_row_ptr : graph->row_ptr;
+    const int *types = incoming ? graph->in_edge_types : graph->edge_types;
+    const int64_t *edge_ids = incoming ? NULL : graph->edge_ids;
+    const int *mult = incoming ? graph->in_multiplicity : graph->multiplicity;
+
+    /* Count the slots first, so the arrays are allocated at their final size */
+    out->row_ptr = malloc(((size_t)n + 1) * sizeof(int64_t));
+    if (!out->row_ptr) return -1;
+    out->row_ptr[0] = 0;
+    for (int u = 0; u < n; u++) {
+        int64_t distinct = 0;
+        for (int64_t j = row_ptr[u]; j < row_ptr[u + 1]; j++) {
+            if (j == row_ptr[u] || col_idx[j] != col_idx[j - 1] || (types && types[j] != types[j - 1])) {
+                distinct++;
+            }
+        }
+        out->row_ptr[u + 1] = out->row_ptr[u] + distinct;
+    }
+
+    size_t size = out->row_ptr[n] > 0 ? (size_t)out->row_ptr[n] : 1;
+    out->col_idx = malloc(size * sizeof(int));
+    out->types = types ? malloc(size * sizeof(int)) : NULL;
+    out->edge_ids = edge_ids ? malloc(size * sizeof(int64_t)) : NULL;
+    out->mult = malloc(size * sizeof(int));
+    if (!out->col_idx || (types && !out->types) || (edge_ids && !out->edge_ids) || !out->mult) {
+        folded_rows_free(out);
+        return -1;
+    }
+
+    int64_t k = -1;
+    for (int u = 0; u < n; u++) {
+        for (int64_t j = row_ptr[u]; j < row_ptr[u + 1]; j++) {
+            if (j == row_ptr[u] || col_idx[j] != col_idx[j - 1] || (types && types[j] != types[j - 1])) {
+                k++;
+                out->col_idx[k] = col_idx[j];
+                if (types) out->types[k] = types[j];
+                if (edge_ids) out->edge_ids[k] = edge_ids[j];
+                out->mult[k] = csr_slot_multiplicity(mult, j);
+            } else {
+                out->mult[k] += csr_slot_multiplicity(mult, j);
+                if (edge_ids && edge_ids[j] < out->edge_ids[k]) out->edge_ids[k] = edge_ids[j];
+            }
+        }
+    }
+    return 0;
+}
+
+int csr_graph_coalesce(csr_graph *graph)
+{
+    if (!graph || graph->borrowed_nodes) return -1;
+    if (!graph->row_ptr) return 0;
+
+    /* Shared arrays are read-only: take a private copy first (a shared graph is in ID order) */
+    if (graph->shared && csr_graph_reorder(graph, graph->order) != 0) return -1;
+
+    bool compressed = graph->adj.bytes != NULL;
+    int *col_idx = compressed ? csr_graph_decode_rows(graph, false) : graph->col_idx;
+    int *in_col_idx = compressed ? csr_graph_decode_rows(graph, true) : graph->in_col_idx;
+    folded_rows out = {0}, in = {0};
+    int rc = col_idx && in_col_idx ? 0 : -1;
+    if (rc == 0) rc = fold_rows(graph, false, col_idx, &out);
+    if (rc == 0) rc = fold_rows(graph, true, in_col_idx, &in);
+    if (compressed) {
+        free(col_idx);
+        free(in_col_idx);
+    }
+
+    int n = graph->node_count;
+    if (rc != 0 || out.row_ptr[n] != in.row_ptr[n]) {
+        folded_rows_free(&out);
+        folded_rows_free(&in);
+        return -1;
+    }
+
+    int64_t before = graph->edge_count;
+    (void)before;  /* Only logged */
+    csr_graph_release(graph, graph->row_ptr);
+    csr_graph_release(graph, graph->col_idx);
+    csr_graph_release(graph, graph->in_row_ptr);
+    csr_graph_release(graph, graph->in_col_idx);
+    csr_graph_release(graph, graph->edge_types);
+    csr_graph_release(graph, graph->in_edge_types);
+    csr_graph_release(graph, graph->edge_ids);
+    csr_graph_release(graph, graph->multiplicity);
+    csr_graph_release(graph, graph->in_multiplicity);
+    csr_adjacency_free(&graph->adj);
+    csr_adjacency_free(&graph->in_adj);
+
+    graph->edge_count = out.row_ptr[n];
+    graph->row_ptr = out.row_ptr;
+    graph->col_idx = out.col_idx;
+    graph->edge_types = out.types;
+    graph->edge_ids = out.edge_ids;
+    graph->multiplicity = out.mult;
+    graph->in_row_ptr = in.row_ptr;
+    graph->in_col_idx = in.col_idx;
+    graph->in_edge_types = in.types;
+    graph->in_multiplicity = in.mult;
+    free(in.edge_ids);
+
+    /* Everything indexed by slot is rebuilt on next use */
+    csr_graph_drop_weights(graph);
+    csr_graph_free(graph->type_view);
+    graph->type_view = NULL;
+    free(graph->type_view_key);
+    graph->type_view_key = NULL;
+    csr_neighbour_sets_free(graph->undirected);
+    graph->undirected = NULL;
+    csr_neighbour_sets_free(graph->out_sets);
+    graph->out_sets = NULL;
+
+    if (compressed) csr_graph_compress(graph);
+
+    CYPHER_DEBUG("Coalesced parallel edges: %lld -> %lld slots for %lld edges",
+                 (long long)before, (long long)graph->edge_count, (long long)csr_graph_edge_total(graph));
+    return 0;
+}
+
+int64_t csr_graph_edge_total(const csr_graph *graph)
+{
+    if (!graph) return 0;
+    if (!graph->multiplicity) return graph->edge_count;
+
+    int64_t total = 0;
+    for (int64_t j = 0; j < graph->edge_count; j++) {
+        total += graph->multiplicity[j];
+    }
+    return total;
+}
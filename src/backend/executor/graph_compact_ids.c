@@ -0,0 +1,132 @@
+/*
+ * Node ID Compaction - Dense Node IDs for the Graph Cache
+ *
+ * Node IDs are AUTOINCREMENT rowids, so deletions leave gaps, and
+ * csr_graph_load() then resolves every edge endpoint through the node map's
+ * hash table. csr_compact_node_ids() renumbers the nodes 1..n, keeping
+ * their order, and rewrites every table that refers to them. Loads of the
+ * compacted tables find IDs first_id + i at index i and use a dense map:
+ * an endpoint's index is its ID minus one.
+ *
+ * IDs are moved in two passes, old -> -new -> new, so no intermediate value
+ * collides with an ID not yet moved in tables keyed by node. Foreign key
+ * checks are deferred to the end of the transaction. Rows left pointing at
+ * deleted nodes (tables written with foreign keys off) are dropped first,
+ * as a renumbered node could otherwise inherit them. The node
+ * AUTOINCREMENT counter is reset to n so new nodes continue the sequence.
+ *
+ * Node IDs are visible to queries (id()), so any IDs held outside the
+ * database are invalid afterwards. Edge IDs are left unchanged.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "executor/graph_algorithms.h"
+#include "executor/graph_algo_internal.h"
+
+/* Tables whose node_id column refers to nodes(id), with (node_id, ...) primary keys */
+static const char *const node_tables[] = {
+    "node_labels", "node_props_int", "node_props_text", "node_props_real", "node_props_bool",
+};
+
+static int exec_sql(sqlite3 *db, const char *sql, char **error)
+{
+    if (sqlite3_exec(db, sql, NULL, NULL, NULL) == SQLITE_OK) return 0;
+
+    char message[512];
+    snprintf(message, sizeof(message), "Node ID compaction failed: %s", sqlite3_errmsg(db));
+    *error = strdup(message);
+    return -1;
+}
+
+static int64_t query_int(sqlite3 *db, const char *sql)
+{
+    sqlite3_stmt *stmt = NULL;
+    int64_t value = -1;
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, NULL) == SQLITE_OK &&
+        sqlite3_step(stmt) == SQLITE_ROW) {
+        value = sqlite3_column_int64(stmt, 0);
+    }
+    sqlite3_finalize(stmt);
+    return value;
+}
+
+/* Rewrite the renumbered rows of the tables keyed by node; 0 on success */
+static int rewrite_node_tables(sqlite3 *db, char **error)
+{
+    char sql[512];
+
+    for (size_t t = 0; t < sizeof(node_tables) / sizeof(node_tables[0]); t++) {
+        snprintf(sql, sizeof(sql),
+                 "DELETE FROM %s WHERE node_id NOT IN (SELECT id FROM nodes);"
+                 "UPDATE %s SET node_id = -(SELECT new_id FROM temp.gql_id_map WHERE old_id = node_id) "
+                 "WHERE node_id IN (SELECT old_id FROM temp.gql_id_map);"
+                 "UPDATE %s SET node_id = -node_id WHERE node_id < 0;",
+                 node_tables[t], node_tables[t], node_tables[t]);
+        if (exec_sql(db, sql, error) != 0) return -1;
+    }
+
+    return exec_sql(db,
+        "DELETE FROM edges WHERE source_id NOT IN (SELECT id FROM nodes) "
+        "OR target_id NOT IN (SELECT id FROM nodes);"
+        "UPDATE edges SET source_id = (SELECT new_id FROM temp.gql_id_map WHERE old_id = source_id) "
+        "WHERE source_id IN (SELECT old_id FROM temp.gql_id_map);"
+        "UPDATE edges SET target_id = (SELECT new_id FROM temp.gql_id_map WHERE old_id = target_id) "
+        "WHERE target_id IN (SELECT old_id FROM temp.gql_id_map);"
+        "UPDATE nodes SET id = -(SELECT new_id FROM temp.gql_id_map WHERE old_id = nodes.id) "
+        "WHERE id IN (SELECT old_id FROM temp.gql_id_map);"
+        "UPDATE nodes SET id = -id WHERE id < 0;"
+        "UPDATE sqlite_sequence SET seq = (SELECT COUNT(*) FROM nodes) WHERE name = 'nodes';",
+        error);
+}
+
+int csr_compact_node_ids(sqlite3 *db, int64_t *node_count, int64_t *renumbered, char **error)
+{
+    *node_count = 0;
+    *renumbered = 0;
+    *error = NULL;
+    if (!db) {
+        *error = strdup("No database");
+        return -1;
+    }
+
+    if (query_int(db, "SELECT COUNT(*) FROM sqlite_master WHERE type = 'table' AND name = 'nodes'") <= 0) {
+        return 0;
+    }
+    if (query_int(db, "SELECT COUNT(*) FROM nodes WHERE id <= 0") != 0) {
+        *error = strdup("Node ID compaction needs positive node IDs");
+        return -1;
+    }
+
+    if (exec_sql(db, "SAVEPOINT gql_compact_ids; PRAGMA defer_foreign_keys = ON;", error) != 0) {
+        return -1;
+    }
+
+    /* Old -> new ID for every node that moves */
+    int rc = exec_sql(db,
+        "CREATE TEMP TABLE IF NOT EXISTS gql_id_map (old_id INTEGER PRIMARY KEY, new_id INTEGER NOT NULL);"
+        "DELETE FROM temp.gql_id_map;"
+        "INSERT INTO temp.gql_id_map "
+        "SELECT id, new_id FROM (SELECT id, row_number() OVER (ORDER BY id) AS new_id FROM nodes) "
+        "WHERE id != new_id;",
+        error);
+    if (rc == 0) {
+        *renumbered = sqlite3_changes(db);
+        *node_count = query_int(db, "SELECT COUNT(*) FROM nodes");
+        if (*renumbered > 0) rc = rewrite_node_tables(db, error);
+    }
+    if (rc == 0) rc = exec_sql(db, "DROP TABLE temp.gql_id_map; RELEASE gql_compact_ids;", error);
+
+    if (rc != 0) {
+        sqlite3_exec(db, "ROLLBACK TO gql_compact_ids; RELEASE gql_compact_ids;", NULL, NULL, NULL);
+        *node_count = 0;
+        *renumbered = 0;
+        return -1;
+    }
+
+    CYPHER_DEBUG("Compacted node IDs: %lld nodes, %lld renumbered",
+                 (long long)*node_count, (long long)*renumbered);
+    return 0;
+}
@@ -0,0 +1,165 @@
+/*
+ * Compressed Adjacency - Gap-Encoded Neighbour Lists
+ *
+ * col_idx and in_col_idx take four bytes per edge each, most of a large
+ * graph's memory. csr_graph_compress() replaces them with byte streams:
+ * each row stores the zigzag varint of every neighbour minus the previous
+ * one, starting from the row's own node. Rows are sorted by (type,
+ * neighbour), so gaps are small within a type segment and only the first
+ * neighbour of a segment steps back. Graphs whose node order follows the
+ * data's locality need one or two bytes per edge.
+ *
+ * Rows are decoded front to back with csr_edge_iter (graph_algo_internal.h).
+ * row_ptr is kept, so an edge's slot still indexes edge_types, edge_ids and
+ * cached weights, and degrees stay O(1).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "executor/graph_algorithms.h"
+#include "executor/graph_algo_internal.h"
+
+static inline uint32_t zigzag(int32_t gap)
+{
+    return ((uint32_t)gap << 1) ^ (uint32_t)(gap >> 31);
+}
+
+static inline int varint_size(uint32_t z)
+{
+    int size = 1;
+    while (z >= 0x80) {
+        z >>= 7;
+        size++;
+    }
+    return size;
+}
+
+/*
+ * Encode every row of one direction. 0 on success, -1 on allocation failure
+ * or if a block of rows needs more than 4 GB (the graph then stays plain).
+ */
+static int encode_rows(int n, const int64_t *row_ptr, const int *col_idx, csr_adjacency *adj)
+{
+    int blocks = (n >> CSR_ADJ_BLOCK_SHIFT) + 1;
+    adj->block_start = calloc(blocks, sizeof(int64_t));
+    adj->row_start = malloc((n > 0 ? (size_t)n : 1) * sizeof(uint32_t));
+    if (!adj->block_start || !adj->row_start) {
+        csr_adjacency_free(adj);
+        return -1;
+    }
+
+    /* Sizes first, so the stream is allocated once at its final size */
+    int64_t size = 0;
+    for (int u = 0; u < n; u++) {
+        int block = u >> CSR_ADJ_BLOCK_SHIFT;
+        if ((u & ((1 << CSR_ADJ_BLOCK_SHIFT) - 1)) == 0) {
+            adj->block_start[block] = size;
+        }
+        if (size - adj->block_start[block] > UINT32_MAX) {
+            csr_adjacency_free(adj);
+            return -1;
+        }
+        adj->row_start[u] = (uint32_t)(size - adj->block_start[block]);
+
+        int prev = u;
+        for (int64_t j = row_ptr[u]; j < row_ptr[u + 1]; j++) {
+            size += varint_size(zigzag(col_idx[j] - prev));
+            prev = col_idx[j];
+        }
+    }
+
+    adj->size = size;
+    adj->bytes = malloc(size > 0 ? (size_t)size : 1);
+    if (!adj->bytes) {
+        csr_adjacency_free(adj);
+        return -1;
+    }
+
+    uint8_t *pos = adj->bytes;
+    for (int u = 0; u < n; u++) {
+        int prev = u;
+        for (int64_t j = row_ptr[u]; j < row_ptr[u + 1]; j++) {
+            uint32_t z = zigzag(col_idx[j] - prev);
+            while (z >= 0x80) {
+                *pos++ = (uint8_t)(z | 0x80);
+                z >>= 7;
+            }
+            *pos++ = (uint8_t)z;
+            prev = col_idx[j];
+        }
+    }
+    return 0;
+}
+
+void csr_adjacency_free(csr_adjacency *adj)
+{
+    free(adj->bytes);
+    free(adj->block_start);
+    free(adj->row_start);
+    memset(adj, 0, sizeof(*adj));
+}
+
+int csr_graph_compress(csr_graph *graph)
+{
+    if (!graph || graph->adj.bytes || !graph->row_ptr || !graph->col_idx) return 0;
+
+    int n = graph->node_count;
+    csr_adjacency adj = {0}, in_adj = {0};
+    if (encode_rows(n, graph->row_ptr, graph->col_idx, &adj) != 0 ||
+        encode_rows(n, graph->in_row_ptr, graph->in_col_idx, &in_adj) != 0) {
+        csr_adjacency_free(&adj);
+        return -1;
+    }
+
+    size_t before = csr_graph_adjacency_bytes(graph);
+    (void)before;  /* Only logged */
+
+    /* Shared arrays belong to the registry; the graph just stops using them */
+    if (!graph->shared) {
+        csr_graph_release(graph, graph->col_idx);
+        csr_graph_release(graph, graph->in_col_idx);
+    }
+    graph->col_idx = NULL;
+    graph->in_col_idx = NULL;
+    graph->adj = adj;
+    graph->in_adj = in_adj;
+
+    /* The cached type view is plain; the next one is built compressed */
+    csr_graph_free(graph->type_view);
+    graph->type_view = NULL;
+    free(graph->type_view_key);
+    graph->type_view_key = NULL;
+
+    CYPHER_DEBUG("Compressed adjacency: %zu -> %zu bytes for %lld edges",
+                 before, csr_graph_adjacency_bytes(graph), (long long)graph->edge_count);
+    return 0;
+}
+
+size_t csr_graph_adjacency_bytes(const csr_graph *graph)
+{
+    if (!graph || !graph->row_ptr) return 0;
+
+    if (graph->adj.bytes) {
+        size_t n = (size_t)graph->node_count;
+        size_t index = ((n >> CSR_ADJ_BLOCK_SHIFT) + 1) * sizeof(int64_t) + n * sizeof(uint32_t);
+        return (size_t)(graph->adj.size + graph->in_adj.size) + 2 * index;
+    }
+    return 2 * (size_t)graph->edge_count * sizeof(int);
+}
+
+int* csr_graph_decode_rows(const csr_graph *graph, bool incoming)
+{
+    int64_t m = graph->edge_count;
+    int *col_idx = malloc(m > 0 ? (size_t)m * sizeof(int) : sizeof(int));
+    if (!col_idx) return NULL;
+
+    for (int u = 0; u < graph->node_count; u++) {
+        csr_edge_iter it = incoming ? csr_in_edges(graph, u) : csr_out_edges(graph, u);
+        while (csr_edge_next(&it)) {
+            col_idx[it.slot] = it.node;
+        }
+    }
+    return col_idx;
+}
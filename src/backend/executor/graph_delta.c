@@ -0,0 +1,530 @@
+/*
+ * Graph Delta - Incremental CSR Maintenance
+ *
+ * Node and edge additions/removals made through the executor are recorded
+ * against the cached CSR graph instead of invalidating it. Before the next
+ * algorithm runs, the pending changes are merged with the existing CSR
+ * arrays in memory, producing the same graph a full reload would (rows
+ * ordered by relationship type, then neighbour), without re-reading the
+ * graph tables.
+ *
+ * Writes the executor does not record itself are caught by the connection's
+ * update hook (csr_graph_note_row_change), rollbacks and commits from other
+ * connections by marking the graph stale, so the cache never serves a graph
+ * that no longer matches the database.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "executor/graph_algorithms.h"
+#include "executor/graph_algo_internal.h"
+
+static int id_list_push(csr_id_list *list, int64_t value)
+{
+    if (list->count >= list->capacity) {
+        int new_capacity = list->capacity ? list->capacity * 2 : 64;
+        int64_t *items = realloc(list->items, new_capacity * sizeof(int64_t));
+        if (!items) return -1;
+        list->items = items;
+        list->capacity = new_capacity;
+    }
+    list->items[list->count++] = value;
+    return 0;
+}
+
+void csr_delta_free(struct csr_delta *delta)
+{
+    if (!delta) return;
+    free(delta->added_nodes.items);
+    free(delta->removed_nodes.items);
+    free(delta->added_edges.items);
+    free(delta->removed_edges.items);
+    free(delta);
+}
+
+/* Get the graph's delta, creating it on first use */
+static struct csr_delta* graph_delta(csr_graph *graph)
+{
+    if (!graph->delta) {
+        graph->delta = calloc(1, sizeof(struct csr_delta));
+        if (!graph->delta) {
+            CYPHER_DEBUG("Failed to allocate graph delta - changes will not be tracked");
+        }
+    }
+    return graph->delta;
+}
+
+/* Delta to record into, or NULL if nothing is cached or a reload is already pending */
+static struct csr_delta* recording_delta(csr_graph *graph)
+{
+    if (!graph) return NULL;
+
+    struct csr_delta *delta = graph_delta(graph);
+    return (delta && !delta->stale) ? delta : NULL;
+}
+
+static void delta_push(struct csr_delta *delta, csr_id_list *list, int64_t value)
+{
+    if (id_list_push(list, value) != 0) {
+        delta->stale = true;
+    }
+}
+
+/* The executor and the update hook both report a node write; keep one */
+static void delta_push_node(struct csr_delta *delta, csr_id_list *list, int64_t node_id)
+{
+    if (list->count > 0 && list->items[list->count - 1] == node_id) return;
+    delta_push(delta, list, node_id);
+}
+
+void csr_graph_record_node_added(csr_graph *graph, int64_t node_id)
+{
+    struct csr_delta *delta = recording_delta(graph);
+    if (delta) delta_push_node(delta, &delta->added_nodes, node_id);
+}
+
+void csr_graph_record_node_removed(csr_graph *graph, int64_t node_id)
+{
+    struct csr_delta *delta = recording_delta(graph);
+    if (delta) delta_push_node(delta, &delta->removed_nodes, node_id);
+}
+
+void csr_graph_record_edge_added(csr_graph *graph, int64_t edge_id, int64_t source_id, int64_t target_id,
+                                 const char *type)
+{
+    struct csr_delta *delta = recording_delta(graph);
+    if (!delta) return;
+
+    int type_id = csr_graph_intern_type(graph, type ? type : "");
+    if (type_id < 0) {
+        delta->stale = true;
+        return;
+    }
+    delta_push(delta, &delta->added_edges, edge_id);
+    delta_push(delta, &delta->added_edges, source_id);
+    delta_push(delta, &delta->added_edges, target_id);
+    delta_push(delta, &delta->added_edges, type_id);
+    delta->recorded_edge_rows++;
+}
+
+void csr_graph_record_edge_removed(csr_graph *graph, int64_t edge_id)
+{
+    struct csr_delta *delta = recording_delta(graph);
+    if (delta) {
+        delta_push(delta, &delta->removed_edges, edge_id);
+        delta->recorded_edge_rows++;
+    }
+}
+
+void csr_graph_record_edges_detached(csr_graph *graph, int count)
+{
+    struct csr_delta *delta = recording_delta(graph);
+    if (delta) delta->recorded_edge_rows += count;
+}
+
+void csr_graph_record_user_ids_changed(csr_graph *graph)
+{
+    struct csr_delta *delta = recording_delta(graph);
+    if (delta) delta->user_ids_changed = true;
+}
+
+void csr_graph_note_row_change(csr_graph *graph, int op, const char *table,
+                               sqlite3_int64 rowid, bool in_executor)
+{
+    if (!graph || !table) return;
+
+    /* Kept even when a reload is already pending (see graph_reload) */
+    if ((strcmp(table, "nodes") == 0 || strcmp(table, "edges") == 0 ||
+         strcmp(table, "node_props_text") == 0) && graph_delta(graph)) {
+        graph->delta->written = true;
+    }
+
+    struct csr_delta *delta = recording_delta(graph);
+    if (!delta) return;
+
+    if (strcmp(table, "nodes") == 0) {
+        if (op == SQLITE_INSERT) {
+            delta_push_node(delta, &delta->added_nodes, rowid);
+        } else if (op == SQLITE_DELETE) {
+            delta_push_node(delta, &delta->removed_nodes, rowid);
+        } else {
+            delta->stale = true;
+        }
+    } else if (strcmp(table, "edges") == 0) {
+        /* Endpoints are unknown here; the record functions must account for the row */
+        if (op == SQLITE_UPDATE) {
+            delta->stale = true;
+        } else {
+            delta->observed_edge_rows++;
+        }
+    } else if (strcmp(table, "node_props_text") == 0) {
+        /* The executor flags its own 'id' changes by clause */
+        if (!in_executor) delta->user_ids_changed = true;
+    } else if (strcmp(table, "edge_props_real") == 0) {
+        csr_graph_drop_weights(graph);
+    }
+}
+
+void csr_graph_mark_stale(csr_graph *graph)
+{
+    if (!graph) return;
+
+    struct csr_delta *delta = graph_delta(graph);
+    if (delta) delta->stale = true;
+}
+
+void csr_graph_check_data_version(csr_graph *graph, sqlite3 *db)
+{
+    if (!graph) return;
+
+    sqlite3_int64 version;
+    if (csr_data_version(db, &version) != 0) return;
+
+    if (version != graph->data_version) {
+        CYPHER_DEBUG("Database changed by another connection - graph is stale");
+        csr_graph_mark_stale(graph);
+    }
+}
+
+int csr_data_version(sqlite3 *db, sqlite3_int64 *version)
+{
+    if (!db) return -1;
+
+    sqlite3_stmt *stmt = NULL;
+    if (sqlite3_prepare_v2(db, "PRAGMA data_version", -1, &stmt, NULL) != SQLITE_OK) {
+        return -1;
+    }
+
+    int rc = -1;
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+        *version = sqlite3_column_int64(stmt, 0);
+        rc = 0;
+    }
+    sqlite3_finalize(stmt);
+    return rc;
+}
+
+/* Edge rows were written that no record function accounted for */
+static bool delta_needs_reload(const struct csr_delta *delta)
+{
+    return delta->stale || delta->observed_edge_rows > delta->recorded_edge_rows;
+}
+
+int csr_graph_pending_changes(const csr_graph *graph)
+{
+    if (!graph || !graph->delta) return 0;
+
+    const struct csr_delta *delta = graph->delta;
+    if (delta_needs_reload(delta)) return -1;
+
+    return delta->added_nodes.count + delta->removed_nodes.count +
+           delta->added_edges.count / 4 + delta->removed_edges.count +
+           (delta->user_ids_changed ? 1 : 0);
+}
+
+/*
+ * Merge helpers
+ */
+
+static int compare_id(const void *a, const void *b)
+{
+    int64_t x = *(const int64_t *)a;
+    int64_t y = *(const int64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static bool sorted_contains(const int64_t *items, int count, int64_t value)
+{
+    return items && bsearch(&value, items, count, sizeof(int64_t), compare_id) != NULL;
+}
+
+/* Swap the contents of graph with fresh and free the old contents */
+static void graph_replace(csr_graph *graph, csr_graph *fresh)
+{
+    bool compressed = graph->adj.bytes != NULL;
+    bool coalesced = graph->multiplicity != NULL;
+    csr_node_order order = graph->order;
+    csr_graph old = *graph;
+    *graph = *fresh;
+    *fresh = old;
+    csr_graph_free(fresh);
+
+    /*
+     * A coalesced graph stays coalesced, a reordered graph keeps its order
+     * and a compressed graph stays compressed (node ID order and plain rows
+     * still work if these fail)
+     */
+    if (coalesced) csr_graph_coalesce(graph);
+    if (order != CSR_ORDER_ID) csr_graph_reorder(graph, order);
+    if (compressed) csr_graph_compress(graph);
+}
+
+/*
+ * Rebuild from SQLite, keeping the graph object itself. A shared graph is
+ * reacquired from the registry, so connections that see the same commit
+ * share the reloaded copy too. After a write of its own the connection
+ * loads the graph itself instead: a copy registered while the write was
+ * committing may predate it.
+ */
+static int graph_reload(csr_graph *graph, sqlite3 *db)
+{
+    csr_graph *fresh;
+    if (!graph->shared) {
+        fresh = csr_graph_load(db);
+    } else if (graph->delta && graph->delta->written) {
+        fresh = csr_graph_reacquire(db);
+    } else {
+        fresh = csr_graph_acquire(db, NULL, NULL);
+    }
+    if (!fresh) {
+        /* No nodes left: keep an empty graph */
+        fresh = calloc(1, sizeof(csr_graph));
+        if (!fresh) return -1;
+        csr_data_version(db, &fresh->data_version);
+    }
+    graph_replace(graph, fresh);
+    return 0;
+}
+
+/* Fetch the 'id' property of each added node (strdup'd, NULL if absent) */
+static void load_added_user_ids(sqlite3 *db, const int64_t *node_ids, int count, char **out)
+{
+    if (!db || count == 0) return;
+
+    sqlite3_stmt *stmt = NULL;
+    if (sqlite3_prepare_v2(db,
+            "SELECT np.value FROM node_props_text np "
+            "JOIN property_keys pk ON pk.id = np.key_id AND pk.key = 'id' "
+            "WHERE np.node_id = ?",
+            -1, &stmt, NULL) != SQLITE_OK) {
+        return;
+    }
+
+    for (int i = 0; i < count; i++) {
+        sqlite3_bind_int64(stmt, 1, node_ids[i]);
+        if (sqlite3_step(stmt) == SQLITE_ROW) {
+            const char *value = (const char *)sqlite3_column_text(stmt, 0);
+            out[i] = value ? strdup(value) : NULL;
+        }
+        sqlite3_reset(stmt);
+    }
+    sqlite3_finalize(stmt);
+}
+
+int csr_graph_apply_delta(csr_graph *graph, sqlite3 *db)
+{
+    if (!graph || !graph->delta) return 0;
+
+    struct csr_delta *delta = graph->delta;
+    /* A coalesced slot only records its lowest edge ID, so removed edges cannot be matched */
+    if (delta_needs_reload(delta) ||
+        (graph->edge_count > 0 && (!graph->edge_types || !graph->edge_ids)) ||
+        (graph->multiplicity && delta->removed_edges.count > 0)) {
+        CYPHER_DEBUG("Graph delta is stale - reloading graph");
+        return graph_reload(graph, db);
+    }
+
+    /* Shared user IDs are read-only, so rereading them takes the merge path below */
+    if (delta->added_nodes.count == 0 && delta->removed_nodes.count == 0 &&
+        delta->added_edges.count == 0 && delta->removed_edges.count == 0 &&
+        (!delta->user_ids_changed || !graph->shared)) {
+        /* Only properties changed: reread user IDs, keep the CSR arrays */
+        csr_graph_free(graph->type_view);
+        free(graph->type_view_key);
+        graph->type_view = NULL;
+        graph->type_view_key = NULL;
+        if (delta->user_ids_changed && csr_graph_load_user_ids(graph, db) != 0) {
+            return graph_reload(graph, db);
+        }
+        csr_delta_free(graph->delta);
+        graph->delta = NULL;
+        return 0;
+    }
+
+    CYPHER_DEBUG("Merging graph delta: +%d/-%d nodes, +%d/-%d edges",
+                 delta->added_nodes.count, delta->removed_nodes.count,
+                 delta->added_edges.count / 4, delta->removed_edges.count);
+
+    int old_n = graph->node_count;
+    int rc = -1;
+
+    int *old_to_new = NULL;
+    int64_t *added = NULL;
+    char **added_user_ids = NULL;
+    const char **user_ids = NULL;
+    int *edge_src = NULL;
+    int *edge_tgt = NULL;
+    int *edge_type = NULL;
+    int64_t *edge_id = NULL;
+    int *edge_mult = NULL;
+    csr_graph *fresh = NULL;
+
+    qsort(delta->removed_nodes.items, delta->removed_nodes.count, sizeof(int64_t), compare_id);
+    qsort(delta->removed_edges.items, delta->removed_edges.count, sizeof(int64_t), compare_id);
+    qsort(delta->added_nodes.items, delta->added_nodes.count, sizeof(int64_t), compare_id);
+
+    /* Added nodes that still exist and are not already in the graph */
+    int added_count = 0;
+    added = malloc((delta->added_nodes.count > 0 ? delta->added_nodes.count : 1) * sizeof(int64_t));
+    old_to_new = malloc((old_n > 0 ? old_n : 1) * sizeof(int));
+    if (!added || !old_to_new) goto done;
+
+    for (int i = 0; i < delta->added_nodes.count; i++) {
+        int64_t node_id = delta->added_nodes.items[i];
+        if (added_count > 0 && added[added_count - 1] == node_id) continue;
+        if (sorted_contains(delta->removed_nodes.items, delta->removed_nodes.count, node_id)) continue;
+        if (node_map_find(&graph->node_map, node_id) >= 0) continue;
+        added[added_count++] = node_id;
+    }
+
+    added_user_ids = calloc(added_count > 0 ? added_count : 1, sizeof(char*));
+    if (!added_user_ids) goto done;
+    if (!delta->user_ids_changed) {
+        load_added_user_ids(db, added, added_count, added_user_ids);
+    }
+
+    /* Merge surviving old nodes and added nodes in node ID order */
+    fresh = calloc(1, sizeof(csr_graph));
+    int max_n = old_n + added_count;
+    if (!fresh) goto done;
+    fresh->node_ids = malloc((max_n > 0 ? max_n : 1) * sizeof(int64_t));
+    user_ids = calloc(max_n > 0 ? max_n : 1, sizeof(char*));
+    if (!fresh->node_ids || !user_ids) goto done;
+
+    int new_n = 0;
+    int a = 0;
+    for (int i = 0; i < old_n; i++) {
+        int64_t node_id = graph->node_ids[i];
+        while (a < added_count && added[a] < node_id) {
+            user_ids[new_n] = added_user_ids[a];
+            fresh->node_ids[new_n++] = added[a++];
+        }
+        if (sorted_contains(delta->removed_nodes.items, delta->removed_nodes.count, node_id)) {
+            old_to_new[i] = -1;
+            continue;
+        }
+        old_to_new[i] = new_n;
+        user_ids[new_n] = graph->user_ids ? graph->user_ids[i] : NULL;
+        fresh->node_ids[new_n++] = node_id;
+    }
+    while (a < added_count) {
+        user_ids[new_n] = added_user_ids[a];
+        fresh->node_ids[new_n++] = added[a++];
+    }
+    fresh->node_count = new_n;
+
+    if (new_n == 0) {
+        /* Everything was deleted: keep an empty graph */
+        csr_graph_free(fresh);
+        fresh = calloc(1, sizeof(csr_graph));
+        if (!fresh) goto done;
+        fresh->data_version = graph->data_version;
+        graph_replace(graph, fresh);
+        fresh = NULL;
+        rc = 0;
+        goto done;
+    }
+
+    if (node_map_build(&fresh->node_map, fresh->node_ids, new_n) != 0) goto done;
+
+    /* Surviving old edges, then added edges; build_edges puts rows in (type, neighbour) order */
+    size_t max_edges = (size_t)graph->edge_count + delta->added_edges.count / 4;
+    int64_t edge_total = 0;
+    edge_src = malloc((max_edges > 0 ? max_edges : 1) * sizeof(int));
+    edge_tgt = malloc((max_edges > 0 ? max_edges : 1) * sizeof(int));
+    edge_type = malloc((max_edges > 0 ? max_edges : 1) * sizeof(int));
+    edge_id = malloc((max_edges > 0 ? max_edges : 1) * sizeof(int64_t));
+    if (!edge_src || !edge_tgt || !edge_type || !edge_id) goto done;
+    if (graph->multiplicity) {
+        edge_mult = malloc((max_edges > 0 ? max_edges : 1) * sizeof(int));
+        if (!edge_mult) goto done;
+    }
+
+    /* Type IDs recorded in the delta index the graph's own type names */
+    if (graph->type_count > 0) {
+        fresh->type_names = calloc(graph->type_count, sizeof(char*));
+        if (!fresh->type_names) goto done;
+        for (int t = 0; t < graph->type_count; t++) {
+            fresh->type_names[t] = strdup(graph->type_names[t]);
+            if (!fresh->type_names[t]) goto done;
+            fresh->type_count++;
+        }
+    }
+
+    for (int u = 0; u < old_n; u++) {
+        int nu = old_to_new[u];
+        if (nu < 0) continue;
+        for (csr_edge_iter it = csr_out_edges(graph, u); csr_edge_next(&it); ) {
+            int nv = old_to_new[it.node];
+            if (nv < 0) continue;
+            if (sorted_contains(delta->removed_edges.items, delta->removed_edges.count,
+                                graph->edge_ids[it.slot])) continue;
+            edge_src[edge_total] = nu;
+            edge_tgt[edge_total] = nv;
+            edge_type[edge_total] = graph->edge_types[it.slot];
+            edge_id[edge_total] = graph->edge_ids[it.slot];
+            if (edge_mult) edge_mult[edge_total] = graph->multiplicity[it.slot];
+            edge_total++;
+        }
+    }
+
+    for (int e = 0; e < delta->added_edges.count / 4; e++) {
+        const int64_t *added_edge = &delta->added_edges.items[4 * e];
+        int nu = node_map_find(&fresh->node_map, added_edge[1]);
+        int nv = node_map_find(&fresh->node_map, added_edge[2]);
+        if (nu < 0 || nv < 0) continue;
+        if (sorted_contains(delta->removed_edges.items, delta->removed_edges.count,
+                            added_edge[0])) continue;
+        edge_src[edge_total] = nu;
+        edge_tgt[edge_total] = nv;
+        edge_type[edge_total] = (int)added_edge[3];
+        edge_id[edge_total] = added_edge[0];
+        if (edge_mult) edge_mult[edge_total] = 1;
+        edge_total++;
+    }
+
+    if (csr_graph_canonical_types(fresh, edge_type, edge_total) != 0) goto done;
+    if (csr_graph_build_edges(fresh, edge_src, edge_tgt, edge_type, edge_id, edge_mult, edge_total) != 0) goto done;
+    if (delta->user_ids_changed) {
+        if (csr_graph_load_user_ids(fresh, db) != 0) goto done;
+    } else {
+        if (csr_graph_build_user_ids(fresh, user_ids) != 0) goto done;
+    }
+
+    fresh->data_version = graph->data_version;
+    graph_replace(graph, fresh);
+    fresh = NULL;
+    rc = 0;
+
+    CYPHER_DEBUG("Graph delta merged: %d nodes, %lld edges", graph->node_count, (long long)graph->edge_count);
+
+done:
+    if (added_user_ids) {
+        for (int i = 0; i < added_count; i++) {
+            free(added_user_ids[i]);
+        }
+        free(added_user_ids);
+    }
+    free(old_to_new);
+    free(added);
+    free(user_ids);
+    free(edge_src);
+    free(edge_tgt);
+    free(edge_type);
+    free(edge_id);
+    free(edge_mult);
+    csr_graph_free(fresh);
+    return rc;
+}
+
+int csr_graph_sync(csr_graph *graph, sqlite3 *db)
+{
+    if (!graph) return 0;
+
+    csr_graph_check_data_version(graph, db);
+    if (csr_graph_pending_changes(graph) == 0) return 0;
+
+    return csr_graph_apply_delta(graph, db);
+}
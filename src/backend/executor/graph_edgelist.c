@@ -0,0 +1,387 @@
+/*
+ * Edge-List Files - Algorithms Without the Graph Tables
+ *
+ * gql_load_edgelist() runs the C algorithms on an edge list exported from
+ * elsewhere without inserting it into the graph tables first. The file is
+ * mapped and parsed in one pass into the endpoint arrays that
+ * csr_graph_build_edges() takes. Nodes are numbered in order of first
+ * appearance, with node IDs 1..n (so the node map is dense), and the
+ * identifiers in the file become their user IDs. Nothing is written to
+ * SQLite.
+ *
+ * Formats:
+ *   text    One edge per line: source and target separated by spaces, tabs
+ *           or commas. Further columns are ignored. Blank lines and lines
+ *           starting with '#' or '%' are comments.
+ *   binary  Pairs of int64 source and target IDs, native byte order. User
+ *           IDs are the IDs in decimal.
+ *
+ * Edges are untyped and have no edge IDs or properties.
+ */
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "executor/graph_algorithms.h"
+#include "executor/graph_algo_internal.h"
+
+/* Growable endpoint arrays, as csr_graph_build_edges() takes them */
+typedef struct {
+    int *src;
+    int *tgt;
+    int64_t count;
+    int64_t capacity;
+} edge_buffer;
+
+static int edge_buffer_push(edge_buffer *edges, int source, int target)
+{
+    if (edges->count == edges->capacity) {
+        int64_t capacity = edges->capacity ? edges->capacity * 2 : 1024;
+        int *src = realloc(edges->src, (size_t)capacity * sizeof(int));
+        if (!src) return -1;
+        edges->src = src;
+        int *tgt = realloc(edges->tgt, (size_t)capacity * sizeof(int));
+        if (!tgt) return -1;
+        edges->tgt = tgt;
+        edges->capacity = capacity;
+    }
+    edges->src[edges->count] = source;
+    edges->tgt[edges->count] = target;
+    edges->count++;
+    return 0;
+}
+
+/*
+ * Text identifiers -> node index. Nodes are kept as the position of their
+ * first occurrence in the mapped file, so no token is copied while parsing.
+ */
+typedef struct {
+    const char *data;
+    int64_t *offset;      /* Size: count. Offset of each node's identifier in data */
+    int *length;
+    unsigned int *hash;
+    int count;
+    int capacity;
+    int *slots;           /* Size: slot_capacity (power of two). Node index, -1 = empty */
+    int slot_capacity;
+} token_table;
+
+/* FNV-1a over len bytes (hash_string() for unterminated tokens) */
+static inline unsigned int hash_token(const char *token, int len)
+{
+    unsigned int h = 2166136261u;
+    for (int i = 0; i < len; i++) {
+        h ^= (unsigned char)token[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static void token_table_free(token_table *table)
+{
+    free(table->offset);
+    free(table->length);
+    free(table->hash);
+    free(table->slots);
+}
+
+static int token_table_grow_slots(token_table *table)
+{
+    int capacity = table->slot_capacity ? table->slot_capacity * 2 : 1024;
+    int *slots = malloc((size_t)capacity * sizeof(int));
+    if (!slots) return -1;
+    memset(slots, 0xff, (size_t)capacity * sizeof(int));
+
+    unsigned int mask = (unsigned int)capacity - 1;
+    for (int i = 0; i < table->count; i++) {
+        unsigned int h = table->hash[i] & mask;
+        while (slots[h] != -1) {
+            h = (h + 1) & mask;
+        }
+        slots[h] = i;
+    }
+
+    free(table->slots);
+    table->slots = slots;
+    table->slot_capacity = capacity;
+    return 0;
+}
+
+/* Node index of a token, adding it if new; -1 on failure */
+static int token_table_intern(token_table *table, const char *token, int len)
+{
+    if ((table->count + 1) * 2 > table->slot_capacity) {
+        if (table->slot_capacity > INT_MAX / 2 || token_table_grow_slots(table) != 0) return -1;
+    }
+
+    unsigned int hash = hash_token(token, len);
+    unsigned int mask = (unsigned int)table->slot_capacity - 1;
+    unsigned int h = hash & mask;
+    while (table->slots[h] != -1) {
+        int i = table->slots[h];
+        if (table->hash[i] == hash && table->length[i] == len &&
+            memcmp(table->data + table->offset[i], token, (size_t)len) == 0) {
+            return i;
+        }
+        h = (h + 1) & mask;
+    }
+
+    if (table->count == table->capacity) {
+        if (table->capacity > INT_MAX / 2) return -1;
+        int capacity = table->capacity ? table->capacity * 2 : 1024;
+        int64_t *offset = realloc(table->offset, (size_t)capacity * sizeof(int64_t));
+        if (!offset) return -1;
+        table->offset = offset;
+        int *length = realloc(table->length, (size_t)capacity * sizeof(int));
+        if (!length) return -1;
+        table->length = length;
+        unsigned int *hashes = realloc(table->hash, (size_t)capacity * sizeof(unsigned int));
+        if (!hashes) return -1;
+        table->hash = hashes;
+        table->capacity = capacity;
+    }
+
+    int i = table->count++;
+    table->offset[i] = token - table->data;
+    table->length[i] = len;
+    table->hash[i] = hash;
+    table->slots[h] = i;
+    return i;
+}
+
+static inline bool is_separator(char c)
+{
+    return c == ' ' || c == '\t' || c == ',' || c == '\r';
+}
+
+static void set_error(char **error, const char *message)
+{
+    *error = strdup(message);
+}
+
+/* Parse a text edge list into edges and the node table; 0 on success */
+static int parse_text(const char *data, size_t size, edge_buffer *edges, token_table *nodes,
+                      char **error)
+{
+    const char *p = data;
+    const char *end = data + size;
+    int64_t line = 0;
+
+    while (p < end) {
+        line++;
+        const char *eol = memchr(p, '\n', (size_t)(end - p));
+        if (!eol) eol = end;
+
+        const char *q = p;
+        while (q < eol && (*q == ' ' || *q == '\t' || *q == '\r')) q++;
+        if (q < eol && *q != '#' && *q != '%') {
+            const char *token[2];
+            int64_t len[2];
+            int found = 0;
+            while (found < 2 && q < eol) {
+                token[found] = q;
+                while (q < eol && !is_separator(*q)) q++;
+                len[found] = q - token[found];
+                found++;
+                while (q < eol && is_separator(*q)) q++;
+            }
+
+            char message[128];
+            if (found < 2 || len[0] == 0 || len[1] == 0) {
+                snprintf(message, sizeof(message),
+                         "Edge list line %lld: expected a source and a target", (long long)line);
+                set_error(error, message);
+                return -1;
+            }
+            if (len[0] > INT_MAX || len[1] > INT_MAX) {
+                snprintf(message, sizeof(message), "Edge list line %lld: identifier too long",
+                         (long long)line);
+                set_error(error, message);
+                return -1;
+            }
+
+            int source = token_table_intern(nodes, token[0], (int)len[0]);
+            int target = source >= 0 ? token_table_intern(nodes, token[1], (int)len[1]) : -1;
+            if (target < 0 || edge_buffer_push(edges, source, target) != 0) {
+                set_error(error, "Out of memory reading edge list");
+                return -1;
+            }
+        }
+        p = eol < end ? eol + 1 : end;
+    }
+    return 0;
+}
+
+/* Copy the identifiers into the graph's user ID arena, and index them */
+static int text_user_ids(csr_graph *graph, const token_table *nodes)
+{
+    size_t arena_size = 0;
+    for (int i = 0; i < nodes->count; i++) {
+        arena_size += (size_t)nodes->length[i] + 1;
+    }
+
+    graph->user_ids = malloc((size_t)nodes->count * sizeof(char*));
+    graph->user_id_arena = malloc(arena_size);
+    if (!graph->user_ids || !graph->user_id_arena) return -1;
+    graph->user_id_arena_size = arena_size;
+
+    size_t offset = 0;
+    for (int i = 0; i < nodes->count; i++) {
+        char *id = graph->user_id_arena + offset;
+        memcpy(id, nodes->data + nodes->offset[i], (size_t)nodes->length[i]);
+        id[nodes->length[i]] = '\0';
+        graph->user_ids[i] = id;
+        offset += (size_t)nodes->length[i] + 1;
+    }
+    return csr_graph_index_user_ids(graph);
+}
+
+/* Parse a binary edge list into edges, with each node's ID from the file in file_ids */
+static int parse_binary(const char *data, size_t size, edge_buffer *edges,
+                        int64_t **file_ids, int *node_count, char **error)
+{
+    if (size % (2 * sizeof(int64_t)) != 0) {
+        set_error(error, "Binary edge list size is not a multiple of 16 bytes");
+        return -1;
+    }
+
+    int64_t m = (int64_t)(size / (2 * sizeof(int64_t)));
+    edges->src = malloc((size_t)(m > 0 ? m : 1) * sizeof(int));
+    edges->tgt = malloc((size_t)(m > 0 ? m : 1) * sizeof(int));
+    if (!edges->src || !edges->tgt) {
+        set_error(error, "Out of memory reading edge list");
+        return -1;
+    }
+    edges->capacity = m;
+
+    csr_node_map map = {0};
+    int capacity = 0;
+    int rc = 0;
+    for (int64_t e = 0; e < m && rc == 0; e++) {
+        int64_t pair[2];
+        memcpy(pair, data + (size_t)e * sizeof(pair), sizeof(pair));
+        int index[2];
+        for (int k = 0; k < 2 && rc == 0; k++) {
+            index[k] = node_map_find(&map, pair[k]);
+            if (index[k] >= 0) continue;
+
+            if (*node_count == capacity) {
+                int64_t *grown = capacity <= INT_MAX / 2
+                    ? realloc(*file_ids, (size_t)(capacity ? capacity * 2 : 1024) * sizeof(int64_t))
+                    : NULL;
+                if (!grown) {
+                    rc = -1;
+                    break;
+                }
+                *file_ids = grown;
+                capacity = capacity ? capacity * 2 : 1024;
+            }
+            index[k] = *node_count;
+            if (node_map_insert(&map, pair[k], index[k]) != 0) {
+                rc = -1;
+                break;
+            }
+            (*file_ids)[(*node_count)++] = pair[k];
+        }
+        if (rc == 0) {
+            edges->src[e] = index[0];
+            edges->tgt[e] = index[1];
+            edges->count++;
+        }
+    }
+    node_map_free(&map);
+
+    if (rc != 0) set_error(error, "Out of memory reading edge list");
+    return rc;
+}
+
+/* User IDs for a binary edge list: the file's IDs in decimal */
+static int binary_user_ids(csr_graph *graph, const int64_t *file_ids)
+{
+    /* Longest int64 in decimal, with sign and NUL */
+    size_t arena_size = (size_t)graph->node_count * 21;
+    graph->user_ids = malloc((size_t)graph->node_count * sizeof(char*));
+    graph->user_id_arena = malloc(arena_size);
+    if (!graph->user_ids || !graph->user_id_arena) return -1;
+
+    size_t offset = 0;
+    for (int i = 0; i < graph->node_count; i++) {
+        int len = snprintf(graph->user_id_arena + offset, 21, "%lld", (long long)file_ids[i]);
+        offset += (size_t)len + 1;
+    }
+
+    /* Shrink to fit, then point into the final arena */
+    char *arena = realloc(graph->user_id_arena, offset);
+    if (arena) graph->user_id_arena = arena;
+    graph->user_id_arena_size = offset;
+    offset = 0;
+    for (int i = 0; i < graph->node_count; i++) {
+        graph->user_ids[i] = graph->user_id_arena + offset;
+        offset += strlen(graph->user_ids[i]) + 1;
+    }
+    return csr_graph_index_user_ids(graph);
+}
+
+csr_graph* csr_graph_load_edgelist(const char *path, const char *format, char **error)
+{
+    *error = NULL;
+    bool binary = false;
+    if (format && strcmp(format, "binary") == 0) {
+        binary = true;
+    } else if (format && strcmp(format, "text") != 0) {
+        set_error(error, "Edge list format must be 'text' or 'binary'");
+        return NULL;
+    }
+
+    size_t size = 0;
+    char *data = path ? csr_map_file(path, &size) : NULL;
+    if (!data) {
+        char message[512];
+        snprintf(message, sizeof(message), "Cannot read edge list '%s'", path ? path : "");
+        set_error(error, message);
+        return NULL;
+    }
+
+    edge_buffer edges = {0};
+    token_table nodes = {0};
+    nodes.data = data;
+    int64_t *file_ids = NULL;
+    int node_count = 0;
+
+    int rc = binary ? parse_binary(data, size, &edges, &file_ids, &node_count, error)
+                    : parse_text(data, size, &edges, &nodes, error);
+    if (!binary) node_count = nodes.count;
+
+    csr_graph *graph = rc == 0 ? calloc(1, sizeof(csr_graph)) : NULL;
+    if (graph && node_count > 0) {
+        graph->node_count = node_count;
+        graph->node_ids = malloc((size_t)node_count * sizeof(int64_t));
+        rc = graph->node_ids ? 0 : -1;
+        for (int i = 0; rc == 0 && i < node_count; i++) {
+            graph->node_ids[i] = i + 1;
+        }
+        if (rc == 0) rc = node_map_build(&graph->node_map, graph->node_ids, node_count);
+        if (rc == 0) rc = binary ? binary_user_ids(graph, file_ids) : text_user_ids(graph, &nodes);
+        if (rc == 0) rc = csr_graph_build_edges(graph, edges.src, edges.tgt, NULL, NULL, NULL, edges.count);
+        if (rc != 0) {
+            csr_graph_free(graph);
+            graph = NULL;
+        }
+    }
+    if (!graph && !*error) set_error(error, "Out of memory reading edge list");
+
+    csr_unmap_file(data, size);
+    free(edges.src);
+    free(edges.tgt);
+    token_table_free(&nodes);
+    free(file_ids);
+
+    if (graph) {
+        CYPHER_DEBUG("Loaded edge list '%s': %d nodes, %lld edges", path,
+                     graph->node_count, (long long)graph->edge_count);
+    }
+    return graph;
+}
@@ -0,0 +1,345 @@
+/*
+ * Graph Memory - Accounting and LRU Eviction for Cached Graphs
+ *
+ * csr_graph_memory() adds up the arrays a cached graph holds, split by
+ * component, so gql_graph_stats() can report where the memory goes.
+ *
+ * Each connection's cached graph and each of its projections is a cache
+ * entry on one process-wide LRU list. Entries are charged their own arrays
+ * plus their share of arrays borrowed from the graph registry, so a graph
+ * shared by N connections is counted once overall. When a memory budget is
+ * set (gql_graph_memory_limit) and the charged total exceeds it, the least
+ * recently used entries are evicted until it fits.
+ *
+ * An entry belongs to its connection and is only used while the connection
+ * is inside an SQLite call, holding its database mutex. Entries of other
+ * connections are therefore only evicted when that mutex can be taken
+ * without waiting; busy connections are skipped, and without per-connection
+ * mutexes (SQLITE_CONFIG_MULTITHREAD) only the calling connection's
+ * entries are candidates.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "executor/graph_algorithms.h"
+#include "executor/graph_algo_internal.h"
+#include "executor/json_builder.h"
+
+/* LRU list, most recently used first; guarded by cache_lock() */
+static csr_cache_entry *lru_head = NULL;
+static csr_cache_entry *lru_tail = NULL;
+static size_t cache_used = 0;
+static size_t cache_budget = 0;     /* 0 = unlimited */
+static int64_t cache_evictions = 0;
+static int cache_entries = 0;
+
+/* Private to the cache: SQLite's static APP mutexes belong to the host application */
+static pthread_mutex_t cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void cache_lock(void)
+{
+    pthread_mutex_lock(&cache_mutex);
+}
+
+static void cache_unlock(void)
+{
+    pthread_mutex_unlock(&cache_mutex);
+}
+
+/*
+ * Add one array to a component. Arrays borrowed from the registry count as
+ * shared, arrays inside a mapped snapshot as mapped.
+ */
+static void count_array(csr_graph_memory_usage *usage, size_t *component,
+                        const csr_graph *graph, const void *ptr, size_t bytes, bool borrowed)
+{
+    if (!ptr) return;
+
+    *component += bytes;
+    usage->total += bytes;
+
+    const char *base = (const char *)graph->snapshot;
+    if (borrowed && graph->shared) {
+        usage->shared += bytes;
+    } else if (base && (const char *)ptr >= base && (const char *)ptr < base + graph->snapshot_size) {
+        usage->mapped += bytes;
+    }
+}
+
+static size_t neighbour_sets_bytes(const csr_neighbour_sets *sets, size_t node_count)
+{
+    if (!sets) return 0;
+    return (node_count + 1) * sizeof(int64_t) + 2 * (size_t)sets->row_ptr[node_count] * sizeof(int);
+}
+
+static size_t adjacency_bytes(const csr_adjacency *adj, int node_count)
+{
+    if (!adj->bytes) return 0;
+    size_t blocks = ((size_t)node_count >> CSR_ADJ_BLOCK_SHIFT) + 1;
+    return (size_t)adj->size + blocks * sizeof(int64_t) + (size_t)node_count * sizeof(uint32_t);
+}
+
+void csr_graph_memory(const csr_graph *graph, csr_graph_memory_usage *usage)
+{
+    memset(usage, 0, sizeof(*usage));
+    if (!graph) return;
+
+    size_t n = (size_t)graph->node_count;
+    size_t m = (size_t)graph->edge_count;
+
+    count_array(usage, &usage->adjacency, graph, graph->row_ptr, (n + 1) * sizeof(int64_t), true);
+    count_array(usage, &usage->adjacency, graph, graph->in_row_ptr, (n + 1) * sizeof(int64_t), true);
+    count_array(usage, &usage->adjacency, graph, graph->col_idx, m * sizeof(int), true);
+    count_array(usage, &usage->adjacency, graph, graph->in_col_idx, m * sizeof(int), true);
+    count_array(usage, &usage->adjacency, graph, graph->adj.bytes, adjacency_bytes(&graph->adj, graph->node_count), false);
+    count_array(usage, &usage->adjacency, graph, graph->in_adj.bytes, adjacency_bytes(&graph->in_adj, graph->node_count), false);
+    count_array(usage, &usage->adjacency, graph, graph->multiplicity, m * sizeof(int), true);
+    count_array(usage, &usage->adjacency, graph, graph->in_multiplicity, m * sizeof(int), true);
+
+    count_array(usage, &usage->edge_types, graph, graph->edge_types, m * sizeof(int), true);
+    count_array(usage, &usage->edge_types, graph, graph->in_edge_types, m * sizeof(int), true);
+    for (int t = 0; t < graph->type_count; t++) {
+        count_array(usage, &usage->edge_types, graph, graph->type_names[t],
+                    strlen(graph->type_names[t]) + 1, false);
+    }
+    count_array(usage, &usage->edge_types, graph, graph->type_names,
+                (size_t)graph->type_count * sizeof(char*), false);
+
+    count_array(usage, &usage->edge_ids, graph, graph->edge_ids, m * sizeof(int64_t), true);
+
+    /* Type views borrow the node arrays of the graph they filter */
+    if (!graph->borrowed_nodes) {
+        count_array(usage, &usage->node_index, graph, graph->node_ids, n * sizeof(int64_t), true);
+        count_array(usage, &usage->node_index, graph, graph->node_map.slots,
+                    (size_t)graph->node_map.capacity * sizeof(csr_node_slot), true);
+        count_array(usage, &usage->user_ids, graph, graph->user_ids, n * sizeof(char*), true);
+        count_array(usage, &usage->user_ids, graph, graph->user_id_arena, graph->user_id_arena_size, true);
+        count_array(usage, &usage->user_ids, graph, graph->user_id_index,
+                    (size_t)graph->user_id_index_capacity * sizeof(csr_string_slot), true);
+    }
+
+    for (int i = 0; i < graph->weight_count; i++) {
+        count_array(usage, &usage->weights, graph, graph->weights[i].values, m * sizeof(double), false);
+        count_array(usage, &usage->weights, graph, graph->weights[i].property,
+                    strlen(graph->weights[i].property) + 1, false);
+    }
+
+    if (graph->type_view) {
+        csr_graph_memory_usage view;
+        csr_graph_memory(graph->type_view, &view);
+        usage->type_view = view.total;
+        usage->total += view.total;
+    }
+
+    usage->undirected = neighbour_sets_bytes(graph->undirected, n);
+    usage->out_sets = neighbour_sets_bytes(graph->out_sets, n);
+    usage->total += usage->undirected + usage->out_sets;
+
+    const struct csr_delta *delta = graph->delta;
+    if (delta) {
+        usage->delta = sizeof(struct csr_delta) +
+            ((size_t)delta->added_nodes.capacity + (size_t)delta->removed_nodes.capacity +
+             (size_t)delta->added_edges.capacity + (size_t)delta->removed_edges.capacity) * sizeof(int64_t);
+        usage->total += usage->delta;
+    }
+}
+
+size_t csr_graph_memory_charge(const csr_graph *graph)
+{
+    if (!graph) return 0;
+
+    csr_graph_memory_usage usage;
+    csr_graph_memory(graph, &usage);
+
+    /* Each sharer pays its part of the registered arrays */
+    size_t charge = usage.total - usage.shared;
+    int sharers = csr_graph_share_count(graph);
+    if (sharers > 0) {
+        charge += usage.shared / (size_t)sharers;
+    }
+    return charge;
+}
+
+static void lru_unlink(csr_cache_entry *entry)
+{
+    if (entry->prev) entry->prev->next = entry->next;
+    else lru_head = entry->next;
+    if (entry->next) entry->next->prev = entry->prev;
+    else lru_tail = entry->prev;
+    entry->prev = entry->next = NULL;
+
+    cache_used -= entry->bytes;
+    cache_entries--;
+    entry->tracked = false;
+}
+
+static void lru_push_front(csr_cache_entry *entry)
+{
+    entry->prev = NULL;
+    entry->next = lru_head;
+    if (lru_head) lru_head->prev = entry;
+    else lru_tail = entry;
+    lru_head = entry;
+
+    cache_used += entry->bytes;
+    cache_entries++;
+    entry->tracked = true;
+}
+
+void csr_cache_entry_init(csr_cache_entry *entry, sqlite3 *db, void (*evict)(csr_cache_entry *entry))
+{
+    memset(entry, 0, sizeof(*entry));
+    entry->db = db;
+    entry->evict = evict;
+}
+
+void csr_cache_touch(csr_cache_entry *entry, size_t bytes)
+{
+    cache_lock();
+    if (entry->tracked) lru_unlink(entry);
+    entry->bytes = bytes;
+    lru_push_front(entry);
+    cache_unlock();
+}
+
+void csr_cache_resize(csr_cache_entry *entry, size_t bytes)
+{
+    cache_lock();
+    if (entry->tracked) {
+        cache_used = cache_used - entry->bytes + bytes;
+        entry->bytes = bytes;
+    }
+    cache_unlock();
+}
+
+void csr_cache_forget(csr_cache_entry *entry)
+{
+    cache_lock();
+    if (entry->tracked) lru_unlink(entry);
+    cache_unlock();
+}
+
+/* Whether entry may be evicted from db's thread; locks the owner's mutex into *held if needed */
+static bool claim_entry(const csr_cache_entry *entry, sqlite3 *db, sqlite3_mutex **held)
+{
+    *held = NULL;
+    if (entry->db == db) return true;
+
+    sqlite3_mutex *mutex = sqlite3_db_mutex(entry->db);
+    if (!mutex || sqlite3_mutex_try(mutex) != SQLITE_OK) return false;
+    *held = mutex;
+    return true;
+}
+
+int csr_cache_enforce(sqlite3 *db, const csr_cache_entry *keep)
+{
+    int evicted = 0;
+
+    cache_lock();
+    csr_cache_entry *entry = lru_tail;
+    while (cache_budget > 0 && cache_used > cache_budget && entry) {
+        csr_cache_entry *prev = entry->prev;
+        sqlite3_mutex *held;
+        if (entry != keep && claim_entry(entry, db, &held)) {
+            CYPHER_DEBUG("Evicting cached graph (%zu bytes) - %zu of %zu bytes in use",
+                         entry->bytes, cache_used, cache_budget);
+            lru_unlink(entry);
+            entry->evict(entry);
+            if (held) sqlite3_mutex_leave(held);
+            cache_evictions++;
+            evicted++;
+        }
+        entry = prev;
+    }
+    cache_unlock();
+    return evicted;
+}
+
+void csr_cache_set_budget(size_t bytes)
+{
+    cache_lock();
+    cache_budget = bytes;
+    cache_unlock();
+}
+
+void csr_cache_get_stats(csr_cache_stats *stats)
+{
+    cache_lock();
+    stats->budget = cache_budget;
+    stats->used = cache_used;
+    stats->entries = cache_entries;
+    stats->evictions = cache_evictions;
+    cache_unlock();
+}
+
+/* "name":"value" with the value escaped for JSON */
+static void append_json_string(json_builder *jb, const char *key, const char *value)
+{
+    jbuf_appendf(jb, "\"%s\":\"", key);
+    for (const unsigned char *c = (const unsigned char *)value; *c; c++) {
+        if (*c == '"' || *c == '\\') {
+            jbuf_appendf(jb, "\\%c", *c);
+        } else if (*c < 0x20) {
+            jbuf_appendf(jb, "\\u%04x", *c);
+        } else {
+            jbuf_appendf(jb, "%c", *c);
+        }
+    }
+    jbuf_append(jb, "\"");
+}
+
+static void append_graph_memory(json_builder *jb, const csr_graph *graph)
+{
+    csr_graph_memory_usage usage;
+    csr_graph_memory(graph, &usage);
+    jbuf_appendf(jb,
+        "\"nodes\":%d,\"edges\":%lld,\"adjacency\":%zu,\"edge_types\":%zu,\"edge_ids\":%zu,"
+        "\"node_index\":%zu,\"user_ids\":%zu,\"weights\":%zu,\"type_view\":%zu,\"undirected\":%zu,"
+        "\"out_sets\":%zu,\"delta\":%zu,\"total\":%zu,\"shared\":%zu,\"mapped\":%zu,\"charged\":%zu",
+        graph->node_count, (long long)graph->edge_count, usage.adjacency, usage.edge_types,
+        usage.edge_ids, usage.node_index, usage.user_ids, usage.weights, usage.type_view,
+        usage.undirected, usage.out_sets, usage.delta, usage.total, usage.shared, usage.mapped,
+        csr_graph_memory_charge(graph));
+}
+
+char* csr_graph_stats_json(const csr_graph *cached_graph, const csr_projection *projections)
+{
+    csr_cache_stats stats;
+    csr_cache_get_stats(&stats);
+
+    json_builder jb;
+    jbuf_init(&jb, 1024);
+    jbuf_appendf(&jb, "{\"budget\":%zu,\"used\":%zu,\"entries\":%d,\"evictions\":%lld,\"graph\":",
+                 stats.budget, stats.used, stats.entries, (long long)stats.evictions);
+
+    if (cached_graph) {
+        jbuf_append(&jb, "{");
+        append_graph_memory(&jb, cached_graph);
+        jbuf_append(&jb, "}");
+    } else {
+        jbuf_append(&jb, "null");
+    }
+
+    jbuf_append(&jb, ",\"projections\":[");
+    for (const csr_projection *p = projections; p; p = p->next) {
+        jbuf_append(&jb, p == projections ? "{" : ",{");
+        append_json_string(&jb, "name", p->name);
+        if (p->graph) {
+            jbuf_append(&jb, ",\"loaded\":true,");
+            append_graph_memory(&jb, p->graph);
+        } else {
+            jbuf_append(&jb, ",\"loaded\":false");
+        }
+        jbuf_append(&jb, "}");
+    }
+    jbuf_append(&jb, "]}");
+
+    if (!jbuf_ok(&jb)) {
+        jbuf_free(&jb);
+        return NULL;
+    }
+    return jbuf_take(&jb);
+}
@@ -0,0 +1,269 @@
+/*
+ * Multi-Source BFS - Bit-Parallel Breadth-First Search from Many Sources
+ *
+ * All-sources metrics (closeness, harmonic centrality, eccentricity) need a
+ * BFS from every node. Run one at a time, each search walks the whole edge
+ * array, and the walks hit the same rows in the same random order. The
+ * multi-source BFS of Then et al. ("The More the Merrier", VLDB 2015)
+ * shares that walk between MSBFS_WIDTH searches. Each node has three
+ * bitsets with one bit per source of the batch:
+ *
+ *   seen   - the sources whose search has reached the node
+ *   visit  - the sources whose frontier holds the node at this depth
+ *   next   - the sources whose frontier holds it at the next depth
+ *
+ * A level sets next[w] = OR(visit[v] for v adjacent to w) & ~seen[w], a
+ * few word operations per edge for all sources at once. Levels are run in
+ * one of two directions (Beamer's direction-optimizing BFS):
+ *
+ * - Pull, while the frontier is large: every node ORs in the bits of its
+ *   neighbours. Each node's bitsets are written by one thread, so the
+ *   nodes are split across the worker threads without locks, and nodes
+ *   every search has already reached are skipped without reading their
+ *   edges.
+ * - Push, while the frontier's edges are a small share of the graph (the
+ *   first and last levels): only frontier nodes are expanded, on the
+ *   calling thread. A pass over every edge for a handful of frontier
+ *   nodes would dominate small batches and the long tails of searches.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "executor/graph_algorithms.h"
+#include "executor/graph_algo_internal.h"
+
+/* Push while the frontier's edges are under 1/MSBFS_PUSH_RATIO of all edges */
+#define MSBFS_PUSH_RATIO 14
+
+typedef struct {
+    uint64_t w[MSBFS_WORDS];
+} msbfs_bits;
+
+static inline bool bits_zero(const msbfs_bits *b)
+{
+    uint64_t any = 0;
+    for (int k = 0; k < MSBFS_WORDS; k++) {
+        any |= b->w[k];
+    }
+    return any == 0;
+}
+
+/* Keep the bits of next[w] that are new to w, mark them seen and count them per source */
+static inline bool bits_settle(msbfs_bits *next, msbfs_bits *seen, int64_t *reached)
+{
+    uint64_t any = 0;
+    for (int k = 0; k < MSBFS_WORDS; k++) {
+        uint64_t fresh = next->w[k] & ~seen->w[k];
+        next->w[k] = fresh;
+        seen->w[k] |= fresh;
+        any |= fresh;
+        while (fresh) {
+            reached[k * 64 + __builtin_ctzll(fresh)]++;
+            fresh &= fresh - 1;
+        }
+    }
+    return any != 0;
+}
+
+/* State of one batch */
+typedef struct {
+    const csr_graph *graph;
+    bool undirected;
+    msbfs_bits *seen;
+    msbfs_bits *visit;
+    msbfs_bits *next;
+    msbfs_bits full;        /* Bits of the batch's sources */
+    int *frontier;          /* Nodes with visit bits */
+    int frontier_count;
+    int *next_frontier;     /* Pull: each chunk lists its nodes from its first node on */
+    int *next_counts;       /* Pull: per chunk, nodes listed */
+    int64_t *reached;       /* Per chunk: MSBFS_WIDTH counts of nodes first reached */
+} msbfs_batch;
+
+static inline void bits_or_row(msbfs_bits *acc, const msbfs_bits *visit, csr_edge_iter it)
+{
+    while (csr_edge_next(&it)) {
+        const msbfs_bits *b = &visit[it.node];
+        for (int k = 0; k < MSBFS_WORDS; k++) {
+            acc->w[k] |= b->w[k];
+        }
+    }
+}
+
+static void pull_chunk(void *ctx, int chunk, int64_t begin, int64_t end)
+{
+    msbfs_batch *batch = (msbfs_batch *)ctx;
+    const csr_graph *graph = batch->graph;
+    int64_t *reached = batch->reached + (size_t)chunk * MSBFS_WIDTH;
+    int first = csr_first_node_at(graph->in_row_ptr, graph->node_count, begin);
+    int last = csr_first_node_at(graph->in_row_ptr, graph->node_count, end);
+    int *listed = batch->next_frontier + first;
+    int count = 0;
+
+    memset(reached, 0, MSBFS_WIDTH * sizeof(int64_t));
+    for (int w = first; w < last; w++) {
+        msbfs_bits *seen = &batch->seen[w];
+        msbfs_bits *next = &batch->next[w];
+
+        /* Reached by every search already: nothing left to find here */
+        bool done = true;
+        for (int k = 0; k < MSBFS_WORDS; k++) {
+            if (seen->w[k] != batch->full.w[k]) done = false;
+        }
+        if (done) {
+            memset(next, 0, sizeof(*next));
+            continue;
+        }
+
+        memset(next, 0, sizeof(*next));
+        bits_or_row(next, batch->visit, csr_in_edges(graph, w));
+        if (batch->undirected) {
+            bits_or_row(next, batch->visit, csr_out_edges(graph, w));
+        }
+        if (bits_settle(next, seen, reached)) {
+            listed[count++] = w;
+        }
+    }
+    batch->next_counts[chunk] = count;
+}
+
+/* One level on the calling thread from the frontier nodes; next is all zero on entry */
+static void push_level(msbfs_batch *batch, int *touched)
+{
+    const csr_graph *graph = batch->graph;
+    int touched_count = 0;
+
+    for (int f = 0; f < batch->frontier_count; f++) {
+        int v = batch->frontier[f];
+        const msbfs_bits *bits = &batch->visit[v];
+        for (int dir = 0; dir < (batch->undirected ? 2 : 1); dir++) {
+            csr_edge_iter it = dir == 0 ? csr_out_edges(graph, v) : csr_in_edges(graph, v);
+            while (csr_edge_next(&it)) {
+                msbfs_bits *next = &batch->next[it.node];
+                if (bits_zero(next)) touched[touched_count++] = it.node;
+                for (int k = 0; k < MSBFS_WORDS; k++) {
+                    next->w[k] |= bits->w[k];
+                }
+            }
+        }
+    }
+
+    memset(batch->reached, 0, MSBFS_WIDTH * sizeof(int64_t));
+    int count = 0;
+    for (int t = 0; t < touched_count; t++) {
+        int w = touched[t];
+        if (bits_settle(&batch->next[w], &batch->seen[w], batch->reached)) {
+            batch->next_frontier[count++] = w;
+        }
+    }
+    batch->next_counts[0] = count;
+}
+
+int graph_msbfs(const csr_graph *graph, const int *sources, int source_count, bool undirected,
+                msbfs_level_fn level_fn, void *ctx)
+{
+    int n = graph->node_count;
+    if (n == 0 || source_count <= 0) return 0;
+
+    int64_t edge_work = undirected ? 2 * graph->edge_count : graph->edge_count;
+    int chunks = graph_parallel_chunks((int64_t)n + graph->in_row_ptr[n]);
+    msbfs_batch batch = {.graph = graph, .undirected = undirected};
+    batch.seen = malloc((size_t)n * sizeof(msbfs_bits));
+    batch.visit = calloc(n, sizeof(msbfs_bits));
+    batch.next = calloc(n, sizeof(msbfs_bits));
+    batch.frontier = malloc((size_t)n * sizeof(int));
+    batch.next_frontier = malloc((size_t)n * sizeof(int));
+    batch.next_counts = malloc(chunks * sizeof(int));
+    batch.reached = malloc((size_t)chunks * MSBFS_WIDTH * sizeof(int64_t));
+    /* Push can touch a node once per frontier edge before it is deduplicated */
+    int *touched = malloc((size_t)n * sizeof(int));
+    int64_t *total = malloc(MSBFS_WIDTH * sizeof(int64_t));
+    int rc = 0;
+    if (!batch.seen || !batch.visit || !batch.next || !batch.frontier || !batch.next_frontier ||
+        !batch.next_counts || !batch.reached || !touched || !total) {
+        rc = -1;
+        goto done;
+    }
+
+    for (int first = 0; first < source_count; first += MSBFS_WIDTH) {
+        int count = source_count - first < MSBFS_WIDTH ? source_count - first : MSBFS_WIDTH;
+
+        /* visit and next are all zero between batches */
+        memset(batch.seen, 0, (size_t)n * sizeof(msbfs_bits));
+        memset(&batch.full, 0, sizeof(batch.full));
+        batch.frontier_count = 0;
+        for (int i = 0; i < count; i++) {
+            int s = sources ? sources[first + i] : first + i;
+            uint64_t bit = 1ULL << (i % 64);
+            if (bits_zero(&batch.visit[s])) batch.frontier[batch.frontier_count++] = s;
+            batch.seen[s].w[i / 64] |= bit;
+            batch.visit[s].w[i / 64] |= bit;
+            batch.full.w[i / 64] |= bit;
+        }
+
+        for (int depth = 1; batch.frontier_count > 0; depth++) {
+            int64_t frontier_edges = 0;
+            for (int f = 0; f < batch.frontier_count; f++) {
+                int v = batch.frontier[f];
+                frontier_edges += graph->row_ptr[v + 1] - graph->row_ptr[v];
+                if (undirected) frontier_edges += graph->in_row_ptr[v + 1] - graph->in_row_ptr[v];
+            }
+
+            int rows;
+            int next_count = 0;
+            if (frontier_edges * MSBFS_PUSH_RATIO < edge_work) {
+                push_level(&batch, touched);
+                rows = 1;
+                next_count = batch.next_counts[0];
+            } else {
+                graph_parallel_for((int64_t)n + graph->in_row_ptr[n], chunks, pull_chunk, &batch);
+                rows = chunks;
+
+                /* Close the gaps between the chunks' lists (each starts at its chunk's first node) */
+                for (int c = 0; c < chunks; c++) {
+                    int64_t begin = ((int64_t)n + graph->in_row_ptr[n]) * c / chunks;
+                    int start = csr_first_node_at(graph->in_row_ptr, n, begin);
+                    memmove(batch.next_frontier + next_count, batch.next_frontier + start,
+                            batch.next_counts[c] * sizeof(int));
+                    next_count += batch.next_counts[c];
+                }
+            }
+
+            /* Clear this level's frontier so visit becomes the next level's empty buffer */
+            for (int f = 0; f < batch.frontier_count; f++) {
+                memset(&batch.visit[batch.frontier[f]], 0, sizeof(msbfs_bits));
+            }
+            msbfs_bits *bits = batch.visit;
+            batch.visit = batch.next;
+            batch.next = bits;
+            int *list = batch.frontier;
+            batch.frontier = batch.next_frontier;
+            batch.next_frontier = list;
+            batch.frontier_count = next_count;
+            if (next_count == 0) break;
+
+            /* Chunk order is fixed, so the counts are the same on every run */
+            for (int i = 0; i < count; i++) {
+                total[i] = 0;
+                for (int c = 0; c < rows; c++) {
+                    total[i] += batch.reached[(size_t)c * MSBFS_WIDTH + i];
+                }
+            }
+            level_fn(ctx, first, count, depth, total);
+        }
+    }
+
+done:
+    free(batch.seen);
+    free(batch.visit);
+    free(batch.next);
+    free(batch.frontier);
+    free(batch.next_frontier);
+    free(batch.next_counts);
+    free(batch.reached);
+    free(touched);
+    free(total);
+    return rc;
+}
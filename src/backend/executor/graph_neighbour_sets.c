@@ -0,0 +1,189 @@
+/*
+ * Neighbour Sets - Sorted, Distinct Neighbour Lists per Node
+ *
+ * Adjacency rows are sorted by (type, neighbour) and keep parallel edges,
+ * so they are neither sorted by neighbour nor sets once a graph has several
+ * relationship types or repeated edges. Algorithms that intersect
+ * neighbourhoods (triangle count, node similarity, KNN) need both, and
+ * used to copy and sort rows on every call. The sets are built once per
+ * cached graph instead:
+ *
+ *   csr_graph_undirected() - out- and in-neighbours merged, for triangle
+ *       count, Louvain and label propagation, which ignore edge direction.
+ *       Walking the out-row and then the in-row of every node visits a pair
+ *       of reciprocal edges twice.
+ *   csr_graph_out_sets()   - out-neighbours only, for Jaccard similarity.
+ *
+ * Each entry carries the number of edges behind it (summing the
+ * multiplicities of a coalesced graph's slots), so that algorithms
+ * weighting by edge count give the same results as walking the rows.
+ *
+ * Rows are built in place over an upper bound (the degree) in parallel,
+ * then compacted.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "executor/graph_algorithms.h"
+#include "executor/graph_algo_internal.h"
+
+typedef struct {
+    const csr_graph *graph;
+    bool incoming;        /* Include in-neighbours */
+    int *col_idx;         /* Row u starts at row_start(graph, u, incoming) */
+    int *multiplicity;
+    int64_t *keys;        /* Coalesced graphs: neighbour << 32 | multiplicity, for sorting rows */
+    int64_t *count;       /* Distinct neighbours of each node */
+} sets_build;
+
+static int compare_int(const void *a, const void *b)
+{
+    int ia = *(const int *)a;
+    int ib = *(const int *)b;
+    return (ia > ib) - (ia < ib);
+}
+
+static int compare_int64(const void *a, const void *b)
+{
+    int64_t ia = *(const int64_t *)a;
+    int64_t ib = *(const int64_t *)b;
+    return (ia > ib) - (ia < ib);
+}
+
+/* Start of node u's row in the uncompacted build arrays */
+static int64_t row_start(const csr_graph *graph, int u, bool incoming)
+{
+    return incoming ? graph->row_ptr[u] + graph->in_row_ptr[u] : graph->row_ptr[u];
+}
+
+static void build_rows_chunk(void *ctx, int chunk, int64_t begin, int64_t end)
+{
+    (void)chunk;
+    sets_build *build = ctx;
+    const csr_graph *graph = build->graph;
+
+    for (int u = (int)begin; u < (int)end; u++) {
+        int64_t start = row_start(graph, u, build->incoming);
+        int *row = build->col_idx + start;
+        int *mult = build->multiplicity + start;
+
+        int64_t size = 0;
+        bool sorted = true;
+        for (csr_edge_iter it = csr_out_edges(graph, u); csr_edge_next(&it); ) {
+            if (size > 0 && row[size - 1] > it.node) sorted = false;
+            mult[size] = csr_slot_multiplicity(graph->multiplicity, it.slot);
+            row[size++] = it.node;
+        }
+        if (build->incoming) {
+            for (csr_edge_iter it = csr_in_edges(graph, u); csr_edge_next(&it); ) {
+                if (size > 0 && row[size - 1] > it.node) sorted = false;
+                mult[size] = csr_slot_multiplicity(graph->in_multiplicity, it.slot);
+                row[size++] = it.node;
+            }
+        }
+        /* Rows of single-type graphs are already in neighbour order */
+        if (!sorted && build->keys) {
+            int64_t *keys = build->keys + start;
+            for (int64_t i = 0; i < size; i++) {
+                keys[i] = (int64_t)row[i] << 32 | (uint32_t)mult[i];
+            }
+            qsort(keys, (size_t)size, sizeof(int64_t), compare_int64);
+            for (int64_t i = 0; i < size; i++) {
+                row[i] = (int)(keys[i] >> 32);
+                mult[i] = (int)(uint32_t)keys[i];
+            }
+        } else if (!sorted) {
+            qsort(row, (size_t)size, sizeof(int), compare_int);
+        }
+
+        int64_t distinct = 0;
+        for (int64_t i = 0; i < size; i++) {
+            if (distinct > 0 && row[distinct - 1] == row[i]) {
+                mult[distinct - 1] += mult[i];
+            } else {
+                row[distinct] = row[i];
+                mult[distinct] = mult[i];
+                distinct++;
+            }
+        }
+        build->count[u] = distinct;
+    }
+}
+
+static csr_neighbour_sets* build_sets(const csr_graph *graph, bool incoming)
+{
+    int n = graph->node_count;
+    int64_t bound = incoming ? 2 * graph->edge_count : graph->edge_count;
+
+    csr_neighbour_sets *sets = calloc(1, sizeof(csr_neighbour_sets));
+    sets_build build = {graph, incoming, NULL, NULL, NULL, NULL};
+    if (!sets) return NULL;
+    sets->row_ptr = malloc(((size_t)n + 1) * sizeof(int64_t));
+    build.col_idx = malloc((bound > 0 ? (size_t)bound : 1) * sizeof(int));
+    build.multiplicity = malloc((bound > 0 ? (size_t)bound : 1) * sizeof(int));
+    build.count = malloc((n > 0 ? (size_t)n : 1) * sizeof(int64_t));
+    if (graph->multiplicity) build.keys = malloc((bound > 0 ? (size_t)bound : 1) * sizeof(int64_t));
+    if (!sets->row_ptr || !build.col_idx || !build.multiplicity || !build.count ||
+        (graph->multiplicity && !build.keys)) {
+        free(sets->row_ptr);
+        free(sets);
+        free(build.col_idx);
+        free(build.multiplicity);
+        free(build.keys);
+        free(build.count);
+        return NULL;
+    }
+
+    if (n > 0 && graph->row_ptr) {
+        graph_parallel_for(n, graph_parallel_chunks(bound), build_rows_chunk, &build);
+    }
+    free(build.keys);
+
+    /* Compact: each row moves down to its final offset, never past a later row's start */
+    sets->row_ptr[0] = 0;
+    for (int u = 0; u < n; u++) {
+        int64_t from = row_start(graph, u, incoming);
+        int64_t to = sets->row_ptr[u];
+        if (to != from) {
+            memmove(build.col_idx + to, build.col_idx + from, (size_t)build.count[u] * sizeof(int));
+            memmove(build.multiplicity + to, build.multiplicity + from, (size_t)build.count[u] * sizeof(int));
+        }
+        sets->row_ptr[u + 1] = to + build.count[u];
+    }
+    free(build.count);
+
+    int64_t total = sets->row_ptr[n];
+    int *col_idx = realloc(build.col_idx, (total > 0 ? (size_t)total : 1) * sizeof(int));
+    int *multiplicity = realloc(build.multiplicity, (total > 0 ? (size_t)total : 1) * sizeof(int));
+    sets->col_idx = col_idx ? col_idx : build.col_idx;
+    sets->multiplicity = multiplicity ? multiplicity : build.multiplicity;
+
+    CYPHER_DEBUG("Built %s neighbour sets: %d nodes, %lld entries for %lld edges",
+                 incoming ? "undirected" : "out", n, (long long)total, (long long)graph->edge_count);
+    return sets;
+}
+
+const csr_neighbour_sets* csr_graph_undirected(csr_graph *graph)
+{
+    if (!graph) return NULL;
+    if (!graph->undirected) graph->undirected = build_sets(graph, true);
+    return graph->undirected;
+}
+
+const csr_neighbour_sets* csr_graph_out_sets(csr_graph *graph)
+{
+    if (!graph) return NULL;
+    if (!graph->out_sets) graph->out_sets = build_sets(graph, false);
+    return graph->out_sets;
+}
+
+void csr_neighbour_sets_free(csr_neighbour_sets *sets)
+{
+    if (!sets) return;
+    free(sets->row_ptr);
+    free(sets->col_idx);
+    free(sets->multiplicity);
+    free(sets);
+}
@@ -0,0 +1,120 @@
+/*
+ * Graph Parallel - Fork-Join Loops for Graph Builds and Algorithms
+ *
+ * graph_parallel_for() splits an index range into contiguous chunks and runs
+ * one chunk per thread, the caller running the first. Threads are created
+ * per loop rather than pooled: the loops this serves touch millions of
+ * edges, so thread start-up is noise, and nothing stays resident between
+ * queries.
+ *
+ * The worker count is process-wide. It defaults to the number of online
+ * processors and can be changed with gql_graph_threads(n); 1 keeps every
+ * loop on the calling thread.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#include <pthread.h>
+
+#include "executor/graph_algorithms.h"
+#include "executor/graph_algo_internal.h"
+
+/* 0 = not set, use every processor */
+static int configured_threads = 0;
+
+static int processor_count(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    long count = (long)info.dwNumberOfProcessors;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    if (count < 1) return 1;
+    return count < GRAPH_MAX_THREADS ? (int)count : GRAPH_MAX_THREADS;
+}
+
+int graph_thread_count(void)
+{
+    int threads = __atomic_load_n(&configured_threads, __ATOMIC_RELAXED);
+    return threads > 0 ? threads : processor_count();
+}
+
+void graph_set_thread_count(int threads)
+{
+    if (threads < 0) threads = 0;
+    if (threads > GRAPH_MAX_THREADS) threads = GRAPH_MAX_THREADS;
+    __atomic_store_n(&configured_threads, threads, __ATOMIC_RELAXED);
+}
+
+int graph_parallel_chunks(int64_t count)
+{
+    int threads = graph_thread_count();
+    int64_t chunks = count / GRAPH_PARALLEL_MIN_ITEMS;
+    if (chunks < 1) return 1;
+    return chunks < threads ? (int)chunks : threads;
+}
+
+typedef struct {
+    graph_parallel_fn fn;
+    void *ctx;
+    int chunk;
+    int64_t begin;
+    int64_t end;
+} parallel_task;
+
+static void* run_task(void *arg)
+{
+    parallel_task *task = (parallel_task *)arg;
+    task->fn(task->ctx, task->chunk, task->begin, task->end);
+    return NULL;
+}
+
+void graph_parallel_for(int64_t count, int chunks, graph_parallel_fn fn, void *ctx)
+{
+    if (chunks <= 1) {
+        fn(ctx, 0, 0, count);
+        return;
+    }
+
+    parallel_task *tasks = malloc(chunks * sizeof(parallel_task));
+    pthread_t *threads = malloc(chunks * sizeof(pthread_t));
+    bool *started = calloc(chunks, sizeof(bool));
+    bool spawn = tasks && threads && started;
+
+    for (int c = 0; c < chunks; c++) {
+        parallel_task task = {fn, ctx, c, count * c / chunks, count * (c + 1) / chunks};
+        if (!spawn) {
+            /* Out of memory: same chunks, one after another */
+            run_task(&task);
+            continue;
+        }
+        tasks[c] = task;
+        if (c > 0) {
+            started[c] = pthread_create(&threads[c], NULL, run_task, &tasks[c]) == 0;
+        }
+    }
+
+    if (spawn) {
+        run_task(&tasks[0]);
+        for (int c = 1; c < chunks; c++) {
+            if (started[c]) {
+                pthread_join(threads[c], NULL);
+            } else {
+                run_task(&tasks[c]);
+            }
+        }
+    }
+
+    free(tasks);
+    free(threads);
+    free(started);
+}
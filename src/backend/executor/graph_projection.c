@@ -0,0 +1,308 @@
+/*
+ * Graph Projections - Named Subgraphs for Algorithms
+ *
+ * gql_load_graph() caches the whole graph. A projection caches only the
+ * part an analysis needs: nodes with given labels, edges of given types
+ * between them, and optionally the weight property weighted algorithms
+ * should use. A connection can hold several, and algorithm calls pick one
+ * with {graph: 'name'}.
+ *
+ * Projections are rebuilt from SQLite rather than patched: a write to the
+ * graph tables on the connection (seen through its update hook), a
+ * rollback, or a commit from another connection marks them stale, and the
+ * next algorithm call rebuilds the one it uses. The same happens when the
+ * memory budget evicts a projection's graph: its definition stays.
+ *
+ * gql_load_edgelist() makes a projection of an edge-list file instead
+ * (graph_edgelist.c). Database writes do not touch it, and after eviction
+ * it is read from the file again.
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "executor/graph_algorithms.h"
+#include "executor/graph_algo_internal.h"
+
+static void free_names(char **names, int count)
+{
+    for (int i = 0; i < count; i++) {
+        free(names[i]);
+    }
+    free(names);
+}
+
+static char** copy_names(char *const *names, int count)
+{
+    char **copy = calloc(count > 0 ? count : 1, sizeof(char*));
+    if (!copy) return NULL;
+
+    for (int i = 0; i < count; i++) {
+        copy[i] = strdup(names[i]);
+        if (!copy[i]) {
+            free_names(copy, i);
+            return NULL;
+        }
+    }
+    return copy;
+}
+
+static void projection_free(csr_projection *projection)
+{
+    if (!projection) return;
+    csr_cache_forget(&projection->cache);
+    free(projection->name);
+    free_names(projection->labels, projection->label_count);
+    free_names(projection->types, projection->type_count);
+    free(projection->weight_property);
+    free(projection->edgelist_path);
+    free(projection->edgelist_format);
+    csr_graph_free(projection->graph);
+    free(projection);
+}
+
+/* Load the projection's subgraph, replacing any previous one; 0 on success */
+static int projection_build(csr_projection *projection, sqlite3 *db, char **error)
+{
+    csr_graph *graph;
+    if (projection->edgelist_path) {
+        char *message = NULL;
+        graph = csr_graph_load_edgelist(projection->edgelist_path, projection->edgelist_format,
+                                        &message);
+        if (!graph) {
+            CYPHER_DEBUG("Projection '%s': %s", projection->name, message ? message : "");
+            if (error) {
+                *error = message;
+            } else {
+                free(message);
+            }
+            return -1;
+        }
+    } else {
+        graph = csr_graph_load_filtered(db, projection->labels, projection->label_count,
+                                        projection->types, projection->type_count);
+    }
+    if (!graph) {
+        /* No matching nodes: keep an empty graph so algorithms do not fall back to the full one */
+        graph = calloc(1, sizeof(csr_graph));
+        if (!graph) return -1;
+        csr_data_version(db, &graph->data_version);
+    }
+
+    if (projection->weight_property && graph->edge_count > 0 &&
+        !csr_graph_edge_weights(graph, db, projection->weight_property)) {
+        csr_graph_free(graph);
+        return -1;
+    }
+
+    csr_graph_free(projection->graph);
+    projection->graph = graph;
+    projection->stale = false;
+
+    CYPHER_DEBUG("Projected graph '%s': %d nodes, %lld edges", projection->name,
+                 graph->node_count, (long long)graph->edge_count);
+
+    csr_cache_touch(&projection->cache, csr_graph_memory_charge(graph));
+    csr_cache_enforce(db, &projection->cache);
+    return 0;
+}
+
+/* Memory budget eviction: drop the graph, keep the definition */
+static void projection_evict(csr_cache_entry *entry)
+{
+    csr_projection *projection = (csr_projection *)((char *)entry - offsetof(csr_projection, cache));
+    CYPHER_DEBUG("Evicting projection '%s'", projection->name);
+    csr_graph_free(projection->graph);
+    projection->graph = NULL;
+}
+
+csr_projection* csr_projection_create(sqlite3 *db, const char *name,
+                                      char *const *labels, int label_count,
+                                      char *const *types, int type_count,
+                                      const char *weight_property)
+{
+    if (!db || !name) return NULL;
+
+    csr_projection *projection = calloc(1, sizeof(csr_projection));
+    if (!projection) return NULL;
+    csr_cache_entry_init(&projection->cache, db, projection_evict);
+
+    projection->name = strdup(name);
+    projection->labels = copy_names(labels, label_count);
+    projection->label_count = label_count;
+    projection->types = copy_names(types, type_count);
+    projection->type_count = type_count;
+    projection->weight_property = weight_property ? strdup(weight_property) : NULL;
+    if (!projection->name || !projection->labels || !projection->types ||
+        (weight_property && !projection->weight_property)) {
+        if (!projection->labels) projection->label_count = 0;
+        if (!projection->types) projection->type_count = 0;
+        projection_free(projection);
+        return NULL;
+    }
+
+    if (projection_build(projection, db, NULL) != 0) {
+        projection_free(projection);
+        return NULL;
+    }
+    return projection;
+}
+
+csr_projection* csr_projection_load_edgelist(sqlite3 *db, const char *name, const char *path,
+                                             const char *format, char **error)
+{
+    *error = NULL;
+    if (!db || !name || !path) return NULL;
+
+    csr_projection *projection = calloc(1, sizeof(csr_projection));
+    if (!projection) return NULL;
+    csr_cache_entry_init(&projection->cache, db, projection_evict);
+
+    projection->name = strdup(name);
+    projection->edgelist_path = strdup(path);
+    projection->edgelist_format = format ? strdup(format) : NULL;
+    if (!projection->name || !projection->edgelist_path || (format && !projection->edgelist_format)) {
+        projection_free(projection);
+        return NULL;
+    }
+
+    if (projection_build(projection, db, error) != 0) {
+        projection_free(projection);
+        return NULL;
+    }
+    return projection;
+}
+
+void csr_projection_add(csr_projection **list, csr_projection *projection)
+{
+    csr_projection_drop(list, projection->name);
+    projection->next = *list;
+    *list = projection;
+}
+
+bool csr_projection_drop(csr_projection **list, const char *name)
+{
+    for (csr_projection **link = list; *link; link = &(*link)->next) {
+        if (strcmp((*link)->name, name) == 0) {
+            csr_projection *projection = *link;
+            *link = projection->next;
+            projection_free(projection);
+            return true;
+        }
+    }
+    return false;
+}
+
+void csr_projection_free_all(csr_projection *list)
+{
+    while (list) {
+        csr_projection *next = list->next;
+        projection_free(list);
+        list = next;
+    }
+}
+
+csr_projection* csr_projection_find(csr_projection *list, const char *name)
+{
+    for (; list && name; list = list->next) {
+        if (strcmp(list->name, name) == 0) return list;
+    }
+    return NULL;
+}
+
+csr_graph* csr_projection_graph(csr_projection *projection, sqlite3 *db)
+{
+    if (!projection) return NULL;
+
+    sqlite3_int64 version;
+    if (projection->graph && !projection->stale && !projection->edgelist_path &&
+        csr_data_version(db, &version) == 0 && version != projection->graph->data_version) {
+        CYPHER_DEBUG("Database changed by another connection - projection '%s' is stale",
+                     projection->name);
+        projection->stale = true;
+    }
+
+    if (projection->stale || !projection->graph) {
+        if (projection_build(projection, db, NULL) != 0) return NULL;
+    } else {
+        csr_cache_touch(&projection->cache, csr_graph_memory_charge(projection->graph));
+    }
+    return projection->graph;
+}
+
+void csr_projections_note_row_change(csr_projection *list, const char *table)
+{
+    if (!table) return;
+
+    bool weights_only = strcmp(table, "edge_props_real") == 0;
+    if (!weights_only &&
+        strcmp(table, "nodes") != 0 && strcmp(table, "edges") != 0 &&
+        strcmp(table, "node_labels") != 0 && strcmp(table, "node_props_text") != 0) {
+        return;
+    }
+
+    for (; list; list = list->next) {
+        if (list->edgelist_path) continue;
+        if (weights_only) {
+            csr_graph_drop_weights(list->graph);
+        } else {
+            list->stale = true;
+        }
+    }
+}
+
+void csr_projections_mark_stale(csr_projection *list)
+{
+    for (; list; list = list->next) {
+        if (!list->edgelist_path) list->stale = true;
+    }
+}
+
+void csr_projections_update_memory(csr_projection *list)
+{
+    for (; list; list = list->next) {
+        if (list->graph) {
+            csr_cache_resize(&list->cache, csr_graph_memory_charge(list->graph));
+        }
+    }
+}
+
+int csr_parse_name_list(sqlite3 *db, const char *text, char ***names, int *count)
+{
+    *names = NULL;
+    *count = 0;
+    if (!text) return 0;
+
+    sqlite3_stmt *stmt = NULL;
+    int rc = sqlite3_prepare_v2(db,
+        "SELECT value FROM json_each(CASE WHEN json_valid(?1) "
+        "THEN CASE WHEN json_type(?1) = 'array' THEN ?1 ELSE json_array(?1) END "
+        "ELSE json_array(?1) END) WHERE type = 'text'",
+        -1, &stmt, NULL);
+    if (rc != SQLITE_OK) return -1;
+    sqlite3_bind_text(stmt, 1, text, -1, SQLITE_STATIC);
+
+    int capacity = 0;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        if (*count >= capacity) {
+            capacity = capacity ? capacity * 2 : 4;
+            char **grown = realloc(*names, capacity * sizeof(char*));
+            if (!grown) break;
+            *names = grown;
+        }
+        (*names)[*count] = strdup((const char *)sqlite3_column_text(stmt, 0));
+        if (!(*names)[*count]) break;
+        (*count)++;
+    }
+    sqlite3_finalize(stmt);
+
+    if (rc != SQLITE_DONE) {
+        free_names(*names, *count);
+        *names = NULL;
+        *count = 0;
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,363 @@
+/*
+ * Graph Registry - Process-Wide Shared CSR Graphs
+ *
+ * Every connection used to build and hold its own copy of the graph, so N
+ * connections to one database file (web workers, connection pools) paid
+ * for N loads and N copies. The registry keeps one read-only copy per
+ * database file and graph fingerprint and hands out references to it.
+ *
+ * A connection's csr_graph is a shallow copy of the registered graph: the
+ * CSR arrays, node index and user IDs are borrowed, while relationship type
+ * names, type views, cached weights and pending changes are its own. When
+ * changes are merged the connection gets private arrays (see graph_delta.c)
+ * and drops its reference; the registered copy is freed with the last one.
+ *
+ * The fingerprint (row counts and highest IDs) does not change when a row
+ * is updated in place, so each file also has a generation that the update,
+ * commit and rollback hooks of every connection in the process bump
+ * (csr_graph_note_write), and a graph is only shared within the generation
+ * it was registered in. A load that sees the generation move is kept
+ * private, and a connection reloading after its own write registers a new
+ * generation, so a copy registered while that write was committing is not
+ * handed out again.
+ *
+ * Loads take a lock of their database file, not the registry lock, so
+ * connections that ask for the same graph at once wait for the first load
+ * instead of repeating it while loads of other files go ahead.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "executor/graph_algorithms.h"
+#include "executor/graph_algo_internal.h"
+
+struct csr_shared_file;
+
+typedef struct csr_shared_graph {
+    struct csr_shared_file *file;
+    int64_t generation;
+    int64_t fingerprint[CSR_FINGERPRINT_FIELDS];
+    csr_graph *graph;                           /* Never modified once registered */
+    int refcount;
+    struct csr_shared_graph *next;
+} csr_shared_graph;
+
+/* A database file with registered graphs or a load in progress */
+typedef struct csr_shared_file {
+    char *path;
+    int64_t generation;                         /* Bumped by writes to the file */
+    csr_shared_graph *graphs;
+    int users;                                  /* Acquires in progress */
+    pthread_mutex_t load_mutex;                 /* Held while one of them loads */
+    struct csr_shared_file *next;
+} csr_shared_file;
+
+static csr_shared_file *registry = NULL;
+
+/* Private to the registry: SQLite's static APP mutexes belong to the host application */
+static pthread_mutex_t registry_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void registry_lock(void)
+{
+    pthread_mutex_lock(&registry_mutex);
+}
+
+static void registry_unlock(void)
+{
+    pthread_mutex_unlock(&registry_mutex);
+}
+
+/* Registry entry for path, created if needed, with a user added (registry locked) */
+static csr_shared_file* file_enter(const char *path)
+{
+    csr_shared_file *file = registry;
+    while (file && strcmp(file->path, path) != 0) {
+        file = file->next;
+    }
+
+    if (!file) {
+        file = calloc(1, sizeof(csr_shared_file));
+        if (!file) return NULL;
+        file->path = strdup(path);
+        if (!file->path || pthread_mutex_init(&file->load_mutex, NULL) != 0) {
+            free(file->path);
+            free(file);
+            return NULL;
+        }
+        file->next = registry;
+        registry = file;
+    }
+    file->users++;
+    return file;
+}
+
+/* Free a file entry once nothing uses it (registry locked) */
+static void file_release(csr_shared_file *file)
+{
+    if (file->users > 0 || file->graphs) return;
+
+    for (csr_shared_file **link = &registry; *link; link = &(*link)->next) {
+        if (*link == file) {
+            *link = file->next;
+            break;
+        }
+    }
+    pthread_mutex_destroy(&file->load_mutex);
+    free(file->path);
+    free(file);
+}
+
+/* Registered graph of file with this generation and fingerprint (registry locked) */
+static csr_shared_graph* file_find_graph(csr_shared_file *file, int64_t generation,
+                                         const int64_t *fingerprint)
+{
+    csr_shared_graph *entry = file->graphs;
+    while (entry && (entry->generation != generation ||
+                     memcmp(entry->fingerprint, fingerprint, sizeof(entry->fingerprint)) != 0)) {
+        entry = entry->next;
+    }
+    return entry;
+}
+
+/* Graph from a snapshot if one matches, otherwise from SQLite */
+static csr_graph* load_graph(sqlite3 *db, const char *snapshot_path, const char **source)
+{
+    csr_graph *graph = csr_graph_open_snapshot(db, snapshot_path);
+    if (graph) {
+        if (source) *source = "snapshot";
+        return graph;
+    }
+    if (source) *source = "sqlite";
+    return csr_graph_load(db);
+}
+
+/* New per-connection graph borrowing the arrays of a registry entry (registry locked) */
+static csr_graph* share_graph(csr_shared_graph *entry, sqlite3 *db)
+{
+    const csr_graph *base = entry->graph;
+    csr_graph *graph = malloc(sizeof(csr_graph));
+    char **type_names = calloc(base->type_count > 0 ? base->type_count : 1, sizeof(char*));
+    bool ok = graph && type_names;
+    for (int t = 0; ok && t < base->type_count; t++) {
+        type_names[t] = strdup(base->type_names[t]);
+        ok = type_names[t] != NULL;
+    }
+    if (!ok) {
+        for (int t = 0; type_names && t < base->type_count; t++) {
+            free(type_names[t]);
+        }
+        free(type_names);
+        free(graph);
+        return NULL;
+    }
+
+    *graph = *base;
+    graph->type_names = type_names;
+    graph->weights = NULL;
+    graph->weight_count = 0;
+    graph->type_view = NULL;
+    graph->type_view_key = NULL;
+    graph->delta = NULL;
+    graph->shared = entry;
+    entry->refcount++;
+
+    csr_data_version(db, &graph->data_version);
+    return graph;
+}
+
+static void entry_release(csr_shared_graph *entry)
+{
+    if (--entry->refcount > 0) return;
+
+    csr_shared_file *file = entry->file;
+    for (csr_shared_graph **link = &file->graphs; *link; link = &(*link)->next) {
+        if (*link == entry) {
+            *link = entry->next;
+            break;
+        }
+    }
+    CYPHER_DEBUG("Freeing shared graph for %s", file->path);
+    csr_graph_free(entry->graph);
+    free(entry);
+    file_release(file);
+}
+
+/* Register a loaded graph and share it with db; NULL if that fails (registry locked) */
+static csr_graph* file_register_graph(csr_shared_file *file, int64_t generation,
+                                      const int64_t *fingerprint, csr_graph *loaded, sqlite3 *db)
+{
+    csr_shared_graph *entry = calloc(1, sizeof(csr_shared_graph));
+    if (!entry) return NULL;
+
+    entry->generation = generation;
+    memcpy(entry->fingerprint, fingerprint, sizeof(entry->fingerprint));
+    entry->file = file;
+    entry->graph = loaded;
+    csr_graph *graph = share_graph(entry, db);
+    if (!graph) {
+        free(entry);
+        return NULL;
+    }
+    entry->next = file->graphs;
+    file->graphs = entry;
+    CYPHER_DEBUG("Registered shared graph for %s", file->path);
+    return graph;
+}
+
+/*
+ * Share the registered graph of file matching the fingerprint, or load and
+ * register it; inside the transaction the fingerprint was read in. With
+ * reuse false, any registered copy is passed over and the loaded graph
+ * starts a new generation.
+ */
+static csr_graph* file_acquire_graph(csr_shared_file *file, int64_t generation, const int64_t *fingerprint,
+                                     sqlite3 *db, const char *snapshot_path, const char **source, bool reuse)
+{
+    csr_graph *graph = NULL;
+    csr_shared_graph *entry = NULL;
+
+    if (reuse) {
+        registry_lock();
+        entry = file_find_graph(file, generation, fingerprint);
+        if (entry) graph = share_graph(entry, db);
+        registry_unlock();
+    }
+
+    if (!entry) {
+        /* Wait for a load of the file in progress, which may be this graph */
+        pthread_mutex_lock(&file->load_mutex);
+        if (reuse) {
+            registry_lock();
+            entry = file_find_graph(file, generation, fingerprint);
+            if (entry) graph = share_graph(entry, db);
+            registry_unlock();
+        }
+
+        if (!entry) {
+            csr_graph *loaded = load_graph(db, snapshot_path, source);
+            registry_lock();
+            /* A write during the load may be missing from it: keep the graph private */
+            if (loaded && file->generation == generation) {
+                if (!reuse) generation = ++file->generation;
+                graph = file_register_graph(file, generation, fingerprint, loaded, db);
+            }
+            registry_unlock();
+            /* Empty graph, or out of memory: keep the graph private */
+            if (!graph) graph = loaded;
+        }
+        pthread_mutex_unlock(&file->load_mutex);
+    }
+
+    if (entry) {
+        if (source) *source = "shared";
+        CYPHER_DEBUG("Sharing graph for %s", file->path);
+    }
+    return graph;
+}
+
+static csr_graph* acquire_graph(sqlite3 *db, const char *snapshot_path, const char **source, bool reuse)
+{
+    /*
+     * Only committed data may be shared: inside a transaction this connection
+     * can see its own uncommitted writes, so it gets a private graph.
+     */
+    const char *filename = sqlite3_db_filename(db, "main");
+    if (!filename || !filename[0] || !sqlite3_get_autocommit(db)) {
+        return load_graph(db, snapshot_path, source);
+    }
+
+    /* The generation is read before the data, so a write after it is seen at registration */
+    registry_lock();
+    csr_shared_file *file = file_enter(filename);
+    int64_t generation = file ? file->generation : 0;
+    registry_unlock();
+    if (!file) return load_graph(db, snapshot_path, source);
+
+    /* Read the fingerprint and the graph in one transaction so they agree */
+    csr_graph *graph = NULL;
+    int64_t fingerprint[CSR_FINGERPRINT_FIELDS];
+    if (sqlite3_exec(db, "BEGIN", NULL, NULL, NULL) != SQLITE_OK) {
+        graph = load_graph(db, snapshot_path, source);
+    } else {
+        if (csr_graph_fingerprint(db, fingerprint) != 0) {
+            graph = load_graph(db, snapshot_path, source);
+        } else {
+            graph = file_acquire_graph(file, generation, fingerprint, db, snapshot_path, source, reuse);
+        }
+        sqlite3_exec(db, "COMMIT", NULL, NULL, NULL);
+    }
+
+    registry_lock();
+    file->users--;
+    file_release(file);
+    registry_unlock();
+    return graph;
+}
+
+csr_graph* csr_graph_acquire(sqlite3 *db, const char *snapshot_path, const char **source)
+{
+    return acquire_graph(db, snapshot_path, source, true);
+}
+
+csr_graph* csr_graph_reacquire(sqlite3 *db)
+{
+    return acquire_graph(db, NULL, NULL, false);
+}
+
+void csr_graph_note_write(sqlite3 *db)
+{
+    const char *filename = sqlite3_db_filename(db, "main");
+    if (!filename || !filename[0]) return;
+
+    registry_lock();
+    for (csr_shared_file *file = registry; file; file = file->next) {
+        if (strcmp(file->path, filename) == 0) {
+            file->generation++;
+            break;
+        }
+    }
+    registry_unlock();
+}
+
+void csr_graph_unshare(csr_graph *graph)
+{
+    if (!graph || !graph->shared) return;
+
+    /* Borrowed arrays are freed with the registered graph */
+    graph->row_ptr = NULL;
+    graph->col_idx = NULL;
+    graph->node_ids = NULL;
+    graph->user_ids = NULL;
+    graph->user_id_arena = NULL;
+    graph->user_id_index = NULL;
+    graph->node_map.slots = NULL;
+    graph->in_row_ptr = NULL;
+    graph->in_col_idx = NULL;
+    graph->edge_types = NULL;
+    graph->in_edge_types = NULL;
+    graph->edge_ids = NULL;
+    graph->multiplicity = NULL;
+    graph->in_multiplicity = NULL;
+    graph->snapshot = NULL;
+    graph->snapshot_size = 0;
+
+    csr_shared_graph *entry = graph->shared;
+    graph->shared = NULL;
+
+    registry_lock();
+    entry_release(entry);
+    registry_unlock();
+}
+
+int csr_graph_share_count(const csr_graph *graph)
+{
+    if (!graph || !graph->shared) return 0;
+
+    registry_lock();
+    int count = graph->shared->refcount;
+    registry_unlock();
+    return count;
+}
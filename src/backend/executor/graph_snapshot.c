@@ -0,0 +1,560 @@
+/*
+ * Graph Snapshot - Persistent CSR Files
+ *
+ * gql_save_graph() writes the CSR arrays of a graph to a binary file next
+ * to the database. gql_load_graph() maps that file instead of rebuilding
+ * the graph from the property tables when the file still matches the
+ * database, so a new connection or process gets a usable graph in the time
+ * it takes to map the file.
+ *
+ * Sections are stored exactly as they are laid out in memory (native byte
+ * order, 8-byte aligned), so the mapped pages are used in place. Only the
+ * user ID pointer array and the relationship type names are rebuilt on open.
+ *
+ * Whether a snapshot matches is decided by a fingerprint of the graph
+ * tables: row counts and highest IDs of nodes, edges and 'id' properties,
+ * plus the AUTOINCREMENT counters. Any insert or delete changes it; an
+ * in-place UPDATE of an edge's endpoints through plain SQL does not, so
+ * such changes need a fresh gql_save_graph().
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "executor/graph_algorithms.h"
+#include "executor/graph_algo_internal.h"
+
+#define SNAPSHOT_MAGIC "GQLCSR\0\0"
+#define SNAPSHOT_VERSION 3
+#define SNAPSHOT_BYTE_ORDER 0x01020304u
+
+typedef enum {
+    SECTION_ROW_PTR,
+    SECTION_COL_IDX,
+    SECTION_IN_ROW_PTR,
+    SECTION_IN_COL_IDX,
+    SECTION_NODE_IDS,
+    SECTION_EDGE_TYPES,
+    SECTION_IN_EDGE_TYPES,
+    SECTION_EDGE_IDS,
+    SECTION_USER_ID_OFFSETS,  /* int64 offset into the arena per node, -1 = no user ID */
+    SECTION_USER_ID_ARENA,
+    SECTION_NODE_MAP,
+    SECTION_USER_ID_INDEX,
+    SECTION_TYPE_NAMES,       /* type_count NUL-terminated names */
+    SECTION_MULTIPLICITY,     /* coalesced graphs only */
+    SECTION_IN_MULTIPLICITY,
+    SECTION_COUNT
+} snapshot_section;
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    int64_t fingerprint[CSR_FINGERPRINT_FIELDS];
+    int64_t edge_count;
+    int32_t node_count;
+    int32_t type_count;
+    int32_t node_map_capacity;
+    int32_t node_map_count;
+    int32_t user_id_index_capacity;
+    uint64_t offset[SECTION_COUNT];
+    uint64_t size[SECTION_COUNT];
+} snapshot_header;
+
+/*
+ * Fingerprint queries, two values each. The sqlite_sequence query fails
+ * harmlessly when no table uses AUTOINCREMENT.
+ */
+static const char *fingerprint_sql[CSR_FINGERPRINT_FIELDS / 2] = {
+    "SELECT count(*), coalesce(max(id), 0) FROM nodes",
+    "SELECT count(*), coalesce(max(id), 0) FROM edges",
+    "SELECT count(*), coalesce(max(np.rowid), 0) FROM node_props_text np "
+    "JOIN property_keys pk ON pk.id = np.key_id AND pk.key = 'id'",
+    "SELECT coalesce((SELECT seq FROM sqlite_sequence WHERE name = 'nodes'), 0), "
+    "coalesce((SELECT seq FROM sqlite_sequence WHERE name = 'edges'), 0)",
+};
+
+int csr_graph_fingerprint(sqlite3 *db, int64_t *fingerprint)
+{
+    memset(fingerprint, 0, CSR_FINGERPRINT_FIELDS * sizeof(int64_t));
+
+    for (int q = 0; q < CSR_FINGERPRINT_FIELDS / 2; q++) {
+        sqlite3_stmt *stmt = NULL;
+        if (sqlite3_prepare_v2(db, fingerprint_sql[q], -1, &stmt, NULL) != SQLITE_OK) {
+            /* Graph tables are required; the others may legitimately be missing */
+            if (q < 2) return -1;
+            continue;
+        }
+        if (sqlite3_step(stmt) == SQLITE_ROW) {
+            fingerprint[2 * q] = sqlite3_column_int64(stmt, 0);
+            fingerprint[2 * q + 1] = sqlite3_column_int64(stmt, 1);
+        }
+        sqlite3_finalize(stmt);
+    }
+    return 0;
+}
+
+char* csr_graph_snapshot_path(sqlite3 *db)
+{
+    const char *filename = sqlite3_db_filename(db, "main");
+    if (!filename || !filename[0]) return NULL;
+
+    size_t len = strlen(filename);
+    char *path = malloc(len + sizeof("-csr"));
+    if (!path) return NULL;
+    memcpy(path, filename, len);
+    memcpy(path + len, "-csr", sizeof("-csr"));
+    return path;
+}
+
+/*
+ * Writing
+ */
+
+/* Zero-pad from *position up to offset, then write size bytes of data */
+static int write_section(FILE *file, uint64_t *position, const void *data, uint64_t size, uint64_t offset)
+{
+    static const char zeros[8] = {0};
+    while (*position < offset) {
+        size_t pad = (size_t)(offset - *position < sizeof(zeros) ? offset - *position : sizeof(zeros));
+        if (fwrite(zeros, 1, pad, file) != pad) return -1;
+        *position += pad;
+    }
+    if (size > 0 && fwrite(data, 1, (size_t)size, file) != (size_t)size) return -1;
+    *position += size;
+    return 0;
+}
+
+int csr_graph_save_snapshot(const csr_graph *graph, sqlite3 *db, const char *path,
+                            sqlite3_int64 *bytes_written, char **error)
+{
+    *error = NULL;
+    if (!graph || graph->node_count == 0) {
+        *error = strdup("Graph is empty");
+        return -1;
+    }
+
+    snapshot_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = SNAPSHOT_VERSION;
+    header.byte_order = SNAPSHOT_BYTE_ORDER;
+    if (csr_graph_fingerprint(db, header.fingerprint) != 0) {
+        *error = strdup("Graph tables not found");
+        return -1;
+    }
+
+    int n = graph->node_count;
+    int64_t m = graph->edge_count;
+    header.node_count = n;
+    header.edge_count = m;
+    header.type_count = graph->type_count;
+    header.node_map_capacity = graph->node_map.capacity;
+    header.node_map_count = graph->node_map.count;
+    header.user_id_index_capacity = graph->user_id_index ? graph->user_id_index_capacity : 0;
+
+    /* User IDs are stored as offsets into the arena */
+    int64_t *user_id_offsets = malloc((n > 0 ? n : 1) * sizeof(int64_t));
+    size_t names_size = 0;
+    for (int t = 0; t < graph->type_count; t++) {
+        names_size += strlen(graph->type_names[t]) + 1;
+    }
+    char *names = malloc(names_size > 0 ? names_size : 1);
+    if (!user_id_offsets || !names) {
+        free(user_id_offsets);
+        free(names);
+        *error = strdup("Memory allocation failed");
+        return -1;
+    }
+    for (int i = 0; i < n; i++) {
+        const char *user_id = graph->user_ids ? graph->user_ids[i] : NULL;
+        user_id_offsets[i] = user_id ? (int64_t)(user_id - graph->user_id_arena) : -1;
+    }
+    size_t names_offset = 0;
+    for (int t = 0; t < graph->type_count; t++) {
+        size_t len = strlen(graph->type_names[t]) + 1;
+        memcpy(names + names_offset, graph->type_names[t], len);
+        names_offset += len;
+    }
+
+    /* Compressed rows are written plain, so a snapshot maps the same either way */
+    int *col_idx = graph->adj.bytes ? csr_graph_decode_rows(graph, false) : graph->col_idx;
+    int *in_col_idx = graph->adj.bytes ? csr_graph_decode_rows(graph, true) : graph->in_col_idx;
+    if (!col_idx || !in_col_idx) {
+        if (graph->adj.bytes) {
+            free(col_idx);
+            free(in_col_idx);
+        }
+        free(user_id_offsets);
+        free(names);
+        *error = strdup("Memory allocation failed");
+        return -1;
+    }
+
+    const void *data[SECTION_COUNT] = {
+        graph->row_ptr, col_idx, graph->in_row_ptr, in_col_idx,
+        graph->node_ids, graph->edge_types, graph->in_edge_types, graph->edge_ids,
+        user_id_offsets, graph->user_id_arena, graph->node_map.slots,
+        graph->user_id_index, names, graph->multiplicity, graph->in_multiplicity,
+    };
+    header.size[SECTION_ROW_PTR] = (uint64_t)(n + 1) * sizeof(int64_t);
+    header.size[SECTION_COL_IDX] = (uint64_t)m * sizeof(int);
+    header.size[SECTION_IN_ROW_PTR] = (uint64_t)(n + 1) * sizeof(int64_t);
+    header.size[SECTION_IN_COL_IDX] = (uint64_t)m * sizeof(int);
+    header.size[SECTION_NODE_IDS] = (uint64_t)n * sizeof(int64_t);
+    header.size[SECTION_EDGE_TYPES] = graph->edge_types ? (uint64_t)m * sizeof(int) : 0;
+    header.size[SECTION_IN_EDGE_TYPES] = graph->in_edge_types ? (uint64_t)m * sizeof(int) : 0;
+    header.size[SECTION_EDGE_IDS] = graph->edge_ids ? (uint64_t)m * sizeof(int64_t) : 0;
+    header.size[SECTION_USER_ID_OFFSETS] = (uint64_t)n * sizeof(int64_t);
+    header.size[SECTION_USER_ID_ARENA] = graph->user_id_arena_size;
+    header.size[SECTION_NODE_MAP] = (uint64_t)header.node_map_capacity * sizeof(csr_node_slot);
+    header.size[SECTION_USER_ID_INDEX] = (uint64_t)header.user_id_index_capacity * sizeof(csr_string_slot);
+    header.size[SECTION_TYPE_NAMES] = names_size;
+    header.size[SECTION_MULTIPLICITY] = graph->multiplicity ? (uint64_t)m * sizeof(int) : 0;
+    header.size[SECTION_IN_MULTIPLICITY] = graph->in_multiplicity ? (uint64_t)m * sizeof(int) : 0;
+
+    uint64_t offset = (sizeof(header) + 7) & ~(uint64_t)7;
+    for (int s = 0; s < SECTION_COUNT; s++) {
+        header.offset[s] = offset;
+        offset = (offset + header.size[s] + 7) & ~(uint64_t)7;
+    }
+
+    /* Write to a temporary file and rename, so readers never map a partial file */
+    size_t path_len = strlen(path);
+    char *tmp_path = malloc(path_len + sizeof(".tmp"));
+    FILE *file = NULL;
+    int rc = -1;
+    if (tmp_path) {
+        memcpy(tmp_path, path, path_len);
+        memcpy(tmp_path + path_len, ".tmp", sizeof(".tmp"));
+        file = fopen(tmp_path, "wb");
+    }
+
+    if (file) {
+        uint64_t position = 0;
+        rc = write_section(file, &position, &header, sizeof(header), 0);
+        for (int s = 0; rc == 0 && s < SECTION_COUNT; s++) {
+            rc = write_section(file, &position, data[s], header.size[s], header.offset[s]);
+        }
+        /* Pad the last section too, so every section ends inside the file */
+        if (rc == 0) rc = write_section(file, &position, NULL, 0, offset);
+        if (fclose(file) != 0) rc = -1;
+        if (rc == 0) {
+#ifdef _WIN32
+            remove(path);
+#endif
+            rc = rename(tmp_path, path) == 0 ? 0 : -1;
+        }
+        if (rc != 0) remove(tmp_path);
+    }
+
+    if (rc != 0) {
+        *error = strdup("Failed to write graph snapshot");
+    } else {
+        if (bytes_written) *bytes_written = (sqlite3_int64)offset;
+        CYPHER_DEBUG("Saved graph snapshot %s: %d nodes, %lld edges, %llu bytes",
+                     path, n, (long long)m, (unsigned long long)offset);
+    }
+
+    if (graph->adj.bytes) {
+        free(col_idx);
+        free(in_col_idx);
+    }
+    free(tmp_path);
+    free(user_id_offsets);
+    free(names);
+    return rc;
+}
+
+/*
+ * Reading
+ */
+
+/* Map the whole file read-only; nothing writes to mapped arrays, they are replaced */
+void* csr_map_file(const char *path, size_t *size)
+{
+#ifdef _WIN32
+    FILE *file = fopen(path, "rb");
+    if (!file) return NULL;
+    void *data = NULL;
+    if (fseek(file, 0, SEEK_END) == 0) {
+        long len = ftell(file);
+        if (len > 0 && fseek(file, 0, SEEK_SET) == 0 && (data = malloc((size_t)len)) != NULL) {
+            if (fread(data, 1, (size_t)len, file) != (size_t)len) {
+                free(data);
+                data = NULL;
+            } else {
+                *size = (size_t)len;
+            }
+        }
+    }
+    fclose(file);
+    return data;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+
+    struct stat st;
+    void *data = NULL;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            data = NULL;
+        } else {
+            *size = (size_t)st.st_size;
+        }
+    }
+    close(fd);
+    return data;
+#endif
+}
+
+void csr_unmap_file(void *data, size_t size)
+{
+#ifdef _WIN32
+    (void)size;
+    free(data);
+#else
+    munmap(data, size);
+#endif
+}
+
+void csr_graph_unmap_snapshot(csr_graph *graph)
+{
+    if (!graph || !graph->snapshot) return;
+    csr_unmap_file(graph->snapshot, graph->snapshot_size);
+    graph->snapshot = NULL;
+    graph->snapshot_size = 0;
+}
+
+/* Header is consistent with itself and the file size */
+static bool header_valid(const snapshot_header *header, size_t file_size)
+{
+    if (file_size < sizeof(*header) ||
+        memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != SNAPSHOT_VERSION ||
+        header->byte_order != SNAPSHOT_BYTE_ORDER ||
+        header->node_count <= 0 || header->edge_count < 0 || header->type_count < 0 ||
+        (header->type_count > 0 && header->size[SECTION_TYPE_NAMES] == 0)) {
+        return false;
+    }
+
+    uint64_t n = (uint64_t)header->node_count;
+    uint64_t m = (uint64_t)header->edge_count;
+    if (header->size[SECTION_ROW_PTR] != (n + 1) * sizeof(int64_t) ||
+        header->size[SECTION_COL_IDX] != m * sizeof(int) ||
+        header->size[SECTION_IN_ROW_PTR] != (n + 1) * sizeof(int64_t) ||
+        header->size[SECTION_IN_COL_IDX] != m * sizeof(int) ||
+        header->size[SECTION_NODE_IDS] != n * sizeof(int64_t) ||
+        (header->size[SECTION_EDGE_TYPES] != 0 && header->size[SECTION_EDGE_TYPES] != m * sizeof(int)) ||
+        header->size[SECTION_IN_EDGE_TYPES] != header->size[SECTION_EDGE_TYPES] ||
+        (header->size[SECTION_EDGE_IDS] != 0 && header->size[SECTION_EDGE_IDS] != m * sizeof(int64_t)) ||
+        header->size[SECTION_USER_ID_OFFSETS] != n * sizeof(int64_t) ||
+        header->size[SECTION_NODE_MAP] != (uint64_t)header->node_map_capacity * sizeof(csr_node_slot) ||
+        header->size[SECTION_USER_ID_INDEX] !=
+            (uint64_t)header->user_id_index_capacity * sizeof(csr_string_slot) ||
+        (header->size[SECTION_MULTIPLICITY] != 0 && header->size[SECTION_MULTIPLICITY] != m * sizeof(int)) ||
+        header->size[SECTION_IN_MULTIPLICITY] != header->size[SECTION_MULTIPLICITY]) {
+        return false;
+    }
+
+    /* Hash tables are probed with capacity - 1 as the mask */
+    int32_t map_capacity = header->node_map_capacity;
+    int32_t index_capacity = header->user_id_index_capacity;
+    if (map_capacity < 0 || (map_capacity & (map_capacity - 1)) != 0 ||
+        index_capacity < 0 || (index_capacity & (index_capacity - 1)) != 0) {
+        return false;
+    }
+
+    for (int s = 0; s < SECTION_COUNT; s++) {
+        if (header->offset[s] % 8 != 0 || header->offset[s] > file_size ||
+            header->size[s] > file_size - header->offset[s]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Row offsets ascend from 0 to m and every neighbour is a node */
+static bool rows_valid(const int64_t *row_ptr, const int *col_idx, int n, int64_t m)
+{
+    if (row_ptr[0] != 0 || row_ptr[n] != m) return false;
+    for (int i = 0; i < n; i++) {
+        if (row_ptr[i + 1] < row_ptr[i]) return false;
+    }
+    for (int64_t e = 0; e < m; e++) {
+        if (col_idx[e] < 0 || col_idx[e] >= n) return false;
+    }
+    return true;
+}
+
+static bool values_below(const int *values, int64_t count, int limit)
+{
+    for (int64_t e = 0; values && e < count; e++) {
+        if (values[e] < 0 || values[e] >= limit) return false;
+    }
+    return true;
+}
+
+/*
+ * Arrays are consistent: a damaged or hand-made file must not send the
+ * algorithms outside their arrays. One pass over the nodes and edges.
+ */
+static bool graph_valid(const csr_graph *graph)
+{
+    int n = graph->node_count;
+    int64_t m = graph->edge_count;
+    if (!rows_valid(graph->row_ptr, graph->col_idx, n, m) ||
+        !rows_valid(graph->in_row_ptr, graph->in_col_idx, n, m) ||
+        !values_below(graph->edge_types, m, graph->type_count) ||
+        !values_below(graph->in_edge_types, m, graph->type_count)) {
+        return false;
+    }
+
+    /* User IDs end inside the arena */
+    if (graph->user_id_arena_size > 0 && graph->user_id_arena[graph->user_id_arena_size - 1] != '\0') {
+        for (int i = 0; i < n; i++) {
+            if (graph->user_ids[i]) return false;
+        }
+    }
+
+    /* Slots point at nodes, and an empty slot ends every probe */
+    if (!graph->node_map.dense) {
+        int occupied = 0;
+        for (int h = 0; h < graph->node_map.capacity; h++) {
+            int index = graph->node_map.slots[h].index;
+            if (index < -1 || index >= n) return false;
+            if (index >= 0) occupied++;
+        }
+        if (occupied != graph->node_map.count || occupied >= graph->node_map.capacity) return false;
+    }
+    if (graph->user_id_index) {
+        int occupied = 0;
+        for (int h = 0; h < graph->user_id_index_capacity; h++) {
+            int index = graph->user_id_index[h].index;
+            if (index < -1 || index >= n || (index >= 0 && !graph->user_ids[index])) return false;
+            if (index >= 0) occupied++;
+        }
+        if (occupied >= graph->user_id_index_capacity) return false;
+    }
+    return true;
+}
+
+csr_graph* csr_graph_open_snapshot(sqlite3 *db, const char *path)
+{
+    if (!path) return NULL;
+
+    size_t size = 0;
+    char *data = csr_map_file(path, &size);
+    if (!data) return NULL;
+
+    const snapshot_header *header = (const snapshot_header *)data;
+    if (!header_valid(header, size)) {
+        CYPHER_DEBUG("Ignoring graph snapshot %s: invalid or unsupported file", path);
+        csr_unmap_file(data, size);
+        return NULL;
+    }
+
+    int64_t fingerprint[CSR_FINGERPRINT_FIELDS];
+    if (csr_graph_fingerprint(db, fingerprint) != 0 ||
+        memcmp(fingerprint, header->fingerprint, sizeof(fingerprint)) != 0) {
+        CYPHER_DEBUG("Ignoring graph snapshot %s: graph changed since it was saved", path);
+        csr_unmap_file(data, size);
+        return NULL;
+    }
+
+    csr_graph *graph = calloc(1, sizeof(csr_graph));
+    if (!graph) {
+        csr_unmap_file(data, size);
+        return NULL;
+    }
+    graph->snapshot = data;
+    graph->snapshot_size = size;
+
+    int n = header->node_count;
+    int64_t m = header->edge_count;
+    graph->node_count = n;
+    graph->edge_count = m;
+
+#define SECTION(s) (header->size[s] > 0 ? (void *)(data + header->offset[s]) : NULL)
+    graph->row_ptr = SECTION(SECTION_ROW_PTR);
+    graph->col_idx = SECTION(SECTION_COL_IDX);
+    graph->in_row_ptr = SECTION(SECTION_IN_ROW_PTR);
+    graph->in_col_idx = SECTION(SECTION_IN_COL_IDX);
+    graph->node_ids = SECTION(SECTION_NODE_IDS);
+    graph->edge_types = SECTION(SECTION_EDGE_TYPES);
+    graph->in_edge_types = SECTION(SECTION_IN_EDGE_TYPES);
+    graph->edge_ids = SECTION(SECTION_EDGE_IDS);
+    graph->multiplicity = SECTION(SECTION_MULTIPLICITY);
+    graph->in_multiplicity = SECTION(SECTION_IN_MULTIPLICITY);
+    graph->user_id_arena = SECTION(SECTION_USER_ID_ARENA);
+    graph->user_id_arena_size = header->size[SECTION_USER_ID_ARENA];
+    graph->node_map.slots = SECTION(SECTION_NODE_MAP);
+    graph->node_map.capacity = header->node_map_capacity;
+    graph->node_map.count = header->node_map_count;
+    graph->user_id_index = SECTION(SECTION_USER_ID_INDEX);
+    graph->user_id_index_capacity = header->user_id_index_capacity;
+    const int64_t *user_id_offsets = SECTION(SECTION_USER_ID_OFFSETS);
+    const char *names = SECTION(SECTION_TYPE_NAMES);
+#undef SECTION
+
+    /* A dense node map has no slots to store; it follows from the node IDs */
+    if (header->node_map_capacity == 0 &&
+        node_map_build(&graph->node_map, graph->node_ids, n) != 0) {
+        csr_graph_free(graph);
+        return NULL;
+    }
+
+    /* Pointers cannot be stored in the file: rebuild user_ids and type_names */
+    graph->user_ids = calloc(n, sizeof(char*));
+    graph->type_names = calloc(header->type_count > 0 ? header->type_count : 1, sizeof(char*));
+    if (!graph->user_ids || !graph->type_names) {
+        csr_graph_free(graph);
+        return NULL;
+    }
+    for (int i = 0; i < n; i++) {
+        int64_t offset = user_id_offsets[i];
+        if (offset < -1 || (offset >= 0 && (uint64_t)offset >= graph->user_id_arena_size)) {
+            CYPHER_DEBUG("Ignoring graph snapshot %s: user ID outside the arena", path);
+            csr_graph_free(graph);
+            return NULL;
+        }
+        if (offset >= 0) graph->user_ids[i] = graph->user_id_arena + offset;
+    }
+
+    size_t names_offset = 0;
+    for (int t = 0; t < header->type_count; t++) {
+        const char *name = names + names_offset;
+        size_t remaining = header->size[SECTION_TYPE_NAMES] - names_offset;
+        size_t len = strnlen(name, remaining);
+        if (len == remaining || !(graph->type_names[t] = strdup(name))) {
+            csr_graph_free(graph);
+            return NULL;
+        }
+        graph->type_count++;
+        names_offset += len + 1;
+    }
+
+    if (!graph_valid(graph)) {
+        CYPHER_DEBUG("Ignoring graph snapshot %s: inconsistent arrays", path);
+        csr_graph_free(graph);
+        return NULL;
+    }
+
+    csr_data_version(db, &graph->data_version);
+
+    CYPHER_DEBUG("Mapped graph snapshot %s: %d nodes, %lld edges", path, n, (long long)m);
+    return graph;
+}
@@ -30,6 +30,37 @@ static bool jbuf_ensure(json_builder *jb, size_t additional)
     return true;
 }
 
+/*
+ * Format straight into the spare capacity; only text that does not fit is
+ * formatted a second time, after growing. Results with many small items
+ * (one per node or pair) format each item once.
+ */
+static bool jbuf_vappendf(json_builder *jb, const char *fmt, va_list args)
+{
+    if (!jb->data) return false;
+
+    va_list args_copy;
+    va_copy(args_copy, args);
+
+    size_t spare = jb->capacity - jb->len;
+    int needed = vsnprintf(jb->data + jb->len, spare, fmt, args);
+    if (needed >= 0 && (size_t)needed >= spare) {
+        if (!jbuf_ensure(jb, needed)) {
+            needed = -1;
+        } else {
+            vsnprintf(jb->data + jb->len, needed + 1, fmt, args_copy);
+        }
+    }
+    va_end(args_copy);
+
+    if (needed < 0) {
+        jb->data[jb->len] = '\0';
+        return false;
+    }
+    jb->len += needed;
+    return true;
+}
+
 void jbuf_init(json_builder *jb, size_t initial_capacity)
 {
     if (!jb) return;
@@ -104,21 +135,10 @@ void jbuf_appendf(json_builder *jb, const char *fmt, ...)
 {
     if (!jb || !fmt) return;
 
-    va_list args, args_copy;
+    va_list args;
     va_start(args, fmt);
-    va_copy(args_copy, args);
-
-    int needed = vsnprintf(NULL, 0, fmt, args);
+    jbuf_vappendf(jb, fmt, args);
     va_end(args);
-
-    if (needed < 0 || !jbuf_ensure(jb, needed)) {
-        va_end(args_copy);
-        return;
-    }
-
-    vsnprintf(jb->data + jb->len, needed + 1, fmt, args_copy);
-    jb->len += needed;
-    va_end(args_copy);
 }
 
 void jbuf_add_item(json_builder *jb, const char *fmt, ...)
@@ -132,22 +152,10 @@ void jbuf_add_item(json_builder *jb, const char *fmt, ...)
         jb->data[jb->len] = '\0';
     }
 
-    va_list args, args_copy;
+    va_list args;
     va_start(args, fmt);
-    va_copy(args_copy, args);
-
-    int needed = vsnprintf(NULL, 0, fmt, args);
+    if (jbuf_vappendf(jb, fmt, args)) jb->item_count++;
     va_end(args);
-
-    if (needed < 0 || !jbuf_ensure(jb, needed)) {
-        va_end(args_copy);
-        return;
-    }
-
-    vsnprintf(jb->data + jb->len, needed + 1, fmt, args_copy);
-    jb->len += needed;
-    jb->item_count++;
-    va_end(args_copy);
 }
 
 char *jbuf_take(json_builder *jb)
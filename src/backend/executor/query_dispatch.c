@@ -500,6 +500,29 @@ const char *clause_flags_to_string(clause_flags flags)
     return buffer;
 }
 
+/*
+ * Whether a query can write properties of nodes or edges that already exist
+ * (the 'id' of nodes, edge weights). New nodes and edges pick up theirs when
+ * the cached graph merges them.
+ */
+static bool may_change_properties(cypher_query *query, clause_flags flags)
+{
+    if (flags & (CLAUSE_SET | CLAUSE_REMOVE | CLAUSE_FOREACH)) {
+        return true;
+    }
+    if (!(flags & CLAUSE_MERGE)) {
+        return false;
+    }
+
+    for (int i = 0; i < query->clauses->count; i++) {
+        ast_node *clause = query->clauses->items[i];
+        if (clause->type == AST_NODE_MERGE && ((cypher_merge *)clause)->on_match) {
+            return true;
+        }
+    }
+    return false;
+}
+
 /*
  * Main dispatch function - replaces the if-else chain.
  */
@@ -522,7 +545,14 @@ int dispatch_query_pattern(cypher_executor *executor, cypher_query *query,
     CYPHER_DEBUG("Matched pattern: %s (priority %d)", pattern->name, pattern->priority);
 
     /* Execute the pattern handler */
-    return pattern->handler(executor, query, result, flags);
+    int rc = pattern->handler(executor, query, result, flags);
+
+    if (may_change_properties(query, flags)) {
+        csr_graph_record_user_ids_changed(executor->cached_graph);
+        csr_graph_drop_weights(executor->cached_graph);
+    }
+
+    return rc;
 }
 
 /*
@@ -879,6 +909,23 @@ static int handle_unwind_create(cypher_executor *executor, cypher_query *query,
     return 0;
 }
 
+/*
+ * Cached graph for algorithm execution, with any pending changes merged.
+ * Returns NULL (algorithms load from SQLite) when nothing usable is cached.
+ */
+static csr_graph* current_cached_graph(cypher_executor *executor)
+{
+    csr_graph *graph = executor->cached_graph;
+    if (!graph) return NULL;
+
+    if (csr_graph_sync(graph, executor->db) != 0) {
+        CYPHER_DEBUG("Failed to merge graph changes - loading graph from SQLite");
+        return NULL;
+    }
+
+    return graph->node_count > 0 ? graph : NULL;
+}
+
 /*
  * Standalone RETURN handler - handles graph algorithms and expressions
  */
@@ -894,77 +941,142 @@ static int handle_return_only(cypher_executor *executor, cypher_query *query,
     graph_algo_params algo_params = detect_graph_algorithm(ret);
     if (algo_params.type != GRAPH_ALGO_NONE) {
         graph_algo_result *algo_result = NULL;
+        csr_graph *graph = NULL;
+        csr_graph *loaded = NULL;
+
+        /* graph option: run on a named projection instead of the cached graph */
+        if (algo_params.graph_name) {
+            csr_projection *projection = csr_projection_find(executor->projections,
+                                                             algo_params.graph_name);
+            if (!projection) {
+                char error[256];
+                snprintf(error, sizeof(error), "Graph projection '%s' does not exist",
+                         algo_params.graph_name);
+                graph_algo_params_free(&algo_params);
+                set_result_error(result, error);
+                return -1;
+            }
+            graph = csr_projection_graph(projection, executor->db);
+            if (!graph) {
+                graph_algo_params_free(&algo_params);
+                set_result_error(result, "Failed to load graph projection");
+                return -1;
+            }
+            if (!algo_params.weight_prop && projection->weight_property) {
+                algo_params.weight_prop = strdup(projection->weight_property);
+            }
+        } else {
+            graph = current_cached_graph(executor);
+        }
+
+        /* relationshipTypes option: run on a view holding only those edge types */
+        if (algo_params.rel_type_count > 0) {
+            if (!graph) {
+                graph = loaded = csr_graph_load(executor->db);
+            }
+            if (graph) {
+                graph = csr_graph_type_view(graph, algo_params.rel_types, algo_params.rel_type_count);
+                if (!graph) {
+                    csr_graph_free(loaded);
+                    graph_algo_params_free(&algo_params);
+                    set_result_error(result, "Failed to filter graph by relationship type");
+                    return -1;
+                }
+            }
+        }
 
         switch (algo_params.type) {
             case GRAPH_ALGO_PAGERANK:
                 CYPHER_DEBUG("Executing C-based PageRank");
-                algo_result = execute_pagerank(executor->db, executor->cached_graph,
+                algo_result = execute_pagerank(executor->db, graph,
                                                algo_params.damping,
                                                algo_params.iterations,
-                                               algo_params.top_k);
+                                               algo_params.tolerance,
+                                               algo_params.top_k,
+                                               algo_params.report_iterations);
+                break;
+            case GRAPH_ALGO_PERSONALIZED_PAGERANK:
+                CYPHER_DEBUG("Executing C-based Personalized PageRank");
+                algo_result = execute_personalized_pagerank(executor->db, graph,
+                                                            algo_params.seeds,
+                                                            algo_params.damping,
+                                                            algo_params.epsilon,
+                                                            algo_params.top_k);
                 break;
             case GRAPH_ALGO_LABEL_PROPAGATION:
                 CYPHER_DEBUG("Executing C-based Label Propagation");
-                algo_result = execute_label_propagation(executor->db, executor->cached_graph,
+                algo_result = execute_label_propagation(executor->db, graph,
                                                         algo_params.iterations);
                 break;
             case GRAPH_ALGO_DIJKSTRA:
                 CYPHER_DEBUG("Executing C-based Dijkstra");
-                algo_result = execute_dijkstra(executor->db, executor->cached_graph,
+                algo_result = execute_dijkstra(executor->db, graph,
                                                algo_params.source_id,
                                                algo_params.target_id,
                                                algo_params.weight_prop);
-                free(algo_params.source_id);
-                free(algo_params.target_id);
-                free(algo_params.weight_prop);
                 break;
             case GRAPH_ALGO_DEGREE_CENTRALITY:
                 CYPHER_DEBUG("Executing C-based Degree Centrality");
-                algo_result = execute_degree_centrality(executor->db, executor->cached_graph);
+                algo_result = execute_degree_centrality(executor->db, graph);
                 break;
             case GRAPH_ALGO_WCC:
                 CYPHER_DEBUG("Executing C-based Weakly Connected Components");
-                algo_result = execute_wcc(executor->db, executor->cached_graph);
+                algo_result = execute_wcc(executor->db, graph);
                 break;
             case GRAPH_ALGO_SCC:
                 CYPHER_DEBUG("Executing C-based Strongly Connected Components");
-                algo_result = execute_scc(executor->db, executor->cached_graph);
+                algo_result = execute_scc(executor->db, graph);
                 break;
             case GRAPH_ALGO_BETWEENNESS_CENTRALITY:
                 CYPHER_DEBUG("Executing C-based Betweenness Centrality");
-                algo_result = execute_betweenness_centrality(executor->db, executor->cached_graph);
+                algo_result = execute_betweenness_centrality(executor->db, graph,
+                                                             algo_params.samples,
+                                                             algo_params.seed);
                 break;
             case GRAPH_ALGO_CLOSENESS_CENTRALITY:
                 CYPHER_DEBUG("Executing C-based Closeness Centrality");
-                algo_result = execute_closeness_centrality(executor->db, executor->cached_graph);
+                algo_result = execute_closeness_centrality(executor->db, graph,
+                                                            algo_params.wasserman_faust);
+                break;
+            case GRAPH_ALGO_HARMONIC_CENTRALITY:
+                CYPHER_DEBUG("Executing C-based Harmonic Centrality");
+                algo_result = execute_harmonic_centrality(executor->db, graph);
+                break;
+            case GRAPH_ALGO_ECCENTRICITY:
+                CYPHER_DEBUG("Executing C-based Eccentricity");
+                algo_result = execute_eccentricity(executor->db, graph);
+                break;
+            case GRAPH_ALGO_DIAMETER:
+                CYPHER_DEBUG("Executing C-based Diameter");
+                algo_result = execute_diameter(executor->db, graph, algo_params.samples, algo_params.seed);
                 break;
             case GRAPH_ALGO_LOUVAIN:
                 CYPHER_DEBUG("Executing C-based Louvain Community Detection");
-                algo_result = execute_louvain(executor->db, executor->cached_graph, algo_params.resolution);
+                algo_result = execute_louvain(executor->db, graph, algo_params.resolution);
                 break;
             case GRAPH_ALGO_TRIANGLE_COUNT:
                 CYPHER_DEBUG("Executing C-based Triangle Count");
-                algo_result = execute_triangle_count(executor->db, executor->cached_graph);
+                algo_result = execute_triangle_count(executor->db, graph);
                 break;
             case GRAPH_ALGO_ASTAR:
                 CYPHER_DEBUG("Executing C-based A* Shortest Path");
-                algo_result = execute_astar(executor->db, executor->cached_graph, algo_params.source_id,
+                algo_result = execute_astar(executor->db, graph, algo_params.source_id,
                                             algo_params.target_id, algo_params.weight_prop,
                                             algo_params.lat_prop, algo_params.lon_prop);
                 break;
             case GRAPH_ALGO_BFS:
                 CYPHER_DEBUG("Executing C-based BFS Traversal");
-                algo_result = execute_bfs(executor->db, executor->cached_graph, algo_params.source_id,
+                algo_result = execute_bfs(executor->db, graph, algo_params.source_id,
                                           algo_params.max_depth);
                 break;
             case GRAPH_ALGO_DFS:
                 CYPHER_DEBUG("Executing C-based DFS Traversal");
-                algo_result = execute_dfs(executor->db, executor->cached_graph, algo_params.source_id,
+                algo_result = execute_dfs(executor->db, graph, algo_params.source_id,
                                           algo_params.max_depth);
                 break;
             case GRAPH_ALGO_NODE_SIMILARITY:
                 CYPHER_DEBUG("Executing C-based Node Similarity (Jaccard)");
-                algo_result = execute_node_similarity(executor->db, executor->cached_graph,
+                algo_result = execute_node_similarity(executor->db, graph,
                                                       algo_params.source_id,
                                                       algo_params.target_id,
                                                       algo_params.threshold,
@@ -972,23 +1084,26 @@ static int handle_return_only(cypher_executor *executor, cypher_query *query,
                 break;
             case GRAPH_ALGO_KNN:
                 CYPHER_DEBUG("Executing C-based K-Nearest Neighbors");
-                algo_result = execute_knn(executor->db, executor->cached_graph,
+                algo_result = execute_knn(executor->db, graph,
                                           algo_params.source_id,
                                           algo_params.k);
                 break;
             case GRAPH_ALGO_EIGENVECTOR_CENTRALITY:
                 CYPHER_DEBUG("Executing C-based Eigenvector Centrality");
-                algo_result = execute_eigenvector_centrality(executor->db, executor->cached_graph,
+                algo_result = execute_eigenvector_centrality(executor->db, graph,
                                                               algo_params.iterations);
                 break;
             case GRAPH_ALGO_APSP:
                 CYPHER_DEBUG("Executing C-based All Pairs Shortest Path");
-                algo_result = execute_apsp(executor->db, executor->cached_graph);
+                algo_result = execute_apsp(executor->db, graph, algo_params.weight_prop);
                 break;
             default:
                 break;
         }
 
+        csr_graph_free(loaded);
+        graph_algo_params_free(&algo_params);
+
         if (algo_result) {
             if (algo_result->success) {
                 result->column_count = 1;
@@ -8,6 +8,7 @@
 
 #include <sqlite3.h>
 #include <string.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <regex.h>
@@ -25,15 +26,30 @@ typedef struct {
     sqlite3 *db;
     cypher_executor *executor;
     csr_graph *cached_graph;  /* Cached CSR graph for algorithm acceleration */
+    csr_projection *projections;  /* Named subgraphs from gql_project_graph() */
+    csr_cache_entry graph_entry;  /* cached_graph's place in the memory budget's LRU list */
+    int executing;            /* Depth of cypher() calls in progress */
+    bool writing;             /* The open transaction has written to the database */
+    unsigned int seen_changes;  /* sqlite3_total_changes() as counted by the update hook */
 } bundled_connection_cache;
 
 /* Destructor called when database connection closes */
 static void bundled_connection_cache_destroy(void *data) {
     bundled_connection_cache *cache = (bundled_connection_cache *)data;
     if (cache) {
+        /*
+         * The hooks point at this cache. SQLite hands back only the previous
+         * argument, not the callback, so whatever they replaced cannot be
+         * put back either.
+         */
+        sqlite3_update_hook(cache->db, NULL, NULL);
+        sqlite3_commit_hook(cache->db, NULL, NULL);
+        sqlite3_rollback_hook(cache->db, NULL, NULL);
+        csr_cache_forget(&cache->graph_entry);
         if (cache->cached_graph) {
             csr_graph_free(cache->cached_graph);
         }
+        csr_projection_free_all(cache->projections);
         if (cache->executor) {
             cypher_executor_free(cache->executor);
         }
@@ -41,6 +57,89 @@ static void bundled_connection_cache_destroy(void *data) {
     }
 }
 
+/*
+ * Keep the cached graph in step with writes on this connection that the
+ * executor does not record itself: plain SQL on the graph tables, and
+ * transactions that roll back changes already merged or recorded.
+ */
+static void bundled_graph_update_hook(void *arg, int op, const char *db_name,
+                                      const char *table, sqlite3_int64 rowid) {
+    bundled_connection_cache *cache = (bundled_connection_cache *)arg;
+    cache->seen_changes++;
+    if (strcmp(db_name, "main") != 0) return;
+    if (!cache->writing) {
+        /* Other connections stop sharing graphs of this file (see graph_registry.c) */
+        cache->writing = true;
+        csr_graph_note_write(cache->db);
+    }
+    csr_graph_note_row_change(cache->cached_graph, op, table, rowid, cache->executing > 0);
+    csr_projections_note_row_change(cache->projections, table);
+}
+
+/* Graphs registered since the first write may have been read before the commit: stop sharing them too */
+static int bundled_graph_commit_hook(void *arg) {
+    bundled_connection_cache *cache = (bundled_connection_cache *)arg;
+    cache->writing = false;
+    csr_graph_note_write(cache->db);
+    return 0;
+}
+
+static void bundled_graph_rollback_hook(void *arg) {
+    bundled_connection_cache *cache = (bundled_connection_cache *)arg;
+    cache->writing = false;
+    csr_graph_note_write(cache->db);
+    csr_graph_mark_stale(cache->cached_graph);
+    csr_projections_mark_stale(cache->projections);
+}
+
+/*
+ * Rows changed that the update hook did not report: the host replaced it
+ * with its own, or SQLite skipped it (DELETE without WHERE). The graphs are
+ * reloaded rather than trusted.
+ */
+static void bundled_check_unreported_changes(bundled_connection_cache *cache) {
+    unsigned int total = (unsigned int)sqlite3_total_changes(cache->db);
+    /* Behind while an enclosing statement is still writing: its rows are already counted */
+    if ((int)(total - cache->seen_changes) <= 0) return;
+    cache->seen_changes = total;
+    csr_graph_mark_stale(cache->cached_graph);
+    csr_projections_mark_stale(cache->projections);
+}
+
+/* Memory budget eviction: the connection runs uncached until the graph is loaded again */
+static void bundled_cached_graph_evict(csr_cache_entry *entry) {
+    bundled_connection_cache *cache = (bundled_connection_cache *)((char *)entry - offsetof(bundled_connection_cache, graph_entry));
+    csr_graph_free(cache->cached_graph);
+    cache->cached_graph = NULL;
+    if (cache->executor) {
+        cache->executor->cached_graph = NULL;
+    }
+}
+
+/* Charge the connection's graphs to the memory budget, evicting the least recently used if it is exceeded */
+static void bundled_account_graph_memory(bundled_connection_cache *cache) {
+    if (cache->cached_graph) {
+        csr_cache_touch(&cache->graph_entry, csr_graph_memory_charge(cache->cached_graph));
+    } else {
+        csr_cache_forget(&cache->graph_entry);
+    }
+    csr_projections_update_memory(cache->projections);
+    csr_cache_enforce(cache->db, NULL);
+}
+
+/* The connection's graph, loaded (or shared from the registry) first if there is none; NULL if empty */
+static csr_graph* bundled_ensure_cached_graph(bundled_connection_cache *cache, sqlite3 *db) {
+    if (!cache->cached_graph) {
+        char *path = csr_graph_snapshot_path(db);
+        cache->cached_graph = csr_graph_acquire(db, path, NULL);
+        free(path);
+        if (cache->executor) {
+            cache->executor->cached_graph = cache->cached_graph;
+        }
+    }
+    return cache->cached_graph;
+}
+
 /* Simple test function */
 static void bundled_test_func(sqlite3_context *context, int argc, sqlite3_value **argv) {
     (void)argc;
@@ -48,11 +147,34 @@ static void bundled_test_func(sqlite3_context *context, int argc, sqlite3_value
     sqlite3_result_text(context, "GraphQLite extension loaded successfully!", -1, SQLITE_STATIC);
 }
 
-/* gql_load_graph() - Build CSR from SQLite and cache in connection memory */
-static void bundled_load_graph_func(sqlite3_context *context, int argc, sqlite3_value **argv) {
-    (void)argc;
-    (void)argv;
+/* Copy a file path into a JSON string body, escaping quotes, backslashes and control characters */
+static char* bundled_json_escape_path(const char *path) {
+    size_t len = strlen(path);
+    char *out = malloc(len * 6 + 1);
+    if (!out) return NULL;
+    char *p = out;
+    for (const unsigned char *c = (const unsigned char *)path; *c; c++) {
+        if (*c == '"' || *c == '\\') {
+            *p++ = '\\';
+            *p++ = (char)*c;
+        } else if (*c < 0x20) {
+            p += sprintf(p, "\\u%04x", *c);
+        } else {
+            *p++ = (char)*c;
+        }
+    }
+    *p = '\0';
+    return out;
+}
 
+/*
+ * gql_load_graph([path]) - Cache the graph for this connection.
+ * Shares the copy already loaded by another connection to the same
+ * database file if there is one; otherwise maps a snapshot written by
+ * gql_save_graph() when it still matches the database, or builds the CSR
+ * from SQLite.
+ */
+static void bundled_load_graph_func(sqlite3_context *context, int argc, sqlite3_value **argv) {
     bundled_connection_cache *cache = (bundled_connection_cache *)sqlite3_user_data(context);
     if (!cache) {
         sqlite3_result_error(context, "No connection cache available", -1);
@@ -65,17 +187,22 @@ static void bundled_load_graph_func(sqlite3_context *context, int argc, sqlite3_
     if (cache->cached_graph) {
         char response[256];
         snprintf(response, sizeof(response),
-                 "{\"status\":\"already_loaded\",\"nodes\":%d,\"edges\":%d}",
+                 "{\"status\":\"already_loaded\",\"nodes\":%d,\"edges\":%lld}",
                  cache->cached_graph->node_count,
-                 cache->cached_graph->edge_count);
+                 (long long)cache->cached_graph->edge_count);
         sqlite3_result_text(context, response, -1, SQLITE_TRANSIENT);
         return;
     }
 
-    /* Load graph from SQLite */
-    csr_graph *graph = csr_graph_load(db);
+    /* Prefer a snapshot, then fall back to loading from SQLite */
+    char *path = argc > 0 && sqlite3_value_type(argv[0]) != SQLITE_NULL
+        ? strdup((const char *)sqlite3_value_text(argv[0]))
+        : csr_graph_snapshot_path(db);
+    const char *source = "sqlite";
+    csr_graph *graph = csr_graph_acquire(db, path, &source);
+    free(path);
     if (!graph) {
-        sqlite3_result_text(context, "{\"status\":\"loaded\",\"nodes\":0,\"edges\":0}", -1, SQLITE_STATIC);
+        sqlite3_result_text(context, "{\"status\":\"loaded\",\"nodes\":0,\"edges\":0,\"source\":\"sqlite\"}", -1, SQLITE_STATIC);
         return;
     }
 
@@ -89,8 +216,243 @@ static void bundled_load_graph_func(sqlite3_context *context, int argc, sqlite3_
 
     char response[256];
     snprintf(response, sizeof(response),
-             "{\"status\":\"loaded\",\"nodes\":%d,\"edges\":%d}",
-             graph->node_count, graph->edge_count);
+             "{\"status\":\"loaded\",\"nodes\":%d,\"edges\":%lld,\"source\":\"%s\"}",
+             graph->node_count, (long long)graph->edge_count, source);
+
+    /* May evict the graph, so only once the response is formatted */
+    bundled_account_graph_memory(cache);
+    sqlite3_result_text(context, response, -1, SQLITE_TRANSIENT);
+}
+
+/* gql_save_graph([path]) - Write the graph to a snapshot file for gql_load_graph() */
+static void bundled_save_graph_func(sqlite3_context *context, int argc, sqlite3_value **argv) {
+    bundled_connection_cache *cache = (bundled_connection_cache *)sqlite3_user_data(context);
+    if (!cache) {
+        sqlite3_result_error(context, "No connection cache available", -1);
+        return;
+    }
+
+    sqlite3 *db = sqlite3_context_db_handle(context);
+
+    char *path = argc > 0 && sqlite3_value_type(argv[0]) != SQLITE_NULL
+        ? strdup((const char *)sqlite3_value_text(argv[0]))
+        : csr_graph_snapshot_path(db);
+    if (!path) {
+        sqlite3_result_error(context, "Snapshot needs a file database or an explicit path", -1);
+        return;
+    }
+
+    /* Read the graph and its fingerprint in one transaction so they agree */
+    int own_transaction = sqlite3_get_autocommit(db) &&
+                          sqlite3_exec(db, "BEGIN", NULL, NULL, NULL) == SQLITE_OK;
+
+    csr_graph *graph = NULL;
+    csr_graph *loaded = NULL;
+    bundled_check_unreported_changes(cache);
+    if (cache->cached_graph) {
+        csr_graph_sync(cache->cached_graph, db);
+        graph = cache->cached_graph;
+    } else {
+        graph = loaded = csr_graph_load(db);
+    }
+
+    sqlite3_int64 bytes = 0;
+    char *error = NULL;
+    int rc = csr_graph_save_snapshot(graph, db, path, &bytes, &error);
+    int nodes = graph ? graph->node_count : 0;
+    int64_t edges = graph ? graph->edge_count : 0;
+
+    if (own_transaction) {
+        sqlite3_exec(db, "COMMIT", NULL, NULL, NULL);
+    }
+    csr_graph_free(loaded);
+
+    if (rc != 0) {
+        sqlite3_result_error(context, error ? error : "Failed to save graph snapshot", -1);
+        free(error);
+        free(path);
+        return;
+    }
+
+    char *escaped = bundled_json_escape_path(path);
+    free(path);
+    if (!escaped) {
+        sqlite3_result_error_nomem(context);
+        return;
+    }
+    size_t response_size = strlen(escaped) + 160;
+    char *response = malloc(response_size);
+    if (!response) {
+        free(escaped);
+        sqlite3_result_error_nomem(context);
+        return;
+    }
+    snprintf(response, response_size,
+             "{\"status\":\"saved\",\"path\":\"%s\",\"nodes\":%d,\"edges\":%lld,\"bytes\":%lld}",
+             escaped, nodes, (long long)edges, (long long)bytes);
+    free(escaped);
+    sqlite3_result_text(context, response, -1, free);
+}
+
+/*
+ * gql_compress_graph() - Gap-encode the cached graph's adjacency to save
+ * memory. Loads the graph first if needed; it stays compressed until
+ * unloaded.
+ */
+static void bundled_compress_graph_func(sqlite3_context *context, int argc, sqlite3_value **argv) {
+    (void)argc;
+    (void)argv;
+
+    bundled_connection_cache *cache = (bundled_connection_cache *)sqlite3_user_data(context);
+    if (!cache) {
+        sqlite3_result_error(context, "No connection cache available", -1);
+        return;
+    }
+
+    csr_graph *graph = bundled_ensure_cached_graph(cache, sqlite3_context_db_handle(context));
+    if (!graph) {
+        sqlite3_result_text(context, "{\"status\":\"empty\"}", -1, SQLITE_STATIC);
+        return;
+    }
+
+    size_t bytes_before = csr_graph_adjacency_bytes(graph);
+    if (csr_graph_compress(graph) != 0) {
+        sqlite3_result_error(context, "Failed to compress graph", -1);
+        return;
+    }
+
+    char response[256];
+    snprintf(response, sizeof(response),
+             "{\"status\":\"compressed\",\"nodes\":%d,\"edges\":%lld,"
+             "\"bytes_before\":%llu,\"bytes_after\":%llu}",
+             graph->node_count, (long long)graph->edge_count,
+             (unsigned long long)bytes_before,
+             (unsigned long long)csr_graph_adjacency_bytes(graph));
+
+    /* May evict the graph, so only once the response is formatted */
+    bundled_account_graph_memory(cache);
+    sqlite3_result_text(context, response, -1, SQLITE_TRANSIENT);
+}
+
+/*
+ * gql_reorder_graph([order]) - Renumber the cached graph's nodes for cache
+ * locality: 'rcm' (default), 'degree', or 'id' to restore node ID order.
+ * Loads the graph first if needed; the order is kept across merged changes
+ * and reloads until unloaded.
+ */
+static void bundled_reorder_graph_func(sqlite3_context *context, int argc, sqlite3_value **argv) {
+    bundled_connection_cache *cache = (bundled_connection_cache *)sqlite3_user_data(context);
+    if (!cache) {
+        sqlite3_result_error(context, "No connection cache available", -1);
+        return;
+    }
+
+    int order = CSR_ORDER_RCM;
+    if (argc == 1 && sqlite3_value_type(argv[0]) != SQLITE_NULL) {
+        order = csr_node_order_from_name((const char *)sqlite3_value_text(argv[0]));
+        if (order < 0) {
+            sqlite3_result_error(context, "gql_reorder_graph() expects 'rcm', 'degree' or 'id'", -1);
+            return;
+        }
+    }
+
+    csr_graph *graph = bundled_ensure_cached_graph(cache, sqlite3_context_db_handle(context));
+    if (!graph) {
+        sqlite3_result_text(context, "{\"status\":\"empty\"}", -1, SQLITE_STATIC);
+        return;
+    }
+
+    double span_before = csr_graph_edge_span(graph);
+    if (csr_graph_reorder(graph, (csr_node_order)order) != 0) {
+        sqlite3_result_error(context, "Failed to reorder graph", -1);
+        return;
+    }
+
+    char response[256];
+    snprintf(response, sizeof(response),
+             "{\"status\":\"reordered\",\"order\":\"%s\",\"nodes\":%d,\"edges\":%lld,"
+             "\"span_before\":%.1f,\"span_after\":%.1f}",
+             csr_node_order_name(graph->order), graph->node_count, (long long)graph->edge_count,
+             span_before, csr_graph_edge_span(graph));
+
+    /* May evict the graph, so only once the response is formatted */
+    bundled_account_graph_memory(cache);
+    sqlite3_result_text(context, response, -1, SQLITE_TRANSIENT);
+}
+
+/*
+ * gql_coalesce_graph() - Merge parallel edges (same source, type and
+ * target) of the cached graph into one entry with a multiplicity. Loads the
+ * graph first if needed; it stays coalesced across merged changes and
+ * reloads until unloaded.
+ */
+static void bundled_coalesce_graph_func(sqlite3_context *context, int argc, sqlite3_value **argv) {
+    (void)argc;
+    (void)argv;
+
+    bundled_connection_cache *cache = (bundled_connection_cache *)sqlite3_user_data(context);
+    if (!cache) {
+        sqlite3_result_error(context, "No connection cache available", -1);
+        return;
+    }
+
+    csr_graph *graph = bundled_ensure_cached_graph(cache, sqlite3_context_db_handle(context));
+    if (!graph) {
+        sqlite3_result_text(context, "{\"status\":\"empty\"}", -1, SQLITE_STATIC);
+        return;
+    }
+
+    int64_t entries_before = graph->edge_count;
+    if (csr_graph_coalesce(graph) != 0) {
+        sqlite3_result_error(context, "Failed to coalesce graph", -1);
+        return;
+    }
+
+    char response[256];
+    snprintf(response, sizeof(response),
+             "{\"status\":\"coalesced\",\"nodes\":%d,\"edges\":%lld,"
+             "\"entries_before\":%lld,\"entries_after\":%lld}",
+             graph->node_count, (long long)csr_graph_edge_total(graph),
+             (long long)entries_before, (long long)graph->edge_count);
+
+    /* May evict the graph, so only once the response is formatted */
+    bundled_account_graph_memory(cache);
+    sqlite3_result_text(context, response, -1, SQLITE_TRANSIENT);
+}
+
+/*
+ * gql_compact_ids() - Renumber nodes 1..n in ID order so cached graphs map
+ * node IDs to indexes without a hash lookup. Node IDs change.
+ */
+static void bundled_compact_ids_func(sqlite3_context *context, int argc, sqlite3_value **argv) {
+    (void)argc;
+    (void)argv;
+
+    bundled_connection_cache *cache = (bundled_connection_cache *)sqlite3_user_data(context);
+    if (!cache) {
+        sqlite3_result_error(context, "No connection cache available", -1);
+        return;
+    }
+
+    int64_t nodes = 0;
+    int64_t renumbered = 0;
+    char *error = NULL;
+    if (csr_compact_node_ids(sqlite3_context_db_handle(context), &nodes, &renumbered, &error) != 0) {
+        sqlite3_result_error(context, error ? error : "Failed to compact node IDs", -1);
+        free(error);
+        return;
+    }
+
+    /* Cached graphs index the old IDs; reload them on next use */
+    if (renumbered > 0) {
+        csr_graph_mark_stale(cache->cached_graph);
+        csr_projections_mark_stale(cache->projections);
+    }
+
+    char response[128];
+    snprintf(response, sizeof(response),
+             "{\"status\":\"compacted\",\"nodes\":%lld,\"renumbered\":%lld}",
+             (long long)nodes, (long long)renumbered);
     sqlite3_result_text(context, response, -1, SQLITE_TRANSIENT);
 }
 
@@ -106,6 +468,7 @@ static void bundled_unload_graph_func(sqlite3_context *context, int argc, sqlite
     }
 
     if (cache->cached_graph) {
+        csr_cache_forget(&cache->graph_entry);
         csr_graph_free(cache->cached_graph);
         cache->cached_graph = NULL;
 
@@ -133,18 +496,35 @@ static void bundled_reload_graph_func(sqlite3_context *context, int argc, sqlite
 
     sqlite3 *db = sqlite3_context_db_handle(context);
 
-    int prev_nodes = 0, prev_edges = 0;
+    int prev_nodes = 0;
+    int64_t prev_edges = 0;
 
     /* Free existing cache if present */
+    bool compressed = false;
+    bool coalesced = false;
+    csr_node_order order = CSR_ORDER_ID;
     if (cache->cached_graph) {
+        compressed = cache->cached_graph->adj.bytes != NULL;
+        coalesced = cache->cached_graph->multiplicity != NULL;
+        order = cache->cached_graph->order;
         prev_nodes = cache->cached_graph->node_count;
-        prev_edges = cache->cached_graph->edge_count;
+        prev_edges = csr_graph_edge_total(cache->cached_graph);
+        csr_cache_forget(&cache->graph_entry);
         csr_graph_free(cache->cached_graph);
         cache->cached_graph = NULL;
     }
 
     /* Load fresh graph from SQLite */
     csr_graph *graph = csr_graph_load(db);
+    if (graph && coalesced) {
+        csr_graph_coalesce(graph);
+    }
+    if (graph && order != CSR_ORDER_ID) {
+        csr_graph_reorder(graph, order);
+    }
+    if (graph && compressed) {
+        csr_graph_compress(graph);
+    }
     cache->cached_graph = graph;
 
     /* Also update executor if it exists */
@@ -153,12 +533,15 @@ static void bundled_reload_graph_func(sqlite3_context *context, int argc, sqlite
     }
 
     int new_nodes = graph ? graph->node_count : 0;
-    int new_edges = graph ? graph->edge_count : 0;
+    int64_t new_edges = csr_graph_edge_total(graph);
 
     char response[512];
     snprintf(response, sizeof(response),
-             "{\"status\":\"reloaded\",\"previous_nodes\":%d,\"previous_edges\":%d,\"nodes\":%d,\"edges\":%d}",
-             prev_nodes, prev_edges, new_nodes, new_edges);
+             "{\"status\":\"reloaded\",\"previous_nodes\":%d,\"previous_edges\":%lld,\"nodes\":%d,\"edges\":%lld}",
+             prev_nodes, (long long)prev_edges, new_nodes, (long long)new_edges);
+
+    /* May evict the graph, so only once the response is formatted */
+    bundled_account_graph_memory(cache);
     sqlite3_result_text(context, response, -1, SQLITE_TRANSIENT);
 }
 
@@ -173,18 +556,228 @@ static void bundled_graph_loaded_func(sqlite3_context *context, int argc, sqlite
         return;
     }
 
+    bundled_check_unreported_changes(cache);
     if (cache->cached_graph) {
-        char response[256];
+        csr_graph_check_data_version(cache->cached_graph, cache->db);
+
+        double avg_probe;
+        int max_probe;
+        csr_graph_probe_stats(cache->cached_graph, &avg_probe, &max_probe);
+
+        char response[352];
         snprintf(response, sizeof(response),
-                 "{\"loaded\":true,\"nodes\":%d,\"edges\":%d}",
+                 "{\"loaded\":true,\"nodes\":%d,\"edges\":%lld,"
+                 "\"index_capacity\":%d,\"avg_probe\":%.3f,\"max_probe\":%d,"
+                 "\"pending_changes\":%d,\"shared_by\":%d,\"compressed\":%s,\"order\":\"%s\","
+                 "\"dense_ids\":%s,\"coalesced\":%s}",
                  cache->cached_graph->node_count,
-                 cache->cached_graph->edge_count);
+                 (long long)csr_graph_edge_total(cache->cached_graph),
+                 cache->cached_graph->node_map.capacity,
+                 avg_probe, max_probe,
+                 csr_graph_pending_changes(cache->cached_graph),
+                 csr_graph_share_count(cache->cached_graph),
+                 cache->cached_graph->adj.bytes ? "true" : "false",
+                 csr_node_order_name(cache->cached_graph->order),
+                 cache->cached_graph->node_map.dense ? "true" : "false",
+                 cache->cached_graph->multiplicity ? "true" : "false");
         sqlite3_result_text(context, response, -1, SQLITE_TRANSIENT);
     } else {
         sqlite3_result_text(context, "{\"loaded\":false,\"nodes\":0,\"edges\":0}", -1, SQLITE_STATIC);
     }
 }
 
+/*
+ * gql_graph_threads([n]) - Worker threads used to build graphs. With an
+ * argument, sets the process-wide count first (0 = one per processor).
+ */
+static void bundled_graph_threads_func(sqlite3_context *context, int argc, sqlite3_value **argv) {
+    if (argc == 1) {
+        if (sqlite3_value_type(argv[0]) != SQLITE_INTEGER || sqlite3_value_int(argv[0]) < 0) {
+            sqlite3_result_error(context, "gql_graph_threads() expects a non-negative integer", -1);
+            return;
+        }
+        graph_set_thread_count(sqlite3_value_int(argv[0]));
+    }
+
+    char response[64];
+    snprintf(response, sizeof(response), "{\"threads\":%d}", graph_thread_count());
+    sqlite3_result_text(context, response, -1, SQLITE_TRANSIENT);
+}
+
+/*
+ * gql_graph_stats() - Memory held by this connection's cached graph and
+ * projections, per component, and the process-wide budget and usage.
+ */
+static void bundled_graph_stats_func(sqlite3_context *context, int argc, sqlite3_value **argv) {
+    (void)argc;
+    (void)argv;
+
+    bundled_connection_cache *cache = (bundled_connection_cache *)sqlite3_user_data(context);
+    if (!cache) {
+        sqlite3_result_error(context, "No connection cache available", -1);
+        return;
+    }
+
+    char *stats = csr_graph_stats_json(cache->cached_graph, cache->projections);
+    if (!stats) {
+        sqlite3_result_error_nomem(context);
+        return;
+    }
+    sqlite3_result_text(context, stats, -1, free);
+}
+
+/*
+ * gql_graph_memory_limit([bytes]) - Memory budget for cached graphs and
+ * projections, process-wide. With an argument, sets it first (0 = no
+ * limit) and evicts least recently used graphs until it is met.
+ */
+static void bundled_graph_memory_limit_func(sqlite3_context *context, int argc, sqlite3_value **argv) {
+    if (argc == 1) {
+        if (sqlite3_value_type(argv[0]) != SQLITE_INTEGER || sqlite3_value_int64(argv[0]) < 0) {
+            sqlite3_result_error(context, "gql_graph_memory_limit() expects a non-negative number of bytes", -1);
+            return;
+        }
+        csr_cache_set_budget((size_t)sqlite3_value_int64(argv[0]));
+        csr_cache_enforce(sqlite3_context_db_handle(context), NULL);
+    }
+
+    csr_cache_stats stats;
+    csr_cache_get_stats(&stats);
+
+    char response[128];
+    snprintf(response, sizeof(response), "{\"budget\":%llu,\"used\":%llu,\"evictions\":%lld}",
+             (unsigned long long)stats.budget, (unsigned long long)stats.used,
+             (long long)stats.evictions);
+    sqlite3_result_text(context, response, -1, SQLITE_TRANSIENT);
+}
+
+/*
+ * gql_project_graph(name[, labels[, types[, weight_property]]]) - Cache the
+ * subgraph of nodes with the given labels and edges of the given types
+ * between them, for algorithms called with {graph: 'name'}. labels and types
+ * are a name or a JSON array of names; NULL keeps every label or type. An
+ * existing projection with the same name is replaced.
+ */
+static void bundled_project_graph_func(sqlite3_context *context, int argc, sqlite3_value **argv) {
+    bundled_connection_cache *cache = (bundled_connection_cache *)sqlite3_user_data(context);
+    if (!cache) {
+        sqlite3_result_error(context, "No connection cache available", -1);
+        return;
+    }
+    if (sqlite3_value_type(argv[0]) != SQLITE_TEXT) {
+        sqlite3_result_error(context, "gql_project_graph() expects a graph name", -1);
+        return;
+    }
+
+    sqlite3 *db = sqlite3_context_db_handle(context);
+    const char *name = (const char *)sqlite3_value_text(argv[0]);
+    const char *labels_text = argc > 1 ? (const char *)sqlite3_value_text(argv[1]) : NULL;
+    const char *types_text = argc > 2 ? (const char *)sqlite3_value_text(argv[2]) : NULL;
+    const char *weight_property = argc > 3 ? (const char *)sqlite3_value_text(argv[3]) : NULL;
+
+    char **labels = NULL, **types = NULL;
+    int label_count = 0, type_count = 0;
+    if (csr_parse_name_list(db, labels_text, &labels, &label_count) != 0 ||
+        csr_parse_name_list(db, types_text, &types, &type_count) != 0) {
+        for (int i = 0; i < label_count; i++) free(labels[i]);
+        free(labels);
+        sqlite3_result_error(context, "gql_project_graph() expects a name or a JSON array of names", -1);
+        return;
+    }
+
+    csr_projection *projection = csr_projection_create(db, name, labels, label_count,
+                                                       types, type_count, weight_property);
+    for (int i = 0; i < label_count; i++) free(labels[i]);
+    free(labels);
+    for (int i = 0; i < type_count; i++) free(types[i]);
+    free(types);
+    if (!projection) {
+        sqlite3_result_error(context, "Failed to load graph projection", -1);
+        return;
+    }
+
+    csr_projection_add(&cache->projections, projection);
+    if (cache->executor) {
+        cache->executor->projections = cache->projections;
+    }
+
+    char response[256];
+    snprintf(response, sizeof(response),
+             "{\"status\":\"projected\",\"nodes\":%d,\"edges\":%lld}",
+             projection->graph->node_count, (long long)projection->graph->edge_count);
+    sqlite3_result_text(context, response, -1, SQLITE_TRANSIENT);
+}
+
+/*
+ * gql_load_edgelist(path[, format[, name]]) - Load an edge-list file
+ * ('text' or 'binary', default 'text') as a projection for algorithms
+ * called with {graph: name}, without writing anything to the database.
+ * Identifiers in the file become node user IDs. name defaults to path; an
+ * existing projection with the same name is replaced.
+ */
+static void bundled_load_edgelist_func(sqlite3_context *context, int argc, sqlite3_value **argv) {
+    bundled_connection_cache *cache = (bundled_connection_cache *)sqlite3_user_data(context);
+    if (!cache) {
+        sqlite3_result_error(context, "No connection cache available", -1);
+        return;
+    }
+    if (sqlite3_value_type(argv[0]) != SQLITE_TEXT ||
+        (argc > 1 && sqlite3_value_type(argv[1]) != SQLITE_TEXT && sqlite3_value_type(argv[1]) != SQLITE_NULL) ||
+        (argc > 2 && sqlite3_value_type(argv[2]) != SQLITE_TEXT)) {
+        sqlite3_result_error(context, "gql_load_edgelist() expects a file path, a format and a graph name", -1);
+        return;
+    }
+
+    sqlite3 *db = sqlite3_context_db_handle(context);
+    const char *path = (const char *)sqlite3_value_text(argv[0]);
+    const char *format = argc > 1 ? (const char *)sqlite3_value_text(argv[1]) : NULL;
+    const char *name = argc > 2 ? (const char *)sqlite3_value_text(argv[2]) : path;
+
+    char *error = NULL;
+    csr_projection *projection = csr_projection_load_edgelist(db, name, path, format, &error);
+    if (!projection) {
+        sqlite3_result_error(context, error ? error : "Failed to load edge list", -1);
+        free(error);
+        return;
+    }
+
+    csr_projection_add(&cache->projections, projection);
+    if (cache->executor) {
+        cache->executor->projections = cache->projections;
+    }
+
+    char *escaped = bundled_json_escape_path(name);
+    size_t response_size = escaped ? strlen(escaped) + 128 : 0;
+    char *response = escaped ? malloc(response_size) : NULL;
+    if (!response) {
+        free(escaped);
+        sqlite3_result_error_nomem(context);
+        return;
+    }
+    snprintf(response, response_size, "{\"status\":\"loaded\",\"graph\":\"%s\",\"nodes\":%d,\"edges\":%lld}",
+             escaped, projection->graph->node_count, (long long)projection->graph->edge_count);
+    free(escaped);
+    sqlite3_result_text(context, response, -1, free);
+}
+
+/* gql_drop_projection(name) - Free a projection made by gql_project_graph() or gql_load_edgelist() */
+static void bundled_drop_projection_func(sqlite3_context *context, int argc, sqlite3_value **argv) {
+    (void)argc;
+    bundled_connection_cache *cache = (bundled_connection_cache *)sqlite3_user_data(context);
+    if (!cache) {
+        sqlite3_result_error(context, "No connection cache available", -1);
+        return;
+    }
+
+    const char *name = (const char *)sqlite3_value_text(argv[0]);
+    bool dropped = name && csr_projection_drop(&cache->projections, name);
+    if (cache->executor) {
+        cache->executor->projections = cache->projections;
+    }
+    sqlite3_result_text(context, dropped ? "{\"status\":\"dropped\"}" : "{\"status\":\"not_found\"}",
+                        -1, SQLITE_STATIC);
+}
+
 /* Cypher function - full implementation with cached executor */
 static void bundled_cypher_func(sqlite3_context *context, int argc, sqlite3_value **argv) {
     if (argc < 1 || argc > 2) {
@@ -240,13 +833,25 @@ static void bundled_cypher_func(sqlite3_context *context, int argc, sqlite3_valu
         }
     }
 
+    /* Ensure executor has current projections */
+    if (cache) {
+        bundled_check_unreported_changes(cache);
+        executor->projections = cache->projections;
+    }
+
     /* Execute query (with or without parameters) */
     cypher_result *result;
+    if (cache) cache->executing++;
     if (params_json) {
         result = cypher_executor_execute_params(executor, query, params_json);
     } else {
         result = cypher_executor_execute(executor, query);
     }
+    if (cache) {
+        cache->executing--;
+        /* Not while an enclosing call may still use the graphs */
+        if (cache->executing == 0) bundled_account_graph_memory(cache);
+    }
     if (!result) {
         sqlite3_result_error(context, "Failed to execute cypher query", -1);
         return;
@@ -508,6 +1113,7 @@ int graphqlite_init(sqlite3 *db) {
     }
     cache->db = db;
     cache->executor = NULL;
+    csr_cache_entry_init(&cache->graph_entry, db, bundled_cached_graph_evict);
 
     /* Register the graphqlite_test function */
     sqlite3_create_function(db, "graphqlite_test", 0, SQLITE_UTF8, 0,
@@ -518,6 +1124,12 @@ int graphqlite_init(sqlite3 *db) {
                                bundled_cypher_func, 0, 0,
                                bundled_connection_cache_destroy);
 
+    /* Track graph writes for the cached graph (after "cypher", whose old cache clears its hooks) */
+    cache->seen_changes = (unsigned int)sqlite3_total_changes(db);
+    sqlite3_update_hook(db, bundled_graph_update_hook, cache);
+    sqlite3_commit_hook(db, bundled_graph_commit_hook, cache);
+    sqlite3_rollback_hook(db, bundled_graph_rollback_hook, cache);
+
     /* Register the regexp() function */
     sqlite3_create_function(db, "regexp", 2, SQLITE_UTF8, 0,
                            bundled_regexp_func, 0, 0);
@@ -525,12 +1137,50 @@ int graphqlite_init(sqlite3 *db) {
     /* Register graph cache management functions */
     sqlite3_create_function(db, "gql_load_graph", 0, SQLITE_UTF8, cache,
                            bundled_load_graph_func, 0, 0);
+    /* Forms taking a file path only from top-level SQL, not from triggers or views in the schema */
+    sqlite3_create_function(db, "gql_load_graph", 1, SQLITE_UTF8 | SQLITE_DIRECTONLY, cache,
+                           bundled_load_graph_func, 0, 0);
+    sqlite3_create_function(db, "gql_save_graph", 0, SQLITE_UTF8, cache,
+                           bundled_save_graph_func, 0, 0);
+    sqlite3_create_function(db, "gql_save_graph", 1, SQLITE_UTF8 | SQLITE_DIRECTONLY, cache,
+                           bundled_save_graph_func, 0, 0);
+    sqlite3_create_function(db, "gql_compress_graph", 0, SQLITE_UTF8, cache,
+                           bundled_compress_graph_func, 0, 0);
+    sqlite3_create_function(db, "gql_reorder_graph", 0, SQLITE_UTF8, cache,
+                           bundled_reorder_graph_func, 0, 0);
+    sqlite3_create_function(db, "gql_reorder_graph", 1, SQLITE_UTF8, cache,
+                           bundled_reorder_graph_func, 0, 0);
+    sqlite3_create_function(db, "gql_coalesce_graph", 0, SQLITE_UTF8, cache,
+                           bundled_coalesce_graph_func, 0, 0);
+    sqlite3_create_function(db, "gql_compact_ids", 0, SQLITE_UTF8, cache,
+                           bundled_compact_ids_func, 0, 0);
     sqlite3_create_function(db, "gql_unload_graph", 0, SQLITE_UTF8, cache,
                            bundled_unload_graph_func, 0, 0);
     sqlite3_create_function(db, "gql_reload_graph", 0, SQLITE_UTF8, cache,
                            bundled_reload_graph_func, 0, 0);
     sqlite3_create_function(db, "gql_graph_loaded", 0, SQLITE_UTF8, cache,
                            bundled_graph_loaded_func, 0, 0);
+    sqlite3_create_function(db, "gql_graph_threads", 0, SQLITE_UTF8, 0,
+                           bundled_graph_threads_func, 0, 0);
+    sqlite3_create_function(db, "gql_graph_threads", 1, SQLITE_UTF8, 0,
+                           bundled_graph_threads_func, 0, 0);
+    for (int nargs = 1; nargs <= 4; nargs++) {
+        sqlite3_create_function(db, "gql_project_graph", nargs, SQLITE_UTF8, cache,
+                               bundled_project_graph_func, 0, 0);
+    }
+    /* Reads a file path: top-level SQL only, like gql_load_graph(path) */
+    for (int nargs = 1; nargs <= 3; nargs++) {
+        sqlite3_create_function(db, "gql_load_edgelist", nargs, SQLITE_UTF8 | SQLITE_DIRECTONLY, cache,
+                               bundled_load_edgelist_func, 0, 0);
+    }
+    sqlite3_create_function(db, "gql_drop_projection", 1, SQLITE_UTF8, cache,
+                           bundled_drop_projection_func, 0, 0);
+    sqlite3_create_function(db, "gql_graph_stats", 0, SQLITE_UTF8, cache,
+                           bundled_graph_stats_func, 0, 0);
+    sqlite3_create_function(db, "gql_graph_memory_limit", 0, SQLITE_UTF8, 0,
+                           bundled_graph_memory_limit_func, 0, 0);
+    sqlite3_create_function(db, "gql_graph_memory_limit", 1, SQLITE_UTF8, 0,
+                           bundled_graph_memory_limit_func, 0, 0);
 
     /* Create schema */
     bundled_create_schema(db);
@@ -36,8 +36,9 @@ typedef struct cypher_result {
     int properties_set;
 } cypher_result;
 
-/* Forward declaration for CSR graph (defined in graph_algorithms.h) */
+/* Forward declarations for CSR graphs (defined in graph_algorithms.h) */
 struct csr_graph;
+struct csr_projection;
 
 /* Execution engine - coordinates parser, transformer, and schema manager */
 struct cypher_executor {
@@ -46,6 +47,7 @@ struct cypher_executor {
     bool schema_initialized;
     const char *params_json;  /* Current query parameters (NULL if no params) */
     struct csr_graph *cached_graph;  /* Cached graph for algorithm acceleration (managed by connection) */
+    struct csr_projection *projections;  /* Named graph projections (managed by connection) */
 };
 
 /* Executor lifecycle */
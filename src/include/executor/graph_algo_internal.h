@@ -12,25 +12,367 @@
 #include "parser/cypher_debug.h"
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 
-/* Hash table size for node ID lookups - should be prime and larger than expected node count */
-#define HASH_TABLE_SIZE 1000003
+/* Smallest node map capacity */
+#define NODE_MAP_MIN_CAPACITY 16
 
-/* Simple hash function for integer keys */
-static inline int hash_int(int key, int size)
+/*
+ * Hash function for integer keys (result is masked to a power-of-two table).
+ * The high half is folded in first, so IDs below 2^32 hash as before.
+ */
+static inline unsigned int hash_int(int64_t key)
 {
-    unsigned int h = (unsigned int)key;
+    unsigned int h = (unsigned int)((uint64_t)key ^ ((uint64_t)key >> 32));
     h = ((h >> 16) ^ h) * 0x45d9f3b;
     h = ((h >> 16) ^ h) * 0x45d9f3b;
     h = (h >> 16) ^ h;
-    return (int)(h % (unsigned int)size);
+    return h;
+}
+
+/*
+ * Free an array owned by the graph. Arrays that live inside a mapped
+ * snapshot are released with the mapping instead.
+ */
+static inline void csr_graph_release(const csr_graph *graph, void *ptr)
+{
+    const char *base = (const char *)graph->snapshot;
+    if (base && (const char *)ptr >= base && (const char *)ptr < base + graph->snapshot_size) {
+        return;
+    }
+    free(ptr);
+}
+
+/* Unmap the snapshot backing a graph's arrays, if any (graph_snapshot.c) */
+void csr_graph_unmap_snapshot(csr_graph *graph);
+
+/*
+ * Map a whole file read-only, or read it into memory where mmap is
+ * unavailable (graph_snapshot.c). NULL if the file is missing or empty.
+ */
+void* csr_map_file(const char *path, size_t *size);
+void csr_unmap_file(void *data, size_t size);
+
+/* Node map operations (graph_algorithms.c) */
+int node_map_init(csr_node_map *map, int expected_count);
+int node_map_insert(csr_node_map *map, int64_t node_id, int index);
+void node_map_free(csr_node_map *map);
+
+/* Map node_ids[i] -> i for count nodes: dense when the IDs allow it, else hashed */
+int node_map_build(csr_node_map *map, const int64_t *node_ids, int count);
+
+/*
+ * Build CSR arrays for graph->node_count nodes from an edge list of internal
+ * indices (graph_algorithms.c). edge_type holds type IDs into
+ * graph->type_names, or is NULL for an untyped graph; edge_id holds edge
+ * row IDs, or is NULL; edge_mult holds the multiplicity of each entry of a
+ * coalesced graph (filling graph->multiplicity and in_multiplicity), or is
+ * NULL. Rows come out sorted by (type, neighbour) whatever the input order;
+ * ties keep input order.
+ */
+int csr_graph_build_edges(csr_graph *graph, const int *edge_src, const int *edge_tgt,
+                          const int *edge_type, const int64_t *edge_id, const int *edge_mult,
+                          int64_t edge_total);
+
+/* Type ID for a relationship type, appending it to graph->type_names if new; -1 on failure */
+int csr_graph_intern_type(csr_graph *graph, const char *type);
+
+/*
+ * Drop types no edge uses and renumber the rest in name order, rewriting
+ * edge_type[0..edge_total) to match. Gives a graph the same type IDs however
+ * it was built (graph_algorithms.c).
+ */
+int csr_graph_canonical_types(csr_graph *graph, int *edge_type, int64_t edge_total);
+
+/* Growable list of IDs (added edges are stored as edge ID, source, target, type ID) */
+typedef struct {
+    int64_t *items;
+    int count;
+    int capacity;
+} csr_id_list;
+
+/* Pending changes against a loaded CSR graph */
+struct csr_delta {
+    csr_id_list added_nodes;
+    csr_id_list removed_nodes;
+    csr_id_list added_edges;
+    csr_id_list removed_edges;
+    int recorded_edge_rows;  /* Edge rows accounted for by the record functions */
+    int observed_edge_rows;  /* Edge rows written, as seen by the update hook */
+    bool user_ids_changed;   /* 'id' properties may have changed; reread them */
+    bool written;            /* This connection wrote the graph tables (update hook) */
+    bool stale;              /* Changes were lost; a full reload is required */
+};
+
+/* Free a delta (graph_delta.c) */
+void csr_delta_free(struct csr_delta *delta);
+
+/* Read PRAGMA data_version for db; 0 on success (graph_delta.c) */
+int csr_data_version(sqlite3 *db, sqlite3_int64 *version);
+
+/*
+ * Fingerprint of the graph tables that stays the same across connections
+ * and processes while the graph is unchanged (graph_snapshot.c). 0 on
+ * success, -1 if the graph tables are missing.
+ */
+#define CSR_FINGERPRINT_FIELDS 8
+int csr_graph_fingerprint(sqlite3 *db, int64_t *fingerprint);
+
+/*
+ * Detach a graph from the shared copy it borrows its arrays from and drop
+ * the reference (graph_registry.c). Per-connection state is left for the
+ * caller to free. No-op for graphs that are not shared.
+ */
+void csr_graph_unshare(csr_graph *graph);
+
+/*
+ * Load the graph again for a connection that wrote to it, passing over any
+ * registered copy (graph_registry.c). The loaded graph is registered as the
+ * file's new generation. NULL for an empty graph.
+ */
+csr_graph* csr_graph_reacquire(sqlite3 *db);
+
+/*
+ * Neighbour iteration over plain or compressed rows:
+ *
+ *     for (csr_edge_iter it = csr_out_edges(graph, u); csr_edge_next(&it); ) {
+ *         ... it.node is the neighbour, it.slot its edge slot ...
+ *     }
+ *
+ * Compressed rows hold the zigzag varint of each neighbour minus the
+ * previous one (the row's own node before the first).
+ */
+typedef struct {
+    const int *col;       /* Plain row: next neighbour */
+    const uint8_t *pos;   /* Compressed row: next encoded gap, NULL for plain rows */
+    int64_t slot;         /* Edge slot of node */
+    int64_t end;
+    int node;
+} csr_edge_iter;
+
+static inline csr_edge_iter csr_edge_iter_row(const int64_t *row_ptr, const int *col_idx,
+                                              const csr_adjacency *adj, int u)
+{
+    csr_edge_iter it;
+    if (adj->bytes) {
+        it.col = NULL;
+        it.pos = adj->bytes + adj->block_start[u >> CSR_ADJ_BLOCK_SHIFT] + adj->row_start[u];
+    } else {
+        it.col = col_idx + row_ptr[u];
+        it.pos = NULL;
+    }
+    it.slot = row_ptr[u] - 1;
+    it.end = row_ptr[u + 1];
+    it.node = u;
+    return it;
+}
+
+static inline csr_edge_iter csr_out_edges(const csr_graph *graph, int u)
+{
+    return csr_edge_iter_row(graph->row_ptr, graph->col_idx, &graph->adj, u);
+}
+
+static inline csr_edge_iter csr_in_edges(const csr_graph *graph, int u)
+{
+    return csr_edge_iter_row(graph->in_row_ptr, graph->in_col_idx, &graph->in_adj, u);
+}
+
+static inline bool csr_edge_next(csr_edge_iter *it)
+{
+    if (++it->slot >= it->end) return false;
+    if (!it->pos) {
+        it->node = *it->col++;
+        return true;
+    }
+
+    uint32_t z = *it->pos++;
+    if (z & 0x80) {
+        z &= 0x7f;
+        int shift = 7;
+        uint8_t b;
+        do {
+            b = *it->pos++;
+            z |= (uint32_t)(b & 0x7f) << shift;
+            shift += 7;
+        } while (b & 0x80);
+    }
+    it->node += (int32_t)((z >> 1) ^ (0u - (z & 1)));
+    return true;
+}
+
+/* Edges behind an edge slot: its multiplicity in a coalesced graph, else 1 */
+static inline int csr_slot_multiplicity(const int *multiplicity, int64_t slot)
+{
+    return multiplicity ? multiplicity[slot] : 1;
+}
+
+/* Out- and in-degree of node u counted in edges, not slots */
+static inline int64_t csr_out_degree(const csr_graph *graph, int u)
+{
+    if (!graph->multiplicity) return graph->row_ptr[u + 1] - graph->row_ptr[u];
+    int64_t degree = 0;
+    for (int64_t j = graph->row_ptr[u]; j < graph->row_ptr[u + 1]; j++) {
+        degree += graph->multiplicity[j];
+    }
+    return degree;
+}
+
+static inline int64_t csr_in_degree(const csr_graph *graph, int u)
+{
+    if (!graph->in_multiplicity) return graph->in_row_ptr[u + 1] - graph->in_row_ptr[u];
+    int64_t degree = 0;
+    for (int64_t j = graph->in_row_ptr[u]; j < graph->in_row_ptr[u + 1]; j++) {
+        degree += graph->in_multiplicity[j];
+    }
+    return degree;
+}
+
+/* Free a compressed adjacency and reset it to empty (graph_compress.c) */
+void csr_adjacency_free(csr_adjacency *adj);
+
+/* Plain copy of one direction's neighbour array (in_col_idx if incoming), malloc'd (graph_compress.c) */
+int* csr_graph_decode_rows(const csr_graph *graph, bool incoming);
+
+/* Free neighbour sets (graph_neighbour_sets.c) */
+void csr_neighbour_sets_free(csr_neighbour_sets *sets);
+
+/* Upper bound on worker threads */
+#define GRAPH_MAX_THREADS 256
+
+/* Fewest items per chunk worth handing to another thread */
+#define GRAPH_PARALLEL_MIN_ITEMS 16384
+
+/*
+ * Parallel loops (graph_parallel.c). graph_parallel_for() splits [0, count)
+ * into `chunks` contiguous ranges and calls fn(ctx, chunk, begin, end) for
+ * each, one thread per range; it returns when all have finished. Chunk
+ * ranges are fixed by the count, so per-chunk results can be combined in
+ * chunk order. graph_parallel_chunks() picks the chunk count for a loop of
+ * count items.
+ */
+typedef void (*graph_parallel_fn)(void *ctx, int chunk, int64_t begin, int64_t end);
+
+int graph_parallel_chunks(int64_t count);
+void graph_parallel_for(int64_t count, int chunks, graph_parallel_fn fn, void *ctx);
+
+/*
+ * Parallel loops over nodes are cut by work (edges plus one per node)
+ * rather than node count, so hubs do not leave one thread with most of the
+ * edges: graph_parallel_for() runs over [0, n + row_ptr[n]) and each chunk
+ * maps its range to nodes with this. Node v starts at work row_ptr[v] + v;
+ * returns the first node at or past w.
+ */
+static inline int csr_first_node_at(const int64_t *row_ptr, int n, int64_t w)
+{
+    int lo = 0, hi = n;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (row_ptr[mid] + mid < w) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
 }
 
+/*
+ * Multi-source BFS (graph_msbfs.c). Runs breadth-first searches from up to
+ * MSBFS_WIDTH sources at once: each node holds a bitset with one bit per
+ * source, so one pass over the edges advances every search in the batch.
+ * Each level pulls the frontier bits of a node's in-neighbours (and
+ * out-neighbours if undirected), split across the worker threads.
+ *
+ * sources lists the source nodes (NULL = every node, in index order) and
+ * is run in batches. After each level, level_fn gets the batch's first
+ * position in sources, its size, the depth and, per source of the batch,
+ * the number of nodes first reached at that depth. 0 on success, -1 if
+ * out of memory.
+ */
+#define MSBFS_WORDS 4
+#define MSBFS_WIDTH (64 * MSBFS_WORDS)
+
+typedef void (*msbfs_level_fn)(void *ctx, int first, int count, int depth, const int64_t *reached);
+
+int graph_msbfs(const csr_graph *graph, const int *sources, int source_count, bool undirected,
+                msbfs_level_fn level_fn, void *ctx);
+
+/* splitmix64: small, seedable, and the same sequence on every platform */
+static inline uint64_t graph_random_next(uint64_t *state)
+{
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+/*
+ * Node indices 0..n-1 shuffled so the first k are distinct nodes chosen
+ * uniformly at random from the seed (graph_algo_betweenness.c). malloc'd,
+ * NULL if out of memory.
+ */
+int* graph_sample_nodes(int n, int k, int64_t seed);
+
+/* Look up a node ID in the map, -1 if absent */
+static inline int node_map_find(const csr_node_map *map, int64_t node_id)
+{
+    if (map->dense) {
+        uint64_t offset = (uint64_t)node_id - (uint64_t)map->first_id;
+        return offset < (uint64_t)map->count ? (int)offset : -1;
+    }
+    if (!map->slots) return -1;
+
+    unsigned int mask = (unsigned int)map->capacity - 1;
+    unsigned int h = hash_int(node_id) & mask;
+    while (map->slots[h].index != -1) {
+        if (map->slots[h].node_id == node_id) {
+            return map->slots[h].index;
+        }
+        h = (h + 1) & mask;
+    }
+    return -1;
+}
+
+/* FNV-1a hash for user ID strings */
+static inline unsigned int hash_string(const char *str)
+{
+    unsigned int h = 2166136261u;
+    for (const unsigned char *p = (const unsigned char *)str; *p; p++) {
+        h ^= *p;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/* Build the user ID hash index over graph->user_ids (graph_algorithms.c) */
+int csr_graph_index_user_ids(csr_graph *graph);
+
+/* Replace user IDs with copies of ids[0..node_count) in a new arena, and reindex */
+int csr_graph_build_user_ids(csr_graph *graph, const char *const *ids);
+
+/* Reread every node's 'id' property from SQLite, and reindex */
+int csr_graph_load_user_ids(csr_graph *graph, sqlite3 *db);
+
 /* Find internal node index by user-defined ID property */
 static inline int find_node_by_user_id(csr_graph *graph, const char *user_id)
 {
     if (!graph->user_ids || !user_id) return -1;
 
+    if (graph->user_id_index) {
+        unsigned int hash = hash_string(user_id);
+        unsigned int mask = (unsigned int)graph->user_id_index_capacity - 1;
+        unsigned int h = hash & mask;
+        while (graph->user_id_index[h].index != -1) {
+            const csr_string_slot *slot = &graph->user_id_index[h];
+            if (slot->hash == hash && strcmp(graph->user_ids[slot->index], user_id) == 0) {
+                return slot->index;
+            }
+            h = (h + 1) & mask;
+        }
+        return -1;
+    }
+
+    /* No index (graph assembled without one) */
     for (int i = 0; i < graph->node_count; i++) {
         if (graph->user_ids[i] && strcmp(graph->user_ids[i], user_id) == 0) {
             return i;
@@ -3,6 +3,7 @@
 
 #include "graphqlite_sqlite.h"
 #include <stdbool.h>
+#include <stdint.h>
 #include "parser/cypher_ast.h"
 
 /*
@@ -12,24 +13,162 @@
  * that would be too slow to implement in pure SQL.
  *
  * Uses Compressed Sparse Row (CSR) format for efficient graph traversal.
+ *
+ * Node and edge IDs are SQLite rowids and are kept as 64-bit values, as are
+ * edge offsets, so neither large AUTOINCREMENT IDs nor more than 2^31 edges
+ * overflow. Internal node indices (col_idx, in_col_idx and the algorithm
+ * scratch arrays) stay 32-bit: graphs are limited to INT_MAX nodes.
+ */
+
+/*
+ * Node ID -> internal index map.
+ *
+ * Open addressing with linear probing over a power-of-two slot array.
+ * Keys and values are stored together in each slot so a probe touches a
+ * single cache line. The map is sized from the node count at load time
+ * (load factor <= 0.5) and doubles when inserts push it past that.
+ *
+ * When the indices are node IDs first_id, first_id + 1, ... in order (no
+ * gaps, as after gql_compact_ids()), the map is dense: no slots at all,
+ * index = node_id - first_id.
+ */
+typedef struct {
+    int64_t node_id;      /* Original node ID (rowid) */
+    int index;            /* Internal index, -1 = empty slot */
+} csr_node_slot;
+
+typedef struct {
+    csr_node_slot *slots; /* Size: capacity. NULL when dense */
+    int capacity;         /* Number of slots (power of two), 0 when dense */
+    int count;            /* Number of occupied slots, or of IDs when dense */
+    bool dense;
+    int64_t first_id;     /* Dense: node ID of index 0 */
+} csr_node_map;
+
+/* User ID index slot: string hash and internal index (-1 = empty) */
+typedef struct {
+    unsigned int hash;
+    int index;
+} csr_string_slot;
+
+/* Edge property values aligned to col_idx, loaded on first use */
+typedef struct {
+    char *property;       /* Edge property name */
+    double *values;       /* Size: edge_count. 1.0 where the edge has no value */
+} csr_weight_column;
+
+/*
+ * Gap-encoded adjacency rows (see graph_compress.c). Row u starts at
+ * bytes + block_start[u >> CSR_ADJ_BLOCK_SHIFT] + row_start[u]: a 64-bit
+ * base per block of rows keeps the per-row offsets at 32 bits.
  */
+#define CSR_ADJ_BLOCK_SHIFT 12
+
+typedef struct {
+    uint8_t *bytes;       /* NULL when the graph is not compressed */
+    int64_t *block_start; /* Size: (node_count >> CSR_ADJ_BLOCK_SHIFT) + 1 */
+    uint32_t *row_start;  /* Size: node_count. Offset of each row within its block */
+    int64_t size;         /* Bytes in the stream */
+} csr_adjacency;
+
+/*
+ * Neighbour sets (see csr_graph_undirected and csr_graph_out_sets): each
+ * node's distinct neighbours in ascending order, with the number of edges
+ * joining them. Adjacency rows are sorted by (type, neighbour), so with
+ * several relationship types they are not sets; these rows are what set
+ * intersection needs. In the undirected sets a self-loop is listed once and
+ * counts twice, as an out-edge and an in-edge.
+ */
+typedef struct {
+    int64_t *row_ptr;     /* Size: node_count + 1 */
+    int *col_idx;         /* Size: row_ptr[node_count]. Distinct neighbours, ascending */
+    int *multiplicity;    /* Size: row_ptr[node_count]. Edges to each neighbour */
+} csr_neighbour_sets;
+
+/* Changes recorded against a loaded graph, not yet merged (see graph_delta.c) */
+struct csr_delta;
+
+/* Graph shared between connections through the process-wide registry (see graph_registry.c) */
+struct csr_shared_graph;
+
+/* Internal node numbering (see graph_reorder.c) */
+typedef enum {
+    CSR_ORDER_ID = 0,     /* Ascending node ID, as loaded */
+    CSR_ORDER_DEGREE,     /* Descending total degree: hubs first */
+    CSR_ORDER_RCM         /* Reverse Cuthill-McKee: neighbours get nearby indices */
+} csr_node_order;
 
 /* CSR Graph representation for efficient algorithm execution */
 typedef struct csr_graph {
     int node_count;       /* Number of nodes */
-    int edge_count;       /* Number of edges */
+    int64_t edge_count;   /* Number of edges */
 
-    int *row_ptr;         /* Size: node_count + 1. row_ptr[i] = start of node i's edges in col_idx */
-    int *col_idx;         /* Size: edge_count. Target node IDs for each edge */
+    int64_t *row_ptr;     /* Size: node_count + 1. row_ptr[i] = start of node i's edges in col_idx */
+    int *col_idx;         /* Size: edge_count. Target node indices for each edge */
 
-    int *node_ids;        /* Size: node_count. Maps internal index -> original node ID (rowid) */
+    int64_t *node_ids;    /* Size: node_count. Maps internal index -> original node ID (rowid) */
     char **user_ids;      /* Size: node_count. Maps internal index -> user-defined 'id' property */
-    int *node_idx;        /* Hash table: original node ID -> internal index (for reverse lookup) */
-    int node_idx_size;    /* Size of node_idx hash table */
+    char *user_id_arena;  /* Interned user ID strings, NUL-terminated; user_ids point into it */
+    size_t user_id_arena_size;
+    csr_string_slot *user_id_index; /* Hash index: user ID -> internal index */
+    int user_id_index_capacity;     /* Number of slots (power of two) */
+    csr_node_map node_map; /* Original node ID -> internal index (for reverse lookup) */
 
     /* For algorithms needing incoming edges (like PageRank) */
-    int *in_row_ptr;      /* Size: node_count + 1. Incoming edge offsets */
-    int *in_col_idx;      /* Size: edge_count. Source node IDs for incoming edges */
+    int64_t *in_row_ptr;  /* Size: node_count + 1. Incoming edge offsets */
+    int *in_col_idx;      /* Size: edge_count. Source node indices for incoming edges */
+
+    /*
+     * Relationship types. Each adjacency row is sorted by (type, neighbour),
+     * so the edges of one type form a contiguous segment of the row.
+     */
+    int *edge_types;      /* Size: edge_count. Type ID of each out-edge (col_idx order), or NULL */
+    int *in_edge_types;   /* Size: edge_count. Type ID of each in-edge (in_col_idx order), or NULL */
+    char **type_names;    /* Size: type_count. Type ID -> relationship type, in name order */
+    int type_count;
+
+    int64_t *edge_ids;    /* Size: edge_count. Edge row ID of each out-edge (col_idx order), or NULL */
+
+    /*
+     * Coalesced parallel edges (see csr_graph_coalesce): one slot per
+     * distinct (source, type, target), holding the number of edges merged
+     * into it. edge_ids then has the lowest edge ID of each slot.
+     */
+    int *multiplicity;    /* Size: edge_count. Edges per out-edge slot, or NULL (not coalesced) */
+    int *in_multiplicity; /* Size: edge_count. Edges per in-edge slot, or NULL */
+
+    /*
+     * Compressed adjacency, replacing col_idx and in_col_idx (both NULL)
+     * when adj.bytes is set. row_ptr and in_row_ptr still number the edge
+     * slots that edge_types, edge_ids and weights are indexed by.
+     */
+    csr_adjacency adj;
+    csr_adjacency in_adj;
+    csr_weight_column *weights; /* Cached edge weights, one column per property */
+    int weight_count;
+
+    struct csr_graph *type_view; /* Last relationship-type filtered view (see csr_graph_type_view) */
+    char *type_view_key;
+    csr_neighbour_sets *undirected; /* Built on first use (see csr_graph_undirected), or NULL */
+    csr_neighbour_sets *out_sets;   /* Built on first use (see csr_graph_out_sets), or NULL */
+    bool borrowed_nodes;  /* Node arrays and indexes belong to another graph (views) */
+
+    /* Incremental maintenance */
+    struct csr_delta *delta; /* Pending node/edge changes, NULL when in sync */
+    sqlite3_int64 data_version; /* PRAGMA data_version when last synced with SQLite */
+
+    /* Snapshot file the arrays were mapped from (see graph_snapshot.c), or NULL */
+    void *snapshot;
+    size_t snapshot_size;
+
+    /*
+     * Registry entry whose arrays this graph borrows, or NULL. Shared arrays
+     * are read-only: merging changes gives the graph private arrays.
+     */
+    struct csr_shared_graph *shared;
+
+    /* Node order applied by csr_graph_reorder(), reapplied after merges and reloads */
+    csr_node_order order;
 } csr_graph;
 
 /* Graph algorithm result */
@@ -41,12 +180,422 @@ typedef struct {
 
 /* Graph loading */
 csr_graph* csr_graph_load(sqlite3 *db);
+
+/*
+ * Load the subgraph of nodes with any of the labels and edges of any of the
+ * types; a count of 0 means no filter. Edges to nodes outside the subgraph
+ * are dropped. NULL if no node matches.
+ */
+csr_graph* csr_graph_load_filtered(sqlite3 *db, char *const *labels, int label_count,
+                                   char *const *rel_types, int rel_type_count);
 void csr_graph_free(csr_graph *graph);
 
+/* Look up the internal index of an original node ID (-1 if not present) */
+int csr_graph_find_node(const csr_graph *graph, int64_t node_id);
+
+/* Look up the internal index of a user-defined 'id' property (-1 if not present) */
+int csr_graph_find_user_id(const csr_graph *graph, const char *user_id);
+
+/* Look up the type ID of a relationship type (-1 if no edge has it) */
+int csr_graph_find_type(const csr_graph *graph, const char *type);
+
+/* Out-edges of node with the given type ID: col_idx[*start .. *end) */
+void csr_graph_type_range(const csr_graph *graph, int node, int type_id, int64_t *start, int64_t *end);
+
+/*
+ * Graph restricted to edges of the given relationship types. Only the
+ * matching segment of each adjacency row is copied; node arrays are shared
+ * with the graph. The view is owned by the graph (the last one is kept for
+ * reuse) and must not be freed or outlive it. NULL on allocation failure.
+ */
+csr_graph* csr_graph_type_view(csr_graph *graph, char *const *types, int type_count);
+
+/*
+ * Undirected adjacency of the graph, for algorithms that ignore edge
+ * direction (graph_neighbour_sets.c). Built from both directions on first
+ * use and kept with the graph until it is freed. Owned by the graph. NULL
+ * on allocation failure.
+ */
+const csr_neighbour_sets* csr_graph_undirected(csr_graph *graph);
+
+/*
+ * Distinct out-neighbours of every node in ascending order, for set
+ * intersection (graph_neighbour_sets.c). Built and owned like
+ * csr_graph_undirected(). NULL on allocation failure.
+ */
+const csr_neighbour_sets* csr_graph_out_sets(csr_graph *graph);
+
+/*
+ * Sorted set intersection (graph_intersect.c). Both arrays ascending with
+ * no duplicates, as in csr_neighbour_sets rows. graph_intersect_count()
+ * picks a kernel per call: galloping search of the larger array when the
+ * sizes differ by GRAPH_GALLOP_RATIO or more (a hub against a leaf costs
+ * O(small * log large)), otherwise a SIMD block compare, or a plain merge
+ * for short rows and where the CPU has no SSE2 / AVX2. The kernels are
+ * exposed for tests and give identical counts.
+ */
+#define GRAPH_GALLOP_RATIO 32
+
+typedef enum {
+    GRAPH_SIMD_NONE = 0,
+    GRAPH_SIMD_SSE2,
+    GRAPH_SIMD_AVX2
+} graph_simd_level;
+
+/* Widest SIMD kernel this CPU runs, checked at runtime */
+graph_simd_level graph_simd_support(void);
+
+int64_t graph_intersect_count(const int *a, int64_t na, const int *b, int64_t nb);
+int64_t graph_intersect_merge(const int *a, int64_t na, const int *b, int64_t nb);
+int64_t graph_intersect_gallop(const int *a, int64_t na, const int *b, int64_t nb);
+
+/* Block compare at the given level, capped at graph_simd_support() */
+int64_t graph_intersect_simd(const int *a, int64_t na, const int *b, int64_t nb,
+                             graph_simd_level level);
+
+/* Jaccard coefficient of two nodes' rows in sets; 0 when either row is empty */
+double graph_jaccard(const csr_neighbour_sets *sets, int a, int b);
+
+/*
+ * Numeric edge property as a weight per out-edge, aligned to col_idx. Read
+ * from edge_props_real on first use and cached on the graph until it is
+ * reloaded or an edge property changes; edges without the property weigh
+ * 1.0. Owned by the graph. NULL on failure.
+ */
+const double* csr_graph_edge_weights(csr_graph *graph, sqlite3 *db, const char *property);
+
+/* Drop cached edge weights (edge properties changed) */
+void csr_graph_drop_weights(csr_graph *graph);
+
+/*
+ * Incremental maintenance (graph_delta.c)
+ *
+ * Writes made through the executor record node and edge additions and
+ * removals against the cached graph. The next algorithm call merges them
+ * into fresh CSR arrays in memory, without re-reading the graph tables.
+ * All record functions accept a NULL graph (nothing is cached).
+ */
+void csr_graph_record_node_added(csr_graph *graph, int64_t node_id);
+void csr_graph_record_node_removed(csr_graph *graph, int64_t node_id);
+void csr_graph_record_edge_added(csr_graph *graph, int64_t edge_id, int64_t source_id, int64_t target_id,
+                                 const char *type);
+void csr_graph_record_edge_removed(csr_graph *graph, int64_t edge_id);
+
+/* Edges removed along with a node by DETACH DELETE (already implied by the node removal) */
+void csr_graph_record_edges_detached(csr_graph *graph, int count);
+
+/* 'id' properties of existing nodes may have changed (SET, REMOVE, ...) */
+void csr_graph_record_user_ids_changed(csr_graph *graph);
+
+/*
+ * Row change on this connection, from sqlite3_update_hook(). Node rows are
+ * recorded directly; edge rows only have to be accounted for by the record
+ * functions above, otherwise the graph is reloaded. 'id' properties written
+ * outside the executor are reread on the next merge, and edge property
+ * writes drop the cached edge weights.
+ */
+void csr_graph_note_row_change(csr_graph *graph, int op, const char *table,
+                               sqlite3_int64 rowid, bool in_executor);
+
+/* Mark the graph as needing a full reload (changes could not be tracked) */
+void csr_graph_mark_stale(csr_graph *graph);
+
+/* Mark the graph stale if another connection has committed since it was loaded */
+void csr_graph_check_data_version(csr_graph *graph, sqlite3 *db);
+
+/* Number of recorded changes not yet merged (-1 if a full reload is pending) */
+int csr_graph_pending_changes(const csr_graph *graph);
+
+/* Merge pending changes into the graph in place; 0 on success, -1 on failure */
+int csr_graph_apply_delta(csr_graph *graph, sqlite3 *db);
+
+/* Bring the graph up to date with SQLite (data_version check, then merge); 0 on success */
+int csr_graph_sync(csr_graph *graph, sqlite3 *db);
+
+/*
+ * Compressed adjacency (graph_compress.c)
+ *
+ * Replaces col_idx and in_col_idx with varint-encoded neighbour gaps,
+ * typically one or two bytes per edge instead of four. Algorithms read rows
+ * through csr_edge_iter; a compressed graph stays compressed across merges
+ * and reloads. 0 on success (or already compressed), -1 on failure.
+ */
+int csr_graph_compress(csr_graph *graph);
+
+/* Bytes held by the adjacency: col_idx and in_col_idx, or the compressed streams */
+size_t csr_graph_adjacency_bytes(const csr_graph *graph);
+
+/*
+ * Parallel edge coalescing (graph_coalesce.c)
+ *
+ * Merges edges with the same source, type and target into one slot whose
+ * multiplicity counts them, in both directions. Algorithms that count
+ * edges (degrees, PageRank, eigenvector and betweenness centrality,
+ * Louvain, label propagation) weigh each slot by its multiplicity and give
+ * the same results; traversals and shortest paths visit each neighbour
+ * once, and cached weights hold the lightest of the merged edges. A
+ * coalesced graph stays coalesced across merges and reloads; removing one
+ * of its edges reloads it. 0 on success, -1 on failure (graph unchanged).
+ */
+int csr_graph_coalesce(csr_graph *graph);
+
+/* Number of edges the graph's slots stand for: edge_count unless coalesced */
+int64_t csr_graph_edge_total(const csr_graph *graph);
+
+/*
+ * Node reordering (graph_reorder.c)
+ *
+ * Renumbers internal indices so that nodes visited together sit close in
+ * memory, and rebuilds the CSR arrays, node_ids and user_ids to match.
+ * Pending changes, compression and the data version carry over; cached
+ * weights and type views are rebuilt on next use, and a shared graph gets
+ * private arrays. Algorithms that list every node return them in the new
+ * order. 0 on success, -1 on failure (the graph is left unchanged).
+ */
+int csr_graph_reorder(csr_graph *graph, csr_node_order order);
+
+/* Order for a name ("id", "degree", "rcm"); -1 if unknown */
+int csr_node_order_from_name(const char *name);
+
+/* Name of an order, as accepted by csr_node_order_from_name() */
+const char* csr_node_order_name(csr_node_order order);
+
+/* Mean |source - target| index distance over all edges: lower is more local */
+double csr_graph_edge_span(const csr_graph *graph);
+
+/*
+ * Node ID compaction (graph_compact_ids.c)
+ *
+ * Renumbers nodes 1..n in ID order and rewrites the node references in
+ * edges, node_labels and node_props_*, in one transaction (a savepoint
+ * inside an open one). Loads of the compacted tables get a dense node map.
+ * Sets *node_count and *renumbered (nodes whose ID changed); 0 on success,
+ * -1 with *error set (caller frees) on failure.
+ */
+int csr_compact_node_ids(sqlite3 *db, int64_t *node_count, int64_t *renumbered, char **error);
+
+/*
+ * Edge-list files (graph_edgelist.c)
+ *
+ * Builds a graph straight from an edge-list file, without the graph tables:
+ * format "text" (one "source target" pair per line; NULL means text) or
+ * "binary" (int64 pairs). Nodes get IDs 1..n in order of first appearance
+ * and the file's identifiers as user IDs; edges are untyped. NULL with
+ * *error set (caller frees) on failure.
+ */
+csr_graph* csr_graph_load_edgelist(const char *path, const char *format, char **error);
+
+/*
+ * Persistent snapshots (graph_snapshot.c)
+ *
+ * A snapshot stores the CSR arrays of a graph in a binary file, with a
+ * fingerprint of the graph tables taken when it was written. Opening it
+ * maps the file and uses the arrays in place, provided the fingerprint
+ * still matches the database.
+ */
+
+/* Default snapshot file: "<database file>-csr". NULL for in-memory/temporary databases (caller frees) */
+char* csr_graph_snapshot_path(sqlite3 *db);
+
+/* Write graph to path; 0 on success, -1 with *error set (caller frees) on failure */
+int csr_graph_save_snapshot(const csr_graph *graph, sqlite3 *db, const char *path,
+                            sqlite3_int64 *bytes_written, char **error);
+
+/* Map a snapshot; NULL if it is missing, unreadable or no longer matches the database */
+csr_graph* csr_graph_open_snapshot(sqlite3 *db, const char *path);
+
+/*
+ * Process-wide graph registry (graph_registry.c)
+ *
+ * Connections to the same database file share one read-only copy of the
+ * graph arrays, keyed by file, write generation and graph fingerprint. Each connection gets
+ * its own csr_graph holding a reference (freed with csr_graph_free), so
+ * per-connection state such as pending changes stays separate.
+ */
+
+/*
+ * Graph for db from the registry, loading it (from the snapshot at
+ * snapshot_path if that still matches, otherwise from SQLite) if no
+ * connection has it yet. In-memory databases and connections inside a
+ * transaction get a private graph. *source is set to "shared", "snapshot"
+ * or "sqlite" when source is not NULL. NULL for an empty graph.
+ */
+csr_graph* csr_graph_acquire(sqlite3 *db, const char *snapshot_path, const char **source);
+
+/*
+ * db wrote to its database file (update, commit and rollback hooks): graphs
+ * registered for the file are no longer shared. Once is enough for each
+ * transaction, plus once when it ends.
+ */
+void csr_graph_note_write(sqlite3 *db);
+
+/* Number of connections sharing the graph's arrays (0 if it is private) */
+int csr_graph_share_count(const csr_graph *graph);
+
+/*
+ * Memory accounting (graph_memory.c)
+ *
+ * Bytes held by a graph, per component. shared and mapped are the parts of
+ * total borrowed from the registry and inside a mapped snapshot file.
+ */
+typedef struct {
+    size_t adjacency;     /* Row offsets and neighbour lists (plain or compressed), both directions */
+    size_t edge_types;    /* Edge type IDs and type names */
+    size_t edge_ids;
+    size_t node_index;    /* Node IDs and the node ID -> index map */
+    size_t user_ids;      /* User 'id' strings and their index */
+    size_t weights;       /* Cached edge weight columns */
+    size_t type_view;     /* Cached relationship-type view */
+    size_t undirected;    /* Cached undirected adjacency */
+    size_t out_sets;      /* Cached sorted out-neighbour sets */
+    size_t delta;         /* Pending changes */
+    size_t total;
+    size_t shared;
+    size_t mapped;
+} csr_graph_memory_usage;
+
+void csr_graph_memory(const csr_graph *graph, csr_graph_memory_usage *usage);
+
+/* Bytes to charge a graph against the budget: its own plus its share of registry arrays */
+size_t csr_graph_memory_charge(const csr_graph *graph);
+
+/*
+ * Cache budget and LRU eviction. Every cached graph and projection is an
+ * entry on one process-wide list; when the charged total exceeds the budget,
+ * csr_cache_enforce() evicts entries from the least recently used end. The
+ * owner of an entry embeds it and supplies evict, which frees the cached
+ * graph; evict runs with the cache lock held and must not call back into
+ * the csr_cache_* functions.
+ */
+typedef struct csr_cache_entry {
+    sqlite3 *db;          /* Owning connection */
+    size_t bytes;         /* Charged size */
+    bool tracked;         /* On the LRU list */
+    void (*evict)(struct csr_cache_entry *entry);
+    struct csr_cache_entry *prev;
+    struct csr_cache_entry *next;
+} csr_cache_entry;
+
+typedef struct {
+    size_t budget;        /* 0 = unlimited */
+    size_t used;
+    int entries;
+    int64_t evictions;
+} csr_cache_stats;
+
+void csr_cache_entry_init(csr_cache_entry *entry, sqlite3 *db, void (*evict)(csr_cache_entry *entry));
+
+/* Mark the entry most recently used and set its size, adding it to the list if needed */
+void csr_cache_touch(csr_cache_entry *entry, size_t bytes);
+
+/* Update the size of a listed entry without changing its place */
+void csr_cache_resize(csr_cache_entry *entry, size_t bytes);
+
+/* Take the entry off the list (before its graph is freed) */
+void csr_cache_forget(csr_cache_entry *entry);
+
+/*
+ * Evict least recently used entries, other than keep, until the budget is
+ * met. Called from db's thread; other connections' entries are skipped
+ * while they are busy. Returns the number evicted.
+ */
+int csr_cache_enforce(sqlite3 *db, const csr_cache_entry *keep);
+
+void csr_cache_set_budget(size_t bytes);
+void csr_cache_get_stats(csr_cache_stats *stats);
+
+/*
+ * Named graph projections (graph_projection.c)
+ *
+ * A projection is the subgraph of nodes with any of its labels and edges of
+ * any of its types (no labels or types = all), loaded from SQLite and kept
+ * by name on a connection. Algorithm calls select one with {graph: 'name'}.
+ * Writes to the graph tables mark projections stale, and the memory budget
+ * may evict their graphs; either way the graph is rebuilt on next use.
+ * A projection can also hold an edge-list file instead of a subgraph.
+ */
+typedef struct csr_projection {
+    char *name;
+    char **labels;
+    int label_count;
+    char **types;
+    int type_count;
+    char *weight_property;      /* Default weight for weighted algorithms (NULL = unweighted) */
+    char *edgelist_path;        /* Edge-list file the graph is read from instead of SQLite, or NULL */
+    char *edgelist_format;
+    csr_graph *graph;           /* Loaded subgraph (node_count 0 if nothing matches), NULL once evicted */
+    bool stale;
+    csr_cache_entry cache;      /* Place in the memory budget's LRU list */
+    struct csr_projection *next;
+} csr_projection;
+
+/* Build a projection and load its subgraph; NULL on failure */
+csr_projection* csr_projection_create(sqlite3 *db, const char *name,
+                                      char *const *labels, int label_count,
+                                      char *const *types, int type_count,
+                                      const char *weight_property);
+
+/*
+ * Projection of an edge-list file (see csr_graph_load_edgelist). Writes to
+ * the database leave it alone; after eviction the file is read again. NULL
+ * with *error set (caller frees) on failure.
+ */
+csr_projection* csr_projection_load_edgelist(sqlite3 *db, const char *name, const char *path,
+                                             const char *format, char **error);
+
+/* Add a projection to a list, replacing (and freeing) one with the same name */
+void csr_projection_add(csr_projection **list, csr_projection *projection);
+
+/* Remove and free the named projection; false if there is none */
+bool csr_projection_drop(csr_projection **list, const char *name);
+
+void csr_projection_free_all(csr_projection *list);
+csr_projection* csr_projection_find(csr_projection *list, const char *name);
+
+/* The projection's subgraph, rebuilt first if stale; NULL on failure */
+csr_graph* csr_projection_graph(csr_projection *projection, sqlite3 *db);
+
+/* A row of table was written on the connection (update hook) */
+void csr_projections_note_row_change(csr_projection *list, const char *table);
+
+/* Rebuild every projection on next use (rollback) */
+void csr_projections_mark_stale(csr_projection *list);
+
+/* Recharge the projections' sizes to the memory budget (weights are cached as queries run) */
+void csr_projections_update_memory(csr_projection *list);
+
+/*
+ * gql_graph_stats() report (graph_memory.c): the memory budget, then bytes
+ * per component of the connection's cached graph (or null) and of each
+ * projection. Caller frees; NULL on allocation failure.
+ */
+char* csr_graph_stats_json(const csr_graph *cached_graph, const csr_projection *projections);
+
+/*
+ * Names from a SQL argument: a JSON array of strings, or a single name.
+ * NULL gives no names. 0 on success, -1 on failure; the caller frees each
+ * name and the array.
+ */
+int csr_parse_name_list(sqlite3 *db, const char *text, char ***names, int *count);
+
+/*
+ * Worker threads (graph_parallel.c)
+ *
+ * Graph builds split their edge passes across this many threads. The count
+ * is process-wide and defaults to the number of online processors; setting
+ * 0 restores the default and 1 disables threading.
+ */
+int graph_thread_count(void);
+void graph_set_thread_count(int threads);
+
+/* Node map probe statistics (average and maximum probe length for lookups of present keys) */
+void csr_graph_probe_stats(const csr_graph *graph, double *avg_probe, int *max_probe);
+
 /* Algorithm detection - check if a RETURN clause contains a graph algorithm function */
 typedef enum {
     GRAPH_ALGO_NONE = 0,
     GRAPH_ALGO_PAGERANK,
+    GRAPH_ALGO_PERSONALIZED_PAGERANK,
     GRAPH_ALGO_LABEL_PROPAGATION,
     GRAPH_ALGO_DIJKSTRA,
     GRAPH_ALGO_DEGREE_CENTRALITY,
@@ -54,6 +603,9 @@ typedef enum {
     GRAPH_ALGO_SCC,
     GRAPH_ALGO_BETWEENNESS_CENTRALITY,
     GRAPH_ALGO_CLOSENESS_CENTRALITY,
+    GRAPH_ALGO_HARMONIC_CENTRALITY,
+    GRAPH_ALGO_ECCENTRICITY,
+    GRAPH_ALGO_DIAMETER,
     GRAPH_ALGO_LOUVAIN,
     GRAPH_ALGO_TRIANGLE_COUNT,
     GRAPH_ALGO_ASTAR,
@@ -69,34 +621,56 @@ typedef struct {
     graph_algo_type type;
     double damping;       /* For PageRank (default 0.85) */
     int iterations;       /* Number of iterations */
+    double tolerance;     /* For PageRank - stop once the L1 rank change is below this (default 1e-6) */
+    bool report_iterations; /* For PageRank - add the iterations run to every row */
     int top_k;            /* For topPageRank - return top k nodes (0 = all) */
+    char *seeds;          /* For personalizedPageRank - seed nodes as a JSON array */
+    double epsilon;       /* For personalizedPageRank - push threshold per out-edge (default 1e-6) */
     char *source_id;      /* For Dijkstra - source node user ID */
     char *target_id;      /* For Dijkstra - target node user ID */
-    char *weight_prop;    /* For Dijkstra - optional edge weight property */
+    char *weight_prop;    /* For Dijkstra, A* and APSP - optional edge weight property */
     double resolution;    /* For Louvain - resolution parameter (default 1.0) */
     char *lat_prop;       /* For A* - latitude/y property name */
     char *lon_prop;       /* For A* - longitude/x property name */
     int max_depth;        /* For BFS/DFS - max traversal depth (-1 = unlimited) */
     double threshold;     /* For Node Similarity - minimum similarity threshold (default 0.0) */
     int k;                /* For KNN - number of neighbors to return */
+    int samples;          /* For betweenness/diameter - sampled source count (0 = every source, exact) */
+    int64_t seed;         /* For betweenness/diameter - random seed for the sampled sources */
+    bool wasserman_faust; /* For closeness - Wasserman-Faust instead of harmonic scores */
+    char **rel_types;     /* Options map relationshipTypes: only follow these edge types (NULL = all) */
+    int rel_type_count;
+    char *graph_name;     /* Options map graph: run on this named projection (NULL = cached graph) */
 } graph_algo_params;
 
-/* Check if RETURN clause contains a graph algorithm call and extract parameters */
+/*
+ * Check if RETURN clause contains a graph algorithm call and extract parameters.
+ * A trailing map argument holds options, e.g. pageRank(0.85, 20, {relationshipTypes: ['KNOWS']}).
+ */
 graph_algo_params detect_graph_algorithm(cypher_return *return_clause);
 
+/* Free the strings owned by algorithm parameters */
+void graph_algo_params_free(graph_algo_params *params);
+
 /* Algorithm implementations
  * All algorithms accept an optional cached CSR graph parameter.
  * If cached is non-NULL, uses it directly (fast path).
  * If cached is NULL, loads graph from SQLite (original behavior).
  */
-graph_algo_result* execute_pagerank(sqlite3 *db, csr_graph *cached, double damping, int iterations, int top_k);
+graph_algo_result* execute_pagerank(sqlite3 *db, csr_graph *cached, double damping, int iterations,
+                                    double tolerance, int top_k, bool report_iterations);
+graph_algo_result* execute_personalized_pagerank(sqlite3 *db, csr_graph *cached, const char *seeds,
+                                                 double damping, double epsilon, int top_k);
 graph_algo_result* execute_label_propagation(sqlite3 *db, csr_graph *cached, int iterations);
 graph_algo_result* execute_dijkstra(sqlite3 *db, csr_graph *cached, const char *source_id, const char *target_id, const char *weight_prop);
 graph_algo_result* execute_degree_centrality(sqlite3 *db, csr_graph *cached);
 graph_algo_result* execute_wcc(sqlite3 *db, csr_graph *cached);
 graph_algo_result* execute_scc(sqlite3 *db, csr_graph *cached);
-graph_algo_result* execute_betweenness_centrality(sqlite3 *db, csr_graph *cached);
-graph_algo_result* execute_closeness_centrality(sqlite3 *db, csr_graph *cached);
+graph_algo_result* execute_betweenness_centrality(sqlite3 *db, csr_graph *cached, int samples, int64_t seed);
+graph_algo_result* execute_closeness_centrality(sqlite3 *db, csr_graph *cached, bool wasserman_faust);
+graph_algo_result* execute_harmonic_centrality(sqlite3 *db, csr_graph *cached);
+graph_algo_result* execute_eccentricity(sqlite3 *db, csr_graph *cached);
+graph_algo_result* execute_diameter(sqlite3 *db, csr_graph *cached, int samples, int64_t seed);
 graph_algo_result* execute_louvain(sqlite3 *db, csr_graph *cached, double resolution);
 graph_algo_result* execute_triangle_count(sqlite3 *db, csr_graph *cached);
 graph_algo_result* execute_astar(sqlite3 *db, csr_graph *cached, const char *source_id, const char *target_id,
@@ -106,7 +680,7 @@ graph_algo_result* execute_dfs(sqlite3 *db, csr_graph *cached, const char *start
 graph_algo_result* execute_node_similarity(sqlite3 *db, csr_graph *cached, const char *node1_id, const char *node2_id, double threshold, int top_k);
 graph_algo_result* execute_knn(sqlite3 *db, csr_graph *cached, const char *node_id, int k);
 graph_algo_result* execute_eigenvector_centrality(sqlite3 *db, csr_graph *cached, int iterations);
-graph_algo_result* execute_apsp(sqlite3 *db, csr_graph *cached);
+graph_algo_result* execute_apsp(sqlite3 *db, csr_graph *cached, const char *weight_prop);
 
 /* Result management */
 void graph_algo_result_free(graph_algo_result *result);
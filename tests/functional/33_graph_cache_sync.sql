@@ -0,0 +1,58 @@
+-- ========================================================================
+-- Test 33: Graph Cache Synchronization
+-- ========================================================================
+-- PURPOSE: Cached graph follows writes without gql_reload_graph()
+-- COVERS:  Cypher writes, plain SQL writes, rolled back transactions
+-- ========================================================================
+
+.load ./build/graphqlite
+
+SELECT '=== Test 33: Graph Cache Synchronization ===' as test_section;
+
+SELECT cypher('CREATE (:City {id: "a"})-[:ROAD]->(:City {id: "b"})') as setup;
+SELECT gql_load_graph() as load;
+
+-- =======================================================================
+-- Cypher writes are merged into the cache
+-- =======================================================================
+SELECT '=== Cypher writes ===' as section;
+
+SELECT cypher('MATCH (b:City {id: "b"}) CREATE (b)-[:ROAD]->(:City {id: "c"})') as write;
+SELECT json_extract(gql_graph_loaded(), '$.pending_changes') as pending_changes;
+SELECT cypher('RETURN degreeCentrality()') as degrees;
+SELECT json_extract(gql_graph_loaded(), '$.nodes') as nodes_expect_3,
+       json_extract(gql_graph_loaded(), '$.edges') as edges_expect_2;
+
+-- =======================================================================
+-- Plain SQL writes are seen by the update hook
+-- =======================================================================
+SELECT '=== Plain SQL writes ===' as section;
+
+INSERT INTO edges (source_id, target_id, type) VALUES (3, 1, 'ROAD');
+SELECT json_extract(gql_graph_loaded(), '$.pending_changes') as pending_expect_reload;
+SELECT cypher('RETURN degreeCentrality()') as degrees;
+SELECT json_extract(gql_graph_loaded(), '$.edges') as edges_expect_3;
+
+-- =======================================================================
+-- Rolled back writes do not survive in the cache
+-- =======================================================================
+SELECT '=== Rollback ===' as section;
+
+BEGIN;
+SELECT cypher('CREATE (:City {id: "d"})') as write;
+ROLLBACK;
+SELECT cypher('RETURN degreeCentrality()') as degrees;
+SELECT json_extract(gql_graph_loaded(), '$.nodes') as nodes_expect_3;
+
+-- =======================================================================
+-- Writes the update hook does not report are caught by the change count
+-- =======================================================================
+SELECT '=== Unreported writes ===' as section;
+
+-- DELETE without WHERE takes SQLite's truncate path, which skips the hook
+DELETE FROM edges;
+SELECT json_extract(gql_graph_loaded(), '$.pending_changes') as pending_expect_reload;
+SELECT cypher('RETURN degreeCentrality()') as degrees;
+SELECT json_extract(gql_graph_loaded(), '$.edges') as edges_expect_0;
+
+SELECT gql_unload_graph() as unload;
@@ -0,0 +1,34 @@
+-- ========================================================================
+-- Test 34: Relationship Type Filter
+-- ========================================================================
+-- PURPOSE: Graph algorithms restricted to selected relationship types
+-- COVERS:  relationshipTypes option, cached and uncached graphs, writes
+-- ========================================================================
+
+.load ./build/graphqlite
+
+SELECT '=== Test 34: Relationship Type Filter ===' as test_section;
+
+SELECT cypher('CREATE (a:Person {id: "alice"})-[:KNOWS]->(b:Person {id: "bob"}), (b)-[:KNOWS]->(c:Person {id: "carol"}), (a)-[:WORKS_WITH]->(c), (c)-[:WORKS_WITH]->(a)') as setup;
+
+-- =======================================================================
+-- Without a cached graph
+-- =======================================================================
+SELECT '=== Uncached ===' as section;
+
+SELECT cypher('RETURN degreeCentrality({relationshipTypes: ["KNOWS"]})') as knows_degrees;
+SELECT cypher('RETURN wcc({relationshipTypes: "WORKS_WITH"})') as works_with_components;
+SELECT cypher('RETURN pageRank(0.85, 20, {relationshipTypes: ["KNOWS", "WORKS_WITH"]})') as all_types;
+
+-- =======================================================================
+-- With a cached graph, including writes merged into the cache
+-- =======================================================================
+SELECT '=== Cached ===' as section;
+
+SELECT gql_load_graph() as load;
+SELECT cypher('RETURN degreeCentrality({relationshipTypes: ["KNOWS"]})') as knows_degrees;
+SELECT cypher('MATCH (c:Person {id: "carol"}), (a:Person {id: "alice"}) CREATE (c)-[:KNOWS]->(a)') as write;
+SELECT cypher('RETURN degreeCentrality({relationshipTypes: ["KNOWS"]})') as knows_degrees_after_write;
+SELECT cypher('RETURN degreeCentrality({relationshipTypes: ["MISSING"]})') as no_edges;
+
+SELECT gql_unload_graph() as unload;
@@ -0,0 +1,51 @@
+-- ========================================================================
+-- Test 35: Graph Projections
+-- ========================================================================
+-- PURPOSE: Graph algorithms on named subgraphs from gql_project_graph()
+-- COVERS:  label and type filters, weight default, writes, rollback, drop
+-- ========================================================================
+
+.load ./build/graphqlite
+
+SELECT '=== Test 35: Graph Projections ===' as test_section;
+
+SELECT cypher('CREATE (a:Person {id: "alice"})-[:KNOWS {w: 4.0}]->(b:Person {id: "bob"}), (a)-[:KNOWS {w: 1.0}]->(c:Person {id: "carol"}), (c)-[:KNOWS {w: 1.0}]->(b), (a)-[:WORKS_AT]->(x:Company {id: "acme"}), (x)-[:EMPLOYS]->(b)') as setup;
+
+-- =======================================================================
+-- Projections by label, by type, and both
+-- =======================================================================
+SELECT '=== Project ===' as section;
+
+SELECT gql_project_graph('people', 'Person') as people;
+SELECT gql_project_graph('work', NULL, '["WORKS_AT", "EMPLOYS"]') as work;
+SELECT gql_project_graph('social', '["Person"]', 'KNOWS', 'w') as social;
+
+SELECT cypher('RETURN degreeCentrality({graph: "people"})') as people_degrees;
+SELECT cypher('RETURN wcc({graph: "work"})') as work_components;
+SELECT cypher('RETURN pageRank({graph: "social"})') as social_pagerank;
+
+-- The projection's weight property applies when none is given
+SELECT cypher('RETURN dijkstra("alice", "bob", {graph: "social"})') as weighted_path;
+
+-- =======================================================================
+-- Writes and rollbacks rebuild projections on next use
+-- =======================================================================
+SELECT '=== Writes ===' as section;
+
+SELECT cypher('CREATE (:Person {id: "dave"})-[:KNOWS {w: 0.5}]->(:Person {id: "erin"})') as write;
+SELECT cypher('RETURN wcc({graph: "social"})') as social_after_write;
+
+BEGIN;
+SELECT cypher('MATCH (d:Person {id: "dave"}) DETACH DELETE d') as delete_in_tx;
+ROLLBACK;
+SELECT cypher('RETURN degreeCentrality({graph: "people"})') as people_after_rollback;
+
+-- =======================================================================
+-- Replace and drop
+-- =======================================================================
+SELECT '=== Drop ===' as section;
+
+SELECT gql_project_graph('people', 'Company') as replaced;
+SELECT cypher('RETURN degreeCentrality({graph: "people"})') as companies;
+SELECT gql_drop_projection('people') as dropped;
+SELECT gql_drop_projection('people') as not_found;
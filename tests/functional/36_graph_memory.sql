@@ -0,0 +1,40 @@
+-- ========================================================================
+-- Test 36: Graph Memory Budget
+-- ========================================================================
+-- PURPOSE: Memory accounting and LRU eviction of cached graphs
+-- COVERS:  gql_graph_stats, gql_graph_memory_limit, eviction and reload
+-- ========================================================================
+
+.load ./build/graphqlite
+
+SELECT '=== Test 36: Graph Memory Budget ===' as test_section;
+
+SELECT cypher('CREATE (a:Person {id: "alice"})-[:KNOWS {w: 2.0}]->(b:Person {id: "bob"}), (b)-[:KNOWS {w: 1.0}]->(c:Person {id: "carol"}), (c)-[:KNOWS]->(a)') as setup;
+
+-- =======================================================================
+-- Accounting
+-- =======================================================================
+SELECT '=== Stats ===' as section;
+
+SELECT gql_graph_stats() as nothing_cached;
+SELECT gql_load_graph() as load;
+SELECT gql_project_graph('people', 'Person', NULL, 'w') as project;
+SELECT json_extract(gql_graph_stats(), '$.graph.total') > 0 as graph_counted;
+SELECT json_extract(gql_graph_stats(), '$.projections[0].weights') > 0 as weights_counted;
+SELECT json_extract(gql_graph_memory_limit(), '$.used') > 0 as usage_tracked;
+
+-- =======================================================================
+-- Eviction
+-- =======================================================================
+SELECT '=== Evict ===' as section;
+
+SELECT json_extract(gql_graph_memory_limit(1), '$.evictions') >= 2 as evicted;
+SELECT gql_graph_loaded() as graph_after_eviction;
+SELECT json_extract(gql_graph_stats(), '$.projections[0].loaded') as projection_loaded;
+
+-- An evicted projection is rebuilt when used
+SELECT cypher('RETURN degreeCentrality({graph: "people"})') as rebuilt;
+
+SELECT gql_graph_memory_limit(0) as unlimited;
+SELECT gql_load_graph() as reload;
+SELECT json_extract(gql_graph_stats(), '$.graph.nodes') as nodes;
@@ -0,0 +1,47 @@
+-- ========================================================================
+-- Test 37: Node Reordering
+-- ========================================================================
+-- PURPOSE: Algorithms on a cached graph renumbered by gql_reorder_graph()
+-- COVERS:  rcm, degree and id orders, merges, reload, compression
+-- ========================================================================
+
+.load ./build/graphqlite
+
+SELECT '=== Test 37: Node Reordering ===' as test_section;
+
+SELECT cypher('CREATE (a:Person {id: "alice"})-[:KNOWS]->(b:Person {id: "bob"}), (b)-[:KNOWS]->(c:Person {id: "carol"}), (c)-[:KNOWS]->(d:Person {id: "dave"}), (d)-[:KNOWS]->(a), (e:Person {id: "erin"})-[:KNOWS]->(a), (e)-[:KNOWS]->(c)') as setup;
+
+-- =======================================================================
+-- Reorder and run algorithms
+-- =======================================================================
+SELECT '=== Reorder ===' as section;
+
+SELECT gql_reorder_graph() as rcm;
+SELECT gql_graph_loaded() as loaded;
+SELECT cypher('RETURN pageRank()') as pagerank_rcm;
+SELECT cypher('RETURN bfs("alice")') as bfs_rcm;
+
+SELECT gql_reorder_graph('degree') as degree;
+SELECT cypher('RETURN degreeCentrality()') as degrees;
+SELECT cypher('RETURN dijkstra("erin", "dave")') as path;
+
+-- =======================================================================
+-- Writes merge into the reordered graph; reload keeps the order
+-- =======================================================================
+SELECT '=== Writes ===' as section;
+
+SELECT cypher('CREATE (:Person {id: "frank"})-[:KNOWS]->(:Person {id: "grace"})') as write;
+SELECT cypher('RETURN wcc()') as components;
+SELECT gql_reload_graph() as reloaded;
+SELECT gql_graph_loaded() as loaded_after_reload;
+
+-- =======================================================================
+-- Compressed graphs and back to node ID order
+-- =======================================================================
+SELECT '=== Compressed ===' as section;
+
+SELECT gql_compress_graph() as compressed;
+SELECT gql_reorder_graph('rcm') as rcm_compressed;
+SELECT cypher('RETURN labelPropagation()') as communities;
+SELECT gql_reorder_graph('id') as id_order;
+SELECT gql_graph_loaded() as loaded_id_order;
@@ -0,0 +1,59 @@
+-- ========================================================================
+-- Test 38: Node ID Compaction
+-- ========================================================================
+-- PURPOSE: gql_compact_ids() renumbers nodes 1..n so the cached graph
+--          maps node IDs to indexes directly (dense_ids)
+-- COVERS:  gaps from deletes, labels/properties/edges follow the new IDs,
+--          cache invalidation, new nodes after compaction
+-- ========================================================================
+
+.load ./build/graphqlite
+
+PRAGMA foreign_keys = ON;
+
+SELECT '=== Test 38: Node ID Compaction ===' as test_section;
+
+SELECT cypher('CREATE (a:Person {id: "alice", age: 30})-[:KNOWS]->(b:Person {id: "bob", age: 25}), (b)-[:KNOWS]->(c:Person {id: "carol", age: 41}), (c)-[:KNOWS]->(d:Person {id: "dave", age: 35}), (d)-[:KNOWS]->(a), (e:Person {id: "erin", age: 28})-[:KNOWS]->(a), (e)-[:KNOWS]->(c)') as setup;
+SELECT cypher('CREATE (:Temp {id: "x1"}), (:Temp {id: "x2"})') as temps;
+SELECT cypher('CREATE (f:Person {id: "frank"})-[:KNOWS]->(g:Person {id: "grace"})') as more;
+
+-- =======================================================================
+-- Gaps: the cached graph needs a hash lookup
+-- =======================================================================
+SELECT '=== Gaps ===' as section;
+
+SELECT cypher('MATCH (t:Temp) DELETE t') as delete_temps;
+SELECT cypher('MATCH (p:Person {id: "bob"}) DETACH DELETE p') as delete_bob;
+SELECT group_concat(id) as ids_before FROM nodes;
+SELECT gql_load_graph() as loaded;
+SELECT json_extract(gql_graph_loaded(), '$.dense_ids') as dense_before;
+SELECT cypher('RETURN pageRank()') as pagerank_before;
+
+-- =======================================================================
+-- Compact: IDs 1..n, everything keyed by node follows
+-- =======================================================================
+SELECT '=== Compact ===' as section;
+
+SELECT gql_compact_ids() as compacted;
+SELECT group_concat(id) as ids_after FROM nodes;
+SELECT cypher('MATCH (a:Person)-[:KNOWS]->(b:Person) RETURN id(a), a.id, a.age, id(b), b.id ORDER BY id(a), id(b)') as edges_after;
+SELECT count(*) as fk_violations FROM pragma_foreign_key_check;
+
+-- The stale cached graph reloads with a dense map
+SELECT cypher('RETURN pageRank()') as pagerank_after;
+SELECT json_extract(gql_graph_loaded(), '$.dense_ids') as dense_after;
+SELECT cypher('RETURN dijkstra("erin", "dave")') as path;
+
+-- Already compact: nothing to renumber
+SELECT gql_compact_ids() as compacted_again;
+
+-- =======================================================================
+-- New nodes continue the sequence and keep the map dense
+-- =======================================================================
+SELECT '=== New nodes ===' as section;
+
+SELECT cypher('CREATE (:Person {id: "heidi"})-[:KNOWS]->(:Person {id: "ivan"})') as write;
+SELECT group_concat(id) as ids_new FROM nodes;
+SELECT cypher('RETURN wcc()') as components;
+SELECT gql_reload_graph() as reloaded;
+SELECT json_extract(gql_graph_loaded(), '$.dense_ids') as dense_new;
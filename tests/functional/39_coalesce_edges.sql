@@ -0,0 +1,55 @@
+-- ========================================================================
+-- Test 39: Parallel Edge Coalescing
+-- ========================================================================
+-- PURPOSE: gql_coalesce_graph() merges repeated (source, type, target)
+--          edges of the cached graph into one entry with a multiplicity
+-- COVERS:  edge-count algorithms unchanged, lightest weight for paths,
+--          merged writes, reload, compression
+-- ========================================================================
+
+.load ./build/graphqlite
+
+SELECT '=== Test 39: Parallel Edge Coalescing ===' as test_section;
+
+SELECT cypher('CREATE (a:Person {id: "alice"}), (b:Person {id: "bob"}), (c:Person {id: "carol"}), (d:Person {id: "dave"})') as setup;
+SELECT cypher('MATCH (a {id: "alice"}), (b {id: "bob"}) CREATE (a)-[:CALLS {cost: 5.0}]->(b), (a)-[:CALLS {cost: 2.0}]->(b), (a)-[:CALLS {cost: 9.0}]->(b)') as calls_ab;
+SELECT cypher('MATCH (b {id: "bob"}), (c {id: "carol"}) CREATE (b)-[:CALLS {cost: 1.0}]->(c), (b)-[:CALLS {cost: 4.0}]->(c)') as calls_bc;
+SELECT cypher('MATCH (a {id: "alice"}), (c {id: "carol"}), (d {id: "dave"}) CREATE (a)-[:CALLS {cost: 4.0}]->(c), (c)-[:CALLS {cost: 1.0}]->(d), (d)-[:MAILS {cost: 1.0}]->(a)') as more;
+
+-- =======================================================================
+-- Before: one entry per edge
+-- =======================================================================
+SELECT '=== Plain ===' as section;
+
+SELECT cypher('RETURN degreeCentrality()') as degrees_plain;
+SELECT cypher('RETURN pageRank()') as pagerank_plain;
+SELECT cypher('RETURN dijkstra("alice", "dave", "cost")') as path_plain;
+
+-- =======================================================================
+-- Coalesce: fewer entries, same results
+-- =======================================================================
+SELECT '=== Coalesce ===' as section;
+
+SELECT gql_coalesce_graph() as coalesced;
+SELECT json_extract(gql_graph_loaded(), '$.coalesced') as is_coalesced;
+SELECT json_extract(gql_graph_loaded(), '$.edges') as edges;
+SELECT cypher('RETURN degreeCentrality()') as degrees_coalesced;
+SELECT cypher('RETURN pageRank()') as pagerank_coalesced;
+SELECT cypher('RETURN betweennessCentrality()') as betweenness;
+SELECT cypher('RETURN dijkstra("alice", "dave", "cost")') as path_coalesced;
+
+-- =======================================================================
+-- Writes fold into existing entries; removals reload, still coalesced
+-- =======================================================================
+SELECT '=== Writes ===' as section;
+
+SELECT cypher('MATCH (a {id: "alice"}), (b {id: "bob"}) CREATE (a)-[:CALLS {cost: 7.0}]->(b)') as write;
+SELECT cypher('RETURN degreeCentrality()') as degrees_after_write;
+SELECT cypher('MATCH ({id: "bob"})-[r:CALLS]->({id: "carol"}) DELETE r') as remove;
+SELECT cypher('RETURN degreeCentrality()') as degrees_after_remove;
+SELECT json_extract(gql_graph_loaded(), '$.coalesced') as still_coalesced;
+
+SELECT gql_reload_graph() as reloaded;
+SELECT gql_compress_graph() as compressed;
+SELECT gql_graph_loaded() as loaded;
+SELECT cypher('RETURN pageRank()') as pagerank_compressed;
@@ -0,0 +1,61 @@
+-- ========================================================================
+-- Test 40: Edge-List Files
+-- ========================================================================
+-- PURPOSE: gql_load_edgelist() reads an edge-list file straight into a
+--          projection, so algorithms run on it without the graph tables
+-- COVERS:  text format (comments, separators, extra columns), binary
+--          format, {graph: name}, no database writes, drop
+-- ========================================================================
+
+.load ./build/graphqlite
+
+SELECT '=== Test 40: Edge-List Files ===' as test_section;
+
+SELECT writefile('/tmp/graphqlite_40_edges.txt',
+    '# from to weight' || char(10) ||
+    'alice bob 1.0' || char(10) ||
+    'bob carol 2.0' || char(10) ||
+    'carol alice 1.5' || char(10) ||
+    char(10) ||
+    'dave,erin' || char(10) ||
+    'erin' || char(9) || 'dave' || char(13) || char(10) ||
+    '% trailing comment' || char(10) ||
+    'frank alice') as written;
+
+-- =======================================================================
+-- Text format
+-- =======================================================================
+SELECT '=== Text ===' as section;
+
+SELECT gql_load_edgelist('/tmp/graphqlite_40_edges.txt', 'text', 'calls') as loaded;
+SELECT cypher('RETURN pageRank({graph: "calls"})') as pagerank;
+SELECT cypher('RETURN wcc({graph: "calls"})') as components;
+SELECT cypher('RETURN louvain({graph: "calls"})') as communities;
+SELECT cypher('RETURN bfs("frank", {graph: "calls"})') as reachable;
+
+-- Nothing was written to the graph tables
+SELECT count(*) as nodes_in_db FROM nodes;
+SELECT count(*) as edges_in_db FROM edges;
+
+-- Writes to the database do not touch the loaded file
+SELECT cypher('CREATE (:Person {id: "zed"})-[:KNOWS]->(:Person {id: "alice"})') as write;
+SELECT cypher('RETURN degreeCentrality({graph: "calls"})') as degrees_after_write;
+
+-- =======================================================================
+-- Binary format: int64 pairs (1 -> 2, 2 -> 3), little-endian as on the test hosts
+-- =======================================================================
+SELECT '=== Binary ===' as section;
+
+SELECT writefile('/tmp/graphqlite_40_edges.bin',
+    unhex('0100000000000000' || '0200000000000000' || '0200000000000000' || '0300000000000000')) as written;
+SELECT gql_load_edgelist('/tmp/graphqlite_40_edges.bin', 'binary', 'chain') as loaded;
+SELECT cypher('RETURN dijkstra("1", "3", {graph: "chain"})') as path;
+SELECT json_extract(gql_graph_stats(), '$.projections[0].name') as newest_projection;
+
+-- =======================================================================
+-- Cleanup
+-- =======================================================================
+SELECT '=== Cleanup ===' as section;
+
+SELECT gql_drop_projection('calls') as dropped;
+SELECT gql_drop_projection('calls') as dropped_again;
@@ -0,0 +1,159 @@
+#!/bin/bash
+# GraphQLite Compressed Adjacency Performance
+#
+# Measures adjacency memory (gql_compress_graph) and algorithm time on the
+# plain and the compressed CSR for PageRank, WCC and BFS.
+#
+# Usage: ./perf_compressed_adjacency.sh [quick|standard|full]
+#   quick:    10K, 100K nodes
+#   standard: 10K, 100K, 1M nodes - default
+#   full:     10K, 100K, 1M, 5M nodes
+
+set -e
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+PROJECT_DIR="$(cd "$SCRIPT_DIR/../.." && pwd)"
+
+case "$(uname -s)" in
+    Darwin) EXTENSION="$PROJECT_DIR/build/graphqlite.dylib" ;;
+    *) EXTENSION="$PROJECT_DIR/build/graphqlite.so" ;;
+esac
+
+if [ ! -f "$EXTENSION" ]; then
+    echo "Error: Extension not found at $EXTENSION"
+    echo "Run 'make extension' first"
+    exit 1
+fi
+
+MODE="${1:-standard}"
+ITERATIONS="${PERF_ITERATIONS:-3}"
+EDGES_PER_NODE=5
+
+fmt_num() {
+    local n=$1
+    if [ "$n" -ge 1000000 ]; then printf "%.1fM" $(echo "scale=1; $n/1000000" | bc)
+    elif [ "$n" -ge 1000 ]; then printf "%.0fK" $(echo "scale=0; $n/1000" | bc)
+    else printf "%d" "$n"; fi
+}
+
+fmt_time() {
+    local ms=$1
+    if [ -z "$ms" ] || [ "$ms" = "ERR" ]; then printf "-"
+    elif [ "$ms" -ge 1000 ]; then printf "%.2fs" $(echo "scale=2; $ms/1000" | bc)
+    else printf "%dms" "$ms"; fi
+}
+
+fmt_bytes() {
+    local b=$1
+    if [ -z "$b" ]; then printf "-"
+    elif [ "$b" -ge 1048576 ]; then printf "%.1fMB" $(echo "scale=1; $b/1048576" | bc)
+    else printf "%.0fKB" $(echo "scale=0; $b/1024" | bc); fi
+}
+
+get_sizes() {
+    case "$MODE" in
+        quick)    echo "10000 100000" ;;
+        standard) echo "10000 100000 1000000" ;;
+        full)     echo "10000 100000 1000000 5000000" ;;
+    esac
+}
+
+# Build a graph with $EDGES_PER_NODE out-edges per node: a ring plus
+# short-range neighbours, the locality most real node orders have.
+build_graph() {
+    local db="$1" count="$2"
+    sqlite3 "$db" <<EOF
+CREATE TABLE IF NOT EXISTS nodes (id INTEGER PRIMARY KEY AUTOINCREMENT);
+CREATE TABLE IF NOT EXISTS edges (id INTEGER PRIMARY KEY AUTOINCREMENT, source_id INTEGER NOT NULL, target_id INTEGER NOT NULL, type TEXT NOT NULL);
+CREATE TABLE IF NOT EXISTS property_keys (id INTEGER PRIMARY KEY AUTOINCREMENT, key TEXT UNIQUE NOT NULL);
+CREATE TABLE IF NOT EXISTS node_props_text (node_id INTEGER NOT NULL, key_id INTEGER NOT NULL, value TEXT NOT NULL, PRIMARY KEY (node_id, key_id));
+CREATE INDEX IF NOT EXISTS idx_edges_source ON edges(source_id, type);
+CREATE INDEX IF NOT EXISTS idx_edges_target ON edges(target_id, type);
+
+WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < $count)
+INSERT INTO nodes (id) SELECT x FROM cnt;
+
+INSERT OR IGNORE INTO property_keys (key) VALUES ('id');
+WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < $count)
+INSERT INTO node_props_text (node_id, key_id, value) SELECT x, 1, 'n' || x FROM cnt;
+
+WITH RECURSIVE
+  n(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM n WHERE x < $count),
+  o(k) AS (VALUES(1) UNION ALL SELECT k+1 FROM o WHERE k < $EDGES_PER_NODE)
+INSERT INTO edges (source_id, target_id, type)
+SELECT n.x, ((n.x - 1 + o.k * o.k) % $count) + 1, 'EDGE' FROM n, o;
+EOF
+}
+
+# Average times for PageRank, WCC and BFS on the currently loaded graph
+algorithm_block() {
+    cat <<EOF
+.timer on
+WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < $ITERATIONS)
+SELECT count(cypher('RETURN pageRank(0.85, 20)')) FROM cnt;
+WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < $ITERATIONS)
+SELECT count(cypher('RETURN wcc()')) FROM cnt;
+WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < $ITERATIONS)
+SELECT count(cypher('RETURN bfs(''n1'')')) FROM cnt;
+.timer off
+EOF
+}
+
+# Print "<pr>|<wcc>|<bfs>|<pr compressed>|<wcc compressed>|<bfs compressed>|<compress json>"
+measure() {
+    local db="$1"
+    local result=$(sqlite3 "$db" 2>&1 <<EOF
+.load $EXTENSION
+SELECT gql_load_graph();
+$(algorithm_block)
+SELECT gql_compress_graph();
+$(algorithm_block)
+EOF
+)
+    local times=$(echo "$result" | grep "Run Time:" | sed 's/.*real \([0-9.]*\).*/\1/' | \
+        awk -v n="$ITERATIONS" '{printf "%.0f\n", ($1 * 1000) / n}' | paste -sd'|')
+    local stats=$(echo "$result" | grep '"status":"compressed"' | tail -1)
+    echo "$times|$stats"
+}
+
+json_field() {
+    echo "$1" | sed -n "s/.*\"$2\":\([0-9.]*\).*/\1/p"
+}
+
+echo ""
+echo "GraphQLite Compressed Adjacency Performance"
+echo "==========================================="
+echo ""
+echo "  Mode: $MODE | Iterations: $ITERATIONS | Edges per node: $EDGES_PER_NODE"
+echo ""
+
+declare -a RESULTS
+
+for size in $(get_sizes); do
+    echo "Testing $(fmt_num $size) nodes..."
+    db=$(mktemp /tmp/gqlcompress_XXXXXX.db)
+    build_graph "$db" "$size"
+
+    IFS='|' read -r pr wcc bfs cpr cwcc cbfs stats <<< "$(measure "$db")"
+    RESULTS+=("$size|$(json_field "$stats" bytes_before)|$(json_field "$stats" bytes_after)|$pr|$cpr|$wcc|$cwcc|$bfs|$cbfs")
+
+    rm -f "$db"
+done
+
+echo ""
+echo "┌─────────┬──────────┬──────────┬──────────┬─────────────────┬─────────────────┬─────────────────┐"
+echo "│ Nodes   │ Edges    │ Plain    │ Packed   │ PageRank        │ WCC             │ BFS             │"
+echo "├─────────┼──────────┼──────────┼──────────┼─────────────────┼─────────────────┼─────────────────┤"
+for row in "${RESULTS[@]}"; do
+    IFS='|' read -r nodes before after pr cpr wcc cwcc bfs cbfs <<< "$row"
+    printf "│ %7s │ %8s │ %8s │ %8s │ %7s %7s │ %7s %7s │ %7s %7s │\n" \
+        "$(fmt_num $nodes)" "$(fmt_num $((nodes * EDGES_PER_NODE)))" \
+        "$(fmt_bytes $before)" "$(fmt_bytes $after)" \
+        "$(fmt_time $pr)" "$(fmt_time $cpr)" "$(fmt_time $wcc)" "$(fmt_time $cwcc)" \
+        "$(fmt_time $bfs)" "$(fmt_time $cbfs)"
+done
+echo "└─────────┴──────────┴──────────┴──────────┴─────────────────┴─────────────────┴─────────────────┘"
+echo ""
+echo "  Plain / Packed = adjacency bytes before and after gql_compress_graph()"
+echo "  Algorithm columns = average time on the plain, then the compressed graph"
+echo ""
@@ -0,0 +1,153 @@
+#!/bin/bash
+# GraphQLite Graph Load Performance
+#
+# Measures CSR load time (gql_reload_graph), snapshot load time
+# (gql_save_graph, then gql_load_graph) and node index probe lengths
+# for dense (1..N) and sparse (strided) node ID layouts.
+#
+# Usage: ./perf_graph_load.sh [quick|standard|full]
+#   quick:    10K, 100K nodes
+#   standard: 10K, 100K, 1M nodes - default
+#   full:     10K, 100K, 1M, 10M nodes
+
+set -e
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+PROJECT_DIR="$(cd "$SCRIPT_DIR/../.." && pwd)"
+
+case "$(uname -s)" in
+    Darwin) EXTENSION="$PROJECT_DIR/build/graphqlite.dylib" ;;
+    *) EXTENSION="$PROJECT_DIR/build/graphqlite.so" ;;
+esac
+
+if [ ! -f "$EXTENSION" ]; then
+    echo "Error: Extension not found at $EXTENSION"
+    echo "Run 'make extension' first"
+    exit 1
+fi
+
+MODE="${1:-standard}"
+ITERATIONS="${PERF_ITERATIONS:-3}"
+EDGES_PER_NODE=5
+SPARSE_STRIDE=7919
+
+fmt_num() {
+    local n=$1
+    if [ "$n" -ge 1000000 ]; then printf "%.1fM" $(echo "scale=1; $n/1000000" | bc)
+    elif [ "$n" -ge 1000 ]; then printf "%.0fK" $(echo "scale=0; $n/1000" | bc)
+    else printf "%d" "$n"; fi
+}
+
+fmt_time() {
+    local ms=$1
+    if [ -z "$ms" ] || [ "$ms" = "ERR" ]; then printf "-"
+    elif [ "$ms" -ge 1000 ]; then printf "%.2fs" $(echo "scale=2; $ms/1000" | bc)
+    else printf "%dms" "$ms"; fi
+}
+
+get_sizes() {
+    case "$MODE" in
+        quick)    echo "10000 100000" ;;
+        standard) echo "10000 100000 1000000" ;;
+        full)     echo "10000 100000 1000000 10000000" ;;
+    esac
+}
+
+# Build a cyclic graph with $EDGES_PER_NODE out-edges per node.
+# Node IDs are 1..N (dense) or x * $SPARSE_STRIDE (sparse).
+build_graph() {
+    local db="$1" count="$2" stride="$3"
+    sqlite3 "$db" <<EOF
+CREATE TABLE IF NOT EXISTS nodes (id INTEGER PRIMARY KEY AUTOINCREMENT);
+CREATE TABLE IF NOT EXISTS edges (id INTEGER PRIMARY KEY AUTOINCREMENT, source_id INTEGER NOT NULL, target_id INTEGER NOT NULL, type TEXT NOT NULL);
+CREATE TABLE IF NOT EXISTS property_keys (id INTEGER PRIMARY KEY AUTOINCREMENT, key TEXT UNIQUE NOT NULL);
+CREATE TABLE IF NOT EXISTS node_props_text (node_id INTEGER NOT NULL, key_id INTEGER NOT NULL, value TEXT NOT NULL, PRIMARY KEY (node_id, key_id));
+CREATE INDEX IF NOT EXISTS idx_edges_source ON edges(source_id, type);
+CREATE INDEX IF NOT EXISTS idx_edges_target ON edges(target_id, type);
+
+WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < $count)
+INSERT INTO nodes (id) SELECT x * $stride FROM cnt;
+
+INSERT OR IGNORE INTO property_keys (key) VALUES ('id');
+WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < $count)
+INSERT INTO node_props_text (node_id, key_id, value) SELECT x * $stride, 1, 'n' || x FROM cnt;
+
+WITH RECURSIVE
+  n(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM n WHERE x < $count),
+  o(k) AS (VALUES(1) UNION ALL SELECT k+1 FROM o WHERE k < $EDGES_PER_NODE)
+INSERT INTO edges (source_id, target_id, type)
+SELECT n.x * $stride, (((n.x - 1 + o.k) % $count) + 1) * $stride, 'EDGE' FROM n, o;
+EOF
+}
+
+# Print "<avg load ms>|<avg snapshot load ms>|<graph_loaded json>" for the database
+measure_load() {
+    local db="$1"
+    local result=$(sqlite3 "$db" 2>&1 <<EOF
+.load $EXTENSION
+SELECT gql_load_graph();
+.timer on
+WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < $ITERATIONS)
+SELECT count(gql_reload_graph()) FROM cnt;
+.timer off
+SELECT gql_graph_loaded();
+SELECT gql_save_graph();
+.timer on
+WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < $ITERATIONS)
+SELECT count(gql_unload_graph() || gql_load_graph()) FROM cnt;
+.timer off
+EOF
+)
+    local times=$(echo "$result" | grep "Run Time:" | sed 's/.*real \([0-9.]*\).*/\1/' | \
+        awk -v n="$ITERATIONS" '{printf "%.0f\n", ($1 * 1000) / n}')
+    local ms=$(echo "$times" | sed -n 1p)
+    local snapshot_ms=$(echo "$times" | sed -n 2p)
+    local stats=$(echo "$result" | grep '"loaded":true' | tail -1)
+    echo "${ms:-ERR}|${snapshot_ms:-ERR}|$stats"
+}
+
+json_field() {
+    echo "$1" | sed -n "s/.*\"$2\":\([0-9.]*\).*/\1/p"
+}
+
+echo ""
+echo "GraphQLite Graph Load Performance"
+echo "================================="
+echo ""
+echo "  Mode: $MODE | Iterations: $ITERATIONS | Edges per node: $EDGES_PER_NODE"
+echo ""
+
+declare -a RESULTS
+
+for size in $(get_sizes); do
+    for layout in dense sparse; do
+        stride=1
+        [ "$layout" = "sparse" ] && stride=$SPARSE_STRIDE
+
+        echo "Testing $(fmt_num $size) nodes ($layout IDs)..."
+        db=$(mktemp /tmp/gqlload_XXXXXX.db)
+        build_graph "$db" "$size" "$stride"
+
+        IFS='|' read -r ms snapshot_ms stats <<< "$(measure_load "$db")"
+        RESULTS+=("$size|$layout|$ms|$snapshot_ms|$(json_field "$stats" index_capacity)|$(json_field "$stats" avg_probe)|$(json_field "$stats" max_probe)")
+
+        rm -f "$db" "$db-csr"
+    done
+done
+
+echo ""
+echo "┌─────────┬──────────┬────────┬──────────┬──────────┬────────────┬───────────┬───────────┐"
+echo "│ Nodes   │ Edges    │ IDs    │ Load     │ Snapshot │ Index Slots│ Avg Probe │ Max Probe │"
+echo "├─────────┼──────────┼────────┼──────────┼──────────┼────────────┼───────────┼───────────┤"
+for row in "${RESULTS[@]}"; do
+    IFS='|' read -r nodes layout ms snapshot_ms capacity avg max <<< "$row"
+    printf "│ %7s │ %8s │ %-6s │ %8s │ %8s │ %10s │ %9s │ %9s │\n" \
+        "$(fmt_num $nodes)" "$(fmt_num $((nodes * EDGES_PER_NODE)))" "$layout" \
+        "$(fmt_time $ms)" "$(fmt_time $snapshot_ms)" "${capacity:--}" "${avg:--}" "${max:--}"
+done
+echo "└─────────┴──────────┴────────┴──────────┴──────────┴────────────┴───────────┴───────────┘"
+echo ""
+echo "  Load = average gql_reload_graph() time"
+echo "  Snapshot = average gql_load_graph() time from a gql_save_graph() snapshot"
+echo "  Probe lengths count slots inspected per successful node ID lookup"
+echo ""
@@ -0,0 +1,203 @@
+#!/bin/bash
+# GraphQLite Node Reordering Performance
+#
+# Measures algorithm time on the cached graph in node ID order and after
+# gql_reorder_graph('degree') and gql_reorder_graph('rcm'), on the powerlaw
+# and dense topologies of run_all_perf.sh. Node IDs are shuffled first, as
+# when nodes are inserted in an order unrelated to the graph's structure.
+# With Linux perf installed, cache misses of the algorithm runs are counted
+# too (the load and reorder are measured separately and subtracted).
+#
+# Usage: ./perf_node_reordering.sh [quick|standard|full]
+#   quick:    10K nodes
+#   standard: 10K, 100K nodes - default
+#   full:     10K, 100K, 1M nodes (powerlaw only above 100K)
+
+set -e
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+PROJECT_DIR="$(cd "$SCRIPT_DIR/../.." && pwd)"
+
+case "$(uname -s)" in
+    Darwin) EXTENSION="$PROJECT_DIR/build/graphqlite.dylib" ;;
+    *) EXTENSION="$PROJECT_DIR/build/graphqlite.so" ;;
+esac
+
+if [ ! -f "$EXTENSION" ]; then
+    echo "Error: Extension not found at $EXTENSION"
+    echo "Run 'make extension' first"
+    exit 1
+fi
+
+MODE="${1:-standard}"
+ITERATIONS="${PERF_ITERATIONS:-3}"
+ORDERS="id degree rcm"
+
+if command -v perf >/dev/null 2>&1 && perf stat -e cache-misses true >/dev/null 2>&1; then
+    HAVE_PERF=1
+else
+    HAVE_PERF=0
+fi
+
+fmt_num() {
+    local n=$1
+    if [ "$n" -ge 1000000 ]; then printf "%.1fM" $(echo "scale=1; $n/1000000" | bc)
+    elif [ "$n" -ge 1000 ]; then printf "%.0fK" $(echo "scale=0; $n/1000" | bc)
+    else printf "%d" "$n"; fi
+}
+
+fmt_time() {
+    local ms=$1
+    if [ -z "$ms" ] || [ "$ms" = "ERR" ]; then printf "-"
+    elif [ "$ms" -ge 1000 ]; then printf "%.2fs" $(echo "scale=2; $ms/1000" | bc)
+    else printf "%dms" "$ms"; fi
+}
+
+get_sizes() {
+    case "$MODE" in
+        quick)    echo "10000" ;;
+        standard) echo "10000 100000" ;;
+        full)     echo "10000 100000 1000000" ;;
+    esac
+}
+
+# Nodes 1..count with 'id' properties n1..n<count>, and a shuffled
+# position -> node ID table for the edge builders
+build_nodes() {
+    local count="$1"
+    cat <<EOF
+CREATE TABLE IF NOT EXISTS nodes (id INTEGER PRIMARY KEY AUTOINCREMENT);
+CREATE TABLE IF NOT EXISTS edges (id INTEGER PRIMARY KEY AUTOINCREMENT, source_id INTEGER NOT NULL, target_id INTEGER NOT NULL, type TEXT NOT NULL);
+CREATE TABLE IF NOT EXISTS property_keys (id INTEGER PRIMARY KEY AUTOINCREMENT, key TEXT UNIQUE NOT NULL);
+CREATE TABLE IF NOT EXISTS node_props_text (node_id INTEGER NOT NULL, key_id INTEGER NOT NULL, value TEXT NOT NULL, PRIMARY KEY (node_id, key_id));
+CREATE INDEX IF NOT EXISTS idx_edges_source ON edges(source_id, type);
+CREATE INDEX IF NOT EXISTS idx_edges_target ON edges(target_id, type);
+
+WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < $count)
+INSERT INTO nodes (id) SELECT x FROM cnt;
+INSERT OR IGNORE INTO property_keys (key) VALUES ('id');
+INSERT INTO node_props_text (node_id, key_id, value) SELECT id, 1, 'n' || id FROM nodes;
+
+CREATE TEMP TABLE shuffled (pos INTEGER PRIMARY KEY, node_id INTEGER NOT NULL);
+INSERT INTO shuffled SELECT row_number() OVER (ORDER BY random()), id FROM nodes;
+EOF
+}
+
+# Same edges as run_all_perf.sh's dense topology, between shuffled positions
+build_dense_edges() {
+    local count="$1"
+    cat <<EOF
+WITH RECURSIVE o(k) AS (VALUES(1) UNION ALL SELECT k+1 FROM o WHERE k < 50)
+INSERT INTO edges (source_id, target_id, type)
+SELECT s.node_id, t.node_id, 'LINK' FROM shuffled s, o
+JOIN shuffled t ON t.pos = ((s.pos - 1 + o.k) % $count) + 1;
+EOF
+}
+
+# Same edges as run_all_perf.sh's powerlaw topology, between shuffled positions
+build_powerlaw_edges() {
+    local count="$1"
+    cat <<EOF
+CREATE TEMP TABLE node_degrees AS
+SELECT pos, MIN(100, MAX(1, CAST(1 / POWER((abs(random()) % 999999 + 1) / 1000000.0, 0.67) AS INTEGER))) AS degree FROM shuffled;
+WITH RECURSIVE o(k) AS (SELECT 1 UNION ALL SELECT k+1 FROM o WHERE k < (SELECT MAX(degree) FROM node_degrees))
+INSERT INTO edges (source_id, target_id, type)
+SELECT s.node_id, t.node_id, 'LINK' FROM node_degrees d JOIN o ON o.k <= d.degree
+JOIN shuffled s ON s.pos = d.pos
+JOIN shuffled t ON t.pos = ((d.pos - 1 + o.k) % $count) + 1;
+EOF
+}
+
+# Average times for PageRank, WCC and BFS on the currently loaded graph
+algorithm_block() {
+    cat <<EOF
+.timer on
+WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < $ITERATIONS)
+SELECT count(cypher('RETURN pageRank(0.85, 20)')) FROM cnt;
+WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < $ITERATIONS)
+SELECT count(cypher('RETURN wcc()')) FROM cnt;
+WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < $ITERATIONS)
+SELECT count(cypher('RETURN bfs(''n1'')')) FROM cnt;
+.timer off
+EOF
+}
+
+# Cache misses of a sqlite3 run of stdin, or empty without perf
+count_misses() {
+    local db="$1"
+    perf stat -x, -e cache-misses -o /dev/stdout sqlite3 "$db" 2>/dev/null | \
+        grep cache-misses | cut -d, -f1
+}
+
+# Print "<pr>|<wcc>|<bfs>|<span>|<misses>" for one node order
+measure() {
+    local db="$1" order="$2"
+    local setup=".load $EXTENSION
+SELECT gql_load_graph();
+SELECT gql_reorder_graph('$order');"
+
+    local result=$(sqlite3 "$db" 2>&1 <<EOF
+$setup
+$(algorithm_block)
+EOF
+)
+    local times=$(echo "$result" | grep "Run Time:" | sed 's/.*real \([0-9.]*\).*/\1/' | \
+        awk -v n="$ITERATIONS" '{printf "%.0f\n", ($1 * 1000) / n}' | paste -sd'|')
+    local span=$(echo "$result" | sed -n 's/.*"span_after":\([0-9.]*\).*/\1/p' | tail -1)
+
+    local misses=""
+    if [ "$HAVE_PERF" = "1" ]; then
+        local base=$(echo "$setup" | count_misses "$db")
+        local total=$( (echo "$setup"; algorithm_block) | count_misses "$db")
+        if [ -n "$base" ] && [ -n "$total" ]; then
+            misses=$(( (total - base) / ITERATIONS ))
+        fi
+    fi
+    echo "$times|$span|$misses"
+}
+
+echo ""
+echo "GraphQLite Node Reordering Performance"
+echo "======================================"
+echo ""
+echo "  Mode: $MODE | Iterations: $ITERATIONS | Cache misses: $([ "$HAVE_PERF" = "1" ] && echo "perf stat" || echo "perf not available")"
+echo ""
+
+declare -a RESULTS
+
+for size in $(get_sizes); do
+    for topo in powerlaw dense; do
+        if [ "$topo" = "dense" ] && [ "$size" -gt 100000 ]; then
+            continue
+        fi
+        echo "Testing $topo, $(fmt_num $size) nodes..."
+        db=$(mktemp /tmp/gqlreorder_XXXXXX.db)
+        (build_nodes "$size"; build_${topo}_edges "$size") | sqlite3 "$db"
+        edges=$(sqlite3 "$db" "SELECT COUNT(*) FROM edges")
+
+        for order in $ORDERS; do
+            IFS='|' read -r pr wcc bfs span misses <<< "$(measure "$db" "$order")"
+            RESULTS+=("$topo|$size|$edges|$order|$span|$pr|$wcc|$bfs|$misses")
+        done
+
+        rm -f "$db"
+    done
+done
+
+echo ""
+echo "┌──────────┬─────────┬──────────┬────────┬──────────┬──────────┬──────────┬──────────┬──────────────┐"
+echo "│ Topology │ Nodes   │ Edges    │ Order  │ Span     │ PageRank │ WCC      │ BFS      │ Cache misses │"
+echo "├──────────┼─────────┼──────────┼────────┼──────────┼──────────┼──────────┼──────────┼──────────────┤"
+for row in "${RESULTS[@]}"; do
+    IFS='|' read -r topo nodes edges order span pr wcc bfs misses <<< "$row"
+    printf "│ %-8s │ %7s │ %8s │ %-6s │ %8s │ %8s │ %8s │ %8s │ %12s │\n" \
+        "$topo" "$(fmt_num $nodes)" "$(fmt_num $edges)" "$order" "${span:--}" \
+        "$(fmt_time $pr)" "$(fmt_time $wcc)" "$(fmt_time $bfs)" \
+        "$([ -n "$misses" ] && fmt_num $misses || echo -)"
+done
+echo "└──────────┴─────────┴──────────┴────────┴──────────┴──────────┴──────────┴──────────┴──────────────┘"
+echo ""
+echo "  Order = internal node numbering (id = as loaded, degree / rcm = gql_reorder_graph())"
+echo "  Span = mean index distance between an edge's endpoints"
+echo "  Algorithm columns = average time per run; cache misses per run of all three"
+echo ""
@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 #include <CUnit/CUnit.h>
 #include <CUnit/Basic.h>
 #include <sqlite3.h>
@@ -169,7 +170,7 @@ static void test_pagerank_with_cached_graph(void)
 
     if (graph) {
         /* Run PageRank with cached graph */
-        graph_algo_result *result = execute_pagerank(test_db, graph, 0.85, 20, 0);
+        graph_algo_result *result = execute_pagerank(test_db, graph, 0.85, 20, 1e-6, 0, false);
         CU_ASSERT_PTR_NOT_NULL(result);
 
         if (result) {
@@ -194,7 +195,7 @@ static void test_pagerank_with_cached_graph(void)
 static void test_pagerank_without_cached_graph(void)
 {
     /* Run PageRank without cached graph (NULL) */
-    graph_algo_result *result = execute_pagerank(test_db, NULL, 0.85, 20, 0);
+    graph_algo_result *result = execute_pagerank(test_db, NULL, 0.85, 20, 1e-6, 0, false);
     CU_ASSERT_PTR_NOT_NULL(result);
 
     if (result) {
@@ -212,7 +213,7 @@ static void test_cache_reuse_across_algorithms(void)
 
     if (graph) {
         /* Run PageRank */
-        graph_algo_result *pr_result = execute_pagerank(test_db, graph, 0.85, 20, 0);
+        graph_algo_result *pr_result = execute_pagerank(test_db, graph, 0.85, 20, 1e-6, 0, false);
         CU_ASSERT_PTR_NOT_NULL(pr_result);
         if (pr_result) {
             CU_ASSERT_TRUE(pr_result->success);
@@ -307,7 +308,2006 @@ static void test_cache_invalidation_pattern(void)
     }
 }
 
+/* Test node ID -> index lookup on the loaded graph */
+static void test_csr_node_lookup(void)
+{
+    csr_graph *graph = csr_graph_load(test_db);
+    CU_ASSERT_PTR_NOT_NULL(graph);
+
+    if (graph) {
+        for (int i = 0; i < graph->node_count; i++) {
+            CU_ASSERT_EQUAL(csr_graph_find_node(graph, graph->node_ids[i]), i);
+        }
+        CU_ASSERT_EQUAL(csr_graph_find_node(graph, -42), -1);
+
+        /* Contiguous IDs need no index; otherwise it is sized from the node count */
+        int capacity = graph->node_map.capacity;
+        if (graph->node_map.dense) {
+            CU_ASSERT_EQUAL(capacity, 0);
+            CU_ASSERT_EQUAL(graph->node_map.first_id, graph->node_ids[0]);
+        } else {
+            CU_ASSERT_TRUE(capacity >= graph->node_count * 2);
+            CU_ASSERT_TRUE(capacity <= 1024);
+            CU_ASSERT_EQUAL(capacity & (capacity - 1), 0);
+        }
+
+        csr_graph_free(graph);
+    }
+}
+
+/* Test user ID lookup through the interned string index */
+static void test_csr_user_id_lookup(void)
+{
+    csr_graph *graph = csr_graph_load(test_db);
+    CU_ASSERT_PTR_NOT_NULL(graph);
+
+    if (graph) {
+        CU_ASSERT_PTR_NOT_NULL(graph->user_id_arena);
+        CU_ASSERT_PTR_NOT_NULL(graph->user_id_index);
+
+        const char *names[] = {"alice", "bob", "charlie"};
+        for (int i = 0; i < 3; i++) {
+            int idx = csr_graph_find_user_id(graph, names[i]);
+            CU_ASSERT_TRUE(idx >= 0 && idx < graph->node_count);
+            if (idx >= 0) {
+                CU_ASSERT_STRING_EQUAL(graph->user_ids[idx], names[i]);
+                /* Strings live in the arena, not separate allocations */
+                CU_ASSERT_TRUE(graph->user_ids[idx] >= graph->user_id_arena &&
+                               graph->user_ids[idx] < graph->user_id_arena + graph->user_id_arena_size);
+            }
+        }
+        CU_ASSERT_EQUAL(csr_graph_find_user_id(graph, "mallory"), -1);
+        CU_ASSERT_EQUAL(csr_graph_find_user_id(graph, NULL), -1);
+
+        csr_graph_free(graph);
+    }
+}
+
+/* Test node index with sparse, widely spaced node IDs */
+static void test_csr_node_lookup_sparse_ids(void)
+{
+    sqlite3 *db = NULL;
+    CU_ASSERT_EQUAL(sqlite3_open(":memory:", &db), SQLITE_OK);
+    if (!db) return;
+
+    cypher_schema_manager *schema_mgr = cypher_schema_create_manager(db);
+    if (schema_mgr) {
+        cypher_schema_initialize(schema_mgr);
+        cypher_schema_free_manager(schema_mgr);
+    }
+
+    int rc = sqlite3_exec(db,
+        "WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < 5000) "
+        "INSERT INTO nodes (id) SELECT x * 1000003 FROM cnt;"
+        "WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < 4999) "
+        "INSERT INTO edges (source_id, target_id, type) SELECT x * 1000003, (x + 1) * 1000003, 'NEXT' FROM cnt;",
+        NULL, NULL, NULL);
+    CU_ASSERT_EQUAL(rc, SQLITE_OK);
+
+    csr_graph *graph = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(graph);
+    if (graph) {
+        CU_ASSERT_EQUAL(graph->node_count, 5000);
+        CU_ASSERT_EQUAL(graph->edge_count, 4999);
+        CU_ASSERT_EQUAL(csr_graph_find_node(graph, 1000003), 0);
+        CU_ASSERT_EQUAL(csr_graph_find_node(graph, 5000 * (int64_t)1000003), 4999);
+        CU_ASSERT_EQUAL(csr_graph_find_node(graph, 1000004), -1);
+
+        double avg_probe = 0.0;
+        int max_probe = 0;
+        csr_graph_probe_stats(graph, &avg_probe, &max_probe);
+        CU_ASSERT_TRUE(avg_probe >= 1.0 && avg_probe < 2.0);
+        CU_ASSERT_TRUE(max_probe >= 1);
+
+        csr_graph_free(graph);
+    }
+
+    sqlite3_close(db);
+}
+
+/* Test node and edge IDs beyond 32 bits survive loading, merging and output */
+static void test_csr_64bit_ids(void)
+{
+    sqlite3 *db = NULL;
+    CU_ASSERT_EQUAL(sqlite3_open(":memory:", &db), SQLITE_OK);
+    if (!db) return;
+
+    cypher_schema_manager *schema_mgr = cypher_schema_create_manager(db);
+    if (schema_mgr) {
+        cypher_schema_initialize(schema_mgr);
+        cypher_schema_free_manager(schema_mgr);
+    }
+
+    int rc = sqlite3_exec(db,
+        "INSERT INTO nodes (id) VALUES (3000000000), (3000000001), (1099511627776);"
+        "INSERT INTO edges (id, source_id, target_id, type) VALUES "
+        "(5000000000, 3000000000, 3000000001, 'R'), (5000000001, 3000000001, 1099511627776, 'R');",
+        NULL, NULL, NULL);
+    CU_ASSERT_EQUAL(rc, SQLITE_OK);
+
+    csr_graph *graph = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(graph);
+    if (!graph) {
+        sqlite3_close(db);
+        return;
+    }
+
+    CU_ASSERT_EQUAL(graph->node_count, 3);
+    CU_ASSERT_EQUAL(graph->edge_count, 2);
+    int a = csr_graph_find_node(graph, 3000000000LL);
+    int b = csr_graph_find_node(graph, 3000000001LL);
+    int c = csr_graph_find_node(graph, 1099511627776LL);
+    CU_ASSERT_TRUE(a >= 0 && b >= 0 && c >= 0);
+    CU_ASSERT_EQUAL(csr_graph_find_node(graph, 3000000000LL - 4294967296LL), -1);
+    if (a >= 0 && b >= 0) {
+        CU_ASSERT_EQUAL(graph->row_ptr[a + 1] - graph->row_ptr[a], 1);
+        CU_ASSERT_EQUAL(graph->col_idx[graph->row_ptr[a]], b);
+        CU_ASSERT_EQUAL(graph->edge_ids[graph->row_ptr[a]], 5000000000LL);
+    }
+
+    /* Merged nodes keep their full ID */
+    sqlite3_exec(db, "INSERT INTO nodes (id) VALUES (4000000000)", NULL, NULL, NULL);
+    csr_graph_note_row_change(graph, SQLITE_INSERT, "nodes", sqlite3_last_insert_rowid(db), false);
+    CU_ASSERT_EQUAL(csr_graph_sync(graph, db), 0);
+    CU_ASSERT_EQUAL(graph->node_count, 4);
+    CU_ASSERT_TRUE(csr_graph_find_node(graph, 4000000000LL) >= 0);
+
+    graph_algo_result *result = execute_pagerank(db, graph, 0.85, 20, 1e-6, 0, false);
+    CU_ASSERT_PTR_NOT_NULL(result);
+    if (result) {
+        CU_ASSERT_PTR_NOT_NULL(result->json_result);
+        if (result->json_result) {
+            CU_ASSERT_PTR_NOT_NULL(strstr(result->json_result, "\"node_id\":1099511627776"));
+        }
+        graph_algo_result_free(result);
+    }
+
+    csr_graph_free(graph);
+    sqlite3_close(db);
+}
+
+/* Compare two graphs by node IDs, user IDs, types and out-adjacency (as node IDs) */
+static void assert_graphs_equivalent(csr_graph *a, csr_graph *b)
+{
+    CU_ASSERT_EQUAL(a->node_count, b->node_count);
+    CU_ASSERT_EQUAL(a->edge_count, b->edge_count);
+    CU_ASSERT_EQUAL(a->type_count, b->type_count);
+    if (a->node_count != b->node_count || a->edge_count != b->edge_count ||
+        a->type_count != b->type_count) return;
+
+    for (int t = 0; t < a->type_count; t++) {
+        CU_ASSERT_STRING_EQUAL(a->type_names[t], b->type_names[t]);
+    }
+
+    for (int i = 0; i < a->node_count; i++) {
+        CU_ASSERT_EQUAL(a->node_ids[i], b->node_ids[i]);
+        if (a->user_ids[i] && b->user_ids[i]) {
+            CU_ASSERT_STRING_EQUAL(a->user_ids[i], b->user_ids[i]);
+        } else {
+            CU_ASSERT_PTR_EQUAL(a->user_ids[i], b->user_ids[i]);
+        }
+        CU_ASSERT_EQUAL(a->row_ptr[i + 1] - a->row_ptr[i], b->row_ptr[i + 1] - b->row_ptr[i]);
+        CU_ASSERT_EQUAL(a->in_row_ptr[i + 1] - a->in_row_ptr[i], b->in_row_ptr[i + 1] - b->in_row_ptr[i]);
+        for (int64_t j = a->row_ptr[i]; j < a->row_ptr[i + 1] && j < a->edge_count; j++) {
+            CU_ASSERT_EQUAL(a->node_ids[a->col_idx[j]], b->node_ids[b->col_idx[j]]);
+            if (a->edge_types && b->edge_types) {
+                CU_ASSERT_EQUAL(a->edge_types[j], b->edge_types[j]);
+            }
+            if (a->edge_ids && b->edge_ids) {
+                CU_ASSERT_EQUAL(a->edge_ids[j], b->edge_ids[j]);
+            }
+        }
+    }
+}
+
+/* Test that executor writes are recorded and merged into the cached graph */
+static void test_cache_delta_merge(void)
+{
+    sqlite3 *db = NULL;
+    CU_ASSERT_EQUAL(sqlite3_open(":memory:", &db), SQLITE_OK);
+    if (!db) return;
+
+    cypher_executor *executor = cypher_executor_create(db);
+    CU_ASSERT_PTR_NOT_NULL(executor);
+    if (!executor) {
+        sqlite3_close(db);
+        return;
+    }
+
+    const char *setup[] = {
+        "CREATE (:P {id: 'a'})-[:R]->(:P {id: 'b'})",
+        "MATCH (a:P {id: 'a'}), (b:P {id: 'b'}) CREATE (b)-[:R]->(a)",
+        "CREATE (:P {id: 'c'})",
+    };
+    for (int i = 0; i < 3; i++) {
+        cypher_result *result = cypher_executor_execute(executor, setup[i]);
+        if (result) cypher_result_free(result);
+    }
+
+    csr_graph *graph = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(graph);
+    if (!graph) {
+        cypher_executor_free(executor);
+        sqlite3_close(db);
+        return;
+    }
+    executor->cached_graph = graph;
+    CU_ASSERT_EQUAL(csr_graph_pending_changes(graph), 0);
+
+    const char *writes[] = {
+        "CREATE (:P {id: 'd'})-[:R]->(:P {id: 'e'})",
+        "MATCH (c:P {id: 'c'}), (a:P {id: 'a'}) CREATE (c)-[:R]->(a)",
+        "MATCH (b:P {id: 'b'})-[r:R]->(a:P {id: 'a'}) DELETE r",
+        "MATCH (e:P {id: 'e'}) DETACH DELETE e",
+        "MERGE (:P {id: 'f'})",
+        "MATCH (a:P {id: 'a'}), (c:P {id: 'c'}) CREATE (a)-[:Q]->(c), (c)-[:S]->(a)",
+    };
+    for (int i = 0; i < 6; i++) {
+        cypher_result *result = cypher_executor_execute(executor, writes[i]);
+        CU_ASSERT_PTR_NOT_NULL(result);
+        if (result) {
+            CU_ASSERT_TRUE(result->success);
+            cypher_result_free(result);
+        }
+    }
+    CU_ASSERT_TRUE(csr_graph_pending_changes(graph) > 0);
+
+    /* Running an algorithm merges the changes into the same graph object */
+    cypher_result *result = cypher_executor_execute(executor, "RETURN degreeCentrality()");
+    CU_ASSERT_PTR_NOT_NULL(result);
+    if (result) {
+        CU_ASSERT_TRUE(result->success);
+        cypher_result_free(result);
+    }
+    CU_ASSERT_PTR_EQUAL(executor->cached_graph, graph);
+    CU_ASSERT_EQUAL(csr_graph_pending_changes(graph), 0);
+
+    csr_graph *fresh = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(fresh);
+    if (fresh) {
+        assert_graphs_equivalent(graph, fresh);
+        CU_ASSERT_TRUE(csr_graph_find_user_id(graph, "f") >= 0);
+        CU_ASSERT_EQUAL(csr_graph_find_user_id(graph, "e"), -1);
+        csr_graph_free(fresh);
+    }
+
+    executor->cached_graph = NULL;
+    csr_graph_free(graph);
+    cypher_executor_free(executor);
+    sqlite3_close(db);
+}
+
+/* Test type-sorted adjacency rows and relationship type views */
+static void test_relationship_type_view(void)
+{
+    sqlite3 *db = NULL;
+    CU_ASSERT_EQUAL(sqlite3_open(":memory:", &db), SQLITE_OK);
+    if (!db) return;
+
+    cypher_executor *executor = cypher_executor_create(db);
+    CU_ASSERT_PTR_NOT_NULL(executor);
+    if (!executor) {
+        sqlite3_close(db);
+        return;
+    }
+
+    cypher_result *result = cypher_executor_execute(executor,
+        "CREATE (a:P {id: 'a'})-[:B]->(c:P {id: 'c'}), (a)-[:A]->(b:P {id: 'b'}), "
+        "(b)-[:A]->(c), (c)-[:B]->(a), (a)-[:B]->(b)");
+    if (result) cypher_result_free(result);
+
+    csr_graph *graph = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(graph);
+    if (!graph) {
+        cypher_executor_free(executor);
+        sqlite3_close(db);
+        return;
+    }
+
+    /* Types are numbered by name; rows are ordered by (type, neighbour) */
+    CU_ASSERT_EQUAL(graph->type_count, 2);
+    CU_ASSERT_EQUAL(csr_graph_find_type(graph, "A"), 0);
+    CU_ASSERT_EQUAL(csr_graph_find_type(graph, "B"), 1);
+    CU_ASSERT_EQUAL(csr_graph_find_type(graph, "Z"), -1);
+    for (int u = 0; u < graph->node_count; u++) {
+        for (int64_t j = graph->row_ptr[u] + 1; j < graph->row_ptr[u + 1]; j++) {
+            CU_ASSERT_TRUE(graph->edge_types[j - 1] < graph->edge_types[j] ||
+                           (graph->edge_types[j - 1] == graph->edge_types[j] &&
+                            graph->col_idx[j - 1] <= graph->col_idx[j]));
+        }
+    }
+
+    int a = csr_graph_find_user_id(graph, "a");
+    int b = csr_graph_find_user_id(graph, "b");
+    int64_t start, end;
+    csr_graph_type_range(graph, a, 0, &start, &end);
+    CU_ASSERT_EQUAL(end - start, 1);
+    CU_ASSERT_EQUAL(graph->col_idx[start], b);
+    csr_graph_type_range(graph, a, 1, &start, &end);
+    CU_ASSERT_EQUAL(end - start, 2);
+
+    /* Views share the node arrays and are cached per type set */
+    char *only_a[] = { "A" };
+    char *both[] = { "B", "A" };
+    csr_graph *view = csr_graph_type_view(graph, only_a, 1);
+    CU_ASSERT_PTR_NOT_NULL(view);
+    if (view) {
+        CU_ASSERT_EQUAL(view->edge_count, 2);
+        CU_ASSERT_PTR_EQUAL(view->node_ids, graph->node_ids);
+        CU_ASSERT_EQUAL(view->in_row_ptr[b + 1] - view->in_row_ptr[b], 1);
+        CU_ASSERT_PTR_EQUAL(csr_graph_type_view(graph, only_a, 1), view);
+    }
+    view = csr_graph_type_view(graph, both, 2);
+    CU_ASSERT_PTR_NOT_NULL(view);
+    if (view) CU_ASSERT_EQUAL(view->edge_count, graph->edge_count);
+
+    /* relationshipTypes option filters the graph an algorithm sees */
+    executor->cached_graph = graph;
+    result = cypher_executor_execute(executor,
+        "RETURN degreeCentrality({relationshipTypes: ['A']})");
+    CU_ASSERT_PTR_NOT_NULL(result);
+    if (result) {
+        CU_ASSERT_TRUE(result->success);
+        if (result->success && result->row_count > 0) {
+            CU_ASSERT_PTR_NOT_NULL(strstr(result->data[0][0],
+                "\"user_id\":\"a\",\"in_degree\":0,\"out_degree\":1"));
+        }
+        cypher_result_free(result);
+    }
+
+    executor->cached_graph = NULL;
+    csr_graph_free(graph);
+    cypher_executor_free(executor);
+    sqlite3_close(db);
+}
+
+/* Test that edge weights are cached per property and dropped when edge properties change */
+static void test_cached_edge_weights(void)
+{
+    sqlite3 *db = NULL;
+    CU_ASSERT_EQUAL(sqlite3_open(":memory:", &db), SQLITE_OK);
+    if (!db) return;
+
+    cypher_executor *executor = cypher_executor_create(db);
+    CU_ASSERT_PTR_NOT_NULL(executor);
+    if (!executor) {
+        sqlite3_close(db);
+        return;
+    }
+
+    /* Parallel a->b edges with different weights must each keep their own */
+    cypher_result *result = cypher_executor_execute(executor,
+        "CREATE (a:N {id: 'a'})-[:R {w: 5.0}]->(b:N {id: 'b'}), (a)-[:R {w: 0.5}]->(b), "
+        "(a)-[:R {w: 1.5}]->(c:N {id: 'c'}), (c)-[:R]->(b)");
+    if (result) cypher_result_free(result);
+
+    csr_graph *graph = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(graph);
+    if (!graph) {
+        cypher_executor_free(executor);
+        sqlite3_close(db);
+        return;
+    }
+    executor->cached_graph = graph;
+    CU_ASSERT_PTR_NOT_NULL(graph->edge_ids);
+
+    const double *weights = csr_graph_edge_weights(graph, db, "w");
+    CU_ASSERT_PTR_NOT_NULL(weights);
+    CU_ASSERT_PTR_EQUAL(csr_graph_edge_weights(graph, db, "w"), weights);
+    CU_ASSERT_EQUAL(graph->weight_count, 1);
+    if (weights) {
+        double total = 0.0;
+        for (int64_t j = 0; j < graph->edge_count; j++) {
+            total += weights[j];
+        }
+        /* The edge without 'w' weighs 1.0 */
+        CU_ASSERT_DOUBLE_EQUAL(total, 5.0 + 0.5 + 1.5 + 1.0, 1e-9);
+    }
+
+    result = cypher_executor_execute(executor, "RETURN dijkstra('a', 'b', 'w')");
+    CU_ASSERT_PTR_NOT_NULL(result);
+    if (result) {
+        CU_ASSERT_TRUE(result->success);
+        if (result->success && result->row_count > 0) {
+            CU_ASSERT_PTR_NOT_NULL(strstr(result->data[0][0], "\"distance\":0.5"));
+        }
+        cypher_result_free(result);
+    }
+
+    /* Changing an edge property drops the cached column */
+    result = cypher_executor_execute(executor,
+        "MATCH (:N {id: 'a'})-[r:R]->(:N {id: 'c'}) SET r.w = 0.25");
+    if (result) cypher_result_free(result);
+    CU_ASSERT_EQUAL(graph->weight_count, 0);
+
+    result = cypher_executor_execute(executor, "RETURN dijkstra('a', 'b', 'w')");
+    CU_ASSERT_PTR_NOT_NULL(result);
+    if (result) {
+        CU_ASSERT_TRUE(result->success);
+        if (result->success && result->row_count > 0) {
+            CU_ASSERT_PTR_NOT_NULL(strstr(result->data[0][0], "\"path\":[\"a\",\"b\"]"));
+        }
+        cypher_result_free(result);
+    }
+
+    executor->cached_graph = NULL;
+    csr_graph_free(graph);
+    cypher_executor_free(executor);
+    sqlite3_close(db);
+}
+
 /* Initialize cache test suite */
+/* Test saving a graph snapshot and mapping it back */
+static void test_graph_snapshot(void)
+{
+    const char *path = "/tmp/graphqlite_test_snapshot.db";
+    remove(path);
+
+    sqlite3 *db = NULL;
+    CU_ASSERT_EQUAL(sqlite3_open(path, &db), SQLITE_OK);
+    if (!db) return;
+
+    cypher_executor *executor = cypher_executor_create(db);
+    CU_ASSERT_PTR_NOT_NULL(executor);
+    if (!executor) {
+        sqlite3_close(db);
+        return;
+    }
+
+    cypher_result *result = cypher_executor_execute(executor,
+        "CREATE (:P {id: 'a'})-[:R]->(:P {id: 'b'})-[:Q]->(:P {id: 'c'}), (:P)");
+    if (result) cypher_result_free(result);
+
+    char *snapshot_path = csr_graph_snapshot_path(db);
+    CU_ASSERT_PTR_NOT_NULL(snapshot_path);
+    if (!snapshot_path) {
+        cypher_executor_free(executor);
+        sqlite3_close(db);
+        return;
+    }
+    CU_ASSERT_PTR_NULL(csr_graph_open_snapshot(db, snapshot_path));
+
+    csr_graph *loaded = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(loaded);
+    sqlite3_int64 bytes = 0;
+    char *error = NULL;
+    CU_ASSERT_EQUAL(csr_graph_save_snapshot(loaded, db, snapshot_path, &bytes, &error), 0);
+    CU_ASSERT_PTR_NULL(error);
+    CU_ASSERT_TRUE(bytes > 0);
+
+    /* The mapped graph matches a fresh load */
+    csr_graph *graph = csr_graph_open_snapshot(db, snapshot_path);
+    CU_ASSERT_PTR_NOT_NULL(graph);
+    if (graph && loaded) {
+        CU_ASSERT_PTR_NOT_NULL(graph->snapshot);
+        assert_graphs_equivalent(graph, loaded);
+        CU_ASSERT_EQUAL(csr_graph_find_node(graph, loaded->node_ids[1]), 1);
+        CU_ASSERT_EQUAL(csr_graph_find_user_id(graph, "c"), csr_graph_find_user_id(loaded, "c"));
+    }
+    csr_graph_free(loaded);
+
+    /* Writes merge into the mapped graph as usual */
+    if (graph) {
+        executor->cached_graph = graph;
+        result = cypher_executor_execute(executor,
+            "MATCH (c:P {id: 'c'}) CREATE (c)-[:R]->(:P {id: 'd'})");
+        if (result) cypher_result_free(result);
+        CU_ASSERT_EQUAL(csr_graph_sync(graph, db), 0);
+        CU_ASSERT_PTR_NULL(graph->snapshot);
+
+        csr_graph *fresh = csr_graph_load(db);
+        CU_ASSERT_PTR_NOT_NULL(fresh);
+        if (fresh) {
+            assert_graphs_equivalent(graph, fresh);
+            csr_graph_free(fresh);
+        }
+        executor->cached_graph = NULL;
+        csr_graph_free(graph);
+    }
+
+    /* The snapshot no longer matches the database */
+    CU_ASSERT_PTR_NULL(csr_graph_open_snapshot(db, snapshot_path));
+
+    /* A damaged word anywhere is rejected or harmless, never an index out of range */
+    loaded = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(loaded);
+    CU_ASSERT_EQUAL(csr_graph_save_snapshot(loaded, db, snapshot_path, &bytes, &error), 0);
+    csr_graph_free(loaded);
+    char *saved = malloc((size_t)bytes);
+    FILE *file = fopen(snapshot_path, "rb");
+    CU_ASSERT_TRUE(saved && file && fread(saved, 1, (size_t)bytes, file) == (size_t)bytes);
+    if (file) fclose(file);
+    int rejected = 0;
+    for (sqlite3_int64 pos = 8; saved && pos + 4 <= bytes; pos += 4) {
+        const int32_t values[] = {-2, 5, 0x7fffffff};
+        for (int v = 0; v < 3; v++) {
+            file = fopen(snapshot_path, "wb");
+            if (!file) continue;
+            fwrite(saved, 1, (size_t)pos, file);
+            fwrite(&values[v], 1, 4, file);
+            fwrite(saved + pos + 4, 1, (size_t)(bytes - pos - 4), file);
+            fclose(file);
+
+            csr_graph *damaged = csr_graph_open_snapshot(db, snapshot_path);
+            if (!damaged) {
+                rejected++;
+                continue;
+            }
+            int n = damaged->node_count;
+            for (int i = 0; i < n; i++) {
+                CU_ASSERT_TRUE(damaged->row_ptr[i] <= damaged->row_ptr[i + 1]);
+                CU_ASSERT_TRUE(damaged->in_row_ptr[i] <= damaged->in_row_ptr[i + 1]);
+            }
+            CU_ASSERT_EQUAL(damaged->row_ptr[n], damaged->edge_count);
+            for (int64_t e = 0; e < damaged->edge_count; e++) {
+                CU_ASSERT_TRUE(damaged->col_idx[e] >= 0 && damaged->col_idx[e] < n);
+                CU_ASSERT_TRUE(damaged->in_col_idx[e] >= 0 && damaged->in_col_idx[e] < n);
+                CU_ASSERT_TRUE(damaged->edge_types[e] >= 0 && damaged->edge_types[e] < damaged->type_count);
+            }
+            /* Probes end */
+            csr_graph_find_node(damaged, 1000);
+            csr_graph_find_user_id(damaged, "missing");
+            csr_graph_free(damaged);
+        }
+    }
+    CU_ASSERT_TRUE(rejected > 0);
+    free(saved);
+
+    /* Unreadable files are ignored */
+    file = fopen(snapshot_path, "wb");
+    if (file) {
+        fputs("not a snapshot", file);
+        fclose(file);
+    }
+    CU_ASSERT_PTR_NULL(csr_graph_open_snapshot(db, snapshot_path));
+
+    remove(snapshot_path);
+    free(snapshot_path);
+    cypher_executor_free(executor);
+    sqlite3_close(db);
+    remove(path);
+}
+
+/* Run an algorithm on two graphs and check both give the same JSON */
+#define ASSERT_SAME_RESULT(call_plain, call_compressed) do { \
+        graph_algo_result *r1 = (call_plain); \
+        graph_algo_result *r2 = (call_compressed); \
+        CU_ASSERT_TRUE(r1 && r2 && r1->success && r2->success); \
+        if (r1 && r2 && r1->json_result && r2->json_result) { \
+            CU_ASSERT_STRING_EQUAL(r1->json_result, r2->json_result); \
+        } \
+        graph_algo_result_free(r1); \
+        graph_algo_result_free(r2); \
+    } while (0)
+
+/* Test algorithms give the same results on compressed and plain adjacency */
+static void test_compressed_adjacency(void)
+{
+    sqlite3 *db = NULL;
+    CU_ASSERT_EQUAL(sqlite3_open(":memory:", &db), SQLITE_OK);
+    if (!db) return;
+
+    cypher_schema_manager *schema_mgr = cypher_schema_create_manager(db);
+    if (schema_mgr) {
+        cypher_schema_initialize(schema_mgr);
+        cypher_schema_free_manager(schema_mgr);
+    }
+
+    /* Ring plus long jumps, two relationship types, one hub with a wide row */
+    int rc = sqlite3_exec(db,
+        "WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < 300) "
+        "INSERT INTO nodes (id) SELECT x FROM cnt;"
+        "INSERT OR IGNORE INTO property_keys (key) VALUES ('id');"
+        "INSERT INTO node_props_text (node_id, key_id, value) "
+        "SELECT id, (SELECT id FROM property_keys WHERE key = 'id'), 'n' || id FROM nodes;"
+        "INSERT INTO edges (source_id, target_id, type) SELECT id, id % 300 + 1, 'A' FROM nodes;"
+        "INSERT INTO edges (source_id, target_id, type) SELECT id, (id * 37) % 300 + 1, 'B' FROM nodes;"
+        "INSERT INTO edges (source_id, target_id, type) SELECT 1, id, 'B' FROM nodes WHERE id % 3 = 0;",
+        NULL, NULL, NULL);
+    CU_ASSERT_EQUAL(rc, SQLITE_OK);
+
+    csr_graph *plain = csr_graph_load(db);
+    csr_graph *graph = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(plain);
+    CU_ASSERT_PTR_NOT_NULL(graph);
+    if (!plain || !graph) {
+        csr_graph_free(plain);
+        csr_graph_free(graph);
+        sqlite3_close(db);
+        return;
+    }
+
+    CU_ASSERT_EQUAL(csr_graph_compress(graph), 0);
+    CU_ASSERT_PTR_NOT_NULL(graph->adj.bytes);
+    CU_ASSERT_PTR_NULL(graph->col_idx);
+    CU_ASSERT_PTR_NULL(graph->in_col_idx);
+    CU_ASSERT_TRUE(csr_graph_adjacency_bytes(graph) < csr_graph_adjacency_bytes(plain));
+    CU_ASSERT_EQUAL(csr_graph_compress(graph), 0);
+
+    ASSERT_SAME_RESULT(execute_pagerank(db, plain, 0.85, 20, 1e-6, 0, false), execute_pagerank(db, graph, 0.85, 20, 1e-6, 0, false));
+    ASSERT_SAME_RESULT(execute_label_propagation(db, plain, 10), execute_label_propagation(db, graph, 10));
+    ASSERT_SAME_RESULT(execute_degree_centrality(db, plain), execute_degree_centrality(db, graph));
+    ASSERT_SAME_RESULT(execute_wcc(db, plain), execute_wcc(db, graph));
+    ASSERT_SAME_RESULT(execute_scc(db, plain), execute_scc(db, graph));
+    ASSERT_SAME_RESULT(execute_betweenness_centrality(db, plain, 0, 0), execute_betweenness_centrality(db, graph, 0, 0));
+    ASSERT_SAME_RESULT(execute_closeness_centrality(db, plain, false), execute_closeness_centrality(db, graph, false));
+    ASSERT_SAME_RESULT(execute_louvain(db, plain, 1.0), execute_louvain(db, graph, 1.0));
+    ASSERT_SAME_RESULT(execute_triangle_count(db, plain), execute_triangle_count(db, graph));
+    ASSERT_SAME_RESULT(execute_bfs(db, plain, "n1", -1), execute_bfs(db, graph, "n1", -1));
+    ASSERT_SAME_RESULT(execute_dfs(db, plain, "n1", -1), execute_dfs(db, graph, "n1", -1));
+    ASSERT_SAME_RESULT(execute_dijkstra(db, plain, "n1", "n150", NULL),
+                       execute_dijkstra(db, graph, "n1", "n150", NULL));
+    ASSERT_SAME_RESULT(execute_node_similarity(db, plain, NULL, NULL, 0.1, 10),
+                       execute_node_similarity(db, graph, NULL, NULL, 0.1, 10));
+    ASSERT_SAME_RESULT(execute_knn(db, plain, "n3", 5), execute_knn(db, graph, "n3", 5));
+    ASSERT_SAME_RESULT(execute_eigenvector_centrality(db, plain, 20),
+                       execute_eigenvector_centrality(db, graph, 20));
+
+    /* Type views of a compressed graph are compressed too */
+    char *types[] = {"B"};
+    csr_graph *plain_view = csr_graph_type_view(plain, types, 1);
+    csr_graph *view = csr_graph_type_view(graph, types, 1);
+    CU_ASSERT_PTR_NOT_NULL(view);
+    if (plain_view && view) {
+        CU_ASSERT_PTR_NOT_NULL(view->adj.bytes);
+        CU_ASSERT_EQUAL(view->edge_count, plain_view->edge_count);
+        ASSERT_SAME_RESULT(execute_bfs(db, plain_view, "n1", -1), execute_bfs(db, view, "n1", -1));
+    }
+
+    /* Snapshots are written plain */
+    const char *snapshot_path = "/tmp/graphqlite_test_compressed.csr";
+    sqlite3_int64 bytes = 0;
+    char *error = NULL;
+    CU_ASSERT_EQUAL(csr_graph_save_snapshot(graph, db, snapshot_path, &bytes, &error), 0);
+    free(error);
+    csr_graph *mapped = csr_graph_open_snapshot(db, snapshot_path);
+    CU_ASSERT_PTR_NOT_NULL(mapped);
+    if (mapped) {
+        assert_graphs_equivalent(mapped, plain);
+        csr_graph_free(mapped);
+    }
+    remove(snapshot_path);
+
+    /* Merged changes keep the graph compressed */
+    sqlite3_exec(db, "INSERT INTO nodes (id) VALUES (301)", NULL, NULL, NULL);
+    csr_graph_note_row_change(graph, SQLITE_INSERT, "nodes", sqlite3_last_insert_rowid(db), false);
+    CU_ASSERT_EQUAL(csr_graph_sync(graph, db), 0);
+    CU_ASSERT_EQUAL(graph->node_count, 301);
+    CU_ASSERT_PTR_NOT_NULL(graph->adj.bytes);
+    CU_ASSERT_EQUAL(graph->edge_count, plain->edge_count);
+
+    csr_graph_free(plain);
+    csr_graph_free(graph);
+    sqlite3_close(db);
+}
+
+/* Test a graph built by worker threads matches the single-threaded build */
+static void test_parallel_graph_build(void)
+{
+    sqlite3 *db = NULL;
+    CU_ASSERT_EQUAL(sqlite3_open(":memory:", &db), SQLITE_OK);
+    if (!db) return;
+
+    cypher_schema_manager *schema_mgr = cypher_schema_create_manager(db);
+    if (schema_mgr) {
+        cypher_schema_initialize(schema_mgr);
+        cypher_schema_free_manager(schema_mgr);
+    }
+
+    /*
+     * Enough edges for several chunks: a ring, jumps of two types, parallel
+     * edges (ordered by edge ID), a hub with a wide row and edges to a
+     * missing node.
+     */
+    int rc = sqlite3_exec(db,
+        "WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < 8000) "
+        "INSERT INTO nodes (id) SELECT x FROM cnt;"
+        "INSERT INTO edges (source_id, target_id, type) SELECT id, id % 8000 + 1, 'A' FROM nodes;"
+        "WITH RECURSIVE k(j) AS (VALUES(1) UNION ALL SELECT j+1 FROM k WHERE j < 4) "
+        "INSERT INTO edges (source_id, target_id, type) "
+        "SELECT id, (id * 37 + j * 101) % 8000 + 1, CASE WHEN j % 2 = 0 THEN 'B' ELSE 'C' END FROM nodes, k;"
+        "INSERT INTO edges (source_id, target_id, type) SELECT id, id % 8000 + 1, 'A' FROM nodes WHERE id % 5 = 0;"
+        "INSERT INTO edges (source_id, target_id, type) SELECT 1, id, 'B' FROM nodes WHERE id % 2 = 0;"
+        "INSERT INTO edges (source_id, target_id, type) SELECT id, 9999, 'A' FROM nodes WHERE id % 7 = 0;",
+        NULL, NULL, NULL);
+    CU_ASSERT_EQUAL(rc, SQLITE_OK);
+
+    graph_set_thread_count(1);
+    csr_graph *serial = csr_graph_load(db);
+    graph_set_thread_count(4);
+    CU_ASSERT_EQUAL(graph_thread_count(), 4);
+    csr_graph *parallel = csr_graph_load(db);
+    graph_set_thread_count(0);
+    CU_ASSERT_TRUE(graph_thread_count() >= 1);
+
+    CU_ASSERT_PTR_NOT_NULL(serial);
+    CU_ASSERT_PTR_NOT_NULL(parallel);
+    if (serial && parallel) {
+        CU_ASSERT_EQUAL(serial->edge_count, 8000 + 32000 + 1600 + 4000);
+        assert_graphs_equivalent(serial, parallel);
+        if (serial->edge_count == parallel->edge_count) {
+            CU_ASSERT_EQUAL(memcmp(serial->row_ptr, parallel->row_ptr,
+                                   (serial->node_count + 1) * sizeof(int64_t)), 0);
+            CU_ASSERT_EQUAL(memcmp(serial->in_row_ptr, parallel->in_row_ptr,
+                                   (serial->node_count + 1) * sizeof(int64_t)), 0);
+            CU_ASSERT_EQUAL(memcmp(serial->in_col_idx, parallel->in_col_idx,
+                                   serial->edge_count * sizeof(int)), 0);
+            CU_ASSERT_EQUAL(memcmp(serial->in_edge_types, parallel->in_edge_types,
+                                   serial->edge_count * sizeof(int)), 0);
+        }
+    }
+
+    /* PageRank pulls each node's rank on one thread: same sums whatever the thread count */
+    if (serial) {
+        graph_set_thread_count(1);
+        graph_algo_result *one = execute_pagerank(db, serial, 0.85, 20, 0, 0, false);
+        graph_set_thread_count(4);
+        graph_algo_result *four = execute_pagerank(db, serial, 0.85, 20, 0, 0, false);
+        graph_set_thread_count(0);
+        ASSERT_SAME_RESULT(one, four);
+    }
+
+    csr_graph_free(serial);
+    csr_graph_free(parallel);
+    sqlite3_close(db);
+}
+
+/* Run a RETURN query and check its first cell contains a fragment (or NULL: just succeeds) */
+static void assert_query_result(cypher_executor *executor, const char *query, const char *fragment)
+{
+    cypher_result *result = cypher_executor_execute(executor, query);
+    CU_ASSERT_PTR_NOT_NULL(result);
+    if (!result) return;
+
+    CU_ASSERT_TRUE(result->success);
+    if (result->success && fragment) {
+        CU_ASSERT_TRUE(result->row_count > 0);
+        if (result->row_count > 0) {
+            CU_ASSERT_PTR_NOT_NULL(strstr(result->data[0][0], fragment));
+        }
+    }
+    cypher_result_free(result);
+}
+
+/* Test the undirected adjacency merges both directions once per graph */
+static void test_undirected_adjacency(void)
+{
+    sqlite3 *db = NULL;
+    CU_ASSERT_EQUAL(sqlite3_open(":memory:", &db), SQLITE_OK);
+    if (!db) return;
+
+    cypher_schema_manager *schema_mgr = cypher_schema_create_manager(db);
+    if (schema_mgr) {
+        cypher_schema_initialize(schema_mgr);
+        cypher_schema_free_manager(schema_mgr);
+    }
+
+    /* Triangle 1-2-3 with reciprocal and parallel edges, a self-loop on 4, node 5 isolated */
+    int rc = sqlite3_exec(db,
+        "INSERT INTO nodes (id) VALUES (1), (2), (3), (4), (5);"
+        "INSERT OR IGNORE INTO property_keys (key) VALUES ('id');"
+        "INSERT INTO node_props_text (node_id, key_id, value) "
+        "SELECT id, (SELECT id FROM property_keys WHERE key = 'id'), 'n' || id FROM nodes;"
+        "INSERT INTO edges (source_id, target_id, type) VALUES "
+        "(1, 2, 'R'), (2, 1, 'R'), (1, 2, 'S'), (2, 3, 'R'), (3, 1, 'R'), (3, 4, 'R'), (4, 4, 'R');",
+        NULL, NULL, NULL);
+    CU_ASSERT_EQUAL(rc, SQLITE_OK);
+
+    csr_graph *graph = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(graph);
+    if (!graph) {
+        sqlite3_close(db);
+        return;
+    }
+
+    const csr_neighbour_sets *adj = csr_graph_undirected(graph);
+    CU_ASSERT_PTR_NOT_NULL(adj);
+    CU_ASSERT_PTR_EQUAL(csr_graph_undirected(graph), adj);
+    if (adj) {
+        /* Rows are distinct and ascending; multiplicities add up to both degrees */
+        for (int u = 0; u < graph->node_count; u++) {
+            int64_t edges = 0;
+            for (int64_t j = adj->row_ptr[u]; j < adj->row_ptr[u + 1]; j++) {
+                if (j > adj->row_ptr[u]) CU_ASSERT_TRUE(adj->col_idx[j - 1] < adj->col_idx[j]);
+                edges += adj->multiplicity[j];
+            }
+            CU_ASSERT_EQUAL(edges, (graph->row_ptr[u + 1] - graph->row_ptr[u]) +
+                                   (graph->in_row_ptr[u + 1] - graph->in_row_ptr[u]));
+        }
+
+        int n1 = csr_graph_find_node(graph, 1);
+        int n2 = csr_graph_find_node(graph, 2);
+        int n4 = csr_graph_find_node(graph, 4);
+        int n5 = csr_graph_find_node(graph, 5);
+        CU_ASSERT_EQUAL(adj->row_ptr[n1 + 1] - adj->row_ptr[n1], 2);
+        CU_ASSERT_EQUAL(adj->col_idx[adj->row_ptr[n1]], n2);
+        CU_ASSERT_EQUAL(adj->multiplicity[adj->row_ptr[n1]], 3);
+        CU_ASSERT_EQUAL(adj->row_ptr[n4 + 1] - adj->row_ptr[n4], 2);
+        CU_ASSERT_EQUAL(adj->multiplicity[adj->row_ptr[n4 + 1] - 1], 2);
+        CU_ASSERT_EQUAL(adj->row_ptr[n5 + 1] - adj->row_ptr[n5], 0);
+    }
+
+    /* Parallel edges count once: the triangle nodes are fully clustered */
+    graph_algo_result *triangles = execute_triangle_count(db, graph);
+    CU_ASSERT_PTR_NOT_NULL(triangles);
+    if (triangles) {
+        CU_ASSERT_TRUE(triangles->success);
+        CU_ASSERT_PTR_NOT_NULL(strstr(triangles->json_result,
+            "{\"node_id\":1,\"user_id\":\"n1\",\"triangles\":1,\"clustering_coefficient\":1.000000}"));
+        graph_algo_result_free(triangles);
+    }
+
+    /* Out-neighbour sets: 1's parallel R and S edges to 2 become one entry */
+    const csr_neighbour_sets *out = csr_graph_out_sets(graph);
+    CU_ASSERT_PTR_NOT_NULL(out);
+    if (out) {
+        int n1 = csr_graph_find_node(graph, 1);
+        CU_ASSERT_EQUAL(out->row_ptr[n1 + 1] - out->row_ptr[n1], 1);
+        CU_ASSERT_EQUAL(out->multiplicity[out->row_ptr[n1]], 2);
+        CU_ASSERT_EQUAL(out->row_ptr[graph->node_count], graph->edge_count - 1);
+    }
+
+    /* Jaccard over sets: N(2) = {1, 3}, N(3) = {1, 4} */
+    graph_algo_result *similarity = execute_node_similarity(db, graph, "n2", "n3", 0.0, 0);
+    CU_ASSERT_PTR_NOT_NULL(similarity);
+    if (similarity) {
+        CU_ASSERT_TRUE(similarity->success);
+        CU_ASSERT_PTR_NOT_NULL(strstr(similarity->json_result, "\"similarity\":0.333333"));
+        graph_algo_result_free(similarity);
+    }
+    graph_algo_result *knn = execute_knn(db, graph, "n2", 5);
+    CU_ASSERT_PTR_NOT_NULL(knn);
+    if (knn) {
+        CU_ASSERT_TRUE(knn->success);
+        CU_ASSERT_STRING_EQUAL(knn->json_result, "[{\"neighbor\":\"n3\",\"similarity\":0.333333,\"rank\":1}]");
+        graph_algo_result_free(knn);
+    }
+
+    /* Compressed rows give the same adjacency and results */
+    csr_graph *packed = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(packed);
+    if (packed && adj) {
+        csr_graph_compress(packed);
+        const csr_neighbour_sets *packed_adj = csr_graph_undirected(packed);
+        CU_ASSERT_PTR_NOT_NULL(packed_adj);
+        if (packed_adj) {
+            int64_t entries = adj->row_ptr[graph->node_count];
+            CU_ASSERT_EQUAL(packed_adj->row_ptr[packed->node_count], entries);
+            CU_ASSERT_EQUAL(memcmp(packed_adj->col_idx, adj->col_idx, (size_t)entries * sizeof(int)), 0);
+            CU_ASSERT_EQUAL(memcmp(packed_adj->multiplicity, adj->multiplicity, (size_t)entries * sizeof(int)), 0);
+        }
+        ASSERT_SAME_RESULT(execute_triangle_count(db, graph), execute_triangle_count(db, packed));
+        ASSERT_SAME_RESULT(execute_louvain(db, graph, 1.0), execute_louvain(db, packed, 1.0));
+        ASSERT_SAME_RESULT(execute_label_propagation(db, graph, 10),
+                           execute_label_propagation(db, packed, 10));
+        ASSERT_SAME_RESULT(execute_node_similarity(db, graph, NULL, NULL, 0.0, 0),
+                           execute_node_similarity(db, packed, NULL, NULL, 0.0, 0));
+        ASSERT_SAME_RESULT(execute_node_similarity(db, graph, NULL, NULL, 0.1, 0),
+                           execute_node_similarity(db, packed, NULL, NULL, 0.1, 0));
+    }
+    csr_graph_free(packed);
+
+    csr_graph_free(graph);
+    sqlite3_close(db);
+}
+
+/*
+ * Check that every node keeps its ID, user ID and edges (by neighbour ID and
+ * edge ID) after reordering. Rows of both graphs must be plain.
+ */
+static void assert_same_graph(const csr_graph *expected, const csr_graph *graph)
+{
+    CU_ASSERT_EQUAL(graph->node_count, expected->node_count);
+    CU_ASSERT_EQUAL(graph->edge_count, expected->edge_count);
+    if (graph->node_count != expected->node_count || !graph->col_idx || !expected->col_idx) return;
+
+    for (int u = 0; u < expected->node_count; u++) {
+        int v = csr_graph_find_node(graph, expected->node_ids[u]);
+        CU_ASSERT_TRUE(v >= 0);
+        if (v < 0) return;
+        CU_ASSERT_STRING_EQUAL(graph->user_ids[v], expected->user_ids[u]);
+        CU_ASSERT_EQUAL(csr_graph_find_user_id(graph, expected->user_ids[u]), v);
+
+        int64_t degree = expected->row_ptr[u + 1] - expected->row_ptr[u];
+        CU_ASSERT_EQUAL(graph->row_ptr[v + 1] - graph->row_ptr[v], degree);
+        CU_ASSERT_EQUAL(graph->in_row_ptr[v + 1] - graph->in_row_ptr[v],
+                        expected->in_row_ptr[u + 1] - expected->in_row_ptr[u]);
+
+        int64_t expected_sum = 0, sum = 0;
+        for (int64_t j = expected->row_ptr[u]; j < expected->row_ptr[u + 1]; j++) {
+            expected_sum += expected->node_ids[expected->col_idx[j]] * 1000 + expected->edge_ids[j];
+        }
+        for (int64_t j = graph->row_ptr[v]; j < graph->row_ptr[v + 1]; j++) {
+            sum += graph->node_ids[graph->col_idx[j]] * 1000 + graph->edge_ids[j];
+            /* Rows stay sorted by (type, neighbour) */
+            if (j > graph->row_ptr[v]) {
+                CU_ASSERT_TRUE(graph->edge_types[j - 1] < graph->edge_types[j] ||
+                               (graph->edge_types[j - 1] == graph->edge_types[j] &&
+                                graph->col_idx[j - 1] <= graph->col_idx[j]));
+            }
+        }
+        CU_ASSERT_EQUAL(sum, expected_sum);
+    }
+}
+
+/* Test locality reordering keeps the graph and round-trips to node ID order */
+static void test_node_reorder(void)
+{
+    sqlite3 *db = NULL;
+    CU_ASSERT_EQUAL(sqlite3_open(":memory:", &db), SQLITE_OK);
+    if (!db) return;
+
+    cypher_executor *executor = cypher_executor_create(db);
+    CU_ASSERT_PTR_NOT_NULL(executor);
+    if (!executor) {
+        sqlite3_close(db);
+        return;
+    }
+
+    /* A ring whose node IDs are scattered, plus a hub, two relationship types */
+    int rc = sqlite3_exec(db,
+        "WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < 400) "
+        "INSERT INTO nodes (id) SELECT x FROM cnt;"
+        "INSERT OR IGNORE INTO property_keys (key) VALUES ('id');"
+        "INSERT INTO node_props_text (node_id, key_id, value) "
+        "SELECT id, (SELECT id FROM property_keys WHERE key = 'id'), 'n' || id FROM nodes;"
+        "INSERT INTO edges (source_id, target_id, type) "
+        "SELECT (id * 37) % 400 + 1, ((id + 1) * 37) % 400 + 1, 'A' FROM nodes;"
+        "INSERT INTO edges (source_id, target_id, type) "
+        "SELECT (id * 37) % 400 + 1, ((id + 2) * 37) % 400 + 1, 'B' FROM nodes;"
+        "INSERT INTO edges (source_id, target_id, type) SELECT id, 5, 'B' FROM nodes WHERE id % 40 = 0;",
+        NULL, NULL, NULL);
+    CU_ASSERT_EQUAL(rc, SQLITE_OK);
+
+    CU_ASSERT_EQUAL(csr_node_order_from_name("rcm"), CSR_ORDER_RCM);
+    CU_ASSERT_EQUAL(csr_node_order_from_name("degree"), CSR_ORDER_DEGREE);
+    CU_ASSERT_EQUAL(csr_node_order_from_name("id"), CSR_ORDER_ID);
+    CU_ASSERT_EQUAL(csr_node_order_from_name("random"), -1);
+
+    csr_graph *plain = csr_graph_load(db);
+    csr_graph *graph = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(plain);
+    CU_ASSERT_PTR_NOT_NULL(graph);
+    if (!plain || !graph) {
+        csr_graph_free(plain);
+        csr_graph_free(graph);
+        cypher_executor_free(executor);
+        sqlite3_close(db);
+        return;
+    }
+
+    /* Degree order puts the hub first */
+    CU_ASSERT_EQUAL(csr_graph_reorder(graph, CSR_ORDER_DEGREE), 0);
+    CU_ASSERT_EQUAL(graph->order, CSR_ORDER_DEGREE);
+    CU_ASSERT_EQUAL(graph->node_ids[0], 5);
+    assert_same_graph(plain, graph);
+
+    /* RCM brings ring neighbours together */
+    CU_ASSERT_EQUAL(csr_graph_reorder(graph, CSR_ORDER_RCM), 0);
+    CU_ASSERT_EQUAL(graph->order, CSR_ORDER_RCM);
+    CU_ASSERT_TRUE(csr_graph_edge_span(graph) * 3 < csr_graph_edge_span(plain));
+    assert_same_graph(plain, graph);
+
+    /* Compressed graphs stay compressed and compress better */
+    csr_graph *packed = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(packed);
+    if (packed) {
+        csr_graph_compress(packed);
+        size_t before = csr_graph_adjacency_bytes(packed);
+        CU_ASSERT_EQUAL(csr_graph_reorder(packed, CSR_ORDER_RCM), 0);
+        CU_ASSERT_PTR_NOT_NULL(packed->adj.bytes);
+        CU_ASSERT_TRUE(csr_graph_adjacency_bytes(packed) < before);
+        ASSERT_SAME_RESULT(execute_pagerank(db, graph, 0.85, 20, 1e-6, 0, false), execute_pagerank(db, packed, 0.85, 20, 1e-6, 0, false));
+        csr_graph_free(packed);
+    }
+
+    /* Back to node ID order gives the loaded graph and the same results */
+    CU_ASSERT_EQUAL(csr_graph_reorder(graph, CSR_ORDER_ID), 0);
+    for (int i = 0; i < graph->node_count; i++) {
+        CU_ASSERT_EQUAL(graph->node_ids[i], plain->node_ids[i]);
+    }
+    assert_same_graph(plain, graph);
+    ASSERT_SAME_RESULT(execute_pagerank(db, plain, 0.85, 20, 1e-6, 0, false), execute_pagerank(db, graph, 0.85, 20, 1e-6, 0, false));
+    ASSERT_SAME_RESULT(execute_wcc(db, plain), execute_wcc(db, graph));
+    ASSERT_SAME_RESULT(execute_bfs(db, plain, "n1", -1), execute_bfs(db, graph, "n1", -1));
+
+    /* Merged changes keep the order */
+    CU_ASSERT_EQUAL(csr_graph_reorder(graph, CSR_ORDER_DEGREE), 0);
+    executor->cached_graph = graph;
+    cypher_result *result = cypher_executor_execute(executor,
+        "MATCH (a {id: 'n7'}), (b {id: 'n9'}) CREATE (a)-[:B]->(:P {id: 'new'})-[:B]->(b)");
+    CU_ASSERT_PTR_NOT_NULL(result);
+    if (result) cypher_result_free(result);
+    CU_ASSERT_TRUE(csr_graph_pending_changes(graph) > 0);
+    CU_ASSERT_EQUAL(csr_graph_sync(graph, db), 0);
+    CU_ASSERT_EQUAL(csr_graph_pending_changes(graph), 0);
+    CU_ASSERT_EQUAL(graph->order, CSR_ORDER_DEGREE);
+    CU_ASSERT_EQUAL(graph->node_count, plain->node_count + 1);
+    CU_ASSERT_EQUAL(graph->node_ids[0], 5);
+    CU_ASSERT_TRUE(csr_graph_find_user_id(graph, "new") >= 0);
+
+    csr_graph *fresh = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(fresh);
+    if (fresh) {
+        assert_same_graph(fresh, graph);
+        csr_graph_free(fresh);
+    }
+
+    executor->cached_graph = NULL;
+    csr_graph_free(plain);
+    csr_graph_free(graph);
+    cypher_executor_free(executor);
+    sqlite3_close(db);
+}
+
+/* Test dense node maps and compacting node IDs */
+static void test_compact_node_ids(void)
+{
+    sqlite3 *db = NULL;
+    CU_ASSERT_EQUAL(sqlite3_open(":memory:", &db), SQLITE_OK);
+    if (!db) return;
+
+    cypher_executor *executor = cypher_executor_create(db);
+    CU_ASSERT_PTR_NOT_NULL(executor);
+    if (!executor) {
+        sqlite3_close(db);
+        return;
+    }
+
+    /* A ring of 300 with chords, then every third node deleted */
+    int rc = sqlite3_exec(db,
+        "PRAGMA foreign_keys = ON;"
+        "WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < 300) "
+        "INSERT INTO nodes (id) SELECT x FROM cnt;"
+        "INSERT OR IGNORE INTO property_keys (key) VALUES ('id'), ('rank');"
+        "INSERT INTO node_props_text (node_id, key_id, value) "
+        "SELECT id, (SELECT id FROM property_keys WHERE key = 'id'), 'n' || id FROM nodes;"
+        "INSERT INTO node_props_int (node_id, key_id, value) "
+        "SELECT id, (SELECT id FROM property_keys WHERE key = 'rank'), id * 10 FROM nodes;"
+        "INSERT INTO node_labels (node_id, label) SELECT id, 'P' FROM nodes;"
+        "INSERT INTO edges (source_id, target_id, type) SELECT id, id % 300 + 1, 'A' FROM nodes;"
+        "INSERT INTO edges (source_id, target_id, type) SELECT id, (id * 7) % 300 + 1, 'B' FROM nodes;"
+        "DELETE FROM nodes WHERE id % 3 = 0;",
+        NULL, NULL, NULL);
+    CU_ASSERT_EQUAL(rc, SQLITE_OK);
+
+    csr_graph *sparse = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(sparse);
+    if (!sparse) {
+        cypher_executor_free(executor);
+        sqlite3_close(db);
+        return;
+    }
+    CU_ASSERT_FALSE(sparse->node_map.dense);
+    CU_ASSERT_EQUAL(csr_graph_find_node(sparse, 3), -1);
+
+    int64_t nodes = 0, renumbered = 0;
+    char *error = NULL;
+    CU_ASSERT_EQUAL(csr_compact_node_ids(db, &nodes, &renumbered, &error), 0);
+    CU_ASSERT_PTR_NULL(error);
+    CU_ASSERT_EQUAL(nodes, 200);
+    CU_ASSERT_EQUAL(renumbered, 198);
+
+    /* Properties, labels and edges follow their nodes */
+    sqlite3_stmt *stmt = NULL;
+    CU_ASSERT_EQUAL(sqlite3_prepare_v2(db,
+        "SELECT (SELECT COUNT(*) FROM pragma_foreign_key_check), MAX(id), "
+        "(SELECT COUNT(*) FROM node_props_text t JOIN node_props_int r USING (node_id) "
+        " WHERE t.value = 'n' || (r.value / 10)), "
+        "(SELECT COUNT(*) FROM node_labels WHERE node_id BETWEEN 1 AND 200), "
+        "(SELECT seq FROM sqlite_sequence WHERE name = 'nodes') FROM nodes",
+        -1, &stmt, NULL), SQLITE_OK);
+    if (stmt && sqlite3_step(stmt) == SQLITE_ROW) {
+        CU_ASSERT_EQUAL(sqlite3_column_int(stmt, 0), 0);
+        CU_ASSERT_EQUAL(sqlite3_column_int(stmt, 1), 200);
+        CU_ASSERT_EQUAL(sqlite3_column_int(stmt, 2), 200);
+        CU_ASSERT_EQUAL(sqlite3_column_int(stmt, 3), 200);
+        CU_ASSERT_EQUAL(sqlite3_column_int(stmt, 4), 200);
+    }
+    sqlite3_finalize(stmt);
+
+    /* The compacted graph is dense and has the same structure by user ID */
+    csr_graph *graph = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(graph);
+    if (graph) {
+        CU_ASSERT_TRUE(graph->node_map.dense);
+        CU_ASSERT_PTR_NULL(graph->node_map.slots);
+        CU_ASSERT_EQUAL(graph->node_count, sparse->node_count);
+        CU_ASSERT_EQUAL(graph->edge_count, sparse->edge_count);
+        CU_ASSERT_EQUAL(csr_graph_find_node(graph, 1), 0);
+        CU_ASSERT_EQUAL(csr_graph_find_node(graph, 200), 199);
+        CU_ASSERT_EQUAL(csr_graph_find_node(graph, 0), -1);
+        CU_ASSERT_EQUAL(csr_graph_find_node(graph, 201), -1);
+        for (int u = 0; u < sparse->node_count && graph->node_count == sparse->node_count; u++) {
+            int v = csr_graph_find_user_id(graph, sparse->user_ids[u]);
+            CU_ASSERT_EQUAL(v, u);
+            CU_ASSERT_EQUAL(graph->node_ids[v], u + 1);
+            CU_ASSERT_EQUAL(graph->row_ptr[v + 1] - graph->row_ptr[v], sparse->row_ptr[u + 1] - sparse->row_ptr[u]);
+            for (int64_t j = sparse->row_ptr[u]; j < sparse->row_ptr[u + 1]; j++) {
+                CU_ASSERT_EQUAL(graph->col_idx[j], sparse->col_idx[j]);
+            }
+        }
+
+        /* Reordering permutes the IDs; back to ID order is dense again */
+        CU_ASSERT_EQUAL(csr_graph_reorder(graph, CSR_ORDER_RCM), 0);
+        CU_ASSERT_EQUAL(graph->node_ids[csr_graph_find_node(graph, 17)], 17);
+        CU_ASSERT_EQUAL(csr_graph_reorder(graph, CSR_ORDER_ID), 0);
+        CU_ASSERT_TRUE(graph->node_map.dense);
+        CU_ASSERT_EQUAL(csr_graph_find_node(graph, 17), 16);
+
+        /* New nodes continue the sequence, and merging them keeps the map dense */
+        executor->cached_graph = graph;
+        cypher_result *result = cypher_executor_execute(executor,
+            "MATCH (a {id: 'n1'}) CREATE (a)-[:A]->(:P {id: 'new'})");
+        CU_ASSERT_PTR_NOT_NULL(result);
+        if (result) cypher_result_free(result);
+        CU_ASSERT_EQUAL(csr_graph_sync(graph, db), 0);
+        CU_ASSERT_EQUAL(graph->node_count, 201);
+        CU_ASSERT_TRUE(graph->node_map.dense);
+        CU_ASSERT_EQUAL(csr_graph_find_user_id(graph, "new"), 200);
+        CU_ASSERT_EQUAL(csr_graph_find_node(graph, 201), 200);
+
+        /* A gap turns it back into a hash map */
+        result = cypher_executor_execute(executor, "MATCH (a {id: 'n2'}) DETACH DELETE a");
+        if (result) cypher_result_free(result);
+        CU_ASSERT_EQUAL(csr_graph_sync(graph, db), 0);
+        CU_ASSERT_FALSE(graph->node_map.dense);
+        CU_ASSERT_EQUAL(csr_graph_find_node(graph, 2), -1);
+        CU_ASSERT_EQUAL(csr_graph_find_node(graph, 201), 199);
+
+        csr_graph *fresh = csr_graph_load(db);
+        CU_ASSERT_PTR_NOT_NULL(fresh);
+        if (fresh) {
+            assert_same_graph(fresh, graph);
+            csr_graph_free(fresh);
+        }
+        executor->cached_graph = NULL;
+        csr_graph_free(graph);
+    }
+
+    /* Compacting a compact graph changes nothing */
+    CU_ASSERT_EQUAL(sqlite3_exec(db, "DELETE FROM nodes WHERE id = 201", NULL, NULL, NULL), SQLITE_OK);
+    CU_ASSERT_EQUAL(csr_compact_node_ids(db, &nodes, &renumbered, &error), 0);
+    CU_ASSERT_EQUAL(renumbered, 198);
+    CU_ASSERT_EQUAL(csr_compact_node_ids(db, &nodes, &renumbered, &error), 0);
+    CU_ASSERT_EQUAL(nodes, 199);
+    CU_ASSERT_EQUAL(renumbered, 0);
+
+    csr_graph_free(sparse);
+    cypher_executor_free(executor);
+    sqlite3_close(db);
+}
+
+/* Assert two results list the same numbers after each "key": (within float rounding) */
+static void assert_close_scores(graph_algo_result *r1, graph_algo_result *r2, const char *key)
+{
+    CU_ASSERT_TRUE(r1 && r2 && r1->success && r2->success);
+    if (r1 && r2 && r1->json_result && r2->json_result) {
+        const char *p1 = r1->json_result;
+        const char *p2 = r2->json_result;
+        int count = 0;
+        while ((p1 = strstr(p1, key)) != NULL) {
+            p2 = strstr(p2, key);
+            CU_ASSERT_PTR_NOT_NULL(p2);
+            if (!p2) break;
+            p1 += strlen(key);
+            p2 += strlen(key);
+            double a = strtod(p1, NULL);
+            double b = strtod(p2, NULL);
+            CU_ASSERT_TRUE(fabs(a - b) <= 1e-5 * (1.0 + fabs(a)));
+            count++;
+        }
+        CU_ASSERT_TRUE(count > 0);
+        CU_ASSERT_PTR_NULL(strstr(p2 ? p2 : "", key));
+    }
+    graph_algo_result_free(r1);
+    graph_algo_result_free(r2);
+}
+
+/* Test coalesced parallel edges give the results of the plain graph */
+static void test_coalesced_edges(void)
+{
+    sqlite3 *db = NULL;
+    CU_ASSERT_EQUAL(sqlite3_open(":memory:", &db), SQLITE_OK);
+    if (!db) return;
+
+    cypher_executor *executor = cypher_executor_create(db);
+    CU_ASSERT_PTR_NOT_NULL(executor);
+    if (!executor) {
+        sqlite3_close(db);
+        return;
+    }
+
+    /* A ring whose edges repeat one to three times, chords doubled on every fifth node, a hub */
+    int rc = sqlite3_exec(db,
+        "WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < 60) "
+        "INSERT INTO nodes (id) SELECT x FROM cnt;"
+        "INSERT OR IGNORE INTO property_keys (key) VALUES ('id'), ('w');"
+        "INSERT INTO node_props_text (node_id, key_id, value) "
+        "SELECT id, (SELECT id FROM property_keys WHERE key = 'id'), 'n' || id FROM nodes;"
+        "WITH c(k) AS (VALUES (1), (2), (3)) INSERT INTO edges (source_id, target_id, type) "
+        "SELECT id, id % 60 + 1, 'A' FROM nodes, c WHERE k <= id % 3 + 1;"
+        "WITH c(k) AS (VALUES (1), (2)) INSERT INTO edges (source_id, target_id, type) "
+        "SELECT id, (id * 7) % 60 + 1, 'B' FROM nodes, c WHERE k = 1 OR id % 5 = 0;"
+        "INSERT INTO edges (source_id, target_id, type) SELECT id, 1, 'A' FROM nodes WHERE id % 4 = 0;"
+        "INSERT INTO edge_props_real (edge_id, key_id, value) "
+        "SELECT id, (SELECT id FROM property_keys WHERE key = 'w'), id % 7 + 1 FROM edges;",
+        NULL, NULL, NULL);
+    CU_ASSERT_EQUAL(rc, SQLITE_OK);
+
+    csr_graph *plain = csr_graph_load(db);
+    csr_graph *graph = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(plain);
+    CU_ASSERT_PTR_NOT_NULL(graph);
+    if (!plain || !graph) {
+        csr_graph_free(plain);
+        csr_graph_free(graph);
+        cypher_executor_free(executor);
+        sqlite3_close(db);
+        return;
+    }
+    CU_ASSERT_PTR_NULL(plain->multiplicity);
+    CU_ASSERT_EQUAL(csr_graph_edge_total(plain), plain->edge_count);
+
+    /* One slot per (source, type, target), counting the edges behind it */
+    CU_ASSERT_EQUAL(csr_graph_coalesce(graph), 0);
+    CU_ASSERT_PTR_NOT_NULL(graph->multiplicity);
+    CU_ASSERT_PTR_NOT_NULL(graph->in_multiplicity);
+    CU_ASSERT_EQUAL(graph->edge_count, 60 + 60 + 14);
+    CU_ASSERT_EQUAL(csr_graph_edge_total(graph), plain->edge_count);
+    for (int u = 0; u < graph->node_count; u++) {
+        int64_t out = 0, in = 0;
+        for (int64_t j = graph->row_ptr[u]; j < graph->row_ptr[u + 1]; j++) {
+            out += graph->multiplicity[j];
+            if (j > graph->row_ptr[u]) {
+                CU_ASSERT_TRUE(graph->edge_types[j - 1] != graph->edge_types[j] ||
+                               graph->col_idx[j - 1] != graph->col_idx[j]);
+            }
+        }
+        for (int64_t j = graph->in_row_ptr[u]; j < graph->in_row_ptr[u + 1]; j++) {
+            in += graph->in_multiplicity[j];
+        }
+        CU_ASSERT_EQUAL(out, plain->row_ptr[u + 1] - plain->row_ptr[u]);
+        CU_ASSERT_EQUAL(in, plain->in_row_ptr[u + 1] - plain->in_row_ptr[u]);
+    }
+
+    /* Coalescing again changes nothing */
+    CU_ASSERT_EQUAL(csr_graph_coalesce(graph), 0);
+    CU_ASSERT_EQUAL(graph->edge_count, 134);
+    CU_ASSERT_EQUAL(csr_graph_edge_total(graph), plain->edge_count);
+
+    /* Algorithms counting edges weigh slots by multiplicity */
+    ASSERT_SAME_RESULT(execute_degree_centrality(db, plain), execute_degree_centrality(db, graph));
+    assert_close_scores(execute_pagerank(db, plain, 0.85, 20, 1e-6, 0, false), execute_pagerank(db, graph, 0.85, 20, 1e-6, 0, false), "\"score\":");
+    assert_close_scores(execute_betweenness_centrality(db, plain, 0, 0), execute_betweenness_centrality(db, graph, 0, 0), "\"score\":");
+    assert_close_scores(execute_eigenvector_centrality(db, plain, 100), execute_eigenvector_centrality(db, graph, 100), "\"score\":");
+    ASSERT_SAME_RESULT(execute_louvain(db, plain, 1.0), execute_louvain(db, graph, 1.0));
+    ASSERT_SAME_RESULT(execute_label_propagation(db, plain, 10), execute_label_propagation(db, graph, 10));
+    ASSERT_SAME_RESULT(execute_wcc(db, plain), execute_wcc(db, graph));
+    ASSERT_SAME_RESULT(execute_bfs(db, plain, "n1", -1), execute_bfs(db, graph, "n1", -1));
+    ASSERT_SAME_RESULT(execute_triangle_count(db, plain), execute_triangle_count(db, graph));
+
+    /* Weights hold the lightest parallel edge, so shortest paths do not change */
+    const double *plain_weights = csr_graph_edge_weights(plain, db, "w");
+    const double *weights = csr_graph_edge_weights(graph, db, "w");
+    CU_ASSERT_PTR_NOT_NULL(plain_weights);
+    CU_ASSERT_PTR_NOT_NULL(weights);
+    for (int u = 0; u < graph->node_count && plain_weights && weights; u++) {
+        for (int64_t j = graph->row_ptr[u]; j < graph->row_ptr[u + 1]; j++) {
+            double lightest = -1.0;
+            for (int64_t k = plain->row_ptr[u]; k < plain->row_ptr[u + 1]; k++) {
+                if (plain->col_idx[k] == graph->col_idx[j] && plain->edge_types[k] == graph->edge_types[j] &&
+                    (lightest < 0.0 || plain_weights[k] < lightest)) {
+                    lightest = plain_weights[k];
+                }
+            }
+            CU_ASSERT_DOUBLE_EQUAL(weights[j], lightest, 1e-9);
+        }
+    }
+    ASSERT_SAME_RESULT(execute_dijkstra(db, plain, "n1", "n40", "w"), execute_dijkstra(db, graph, "n1", "n40", "w"));
+
+    /* Type views keep the multiplicities */
+    char *types[] = {"B"};
+    csr_graph *plain_view = csr_graph_type_view(plain, types, 1);
+    csr_graph *view = csr_graph_type_view(graph, types, 1);
+    CU_ASSERT_PTR_NOT_NULL(view);
+    if (plain_view && view) {
+        CU_ASSERT_PTR_NOT_NULL(view->multiplicity);
+        CU_ASSERT_EQUAL(view->edge_count, 60);
+        CU_ASSERT_EQUAL(csr_graph_edge_total(view), plain_view->edge_count);
+        assert_close_scores(execute_pagerank(db, plain_view, 0.85, 20, 1e-6, 0, false), execute_pagerank(db, view, 0.85, 20, 1e-6, 0, false), "\"score\":");
+    }
+
+    /* Reordered and compressed graphs keep them too */
+    CU_ASSERT_EQUAL(csr_graph_reorder(graph, CSR_ORDER_DEGREE), 0);
+    CU_ASSERT_EQUAL(csr_graph_compress(graph), 0);
+    CU_ASSERT_PTR_NOT_NULL(graph->multiplicity);
+    CU_ASSERT_EQUAL(csr_graph_edge_total(graph), plain->edge_count);
+    assert_close_scores(execute_pagerank(db, plain, 0.85, 20, 1e-6, 0, false), execute_pagerank(db, graph, 0.85, 20, 1e-6, 0, false), "\"score\":");
+    CU_ASSERT_EQUAL(csr_graph_reorder(graph, CSR_ORDER_ID), 0);
+    ASSERT_SAME_RESULT(execute_degree_centrality(db, plain), execute_degree_centrality(db, graph));
+
+    /* Snapshots store the multiplicities */
+    const char *snapshot_path = "/tmp/graphqlite_test_coalesced.csr";
+    sqlite3_int64 bytes = 0;
+    char *error = NULL;
+    CU_ASSERT_EQUAL(csr_graph_save_snapshot(graph, db, snapshot_path, &bytes, &error), 0);
+    free(error);
+    csr_graph *mapped = csr_graph_open_snapshot(db, snapshot_path);
+    CU_ASSERT_PTR_NOT_NULL(mapped);
+    if (mapped) {
+        CU_ASSERT_PTR_NOT_NULL(mapped->multiplicity);
+        CU_ASSERT_EQUAL(mapped->edge_count, 134);
+        CU_ASSERT_EQUAL(csr_graph_edge_total(mapped), plain->edge_count);
+        ASSERT_SAME_RESULT(execute_degree_centrality(db, plain), execute_degree_centrality(db, mapped));
+        csr_graph_free(mapped);
+    }
+    remove(snapshot_path);
+
+    /* Merged edges fold into existing slots */
+    executor->cached_graph = graph;
+    cypher_result *result = cypher_executor_execute(executor,
+        "MATCH (a {id: 'n1'}), (b {id: 'n2'}) CREATE (a)-[:A]->(b), (b)-[:C]->(a)");
+    CU_ASSERT_PTR_NOT_NULL(result);
+    if (result) cypher_result_free(result);
+    CU_ASSERT_EQUAL(csr_graph_sync(graph, db), 0);
+    CU_ASSERT_PTR_NOT_NULL(graph->multiplicity);
+    CU_ASSERT_EQUAL(graph->edge_count, 135);
+    CU_ASSERT_EQUAL(csr_graph_edge_total(graph), plain->edge_count + 2);
+
+    csr_graph *fresh = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(fresh);
+    if (fresh) {
+        ASSERT_SAME_RESULT(execute_degree_centrality(db, fresh), execute_degree_centrality(db, graph));
+        csr_graph_free(fresh);
+    }
+
+    /* Removing one of several parallel edges reloads, still coalesced */
+    sqlite3_stmt *stmt = NULL;
+    CU_ASSERT_EQUAL(sqlite3_prepare_v2(db,
+        "DELETE FROM edges WHERE id = (SELECT MAX(id) FROM edges WHERE source_id = 2 AND target_id = 3) "
+        "RETURNING id", -1, &stmt, NULL), SQLITE_OK);
+    if (stmt && sqlite3_step(stmt) == SQLITE_ROW) {
+        csr_graph_note_row_change(graph, SQLITE_DELETE, "edges", sqlite3_column_int64(stmt, 0), false);
+    }
+    sqlite3_finalize(stmt);
+    CU_ASSERT_EQUAL(csr_graph_sync(graph, db), 0);
+    CU_ASSERT_PTR_NOT_NULL(graph->multiplicity);
+    CU_ASSERT_EQUAL(graph->edge_count, 135);
+    CU_ASSERT_EQUAL(csr_graph_edge_total(graph), plain->edge_count + 1);
+
+    executor->cached_graph = NULL;
+    csr_graph_free(plain);
+    csr_graph_free(graph);
+    cypher_executor_free(executor);
+    sqlite3_close(db);
+}
+
+/* Test named projections by label and relationship type */
+static void test_graph_projection(void)
+{
+    sqlite3 *db = NULL;
+    CU_ASSERT_EQUAL(sqlite3_open(":memory:", &db), SQLITE_OK);
+    if (!db) return;
+
+    cypher_executor *executor = cypher_executor_create(db);
+    CU_ASSERT_PTR_NOT_NULL(executor);
+    if (!executor) {
+        sqlite3_close(db);
+        return;
+    }
+
+    cypher_result *result = cypher_executor_execute(executor,
+        "CREATE (a:Person {id: 'a'})-[:KNOWS {w: 4.0}]->(b:Person {id: 'b'}), "
+        "(a)-[:KNOWS {w: 1.0}]->(c:Person {id: 'c'}), (c)-[:KNOWS {w: 1.0}]->(b), "
+        "(a)-[:WORKS_AT]->(x:Company {id: 'x'}), (x)-[:EMPLOYS]->(b), (b)-[:LIKES]->(a)");
+    if (result) cypher_result_free(result);
+
+    char **labels = NULL, **types = NULL;
+    int label_count = 0, type_count = 0;
+    CU_ASSERT_EQUAL(csr_parse_name_list(db, "Person", &labels, &label_count), 0);
+    CU_ASSERT_EQUAL(label_count, 1);
+    CU_ASSERT_EQUAL(csr_parse_name_list(db, "[\"KNOWS\", \"LIKES\"]", &types, &type_count), 0);
+    CU_ASSERT_EQUAL(type_count, 2);
+
+    csr_projection *social = csr_projection_create(db, "social", labels, label_count,
+                                                   types, 1, "w");
+    csr_projection *people = csr_projection_create(db, "people", labels, label_count,
+                                                   NULL, 0, NULL);
+    csr_projection *typed = csr_projection_create(db, "typed", NULL, 0,
+                                                  types, type_count, NULL);
+    csr_projection *nobody = csr_projection_create(db, "nobody", types, 1, NULL, 0, NULL);
+    for (int i = 0; i < label_count; i++) free(labels[i]);
+    free(labels);
+    for (int i = 0; i < type_count; i++) free(types[i]);
+    free(types);
+
+    CU_ASSERT_PTR_NOT_NULL(social);
+    CU_ASSERT_PTR_NOT_NULL(people);
+    CU_ASSERT_PTR_NOT_NULL(typed);
+    CU_ASSERT_PTR_NOT_NULL(nobody);
+    if (!social || !people || !typed || !nobody) {
+        csr_projection_free_all(social);
+        csr_projection_free_all(people);
+        csr_projection_free_all(typed);
+        csr_projection_free_all(nobody);
+        cypher_executor_free(executor);
+        sqlite3_close(db);
+        return;
+    }
+
+    /* Only Person nodes, and only edges between them */
+    CU_ASSERT_EQUAL(social->graph->node_count, 3);
+    CU_ASSERT_EQUAL(social->graph->edge_count, 3);
+    CU_ASSERT_EQUAL(social->graph->weight_count, 1);
+    CU_ASSERT_EQUAL(people->graph->node_count, 3);
+    CU_ASSERT_EQUAL(people->graph->edge_count, 4);
+    CU_ASSERT_EQUAL(typed->graph->node_count, 4);
+    CU_ASSERT_EQUAL(typed->graph->edge_count, 4);
+    CU_ASSERT_EQUAL(nobody->graph->node_count, 0);
+    CU_ASSERT_EQUAL(nobody->graph->edge_count, 0);
+
+    csr_projection *list = NULL;
+    csr_projection_add(&list, social);
+    csr_projection_add(&list, people);
+    csr_projection_add(&list, typed);
+    csr_projection_add(&list, nobody);
+    executor->projections = list;
+    CU_ASSERT_PTR_EQUAL(csr_projection_find(list, "people"), people);
+    CU_ASSERT_PTR_NULL(csr_projection_find(list, "missing"));
+
+    assert_query_result(executor, "RETURN pageRank({graph: 'social'})", "\"user_id\":\"b\"");
+    result = cypher_executor_execute(executor, "RETURN pageRank({graph: 'social'})");
+    if (result) {
+        if (result->success && result->row_count > 0) {
+            CU_ASSERT_PTR_NULL(strstr(result->data[0][0], "\"user_id\":\"x\""));
+        }
+        cypher_result_free(result);
+    }
+
+    /* The projection's weight property is the default; the WORKS_AT/EMPLOYS route is not in it */
+    assert_query_result(executor, "RETURN dijkstra('a', 'b', {graph: 'social'})", "\"distance\":2");
+    assert_query_result(executor, "RETURN dijkstra('a', 'b', {graph: 'typed'})", "\"path\":[\"a\",\"b\"]");
+
+    result = cypher_executor_execute(executor, "RETURN pageRank({graph: 'missing'})");
+    CU_ASSERT_PTR_NOT_NULL(result);
+    if (result) {
+        CU_ASSERT_FALSE(result->success);
+        cypher_result_free(result);
+    }
+
+    /* Every algorithm runs on an empty projection instead of the whole graph */
+    static const char *const on_nobody[] = {
+        "RETURN pageRank({graph: 'nobody'})",
+        "RETURN labelPropagation({graph: 'nobody'})",
+        "RETURN degreeCentrality({graph: 'nobody'})",
+        "RETURN wcc({graph: 'nobody'})",
+        "RETURN scc({graph: 'nobody'})",
+        "RETURN betweennessCentrality({graph: 'nobody'})",
+        "RETURN closenessCentrality({graph: 'nobody'})",
+        "RETURN louvain({graph: 'nobody'})",
+        "RETURN triangleCount({graph: 'nobody'})",
+        "RETURN eigenvectorCentrality({graph: 'nobody'})",
+        "RETURN nodeSimilarity({graph: 'nobody'})",
+        "RETURN apsp({graph: 'nobody'})",
+    };
+    for (size_t i = 0; i < sizeof(on_nobody) / sizeof(on_nobody[0]); i++) {
+        result = cypher_executor_execute(executor, on_nobody[i]);
+        CU_ASSERT_PTR_NOT_NULL(result);
+        if (result) {
+            CU_ASSERT_TRUE(result->success);
+            if (result->success && result->row_count > 0 && result->data[0][0]) {
+                CU_ASSERT_PTR_NULL(strstr(result->data[0][0], "\"a\""));
+            }
+            cypher_result_free(result);
+        }
+    }
+    assert_query_result(executor, "RETURN bfs('a', {graph: 'nobody'})", NULL);
+    assert_query_result(executor, "RETURN dijkstra('a', 'b', {graph: 'nobody'})", "\"found\":false");
+
+    /* A write marks projections stale; the next call rebuilds the one it uses */
+    result = cypher_executor_execute(executor, "CREATE (:Person {id: 'd'})");
+    if (result) cypher_result_free(result);
+    csr_projections_note_row_change(list, "nodes");
+    CU_ASSERT_TRUE(social->stale);
+    CU_ASSERT_TRUE(nobody->stale);
+    csr_graph *rebuilt = csr_projection_graph(people, db);
+    CU_ASSERT_PTR_NOT_NULL(rebuilt);
+    if (rebuilt) CU_ASSERT_EQUAL(rebuilt->node_count, 4);
+    CU_ASSERT_FALSE(people->stale);
+
+    /* Weight changes only drop the cached column */
+    csr_projection_graph(social, db);
+    csr_projections_note_row_change(list, "edge_props_real");
+    CU_ASSERT_FALSE(social->stale);
+    CU_ASSERT_EQUAL(social->graph->weight_count, 0);
+
+    /* Adding a projection with an existing name replaces it */
+    csr_projection *replacement = csr_projection_create(db, "people", NULL, 0, NULL, 0, NULL);
+    CU_ASSERT_PTR_NOT_NULL(replacement);
+    if (replacement) {
+        csr_projection_add(&list, replacement);
+        CU_ASSERT_PTR_EQUAL(csr_projection_find(list, "people"), replacement);
+        CU_ASSERT_EQUAL(replacement->graph->node_count, 5);
+    }
+
+    CU_ASSERT_TRUE(csr_projection_drop(&list, "typed"));
+    CU_ASSERT_FALSE(csr_projection_drop(&list, "typed"));
+    executor->projections = list;
+    result = cypher_executor_execute(executor, "RETURN pageRank({graph: 'typed'})");
+    if (result) {
+        CU_ASSERT_FALSE(result->success);
+        cypher_result_free(result);
+    }
+
+    executor->projections = NULL;
+    csr_projection_free_all(list);
+    cypher_executor_free(executor);
+    sqlite3_close(db);
+}
+
+/* Test loading edge-list files into a graph and running algorithms on them */
+static void test_edgelist_graph(void)
+{
+    const char *text_path = "/tmp/graphqlite_test_edgelist.txt";
+    const char *binary_path = "/tmp/graphqlite_test_edgelist.bin";
+
+    FILE *file = fopen(text_path, "w");
+    CU_ASSERT_PTR_NOT_NULL(file);
+    if (!file) return;
+    fputs("# source target\n"
+          "alice bob\n"
+          "\n"
+          "bob\tcarol 0.5\r\n"
+          "  carol,alice\n"
+          "% comment\n"
+          "dave alice\n"
+          "bob carol", file);
+    fclose(file);
+
+    /* Nodes in order of first appearance, IDs 1..n, file identifiers as user IDs */
+    char *error = NULL;
+    csr_graph *graph = csr_graph_load_edgelist(text_path, NULL, &error);
+    CU_ASSERT_PTR_NOT_NULL(graph);
+    CU_ASSERT_PTR_NULL(error);
+    if (graph) {
+        CU_ASSERT_EQUAL(graph->node_count, 4);
+        CU_ASSERT_EQUAL(graph->edge_count, 5);
+        CU_ASSERT_TRUE(graph->node_map.dense);
+        CU_ASSERT_PTR_NULL(graph->edge_types);
+        CU_ASSERT_PTR_NULL(graph->edge_ids);
+        CU_ASSERT_STRING_EQUAL(graph->user_ids[0], "alice");
+        CU_ASSERT_STRING_EQUAL(graph->user_ids[3], "dave");
+        CU_ASSERT_EQUAL(graph->node_ids[3], 4);
+        CU_ASSERT_EQUAL(csr_graph_find_user_id(graph, "carol"), 2);
+        CU_ASSERT_EQUAL(csr_graph_find_node(graph, 2), 1);
+
+        /* bob -> carol twice, alice <- carol and dave */
+        CU_ASSERT_EQUAL(graph->row_ptr[2] - graph->row_ptr[1], 2);
+        CU_ASSERT_EQUAL(graph->in_row_ptr[1] - graph->in_row_ptr[0], 2);
+        csr_graph_free(graph);
+    }
+
+    /* Binary: int64 pairs, IDs in decimal as user IDs */
+    int64_t pairs[] = { 10, -5, -5, 4000000000LL, 4000000000LL, 10, 10, 7 };
+    file = fopen(binary_path, "wb");
+    CU_ASSERT_PTR_NOT_NULL(file);
+    if (!file) return;
+    fwrite(pairs, sizeof(pairs), 1, file);
+    fclose(file);
+
+    graph = csr_graph_load_edgelist(binary_path, "binary", &error);
+    CU_ASSERT_PTR_NOT_NULL(graph);
+    if (graph) {
+        CU_ASSERT_EQUAL(graph->node_count, 4);
+        CU_ASSERT_EQUAL(graph->edge_count, 4);
+        CU_ASSERT_STRING_EQUAL(graph->user_ids[1], "-5");
+        CU_ASSERT_EQUAL(csr_graph_find_user_id(graph, "4000000000"), 2);
+        CU_ASSERT_EQUAL(graph->row_ptr[1] - graph->row_ptr[0], 2);
+        csr_graph_free(graph);
+    }
+
+    /* Malformed input is reported, not guessed at */
+    CU_ASSERT_PTR_NULL(csr_graph_load_edgelist(text_path, "binary", &error));
+    CU_ASSERT_PTR_NOT_NULL(error);
+    free(error);
+    CU_ASSERT_PTR_NULL(csr_graph_load_edgelist(text_path, "csv", &error));
+    CU_ASSERT_PTR_NOT_NULL(error);
+    free(error);
+    CU_ASSERT_PTR_NULL(csr_graph_load_edgelist("/tmp/graphqlite_test_missing.txt", NULL, &error));
+    CU_ASSERT_PTR_NOT_NULL(error);
+    free(error);
+
+    file = fopen(binary_path, "w");
+    if (file) {
+        fputs("alice bob\nlonely\n", file);
+        fclose(file);
+        CU_ASSERT_PTR_NULL(csr_graph_load_edgelist(binary_path, "text", &error));
+        CU_ASSERT_PTR_NOT_NULL(error);
+        if (error) CU_ASSERT_PTR_NOT_NULL(strstr(error, "line 2"));
+        free(error);
+    }
+    remove(binary_path);
+
+    /* As a projection: algorithms run on it, database writes leave it alone */
+    sqlite3 *db = NULL;
+    CU_ASSERT_EQUAL(sqlite3_open(":memory:", &db), SQLITE_OK);
+    cypher_executor *executor = db ? cypher_executor_create(db) : NULL;
+    CU_ASSERT_PTR_NOT_NULL(executor);
+    csr_projection *projection = executor
+        ? csr_projection_load_edgelist(db, "file", text_path, "text", &error) : NULL;
+    CU_ASSERT_PTR_NOT_NULL(projection);
+    if (projection) {
+        executor->projections = projection;
+        assert_query_result(executor, "RETURN pageRank({graph: 'file'})", "\"user_id\":\"alice\"");
+        assert_query_result(executor, "RETURN wcc({graph: 'file'})", "\"user_id\":\"dave\"");
+        assert_query_result(executor, "RETURN bfs('dave', {graph: 'file'})", "\"user_id\":\"carol\"");
+
+        cypher_result *result = cypher_executor_execute(executor, "CREATE (:Person {id: 'erin'})");
+        if (result) cypher_result_free(result);
+        csr_projections_note_row_change(projection, "nodes");
+        csr_projections_mark_stale(projection);
+        CU_ASSERT_FALSE(projection->stale);
+        CU_ASSERT_EQUAL(csr_projection_graph(projection, db)->node_count, 4);
+
+        /* Evicted: read from the file again on next use */
+        csr_cache_set_budget(1);
+        csr_cache_enforce(db, NULL);
+        CU_ASSERT_PTR_NULL(projection->graph);
+        csr_cache_set_budget(0);
+        csr_graph *reloaded = csr_projection_graph(projection, db);
+        CU_ASSERT_PTR_NOT_NULL(reloaded);
+        if (reloaded) CU_ASSERT_EQUAL(reloaded->edge_count, 5);
+
+        executor->projections = NULL;
+        csr_projection_free_all(projection);
+    }
+    CU_ASSERT_PTR_NULL(csr_projection_load_edgelist(db, "bad", text_path, "csv", &error));
+    CU_ASSERT_PTR_NOT_NULL(error);
+    free(error);
+
+    cypher_executor_free(executor);
+    sqlite3_close(db);
+    remove(text_path);
+}
+
+/* Test memory accounting and LRU eviction under a budget */
+static void test_graph_memory_budget(void)
+{
+    csr_graph *graph = csr_graph_load(test_db);
+    CU_ASSERT_PTR_NOT_NULL(graph);
+    if (!graph) return;
+
+    size_t n = (size_t)graph->node_count;
+    size_t m = (size_t)graph->edge_count;
+    csr_graph_memory_usage usage;
+    csr_graph_memory(graph, &usage);
+    CU_ASSERT_EQUAL(usage.adjacency, 2 * (n + 1) * sizeof(int64_t) + 2 * m * sizeof(int));
+    CU_ASSERT_EQUAL(usage.edge_ids, m * sizeof(int64_t));
+    CU_ASSERT_EQUAL(usage.node_index, n * sizeof(int64_t) +
+                    (size_t)graph->node_map.capacity * sizeof(csr_node_slot));
+    CU_ASSERT_EQUAL(usage.weights, 0);
+    CU_ASSERT_EQUAL(usage.total, usage.adjacency + usage.edge_types + usage.edge_ids +
+                    usage.node_index + usage.user_ids + usage.weights + usage.type_view +
+                    usage.undirected + usage.out_sets + usage.delta);
+    CU_ASSERT_EQUAL(usage.shared, 0);
+    CU_ASSERT_EQUAL(usage.mapped, 0);
+    CU_ASSERT_EQUAL(csr_graph_memory_charge(graph), usage.total);
+
+    /* Cached weights and compression show up in their components */
+    CU_ASSERT_PTR_NOT_NULL(csr_graph_edge_weights(graph, test_db, "weight"));
+    csr_graph_memory(graph, &usage);
+    CU_ASSERT_EQUAL(usage.weights, m * sizeof(double) + strlen("weight") + 1);
+    CU_ASSERT_EQUAL(csr_graph_compress(graph), 0);
+    csr_graph_memory(graph, &usage);
+    CU_ASSERT_EQUAL(usage.adjacency, csr_graph_adjacency_bytes(graph) + 2 * (n + 1) * sizeof(int64_t));
+    const csr_neighbour_sets *undirected = csr_graph_undirected(graph);
+    CU_ASSERT_PTR_NOT_NULL(undirected);
+    if (undirected) {
+        csr_graph_memory(graph, &usage);
+        CU_ASSERT_EQUAL(usage.undirected, (n + 1) * sizeof(int64_t) +
+                        2 * (size_t)undirected->row_ptr[n] * sizeof(int));
+    }
+    const csr_neighbour_sets *out_sets = csr_graph_out_sets(graph);
+    CU_ASSERT_PTR_NOT_NULL(out_sets);
+    if (out_sets) {
+        csr_graph_memory(graph, &usage);
+        CU_ASSERT_EQUAL(usage.out_sets, (n + 1) * sizeof(int64_t) +
+                        2 * (size_t)out_sets->row_ptr[n] * sizeof(int));
+    }
+    csr_graph_free(graph);
+
+    /* Three equal projections; a budget for two and a half evicts the oldest */
+    csr_cache_stats before;
+    csr_cache_get_stats(&before);
+    csr_projection *list = NULL;
+    csr_projection *p1 = csr_projection_create(test_db, "p1", NULL, 0, NULL, 0, NULL);
+    csr_projection *p2 = csr_projection_create(test_db, "p2", NULL, 0, NULL, 0, NULL);
+    csr_projection *p3 = csr_projection_create(test_db, "p3", NULL, 0, NULL, 0, NULL);
+    CU_ASSERT_PTR_NOT_NULL(p1);
+    CU_ASSERT_PTR_NOT_NULL(p2);
+    CU_ASSERT_PTR_NOT_NULL(p3);
+    if (!p1 || !p2 || !p3) {
+        csr_projection_free_all(p1);
+        csr_projection_free_all(p2);
+        csr_projection_free_all(p3);
+        return;
+    }
+    csr_projection_add(&list, p1);
+    csr_projection_add(&list, p2);
+    csr_projection_add(&list, p3);
+
+    size_t charge = p1->cache.bytes;
+    CU_ASSERT_TRUE(charge > 0);
+    CU_ASSERT_EQUAL(charge, csr_graph_memory_charge(p1->graph));
+
+    csr_cache_stats stats;
+    csr_cache_get_stats(&stats);
+    CU_ASSERT_EQUAL(stats.entries, before.entries + 3);
+    CU_ASSERT_EQUAL(stats.used, before.used + 3 * charge);
+
+    csr_cache_set_budget(before.used + 2 * charge + charge / 2);
+    CU_ASSERT_EQUAL(csr_cache_enforce(test_db, NULL), 1);
+    CU_ASSERT_PTR_NULL(p1->graph);
+    CU_ASSERT_PTR_NOT_NULL(p2->graph);
+    CU_ASSERT_PTR_NOT_NULL(p3->graph);
+
+    /* Using the evicted one rebuilds it and evicts the next least recently used */
+    csr_graph *rebuilt = csr_projection_graph(p1, test_db);
+    CU_ASSERT_PTR_NOT_NULL(rebuilt);
+    CU_ASSERT_PTR_EQUAL(p1->graph, rebuilt);
+    CU_ASSERT_PTR_NULL(p2->graph);
+    CU_ASSERT_PTR_NOT_NULL(p3->graph);
+
+    /* Touching p3 makes p1 the oldest */
+    CU_ASSERT_PTR_NOT_NULL(csr_projection_graph(p3, test_db));
+    CU_ASSERT_PTR_NOT_NULL(csr_projection_graph(p2, test_db));
+    CU_ASSERT_PTR_NULL(p1->graph);
+    CU_ASSERT_PTR_NOT_NULL(p3->graph);
+
+    csr_cache_get_stats(&stats);
+    CU_ASSERT_EQUAL(stats.evictions, before.evictions + 3);
+    CU_ASSERT_EQUAL(stats.entries, before.entries + 2);
+    CU_ASSERT_TRUE(stats.used <= stats.budget);
+
+    char *json = csr_graph_stats_json(NULL, list);
+    CU_ASSERT_PTR_NOT_NULL(json);
+    if (json) {
+        CU_ASSERT_PTR_NOT_NULL(strstr(json, "\"graph\":null"));
+        CU_ASSERT_PTR_NOT_NULL(strstr(json, "{\"name\":\"p1\",\"loaded\":false}"));
+        CU_ASSERT_PTR_NOT_NULL(strstr(json, "{\"name\":\"p2\",\"loaded\":true,"));
+        free(json);
+    }
+
+    csr_cache_set_budget(0);
+    csr_projection_free_all(list);
+    csr_cache_get_stats(&stats);
+    CU_ASSERT_EQUAL(stats.entries, before.entries);
+    CU_ASSERT_EQUAL(stats.used, before.used);
+}
+
+/* Test sharing one graph between connections through the registry */
+static void test_shared_graph_registry(void)
+{
+    const char *path = "/tmp/graphqlite_test_registry.db";
+    remove(path);
+
+    sqlite3 *db = NULL;
+    sqlite3 *other = NULL;
+    CU_ASSERT_EQUAL(sqlite3_open(path, &db), SQLITE_OK);
+    CU_ASSERT_EQUAL(sqlite3_open(path, &other), SQLITE_OK);
+    cypher_executor *executor = db ? cypher_executor_create(db) : NULL;
+    cypher_executor *other_executor = other ? cypher_executor_create(other) : NULL;
+    CU_ASSERT_PTR_NOT_NULL(executor);
+    CU_ASSERT_PTR_NOT_NULL(other_executor);
+    if (!executor || !other_executor) {
+        if (executor) cypher_executor_free(executor);
+        if (other_executor) cypher_executor_free(other_executor);
+        sqlite3_close(db);
+        sqlite3_close(other);
+        return;
+    }
+
+    cypher_result *result = cypher_executor_execute(executor,
+        "CREATE (:P {id: 'a'})-[:R]->(:P {id: 'b'})-[:Q]->(:P {id: 'c'})");
+    if (result) cypher_result_free(result);
+
+    /* The second connection shares the first one's arrays */
+    const char *source = NULL;
+    csr_graph *graph = csr_graph_acquire(db, NULL, &source);
+    CU_ASSERT_PTR_NOT_NULL(graph);
+    CU_ASSERT_STRING_EQUAL(source, "sqlite");
+    csr_graph *other_graph = csr_graph_acquire(other, NULL, &source);
+    CU_ASSERT_PTR_NOT_NULL(other_graph);
+    CU_ASSERT_STRING_EQUAL(source, "shared");
+    if (!graph || !other_graph) {
+        csr_graph_free(graph);
+        csr_graph_free(other_graph);
+        cypher_executor_free(executor);
+        cypher_executor_free(other_executor);
+        sqlite3_close(db);
+        sqlite3_close(other);
+        return;
+    }
+    CU_ASSERT_PTR_EQUAL(graph->row_ptr, other_graph->row_ptr);
+    CU_ASSERT_PTR_EQUAL(graph->user_ids, other_graph->user_ids);
+    CU_ASSERT_PTR_NOT_EQUAL(graph->type_names, other_graph->type_names);
+    CU_ASSERT_EQUAL(csr_graph_share_count(graph), 2);
+    CU_ASSERT_TRUE(csr_graph_find_user_id(other_graph, "c") >= 0);
+
+    /* Per-connection caches stay per connection */
+    char *types[] = {"R"};
+    csr_graph *view = csr_graph_type_view(graph, types, 1);
+    CU_ASSERT_PTR_NOT_NULL(view);
+    if (view) CU_ASSERT_EQUAL(view->edge_count, 1);
+    CU_ASSERT_PTR_NULL(other_graph->type_view);
+
+    /* Writes merge into private arrays and drop the reference */
+    executor->cached_graph = graph;
+    result = cypher_executor_execute(executor,
+        "MATCH (c:P {id: 'c'}) CREATE (c)-[:R]->(:P {id: 'd'})");
+    if (result) cypher_result_free(result);
+    CU_ASSERT_EQUAL(csr_graph_sync(graph, db), 0);
+    CU_ASSERT_EQUAL(csr_graph_share_count(graph), 0);
+    CU_ASSERT_EQUAL(csr_graph_share_count(other_graph), 1);
+    CU_ASSERT_EQUAL(graph->node_count, 4);
+    CU_ASSERT_EQUAL(other_graph->node_count, 3);
+
+    csr_graph *fresh = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(fresh);
+    if (fresh) {
+        assert_graphs_equivalent(graph, fresh);
+        csr_graph_free(fresh);
+    }
+
+    /* The other connection sees the commit and reloads through the registry */
+    CU_ASSERT_EQUAL(csr_graph_sync(other_graph, other), 0);
+    CU_ASSERT_EQUAL(other_graph->node_count, 4);
+    CU_ASSERT_EQUAL(csr_graph_share_count(other_graph), 1);
+    csr_graph *third = csr_graph_acquire(db, NULL, &source);
+    CU_ASSERT_PTR_NOT_NULL(third);
+    CU_ASSERT_STRING_EQUAL(source, "shared");
+    CU_ASSERT_EQUAL(csr_graph_share_count(other_graph), 2);
+    csr_graph_free(third);
+
+    /* An in-place update keeps the fingerprint; the writer must not get the old copy back */
+    CU_ASSERT_EQUAL(sqlite3_exec(other, "UPDATE edges SET target_id = 1 WHERE id = 1", NULL, NULL, NULL),
+                    SQLITE_OK);
+    csr_graph_note_write(other);
+    csr_graph_note_row_change(other_graph, SQLITE_UPDATE, "edges", 1, false);
+    CU_ASSERT_EQUAL(csr_graph_sync(other_graph, other), 0);
+    fresh = csr_graph_load(other);
+    CU_ASSERT_PTR_NOT_NULL(fresh);
+    if (fresh) {
+        assert_graphs_equivalent(other_graph, fresh);
+        csr_graph_free(fresh);
+    }
+    CU_ASSERT_EQUAL(csr_graph_share_count(other_graph), 1);
+
+    /* Later acquires share the writer's reloaded copy */
+    third = csr_graph_acquire(db, NULL, &source);
+    CU_ASSERT_PTR_NOT_NULL(third);
+    CU_ASSERT_STRING_EQUAL(source, "shared");
+    if (third) CU_ASSERT_PTR_EQUAL(third->col_idx, other_graph->col_idx);
+    csr_graph_free(third);
+
+    /* A connection inside a transaction gets a private graph */
+    sqlite3_exec(db, "BEGIN", NULL, NULL, NULL);
+    csr_graph *private_graph = csr_graph_acquire(db, NULL, &source);
+    CU_ASSERT_PTR_NOT_NULL(private_graph);
+    CU_ASSERT_STRING_EQUAL(source, "sqlite");
+    CU_ASSERT_EQUAL(csr_graph_share_count(private_graph), 0);
+    csr_graph_free(private_graph);
+    sqlite3_exec(db, "COMMIT", NULL, NULL, NULL);
+
+    executor->cached_graph = NULL;
+    csr_graph_free(graph);
+    csr_graph_free(other_graph);
+    cypher_executor_free(executor);
+    cypher_executor_free(other_executor);
+    sqlite3_close(other);
+    sqlite3_close(db);
+    remove(path);
+}
+
+/* Writes the executor does not record: plain SQL, other connections, rollbacks */
+static void test_cache_external_writes(void)
+{
+    const char *path = "/tmp/graphqlite_test_cache_external.db";
+    remove(path);
+
+    sqlite3 *db = NULL;
+    sqlite3 *other = NULL;
+    CU_ASSERT_EQUAL(sqlite3_open(path, &db), SQLITE_OK);
+    CU_ASSERT_EQUAL(sqlite3_open(path, &other), SQLITE_OK);
+    if (!db || !other) {
+        sqlite3_close(db);
+        sqlite3_close(other);
+        return;
+    }
+
+    cypher_executor *executor = cypher_executor_create(db);
+    CU_ASSERT_PTR_NOT_NULL(executor);
+    if (!executor) {
+        sqlite3_close(db);
+        sqlite3_close(other);
+        return;
+    }
+
+    cypher_result *result = cypher_executor_execute(executor,
+        "CREATE (:P {id: 'a'})-[:R]->(:P {id: 'b'})");
+    if (result) cypher_result_free(result);
+
+    csr_graph *graph = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(graph);
+    if (!graph) {
+        cypher_executor_free(executor);
+        sqlite3_close(db);
+        sqlite3_close(other);
+        return;
+    }
+    executor->cached_graph = graph;
+
+    /* Plain SQL node on this connection, as reported by the update hook */
+    sqlite3_exec(db, "INSERT INTO nodes DEFAULT VALUES", NULL, NULL, NULL);
+    csr_graph_note_row_change(graph, SQLITE_INSERT, "nodes", sqlite3_last_insert_rowid(db), false);
+    sqlite3_exec(db, "INSERT INTO node_props_text (node_id, key_id, value) "
+                     "SELECT 3, id, 'c' FROM property_keys WHERE key = 'id'", NULL, NULL, NULL);
+    csr_graph_note_row_change(graph, SQLITE_INSERT, "node_props_text", sqlite3_last_insert_rowid(db), false);
+    CU_ASSERT_TRUE(csr_graph_pending_changes(graph) > 0);
+    CU_ASSERT_EQUAL(csr_graph_sync(graph, db), 0);
+    CU_ASSERT_EQUAL(graph->node_count, 3);
+    CU_ASSERT_TRUE(csr_graph_find_user_id(graph, "c") >= 0);
+
+    /* Plain SQL edge: endpoints unknown to the hook, so the graph is reloaded */
+    sqlite3_exec(db, "INSERT INTO edges (source_id, target_id, type) VALUES (3, 1, 'R')", NULL, NULL, NULL);
+    csr_graph_note_row_change(graph, SQLITE_INSERT, "edges", sqlite3_last_insert_rowid(db), false);
+    CU_ASSERT_EQUAL(csr_graph_pending_changes(graph), -1);
+    CU_ASSERT_EQUAL(csr_graph_sync(graph, db), 0);
+    CU_ASSERT_EQUAL(graph->edge_count, 2);
+
+    /* Executor edges are accounted for and merged, not reloaded */
+    result = cypher_executor_execute(executor,
+        "MATCH (b:P {id: 'b'}), (c {id: 'c'}) CREATE (b)-[:R]->(c)");
+    if (result) cypher_result_free(result);
+    csr_graph_note_row_change(graph, SQLITE_INSERT, "edges", sqlite3_last_insert_rowid(db), true);
+    CU_ASSERT_EQUAL(csr_graph_pending_changes(graph), 1);
+
+    /* SET of an existing node's id is picked up on merge */
+    result = cypher_executor_execute(executor, "MATCH (n:P {id: 'a'}) SET n.id = 'z'");
+    if (result) cypher_result_free(result);
+    CU_ASSERT_EQUAL(csr_graph_sync(graph, db), 0);
+    CU_ASSERT_EQUAL(graph->edge_count, 3);
+    CU_ASSERT_EQUAL(csr_graph_find_user_id(graph, "a"), -1);
+    CU_ASSERT_TRUE(csr_graph_find_user_id(graph, "z") >= 0);
+
+    /* Commit from another connection is seen through PRAGMA data_version */
+    CU_ASSERT_EQUAL(sqlite3_exec(other,
+        "INSERT INTO edges (source_id, target_id, type) VALUES (1, 3, 'R')", NULL, NULL, NULL), SQLITE_OK);
+    csr_graph_check_data_version(graph, db);
+    CU_ASSERT_EQUAL(csr_graph_pending_changes(graph), -1);
+    CU_ASSERT_EQUAL(csr_graph_sync(graph, db), 0);
+    CU_ASSERT_EQUAL(csr_graph_pending_changes(graph), 0);
+
+    csr_graph *fresh = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(fresh);
+    if (fresh) {
+        assert_graphs_equivalent(graph, fresh);
+        csr_graph_free(fresh);
+    }
+
+    /* In sync: nothing to do */
+    csr_graph_check_data_version(graph, db);
+    CU_ASSERT_EQUAL(csr_graph_pending_changes(graph), 0);
+
+    executor->cached_graph = NULL;
+    csr_graph_free(graph);
+    cypher_executor_free(executor);
+    sqlite3_close(other);
+    sqlite3_close(db);
+    remove(path);
+}
+
 int init_cache_suite(void)
 {
     CU_pSuite suite = CU_add_suite("Graph Cache Tests",
@@ -324,7 +2324,26 @@ int init_cache_suite(void)
         CU_add_test(suite, "PageRank without cached graph", test_pagerank_without_cached_graph) == NULL ||
         CU_add_test(suite, "Cache reuse across algorithms", test_cache_reuse_across_algorithms) == NULL ||
         CU_add_test(suite, "Empty graph cache", test_empty_graph_cache) == NULL ||
-        CU_add_test(suite, "Cache invalidation pattern", test_cache_invalidation_pattern) == NULL) {
+        CU_add_test(suite, "Cache invalidation pattern", test_cache_invalidation_pattern) == NULL ||
+        CU_add_test(suite, "CSR node lookup", test_csr_node_lookup) == NULL ||
+        CU_add_test(suite, "CSR node lookup sparse IDs", test_csr_node_lookup_sparse_ids) == NULL ||
+        CU_add_test(suite, "CSR 64-bit IDs", test_csr_64bit_ids) == NULL ||
+        CU_add_test(suite, "CSR user ID lookup", test_csr_user_id_lookup) == NULL ||
+        CU_add_test(suite, "Cache delta merge", test_cache_delta_merge) == NULL ||
+        CU_add_test(suite, "Cache external writes", test_cache_external_writes) == NULL ||
+        CU_add_test(suite, "Relationship type view", test_relationship_type_view) == NULL ||
+        CU_add_test(suite, "Cached edge weights", test_cached_edge_weights) == NULL ||
+        CU_add_test(suite, "Graph snapshot", test_graph_snapshot) == NULL ||
+        CU_add_test(suite, "Compressed adjacency", test_compressed_adjacency) == NULL ||
+        CU_add_test(suite, "Parallel graph build", test_parallel_graph_build) == NULL ||
+        CU_add_test(suite, "Node reorder", test_node_reorder) == NULL ||
+        CU_add_test(suite, "Compact node IDs", test_compact_node_ids) == NULL ||
+        CU_add_test(suite, "Coalesced edges", test_coalesced_edges) == NULL ||
+        CU_add_test(suite, "Undirected adjacency", test_undirected_adjacency) == NULL ||
+        CU_add_test(suite, "Graph projection", test_graph_projection) == NULL ||
+        CU_add_test(suite, "Edge-list graph", test_edgelist_graph) == NULL ||
+        CU_add_test(suite, "Graph memory budget", test_graph_memory_budget) == NULL ||
+        CU_add_test(suite, "Shared graph registry", test_shared_graph_registry) == NULL) {
         return CU_get_error();
     }
 
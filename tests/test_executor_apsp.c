@@ -225,6 +225,68 @@ static void test_apsp_cycle(void)
     }
 }
 
+static void test_apsp_weighted(void)
+{
+    cypher_executor_free(executor);
+    sqlite3_close(test_db);
+    sqlite3_open(":memory:", &test_db);
+    executor = cypher_executor_create(test_db);
+
+    /* a -> c costs 5.0 directly, 3.5 through b */
+    exec_cypher("CREATE (a:Node {id: 'a'}), (b:Node {id: 'b'}), (c:Node {id: 'c'})");
+    exec_cypher("MATCH (a {id: 'a'}), (b {id: 'b'}) CREATE (a)-[:L {cost: 1.5}]->(b)");
+    exec_cypher("MATCH (b {id: 'b'}), (c {id: 'c'}) CREATE (b)-[:L {cost: 2.0}]->(c)");
+    exec_cypher("MATCH (a {id: 'a'}), (c {id: 'c'}) CREATE (a)-[:L {cost: 5.0}]->(c)");
+
+    char *json = exec_get_json("RETURN apsp({weight: 'cost'})");
+    CU_ASSERT_PTR_NOT_NULL(json);
+    if (json) {
+        CU_ASSERT_PTR_NOT_NULL(strstr(json, "{\"source\":\"a\",\"target\":\"b\",\"distance\":1.5}"));
+        CU_ASSERT_PTR_NOT_NULL(strstr(json, "{\"source\":\"a\",\"target\":\"c\",\"distance\":3.5}"));
+        CU_ASSERT_PTR_NOT_NULL(strstr(json, "{\"source\":\"b\",\"target\":\"c\",\"distance\":2}"));
+        free(json);
+    }
+
+    /* Without the option, hops */
+    json = exec_get_json("RETURN apsp()");
+    CU_ASSERT_PTR_NOT_NULL(json);
+    if (json) {
+        CU_ASSERT_PTR_NOT_NULL(strstr(json, "{\"source\":\"a\",\"target\":\"c\",\"distance\":1}"));
+        free(json);
+    }
+}
+
+static void test_apsp_bfs_matches_floyd_warshall(void)
+{
+    cypher_executor_free(executor);
+    sqlite3_close(test_db);
+    sqlite3_open(":memory:", &test_db);
+    executor = cypher_executor_create(test_db);
+    exec_cypher("CREATE (a:Node {id: 'a'})");
+
+    /* 150 nodes (three tiles, the last partial), sparse enough for BFS */
+    int rc = sqlite3_exec(test_db,
+        "WITH RECURSIVE cnt(x) AS (VALUES(2) UNION ALL SELECT x+1 FROM cnt WHERE x < 150) "
+        "INSERT INTO nodes (id) SELECT x FROM cnt;"
+        "INSERT INTO edges (source_id, target_id, type) SELECT id, id + 1, 'L' FROM nodes WHERE id < 120;"
+        "INSERT INTO edges (source_id, target_id, type) SELECT id, (id * 37) % 150 + 1, 'L' FROM nodes WHERE id % 3 = 0;"
+        "INSERT INTO edges (source_id, target_id, type) SELECT id, id - 60, 'L' FROM nodes WHERE id > 130;",
+        NULL, NULL, NULL);
+    CU_ASSERT_EQUAL(rc, SQLITE_OK);
+
+    /* Unweighted: BFS. A property no edge has weighs every edge 1.0: Floyd-Warshall */
+    char *bfs = exec_get_json("RETURN apsp()");
+    char *floyd = exec_get_json("RETURN apsp({weight: 'missing'})");
+    CU_ASSERT_PTR_NOT_NULL(bfs);
+    CU_ASSERT_PTR_NOT_NULL(floyd);
+    if (bfs && floyd) {
+        CU_ASSERT_STRING_EQUAL(bfs, floyd);
+        CU_ASSERT_PTR_NOT_NULL(strstr(bfs, "\"distance\":2"));
+    }
+    free(bfs);
+    free(floyd);
+}
+
 /* =============================================================================
  * Test Suite Registration
  * =============================================================================
@@ -242,6 +304,8 @@ int init_executor_apsp_suite(void)
     if (!CU_add_test(suite, "APSP disconnected", test_apsp_disconnected)) return CU_get_error();
     if (!CU_add_test(suite, "APSP alias", test_apsp_alias)) return CU_get_error();
     if (!CU_add_test(suite, "APSP cycle", test_apsp_cycle)) return CU_get_error();
+    if (!CU_add_test(suite, "APSP weighted", test_apsp_weighted)) return CU_get_error();
+    if (!CU_add_test(suite, "APSP BFS matches Floyd-Warshall", test_apsp_bfs_matches_floyd_warshall)) return CU_get_error();
 
     return CUE_SUCCESS;
 }
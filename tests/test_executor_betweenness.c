@@ -10,6 +10,7 @@
 #include <stdlib.h>
 #include <math.h>
 #include "executor/cypher_executor.h"
+#include "executor/cypher_schema.h"
 #include "executor/graph_algorithms.h"
 
 /* Test fixture */
@@ -210,6 +211,143 @@ static void test_betweenness_alias(void)
     }
 }
 
+static void test_betweenness_sampled(void)
+{
+    cypher_executor_free(executor);
+    sqlite3_close(test_db);
+    sqlite3_open(":memory:", &test_db);
+    executor = cypher_executor_create(test_db);
+
+    /* Chain a -> b -> c -> d */
+    exec_cypher("CREATE (a:Node {id: 'a'})-[:NEXT]->(b:Node {id: 'b'})-[:NEXT]->(c:Node {id: 'c'})-[:NEXT]->(d:Node {id: 'd'})");
+
+    /* Two of four sources: rows carry the sample size and error bound */
+    char *json = exec_get_json("RETURN betweennessCentrality({samples: 2, seed: 3})");
+    CU_ASSERT_PTR_NOT_NULL(json);
+    if (json) {
+        CU_ASSERT_PTR_NOT_NULL(strstr(json, "\"samples\":2,\"error\":"));
+        free(json);
+    }
+
+    /* As many samples as nodes is the exact computation */
+    char *exact = exec_get_json("RETURN betweennessCentrality()");
+    char *all = exec_get_json("RETURN betweennessCentrality({samples: 4})");
+    CU_ASSERT_PTR_NOT_NULL(exact);
+    CU_ASSERT_PTR_NOT_NULL(all);
+    if (exact && all) {
+        CU_ASSERT_STRING_EQUAL(exact, all);
+        CU_ASSERT_PTR_NULL(strstr(all, "samples"));
+    }
+    free(exact);
+    free(all);
+}
+
+/* Run an algorithm on two graphs and check both give the same JSON */
+#define ASSERT_SAME_RESULT(call_plain, call_compressed) do { \
+        graph_algo_result *r1 = (call_plain); \
+        graph_algo_result *r2 = (call_compressed); \
+        CU_ASSERT_TRUE(r1 && r2 && r1->success && r2->success); \
+        if (r1 && r2 && r1->json_result && r2->json_result) { \
+            CU_ASSERT_STRING_EQUAL(r1->json_result, r2->json_result); \
+        } \
+        graph_algo_result_free(r1); \
+        graph_algo_result_free(r2); \
+    } while (0)
+
+/* Assert two results list the same numbers after each "key": (within float rounding) */
+static void assert_close_scores(graph_algo_result *r1, graph_algo_result *r2, const char *key)
+{
+    CU_ASSERT_TRUE(r1 && r2 && r1->success && r2->success);
+    if (r1 && r2 && r1->json_result && r2->json_result) {
+        const char *p1 = r1->json_result;
+        const char *p2 = r2->json_result;
+        int count = 0;
+        while ((p1 = strstr(p1, key)) != NULL) {
+            p2 = strstr(p2, key);
+            CU_ASSERT_PTR_NOT_NULL(p2);
+            if (!p2) break;
+            p1 += strlen(key);
+            p2 += strlen(key);
+            double a = strtod(p1, NULL);
+            double b = strtod(p2, NULL);
+            CU_ASSERT_TRUE(fabs(a - b) <= 1e-5 * (1.0 + fabs(a)));
+            count++;
+        }
+        CU_ASSERT_TRUE(count > 0);
+        CU_ASSERT_PTR_NULL(strstr(p2 ? p2 : "", key));
+    }
+    graph_algo_result_free(r1);
+    graph_algo_result_free(r2);
+}
+
+/* Sum of the scores in a betweenness result */
+static double sum_scores(const graph_algo_result *r)
+{
+    double sum = 0.0;
+    const char *p = r && r->json_result ? r->json_result : "";
+    while ((p = strstr(p, "\"score\":")) != NULL) {
+        p += strlen("\"score\":");
+        sum += strtod(p, NULL);
+    }
+    return sum;
+}
+
+/* Test betweenness split across threads, and sampled from a subset of sources */
+static void test_parallel_betweenness(void)
+{
+    sqlite3 *db = NULL;
+    CU_ASSERT_EQUAL(sqlite3_open(":memory:", &db), SQLITE_OK);
+    if (!db) return;
+
+    cypher_schema_manager *schema_mgr = cypher_schema_create_manager(db);
+    if (schema_mgr) {
+        cypher_schema_initialize(schema_mgr);
+        cypher_schema_free_manager(schema_mgr);
+    }
+
+    /* A ring with chords, doubled edges and a hub: enough work for several chunks */
+    int rc = sqlite3_exec(db,
+        "WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < 400) "
+        "INSERT INTO nodes (id) SELECT x FROM cnt;"
+        "INSERT INTO edges (source_id, target_id, type) SELECT id, id % 400 + 1, 'A' FROM nodes;"
+        "INSERT INTO edges (source_id, target_id, type) SELECT id, (id * 37) % 400 + 1, 'B' FROM nodes;"
+        "INSERT INTO edges (source_id, target_id, type) SELECT id, id % 400 + 1, 'A' FROM nodes WHERE id % 3 = 0;"
+        "INSERT INTO edges (source_id, target_id, type) SELECT id, 1, 'A' FROM nodes WHERE id % 5 = 0;",
+        NULL, NULL, NULL);
+    CU_ASSERT_EQUAL(rc, SQLITE_OK);
+
+    csr_graph *graph = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(graph);
+    if (!graph) {
+        sqlite3_close(db);
+        return;
+    }
+
+    /* Thread count changes only the order sources are added in */
+    graph_set_thread_count(1);
+    graph_algo_result *one = execute_betweenness_centrality(db, graph, 0, 0);
+    graph_set_thread_count(4);
+    graph_algo_result *four = execute_betweenness_centrality(db, graph, 0, 0);
+    graph_algo_result *all = execute_betweenness_centrality(db, graph, 400, 0);
+    graph_set_thread_count(0);
+    double exact_sum = sum_scores(four);
+    CU_ASSERT_TRUE(exact_sum > 0.0);
+    ASSERT_SAME_RESULT(four, all);
+    assert_close_scores(one, execute_betweenness_centrality(db, graph, 0, 0), "\"score\":");
+
+    /* Sampling: reproducible for a seed, unbiased, and reports its error bound */
+    graph_algo_result *sampled = execute_betweenness_centrality(db, graph, 100, 7);
+    CU_ASSERT_TRUE(sampled && sampled->success);
+    if (sampled && sampled->json_result) {
+        CU_ASSERT_PTR_NOT_NULL(strstr(sampled->json_result, "\"samples\":100,\"error\":"));
+        CU_ASSERT_DOUBLE_EQUAL(sum_scores(sampled), exact_sum, 0.2 * exact_sum);
+    }
+    ASSERT_SAME_RESULT(sampled, execute_betweenness_centrality(db, graph, 100, 7));
+
+    csr_graph_free(graph);
+    sqlite3_close(db);
+}
+
 /* =============================================================================
  * Test Suite Registration
  * =============================================================================
@@ -227,6 +365,8 @@ int init_executor_betweenness_suite(void)
     if (!CU_add_test(suite, "Diamond graph", test_betweenness_diamond)) return CU_get_error();
     if (!CU_add_test(suite, "Star graph", test_betweenness_star)) return CU_get_error();
     if (!CU_add_test(suite, "Alias betweenness()", test_betweenness_alias)) return CU_get_error();
+    if (!CU_add_test(suite, "Sampled sources", test_betweenness_sampled)) return CU_get_error();
+    if (!CU_add_test(suite, "Parallel betweenness", test_parallel_betweenness)) return CU_get_error();
 
     return CUE_SUCCESS;
 }
@@ -6,10 +6,12 @@
 
 #include <CUnit/CUnit.h>
 #include <CUnit/Basic.h>
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <math.h>
 #include "executor/cypher_executor.h"
+#include "executor/cypher_schema.h"
 #include "executor/graph_algorithms.h"
 
 /* Test fixture */
@@ -202,6 +204,199 @@ static void test_closeness_alias(void)
     }
 }
 
+static void test_harmonic_chain(void)
+{
+    cypher_executor_free(executor);
+    sqlite3_close(test_db);
+    sqlite3_open(":memory:", &test_db);
+    executor = cypher_executor_create(test_db);
+
+    /* Create chain: a -> b -> c */
+    exec_cypher("CREATE (a:Node {id: 'a'})-[:LINK]->(b:Node {id: 'b'})-[:LINK]->(c:Node {id: 'c'})");
+
+    /* a: distances 1 and 2 */
+    char *json = exec_get_json("RETURN harmonicCentrality()");
+    CU_ASSERT_PTR_NOT_NULL(json);
+    if (json) {
+        CU_ASSERT_PTR_NOT_NULL(strstr(json, "\"user_id\":\"a\",\"score\":0.750000"));
+        CU_ASSERT_PTR_NOT_NULL(strstr(json, "\"user_id\":\"b\",\"score\":1.000000"));
+        free(json);
+    }
+
+    /* Closeness is harmonic by default */
+    json = exec_get_json("RETURN closenessCentrality()");
+    CU_ASSERT_PTR_NOT_NULL(json);
+    if (json) {
+        CU_ASSERT_PTR_NOT_NULL(strstr(json, "\"user_id\":\"a\",\"score\":0.750000"));
+        free(json);
+    }
+
+    /* Wasserman-Faust, a: 2 of 2 reachable at total distance 3 */
+    json = exec_get_json("RETURN closenessCentrality({wassermanFaust: true})");
+    CU_ASSERT_PTR_NOT_NULL(json);
+    if (json) {
+        CU_ASSERT_PTR_NOT_NULL(strstr(json, "\"user_id\":\"a\",\"score\":0.666667"));
+        CU_ASSERT_PTR_NOT_NULL(strstr(json, "\"user_id\":\"b\",\"score\":1.000000"));
+        free(json);
+    }
+}
+
+static void test_eccentricity_and_diameter(void)
+{
+    cypher_executor_free(executor);
+    sqlite3_close(test_db);
+    sqlite3_open(":memory:", &test_db);
+    executor = cypher_executor_create(test_db);
+
+    /* Chain a -> b -> c -> d, and a separate pair */
+    exec_cypher("CREATE (a:Node {id: 'a'})-[:LINK]->(b:Node {id: 'b'})-[:LINK]->(c:Node {id: 'c'})-[:LINK]->(d:Node {id: 'd'})");
+    exec_cypher("CREATE (:Node {id: 'x'})-[:LINK]->(:Node {id: 'y'})");
+
+    char *json = exec_get_json("RETURN eccentricity()");
+    CU_ASSERT_PTR_NOT_NULL(json);
+    if (json) {
+        CU_ASSERT_PTR_NOT_NULL(strstr(json, "\"user_id\":\"a\",\"eccentricity\":3"));
+        CU_ASSERT_PTR_NOT_NULL(strstr(json, "\"user_id\":\"b\",\"eccentricity\":2"));
+        CU_ASSERT_PTR_NOT_NULL(strstr(json, "\"user_id\":\"y\",\"eccentricity\":1"));
+        free(json);
+    }
+
+    json = exec_get_json("RETURN diameter()");
+    CU_ASSERT_PTR_NOT_NULL(json);
+    if (json) {
+        CU_ASSERT_STRING_EQUAL(json, "{\"diameter\":3,\"exact\":true,\"sources\":6}");
+        free(json);
+    }
+
+    /* One sample of the chain, then a double sweep from its farthest node */
+    json = exec_get_json("RETURN diameter({samples: 1, seed: 1})");
+    CU_ASSERT_PTR_NOT_NULL(json);
+    if (json) {
+        CU_ASSERT_PTR_NOT_NULL(strstr(json, "\"exact\":false"));
+        free(json);
+    }
+}
+
+/* Run an algorithm on two graphs and check both give the same JSON */
+#define ASSERT_SAME_RESULT(call_plain, call_compressed) do { \
+        graph_algo_result *r1 = (call_plain); \
+        graph_algo_result *r2 = (call_compressed); \
+        CU_ASSERT_TRUE(r1 && r2 && r1->success && r2->success); \
+        if (r1 && r2 && r1->json_result && r2->json_result) { \
+            CU_ASSERT_STRING_EQUAL(r1->json_result, r2->json_result); \
+        } \
+        graph_algo_result_free(r1); \
+        graph_algo_result_free(r2); \
+    } while (0)
+
+/* Test the multi-source BFS against one plain BFS per node, across several batches */
+static void test_multi_source_bfs(void)
+{
+    sqlite3 *db = NULL;
+    CU_ASSERT_EQUAL(sqlite3_open(":memory:", &db), SQLITE_OK);
+    if (!db) return;
+
+    cypher_schema_manager *schema_mgr = cypher_schema_create_manager(db);
+    if (schema_mgr) {
+        cypher_schema_initialize(schema_mgr);
+        cypher_schema_free_manager(schema_mgr);
+    }
+
+    /* 700 nodes (three batches): a long path with chords, a small cycle and isolated nodes */
+    int rc = sqlite3_exec(db,
+        "WITH RECURSIVE cnt(x) AS (VALUES(1) UNION ALL SELECT x+1 FROM cnt WHERE x < 700) "
+        "INSERT INTO nodes (id) SELECT x FROM cnt;"
+        "INSERT INTO edges (source_id, target_id, type) SELECT id, id + 1, 'A' FROM nodes WHERE id < 600;"
+        "INSERT INTO edges (source_id, target_id, type) SELECT id + 40, id, 'B' FROM nodes WHERE id % 97 = 0 AND id < 560;"
+        "INSERT INTO edges (source_id, target_id, type) SELECT id, id % 10 + 601, 'A' FROM nodes WHERE id BETWEEN 601 AND 610;",
+        NULL, NULL, NULL);
+    CU_ASSERT_EQUAL(rc, SQLITE_OK);
+
+    csr_graph *graph = csr_graph_load(db);
+    CU_ASSERT_PTR_NOT_NULL(graph);
+    if (!graph) {
+        sqlite3_close(db);
+        return;
+    }
+
+    /* Reference eccentricities, following edges both ways */
+    int n = graph->node_count;
+    int *expected = calloc(n, sizeof(int));
+    int *dist = malloc(n * sizeof(int));
+    int *queue = malloc(n * sizeof(int));
+    int diameter = 0;
+    for (int s = 0; expected && dist && queue && s < n; s++) {
+        for (int i = 0; i < n; i++) dist[i] = -1;
+        int front = 0, back = 0;
+        dist[s] = 0;
+        queue[back++] = s;
+        while (front < back) {
+            int u = queue[front++];
+            for (int64_t j = graph->row_ptr[u]; j < graph->row_ptr[u + 1]; j++) {
+                if (dist[graph->col_idx[j]] < 0) {
+                    dist[graph->col_idx[j]] = dist[u] + 1;
+                    queue[back++] = graph->col_idx[j];
+                }
+            }
+            for (int64_t j = graph->in_row_ptr[u]; j < graph->in_row_ptr[u + 1]; j++) {
+                if (dist[graph->in_col_idx[j]] < 0) {
+                    dist[graph->in_col_idx[j]] = dist[u] + 1;
+                    queue[back++] = graph->in_col_idx[j];
+                }
+            }
+        }
+        expected[s] = dist[queue[back - 1]];
+        if (expected[s] > diameter) diameter = expected[s];
+    }
+
+    graph_algo_result *ecc = execute_eccentricity(db, graph);
+    CU_ASSERT_TRUE(ecc && ecc->success);
+    if (ecc && ecc->json_result && expected) {
+        const char *p = ecc->json_result;
+        int i = 0;
+        while ((p = strstr(p, "\"eccentricity\":")) != NULL && i < n) {
+            p += strlen("\"eccentricity\":");
+            CU_ASSERT_EQUAL(atoi(p), expected[i]);
+            i++;
+        }
+        CU_ASSERT_EQUAL(i, n);
+    }
+    graph_algo_result_free(ecc);
+
+    graph_algo_result *diam = execute_diameter(db, graph, 0, 0);
+    CU_ASSERT_TRUE(diam && diam->success);
+    if (diam && diam->json_result) {
+        char want[128];
+        snprintf(want, sizeof(want), "{\"diameter\":%d,\"exact\":true,\"sources\":%d}", diameter, n);
+        CU_ASSERT_STRING_EQUAL(diam->json_result, want);
+    }
+    graph_algo_result_free(diam);
+
+    /* A sampled diameter is a lower bound; the double sweep finds the path's length here */
+    diam = execute_diameter(db, graph, 5, 3);
+    CU_ASSERT_TRUE(diam && diam->success);
+    if (diam && diam->json_result) {
+        int estimate = -1;
+        sscanf(diam->json_result, "{\"diameter\":%d", &estimate);
+        CU_ASSERT_TRUE(estimate > 0 && estimate <= diameter);
+    }
+    graph_algo_result_free(diam);
+
+    /* Level counts are whole numbers: identical on any thread count */
+    graph_set_thread_count(1);
+    graph_algo_result *one = execute_harmonic_centrality(db, graph);
+    graph_set_thread_count(4);
+    graph_algo_result *four = execute_harmonic_centrality(db, graph);
+    graph_set_thread_count(0);
+    ASSERT_SAME_RESULT(one, four);
+
+    free(expected);
+    free(dist);
+    free(queue);
+    csr_graph_free(graph);
+    sqlite3_close(db);
+}
+
 /* =============================================================================
  * Test Suite Registration
  * =============================================================================
@@ -219,6 +414,9 @@ int init_executor_closeness_suite(void)
     if (!CU_add_test(suite, "Star graph", test_closeness_star)) return CU_get_error();
     if (!CU_add_test(suite, "Disconnected graph", test_closeness_disconnected)) return CU_get_error();
     if (!CU_add_test(suite, "Alias closeness()", test_closeness_alias)) return CU_get_error();
+    if (!CU_add_test(suite, "Harmonic centrality", test_harmonic_chain)) return CU_get_error();
+    if (!CU_add_test(suite, "Eccentricity and diameter", test_eccentricity_and_diameter)) return CU_get_error();
+    if (!CU_add_test(suite, "Multi-source BFS", test_multi_source_bfs)) return CU_get_error();
 
     return CUE_SUCCESS;
 }
@@ -323,6 +323,141 @@ static double extract_score_for_node(const char *json, int target_node_id)
     return -1.0;  /* Not found */
 }
 
+/* pageRank() result JSON of a query (NULL on failure), caller frees */
+static char* pagerank_json(const char *query)
+{
+    cypher_result *result = cypher_executor_execute(shared_executor, query);
+    char *json = result_has_pagerank_data(result) ? strdup(result->data[0][0]) : NULL;
+    if (result) cypher_result_free(result);
+    return json;
+}
+
+/* Iterations run, as reported by pageRank(..., {reportIterations: true}) (-1 if absent) */
+static int extract_iterations(const char *json)
+{
+    int iterations = -1;
+    const char *p = json ? strstr(json, "\"iterations\":") : NULL;
+    if (p) sscanf(p, "\"iterations\":%d", &iterations);
+    return iterations;
+}
+
+/* Test pageRank stops once the ranks change less than the tolerance */
+static void test_pagerank_tolerance(void)
+{
+    CU_ASSERT_PTR_NOT_NULL(shared_executor);
+
+    /* Rows carry no iteration count unless asked for */
+    char *zero = pagerank_json("RETURN pageRank(0.85, 7, {tolerance: 0})");
+    CU_ASSERT_PTR_NOT_NULL(zero);
+    if (zero) CU_ASSERT_PTR_NULL(strstr(zero, "iterations"));
+
+    /* A tight tolerance converges before either limit, so the limit does not matter */
+    char *tight = pagerank_json("RETURN pageRank(0.85, 100, {tolerance: 0.0000001})");
+    char *tight_long = pagerank_json("RETURN pageRank(0.85, 1000, {tolerance: 0.0000001})");
+    CU_ASSERT_PTR_NOT_NULL(tight);
+    CU_ASSERT_PTR_NOT_NULL(tight_long);
+    if (tight && tight_long) CU_ASSERT_STRING_EQUAL(tight, tight_long);
+
+    /* A loose tolerance stops earlier, close to the converged ranks */
+    char *loose = pagerank_json("RETURN pageRank(0.85, 100, {tolerance: 0.01})");
+    CU_ASSERT_PTR_NOT_NULL(loose);
+    if (loose && tight) {
+        CU_ASSERT_STRING_NOT_EQUAL(loose, tight);
+        CU_ASSERT_DOUBLE_EQUAL(extract_score_for_node(loose, 3), extract_score_for_node(tight, 3), 0.01);
+    }
+
+    /* Tolerance 0 runs every iteration: 7 are not yet converged */
+    if (zero && tight) CU_ASSERT_STRING_NOT_EQUAL(zero, tight);
+
+    /* reportIterations adds the count run: all of them at tolerance 0, fewer the looser it is */
+    char *zero_n = pagerank_json("RETURN pageRank(0.85, 7, {tolerance: 0, reportIterations: true})");
+    char *loose_n = pagerank_json("RETURN pageRank(0.85, 100, {tolerance: 0.01, reportIterations: true})");
+    char *tight_n = pagerank_json("RETURN pageRank(0.85, 100, {tolerance: 0.0000001, reportIterations: true})");
+    CU_ASSERT_EQUAL(extract_iterations(zero_n), 7);
+    CU_ASSERT_TRUE(extract_iterations(loose_n) > 1);
+    CU_ASSERT_TRUE(extract_iterations(loose_n) < extract_iterations(tight_n));
+    CU_ASSERT_TRUE(extract_iterations(tight_n) < 100);
+    if (loose_n && loose) CU_ASSERT_DOUBLE_EQUAL(extract_score_for_node(loose_n, 3), extract_score_for_node(loose, 3), 1e-12);
+
+    free(zero);
+    free(tight);
+    free(tight_long);
+    free(loose);
+    free(zero_n);
+    free(loose_n);
+    free(tight_n);
+}
+
+/* Test push-based personalizedPageRank against the SQL power iteration */
+static void test_personalized_pagerank_push(void)
+{
+    CU_ASSERT_PTR_NOT_NULL(shared_executor);
+
+    /* An integer third argument (iterations) keeps the SQL form */
+    cypher_result *push = cypher_executor_execute(shared_executor,
+        "RETURN personalizedPageRank(\"[1,4]\", 0.85, 0.0000001, 0)");
+    cypher_result *sql = cypher_executor_execute(shared_executor,
+        "RETURN personalizedPageRank(\"[1,4]\", 0.85, 100)");
+    CU_ASSERT_TRUE(result_has_pagerank_data(push));
+    CU_ASSERT_TRUE(result_has_pagerank_data(sql));
+    if (result_has_pagerank_data(push) && result_has_pagerank_data(sql)) {
+        for (int node = 1; node <= 4; node++) {
+            double expected = extract_score_for_node(sql->data[0][0], node);
+            CU_ASSERT_TRUE(expected > 0.0);
+            CU_ASSERT_DOUBLE_EQUAL(extract_score_for_node(push->data[0][0], node), expected, 0.0001);
+        }
+    }
+    if (push) cypher_result_free(push);
+    if (sql) cypher_result_free(sql);
+
+    /* Without epsilon or options the SQL form runs: every node, named column */
+    cypher_result *legacy = cypher_executor_execute(shared_executor,
+        "RETURN personalizedPageRank(\"[3]\")");
+    CU_ASSERT_TRUE(result_has_pagerank_data(legacy));
+    if (result_has_pagerank_data(legacy)) {
+        CU_ASSERT_TRUE(extract_score_for_node(legacy->data[0][0], 4) >= 0.0);
+        CU_ASSERT_PTR_NOT_NULL(legacy->column_names);
+        if (legacy->column_names && legacy->column_names[0]) {
+            CU_ASSERT_STRING_NOT_EQUAL(legacy->column_names[0], "column_0");
+        }
+    }
+    if (legacy) cypher_result_free(legacy);
+
+    /* Only nodes reachable from the seeds are scored: D has no in-edges */
+    cypher_result *result = cypher_executor_execute(shared_executor,
+        "RETURN personalizedPageRank([3], {epsilon: 0.000001})");
+    CU_ASSERT_TRUE(result_has_pagerank_data(result));
+    if (result_has_pagerank_data(result)) {
+        CU_ASSERT_TRUE(extract_score_for_node(result->data[0][0], 3) > 0.0);
+        CU_ASSERT_EQUAL(extract_score_for_node(result->data[0][0], 4), -1.0);
+    }
+    if (result) cypher_result_free(result);
+
+    /* Top k */
+    result = cypher_executor_execute(shared_executor,
+        "RETURN personalizedPageRank([3], 0.85, 0.0000001, 2)");
+    CU_ASSERT_TRUE(result_has_pagerank_data(result));
+    if (result_has_pagerank_data(result)) {
+        int count = 0;
+        for (const char *p = result->data[0][0]; (p = strstr(p, "node_id")) != NULL; p++) {
+            count++;
+        }
+        CU_ASSERT_EQUAL(count, 2);
+    }
+    if (result) cypher_result_free(result);
+
+    /* Seeds not in the graph */
+    result = cypher_executor_execute(shared_executor, "RETURN personalizedPageRank([99], 0.85, 0.000001)");
+    CU_ASSERT_PTR_NOT_NULL(result);
+    if (result) {
+        CU_ASSERT_TRUE(result->success);
+        if (result->success && result->row_count > 0) {
+            CU_ASSERT_STRING_EQUAL(result->data[0][0], "[]");
+        }
+        cypher_result_free(result);
+    }
+}
+
 /* Test pageRank correctness - verify scores and ranking */
 static void test_pagerank_correctness(void)
 {
@@ -420,10 +555,12 @@ int init_executor_pagerank_suite(void)
     if (!CU_add_test(suite, "PageRank basic", test_pagerank_basic) ||
         !CU_add_test(suite, "PageRank custom damping", test_pagerank_custom_damping) ||
         !CU_add_test(suite, "PageRank custom iterations", test_pagerank_custom_iterations) ||
+        !CU_add_test(suite, "PageRank tolerance", test_pagerank_tolerance) ||
         !CU_add_test(suite, "topPageRank(k)", test_top_pagerank) ||
         !CU_add_test(suite, "personalizedPageRank single seed", test_personalized_pagerank_single_seed) ||
         !CU_add_test(suite, "personalizedPageRank multiple seeds", test_personalized_pagerank_multiple_seeds) ||
         !CU_add_test(suite, "personalizedPageRank custom params", test_personalized_pagerank_custom_params) ||
+        !CU_add_test(suite, "personalizedPageRank push", test_personalized_pagerank_push) ||
         !CU_add_test(suite, "PageRank empty graph", test_pagerank_empty_graph) ||
         !CU_add_test(suite, "PageRank ranking order", test_pagerank_ranking_order) ||
         !CU_add_test(suite, "PageRank correctness", test_pagerank_correctness)) {
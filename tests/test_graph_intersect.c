@@ -0,0 +1,99 @@
+/*
+ * test_graph_intersect.c
+ *
+ * Unit tests for the sorted set intersection kernels
+ */
+
+#include <CUnit/CUnit.h>
+#include <CUnit/Basic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "executor/graph_algorithms.h"
+
+/* Sorted, distinct values drawn from [0, universe) */
+static int* random_set(int size, int universe)
+{
+    int *values = malloc((size > 0 ? (size_t)size : 1) * sizeof(int));
+    bool *taken = calloc((size_t)universe, sizeof(bool));
+    if (!values || !taken) {
+        free(values);
+        free(taken);
+        return NULL;
+    }
+    for (int i = 0; i < size; ) {
+        int v = rand() % universe;
+        if (!taken[v]) {
+            taken[v] = true;
+            i++;
+        }
+    }
+    int count = 0;
+    for (int v = 0; v < universe; v++) {
+        if (taken[v]) values[count++] = v;
+    }
+    free(taken);
+    return values;
+}
+
+/* Test every intersection kernel counts the same common elements */
+static void test_set_intersection(void)
+{
+    static const int sizes[][2] = {
+        {0, 5}, {1, 1}, {3, 4}, {7, 9}, {8, 8}, {16, 17}, {33, 100},
+        {100, 33}, {250, 260}, {5, 5000}, {4000, 3}, {1000, 1000}
+    };
+    graph_simd_level support = graph_simd_support();
+    srand(17);
+
+    for (size_t t = 0; t < sizeof(sizes) / sizeof(sizes[0]); t++) {
+        int na = sizes[t][0];
+        int nb = sizes[t][1];
+        int universe = 2 * (na + nb) + 1;
+        int *a = random_set(na, universe);
+        int *b = random_set(nb, universe);
+        CU_ASSERT_PTR_NOT_NULL(a);
+        CU_ASSERT_PTR_NOT_NULL(b);
+        if (!a || !b) {
+            free(a);
+            free(b);
+            return;
+        }
+
+        int64_t expected = 0;
+        for (int i = 0; i < na; i++) {
+            for (int j = 0; j < nb; j++) {
+                if (a[i] == b[j]) expected++;
+            }
+        }
+
+        CU_ASSERT_EQUAL(graph_intersect_merge(a, na, b, nb), expected);
+        CU_ASSERT_EQUAL(graph_intersect_gallop(a, na, b, nb), expected);
+        CU_ASSERT_EQUAL(graph_intersect_count(a, na, b, nb), expected);
+        for (int level = GRAPH_SIMD_NONE; level <= (int)support; level++) {
+            CU_ASSERT_EQUAL(graph_intersect_simd(a, na, b, nb, (graph_simd_level)level), expected);
+        }
+
+        /* Identical sets share every element */
+        CU_ASSERT_EQUAL(graph_intersect_count(a, na, a, na), na);
+        CU_ASSERT_EQUAL(graph_intersect_simd(b, nb, b, nb, support), nb);
+
+        free(a);
+        free(b);
+    }
+}
+
+/* =============================================================================
+ * Test Suite Registration
+ * =============================================================================
+ */
+
+/* Initialize function for test runner */
+int init_graph_intersect_suite(void)
+{
+    CU_pSuite suite = CU_add_suite("Set Intersection", NULL, NULL);
+    if (!suite) return CU_get_error();
+
+    if (!CU_add_test(suite, "Every kernel agrees", test_set_intersection)) return CU_get_error();
+
+    return CUE_SUCCESS;
+}
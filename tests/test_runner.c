@@ -51,6 +51,7 @@ int init_sql_builder_suite(void);
 int init_query_dispatch_suite(void);
 int init_executor_multigraph_suite(void);
 int init_cache_suite(void);
+int init_graph_intersect_suite(void);
 
 int main(void)
 {
@@ -337,6 +338,12 @@ int main(void)
         return CU_get_error();
     }
 
+    if (init_graph_intersect_suite() != CUE_SUCCESS) {
+        fprintf(stderr, "Failed to add set intersection suite\n");
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
     /* Run tests */
     CU_basic_set_mode(CU_BRM_VERBOSE);
     CU_basic_run_tests();